@@ -45,6 +45,7 @@ PadApp_ParseOpts(PadApp *self) {
         {"help", no_argument, 0, 'h'},
         {"version", no_argument, 0, 'V'},
         {"debug", no_argument, 0, 'd'},
+        {"recursion-limit", required_argument, 0, 'r'},
         {0},
     };
 
@@ -56,7 +57,7 @@ PadApp_ParseOpts(PadApp *self) {
     // parse options
     for (;;) {
         int optsindex;
-        int cur = getopt_long(self->argc, self->argv, "hVd", longopts, &optsindex);
+        int cur = getopt_long(self->argc, self->argv, "hVdr:", longopts, &optsindex);
         if (cur == -1) {
             break;
         }
@@ -65,6 +66,15 @@ PadApp_ParseOpts(PadApp *self) {
         case 'h': self->opts.is_help = true; break;
         case 'V': self->opts.is_version = true; break;
         case 'd': self->opts.is_debug = true; break;
+        case 'r': {
+            char *end = NULL;
+            long limit = strtol(optarg, &end, 10);
+            if (*end != '\0' || limit <= 0 || limit > INT32_MAX) {
+                Pad_PushErr("invalid recursion limit \"%s\"", optarg);
+                return false;
+            }
+            self->config->recursion_limit = limit;
+        } break;
         case '?':
         default:
             Pad_PushErr("invalid option");
@@ -175,11 +185,12 @@ PadApp_Usage(PadApp *app) {
         "    -h, --help       show usage\n"
         "    -V, --version    show version\n"
         "    -d, --debug      debug mode\n"
+        "    -r, --recursion-limit=<number>\n"
+        "                     max depth of function calls (default %d)\n"
+        "                     the depth is also capped by native stack\n"
         "\n"
     ;
-    fprintf(stderr,
-        "%s"
-    , usage);
+    fprintf(stderr, usage, PAD_CONFIG__RECURSION_LIMIT);
 }
 
 /**
@@ -251,6 +262,8 @@ _PadApp_Run(PadApp *self) {
     PadKit *kit = PadKit_New(self->config);
     PadCtx *ctx = PadKit_GetCtx(kit);
     PadCtx_SetUseBuf(ctx, false);  // no use stdout/stderr buffer
+    PadSink *sink = PadSink_NewFile(stdout);  // stream outputs to stdout
+    PadCtx_SetStdoutSink(ctx, sink);
 
     if (!PadKit_CompileFromStr(kit, content)) {
         PadApp_TraceKit(self, kit, stderr);
@@ -262,6 +275,7 @@ _PadApp_Run(PadApp *self) {
     fflush(stderr);
 
     PadKit_Del(kit);
+    PadSink_Del(sink);
     free(content);
     return 0;
 }
@@ -283,6 +297,8 @@ PadApp_RunArgs(PadApp *self) {
 
     PadKit *kit = PadKit_New(self->config);
     PadKit_SetUseBuf(kit, false);  // no use stdout/stderr buffer
+    PadSink *sink = PadSink_NewFile(stdout);  // stream outputs to stdout
+    PadKit_SetStdoutSink(kit, sink);
     
     if (!PadKit_CompileFromPathArgs(kit, path, argc, argv)) {
         PadApp_TraceKit(self, kit, stderr);
@@ -294,6 +310,7 @@ PadApp_RunArgs(PadApp *self) {
     fflush(stderr);
 
     PadKit_Del(kit);
+    PadSink_Del(sink);
     return 0;
 }
 
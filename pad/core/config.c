@@ -23,6 +23,7 @@ Pad_PopTailSlash(char *path);
 PadConfig *
 PadConfig_Init(PadConfig *self) {
     strcpy(self->line_encoding, "lf");
+    self->recursion_limit = PAD_CONFIG__RECURSION_LIMIT;
 
     // standard libraries
     if (!PadFile_Solve(self->std_lib_dir_path, sizeof self->std_lib_dir_path, "~/.pad/stdlib")) {
@@ -5,9 +5,17 @@
 #include <pad/lib/path.h>
 #include <pad/core/constant.h>
 
+enum {
+    // default of max depth of function calls
+    // this is below the depth that fills 8MB native stack on debug build.
+    // a larger limit is capped by the guard of native stack
+    PAD_CONFIG__RECURSION_LIMIT = 500,
+};
+
 typedef struct PadConfig {
     char line_encoding[32+1];  // line encoding "cr" | "crlf" | "lf"
     char std_lib_dir_path[PAD_FILE__NPATH];  // standard libraries directory path
+    int32_t recursion_limit;  // max depth of function calls. if 0 then use default
 } PadConfig;
 
 /**
@@ -87,9 +87,6 @@ struct PadTrvArgs {
     // a index value object
     PadIndexValue index_value;
 
-    // a callback function
-    PadObj * (*callback)(PadAST *ast, struct PadTrvArgs *targs);
-
     // if do not refer chain object on context then store true else store false
     // this flag refer in trv_chain function
     bool do_not_refer_ring;
@@ -105,6 +105,9 @@ PadAST_DelNodes(const PadAST *self, PadNode *node) {
         PadAST_DelNodes(self, for_stmt->init_formula);
         PadAST_DelNodes(self, for_stmt->comp_formula);
         PadAST_DelNodes(self, for_stmt->update_formula);
+        PadAST_DelNodes(self, for_stmt->iter_key);
+        PadAST_DelNodes(self, for_stmt->iter_value);
+        PadAST_DelNodes(self, for_stmt->iter_formula);
         PadNodeAry_Del(for_stmt->contents);
     } break;
     case PAD_NODE_TYPE__BREAK_STMT: {
@@ -251,7 +251,7 @@ builtin_len(PadBltFuncArgs *fargs) {
     }
 
     PadObj *arg = PadObjAry_Get(args, 0);
-    int32_t len = 0;
+    PadIntObj len = 0;
 
 again:
     switch (arg->type) {
@@ -277,6 +277,21 @@ again:
     case PAD_OBJ_TYPE__DICT:
         len = PadObjDict_Len(arg->objdict);
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        len = arg->builder.length;
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        len = PadObj_GetRangeLen(arg);
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        len = PadObjDeq_Len(arg->objdeq);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        len = PadNumAry_Len(arg->numarr);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        len = PadObj_GetDictViewLen(arg);
+        break;
     }
 
     return PadObj_NewInt(ref_ast->ref_gc, len);
@@ -290,6 +305,7 @@ builtin_die(PadBltFuncArgs *fargs) {
     PadObj *result = builtin_eputs(fargs);
     PadObj_Del(result);
 
+    PadCtx_FlushSinks(PadCtx_FindMostPrev(ref_ast->ref_context));
     fflush(stdout);
     fprintf(stderr, "%s", PadCtx_GetcStderrBuf(ref_ast->ref_context));
     fflush(stderr);
@@ -318,6 +334,8 @@ builtin_exit(PadBltFuncArgs *fargs) {
         return NULL;
     }
 
+    PadCtx_FlushSinks(PadCtx_FindMostPrev(ref_ast->ref_context));
+
     printf("%s", PadCtx_GetcStderrBuf(ref_ast->ref_context));
     fflush(stderr);
 
@@ -809,6 +827,86 @@ builtin_open(PadBltFuncArgs *fargs) {
     return PadObj_NewFile(ref_gc, PadMem_Move(fp));
 }
 
+static PadObj *
+builtin_builder(PadBltFuncArgs *fargs) {
+    PadAST *ref_ast = fargs->ref_ast;
+    assert(ref_ast);
+    PadObj *actual_args = fargs->ref_args;
+    assert(actual_args);
+    PadObjAry *args = actual_args->objarr;
+    assert(args);
+
+    PadObj *builder = PadObj_NewBuilder(ref_ast->ref_gc);
+    if (!builder) {
+        push_err("failed to create builder");
+        return NULL;
+    }
+
+    // initial strings
+    for (int32_t i = 0; i < PadObjAry_Len(args); i++) {
+        PadObj *s = PadObjAry_Get(args, i);
+        if (s->type != PAD_OBJ_TYPE__UNICODE) {
+            push_err("invalid argument type (%d)", s->type);
+            PadObj_Del(builder);
+            return NULL;
+        }
+        PadObj_AppBuilder(builder, s->unicode);
+    }
+
+    return builder;
+}
+
+/**
+ * range(stop), range(start, stop) or range(start, stop, step)
+ * values of range are not materialized
+ */
+static PadObj *
+builtin_range(PadBltFuncArgs *fargs) {
+    PadAST *ref_ast = fargs->ref_ast;
+    assert(ref_ast);
+    PadObj *actual_args = fargs->ref_args;
+    assert(actual_args);
+    PadObjAry *args = actual_args->objarr;
+    assert(args);
+
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < 1 || nargs > 3) {
+        push_err("range function need one to three arguments");
+        return NULL;
+    }
+
+    PadIntObj vals[3];
+    for (int32_t i = 0; i < nargs; i++) {
+        const PadObj *arg = PadObjAry_Getc(args, i);
+        if (arg->type != PAD_OBJ_TYPE__INT) {
+            push_err("range argument is not integer");
+            return NULL;
+        }
+        vals[i] = arg->lvalue;
+    }
+
+    PadIntObj start = 0, stop, step = 1;
+    if (nargs == 1) {
+        stop = vals[0];
+    } else {
+        start = vals[0];
+        stop = vals[1];
+        if (nargs == 3) {
+            step = vals[2];
+        }
+    }
+    if (!step) {
+        push_err("range step is zero");
+        return NULL;
+    }
+    if (PadObj_CalcRangeLen(start, stop, step) < 0) {
+        push_err("range is too long");
+        return NULL;
+    }
+
+    return PadObj_NewRange(ref_ast->ref_gc, start, stop, step);
+}
+
 static PadObj *
 builtin_dump(PadBltFuncArgs *fargs) {
     PadObj *actual_args = fargs->ref_args;
@@ -819,10 +917,66 @@ builtin_dump(PadBltFuncArgs *fargs) {
         return NULL;
     }    
     
+    PadAST *ref_ast = fargs->ref_ast;
     PadObj *obj = PadObjAry_Get(args, 0);
-    PadObj_Dump(obj, stderr);
+    PadCtx *context = PadCtx_FindMostPrev(ref_ast->ref_context);
+
+    if (context->ref_stderr_sink) {
+        // serialize to sink directly without temporary strings
+        if (!PadSer_ObjToSink(context->ref_stderr_sink, obj)) {
+            push_err("failed to serialize object");
+            return NULL;
+        }
+        PadSink_Write(context->ref_stderr_sink, "\n", 1);
+    } else {
+        PadStr *s = PadStr_New();
+        if (!s || !PadSer_ObjToStr(s, obj)) {
+            PadStr_Del(s);
+            push_err("failed to serialize object");
+            return NULL;
+        }
+        PadStr_PushBack(s, '\n');
+        PadCtx_PushBackStderrBuf(context, PadStr_Getc(s));
+        PadStr_Del(s);
+    }
 
-    return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    return PadObj_NewNil(ref_ast->ref_gc);
+}
+
+static PadObj *
+builtin_escape_html(PadBltFuncArgs *fargs) {
+    PadAST *ref_ast = fargs->ref_ast;
+    PadGC *ref_gc = ref_ast->ref_gc;
+    PadObj *actual_args = fargs->ref_args;
+    PadObjAry *args = actual_args->objarr;
+
+    if (PadObjAry_Len(args) != 1) {
+        push_err("need one argument");
+        return NULL;
+    }
+
+    const PadObj *u = PadObjAry_Getc(args, 0);
+    if (u->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("invalid argument type");
+        return NULL;
+    }
+
+    const char *mb = PadUni_GetcMB(u->unicode);
+    int32_t len = strlen(mb);
+    if (!PadHtml_NeedEscape(mb, len)) {
+        return PadObj_NewUnicodeCStr(ref_gc, mb);
+    }
+
+    PadStr *s = PadStr_New();
+    if (!s || !PadHtml_EscapeApp(s, mb, len)) {
+        PadStr_Del(s);
+        push_err("failed to escape");
+        return NULL;
+    }
+
+    PadObj *ret = PadObj_NewUnicodeCStr(ref_gc, PadStr_Getc(s));
+    PadStr_Del(s);
+    return ret;
 }
 
 static PadBltFuncInfo
@@ -843,7 +997,10 @@ builtin_func_infos[] = {
     {"dance", builtin_dance},
     {"ord", builtin_ord},
     {"chr", builtin_chr},
+    {"escape_html", builtin_escape_html},
     {"open", builtin_open},
+    {"builder", builtin_builder},
+    {"range", builtin_range},
     {"dump", builtin_dump},
     {0},
 };
@@ -5,6 +5,7 @@
 #include <pad/lang/object.h>
 #include <pad/lang/ast.h>
 #include <pad/lang/utils.h>
+#include <pad/lang/serializer.h>
 #include <pad/lang/gc.h>
 #include <pad/lang/arguments.h>
 #include <pad/lang/tokenizer.h>
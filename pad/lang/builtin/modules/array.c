@@ -1,9 +1,11 @@
 #include <pad/lang/builtin/modules/array.h>
 
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
 static PadObj *
 builtin_array_push(PadBltFuncArgs *fargs) {
-    PadAST *ref_ast = fargs->ref_ast;
-    assert(ref_ast);
+    assert(fargs->ref_ast);
     PadObj *actual_args = fargs->ref_args;
     assert(actual_args);
     assert(actual_args->type == PAD_OBJ_TYPE__ARRAY);
@@ -11,26 +13,26 @@ builtin_array_push(PadBltFuncArgs *fargs) {
 
     PadObjAry *args = actual_args->objarr;
     if (PadObjAry_Len(args) != 1) {
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "can't invoke array.push. need one argument");
+        push_err("can't invoke array.push. need one argument");
         return NULL;
     }
 
     if (!ref_owners) {
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "owners is null. can't push");
+        push_err("owners is null. can't push");
         return NULL;
     }
 
     int32_t nowns = PadObjAry_Len(ref_owners);
     PadObj *ref_owner = PadObjAry_Get(ref_owners, nowns-1);
     if (!ref_owner) {
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "owner is null. can't push");
+        push_err("owner is null. can't push");
         return NULL;
     }
 
 again:
     switch (ref_owner->type) {
     default:
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "unsupported object type (%d). can't push", ref_owner->type);
+        push_err("unsupported object type (%d). can't push", ref_owner->type);
         return NULL;
         break;
     case PAD_OBJ_TYPE__OWNERS_METHOD:
@@ -40,7 +42,7 @@ again:
     case PAD_OBJ_TYPE__IDENT:
         ref_owner = Pad_PullRef(ref_owner);
         if (!ref_owner) {
-            PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "object is not found. can't push");
+            push_err("object is not found. can't push");
             return NULL;
         }
         goto again;
@@ -63,7 +65,7 @@ again2:
         const char *idn = PadObj_GetcIdentName(arg);
         arg = Pad_PullRef(arg);
         if (!arg) {
-            PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "\"%s\" is not defined", idn);
+            push_err("\"%s\" is not defined", idn);
             return NULL;
         }
         push_arg = arg;
@@ -73,7 +75,7 @@ again2:
 
     PadObjAry_MoveBack(ref_owner->objarr, push_arg);
 
-    return PadObj_DeepCopy(ref_owner);
+    return ref_owner;
 }
 
 static PadObj *
@@ -86,21 +88,21 @@ builtin_array_pop(PadBltFuncArgs *fargs) {
     PadObjAry *ref_owners = fargs->ref_owners;
 
     if (!ref_owners) {
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "owners inull. can't pop");
+        push_err("owners inull. can't pop");
         return NULL;
     }
 
     int32_t nowns = PadObjAry_Len(ref_owners);
     PadObj *ref_owner = PadObjAry_Get(ref_owners, nowns-1);
     if (!ref_owner) {
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "owner is null. can't pop");
+        push_err("owner is null. can't pop");
         return NULL;
     }
 
 again:
     switch (ref_owner->type) {
     default:
-        PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "unsupported object type (%d). can't pop", ref_owner->type);
+        push_err("unsupported object type (%d). can't pop", ref_owner->type);
         return NULL;
         break;
     case PAD_OBJ_TYPE__OWNERS_METHOD:
@@ -110,7 +112,7 @@ again:
     case PAD_OBJ_TYPE__IDENT:
         ref_owner = Pad_PullRef(ref_owner);
         if (!ref_owner) {
-            PadAST_PushBackErr(ref_ast, NULL, 0, NULL, 0, "object is not found. can't pop");
+            push_err("object is not found. can't pop");
             return NULL;
         }
         goto again;
@@ -126,10 +128,655 @@ again:
     return ret;
 }
 
+/**
+ * pull array object of owner of method
+ *
+ * @return success to pointer to array object
+ * @return failed to NULL
+ */
+static PadObj *
+pull_last_array(PadObjAry *ref_owners) {
+    if (!ref_owners) {
+        return NULL;
+    }
+
+    PadObj *ref_owner = PadObjAry_GetLast(ref_owners);
+    if (!ref_owner) {
+        return NULL;
+    }
+
+again:
+    switch (ref_owner->type) {
+    default:
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__OWNERS_METHOD:
+        ref_owner = ref_owner->owners_method.owner;
+        goto again;
+        break;
+    case PAD_OBJ_TYPE__IDENT:
+        ref_owner = Pad_PullRefAll(ref_owner);
+        if (!ref_owner) {
+            return NULL;
+        }
+        goto again;
+        break;
+    case PAD_OBJ_TYPE__ARRAY:
+        return ref_owner;
+        break;
+    }
+}
+
+/**
+ * pull reference of argument if it is identifier
+ */
+static PadObj *
+pull_arg(PadObj *arg) {
+    while (arg && arg->type == PAD_OBJ_TYPE__IDENT) {
+        arg = Pad_PullRefAll(arg);
+    }
+    return arg;
+}
+
+/*******
+* sort *
+*******/
+
+/**
+ * item of sort. the key is extracted from element (or result of key
+ * function) before sort. the index of element breaks ties so the sort
+ * is stable
+ */
+typedef struct {
+    union {
+        PadIntObj i;
+        double f;
+        const PadUniType *u;
+    } key;
+    int32_t index;
+} sort_item_t;
+
+typedef int (*sort_cmp_t)(const sort_item_t *a, const sort_item_t *b);
+
+enum {
+    SORT_INSERTION_MAX = 16,
+};
+
+static int
+cmp_int(const sort_item_t *a, const sort_item_t *b) {
+    if (a->key.i != b->key.i) {
+        return a->key.i < b->key.i ? -1 : 1;
+    }
+    return a->index - b->index;
+}
+
+static int
+cmp_float(const sort_item_t *a, const sort_item_t *b) {
+    // nan is greater than other numbers for total order
+    bool anan = isnan(a->key.f);
+    bool bnan = isnan(b->key.f);
+    if (anan != bnan) {
+        return anan ? 1 : -1;
+    }
+    if (!anan && a->key.f != b->key.f) {
+        return a->key.f < b->key.f ? -1 : 1;
+    }
+    return a->index - b->index;
+}
+
+static int
+cmp_unicode(const sort_item_t *a, const sort_item_t *b) {
+    int c = PadU_StrCmp(a->key.u, b->key.u);
+    if (c) {
+        return c;
+    }
+    return a->index - b->index;
+}
+
+static inline void
+swap_item(sort_item_t *a, sort_item_t *b) {
+    sort_item_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+static void
+insertion_sort(sort_item_t *a, int32_t n, sort_cmp_t cmp) {
+    for (int32_t i = 1; i < n; i++) {
+        sort_item_t x = a[i];
+        int32_t j = i;
+        for (; j > 0 && cmp(&x, &a[j - 1]) < 0; j--) {
+            a[j] = a[j - 1];
+        }
+        a[j] = x;
+    }
+}
+
+static void
+sift_down(sort_item_t *a, int32_t root, int32_t n, sort_cmp_t cmp) {
+    for (;;) {
+        int32_t child = root * 2 + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && cmp(&a[child], &a[child + 1]) < 0) {
+            child++;
+        }
+        if (cmp(&a[root], &a[child]) >= 0) {
+            break;
+        }
+        swap_item(&a[root], &a[child]);
+        root = child;
+    }
+}
+
+static void
+heap_sort(sort_item_t *a, int32_t n, sort_cmp_t cmp) {
+    for (int32_t i = n / 2 - 1; i >= 0; i--) {
+        sift_down(a, i, n, cmp);
+    }
+    for (int32_t i = n - 1; i > 0; i--) {
+        swap_item(&a[0], &a[i]);
+        sift_down(a, 0, i, cmp);
+    }
+}
+
+/**
+ * partition by median of three. items are distinct (see sort_item_t)
+ *
+ * @return index of pivot
+ */
+static int32_t
+partition(sort_item_t *a, int32_t n, sort_cmp_t cmp) {
+    int32_t mid = n / 2;
+    if (cmp(&a[mid], &a[0]) < 0) {
+        swap_item(&a[mid], &a[0]);
+    }
+    if (cmp(&a[n - 1], &a[0]) < 0) {
+        swap_item(&a[n - 1], &a[0]);
+    }
+    if (cmp(&a[n - 1], &a[mid]) < 0) {
+        swap_item(&a[n - 1], &a[mid]);
+    }
+    swap_item(&a[0], &a[mid]);
+
+    sort_item_t pivot = a[0];
+    int32_t i = 0;
+    int32_t j = n;
+    for (;;) {
+        do {
+            i++;
+        } while (i < n && cmp(&a[i], &pivot) < 0);
+        do {
+            j--;
+        } while (cmp(&a[j], &pivot) > 0);
+        if (i >= j) {
+            break;
+        }
+        swap_item(&a[i], &a[j]);
+    }
+    swap_item(&a[0], &a[j]);
+
+    return j;
+}
+
+/**
+ * introsort. quick sort falls back to heap sort at limit of depth
+ * and small partitions are sorted by insertion sort
+ */
+static void
+intro_sort(sort_item_t *a, int32_t n, int32_t depth, sort_cmp_t cmp) {
+    while (n > SORT_INSERTION_MAX) {
+        if (depth-- <= 0) {
+            heap_sort(a, n, cmp);
+            return;
+        }
+        int32_t p = partition(a, n, cmp);
+        // recurse into smaller side and loop on larger side
+        if (p < n - p - 1) {
+            intro_sort(a, p, depth, cmp);
+            a += p + 1;
+            n -= p + 1;
+        } else {
+            intro_sort(a + p + 1, n - p - 1, depth, cmp);
+            n = p;
+        }
+    }
+    insertion_sort(a, n, cmp);
+}
+
+/**
+ * set key of item by key object
+ * all keys must be numbers or all keys must be strings
+ *
+ * @param[in,out] *cmp comparator of keys. set by first key
+ *
+ * @return success to true
+ * @return failed to false (can't compare type)
+ */
+static bool
+set_sort_key(sort_item_t *item, const PadObj *key, sort_cmp_t *cmp) {
+    switch (key->type) {
+    default:
+        return false;
+        break;
+    case PAD_OBJ_TYPE__BOOL:
+    case PAD_OBJ_TYPE__INT: {
+        PadIntObj i = key->type == PAD_OBJ_TYPE__INT ? key->lvalue : key->boolean;
+        if (*cmp == NULL || *cmp == cmp_int) {
+            *cmp = cmp_int;
+            item->key.i = i;
+        } else if (*cmp == cmp_float) {
+            item->key.f = i;
+        } else {
+            return false;
+        }
+    } break;
+    case PAD_OBJ_TYPE__FLOAT:
+        if (*cmp == cmp_int) {
+            // mixed integers and floats. compare all as float
+            for (sort_item_t *p = item - 1; p >= item - item->index; p--) {
+                p->key.f = p->key.i;
+            }
+            *cmp = cmp_float;
+        } else if (*cmp != NULL && *cmp != cmp_float) {
+            return false;
+        }
+        *cmp = cmp_float;
+        item->key.f = key->float_value;
+        break;
+    case PAD_OBJ_TYPE__UNICODE:
+        if (*cmp != NULL && *cmp != cmp_unicode) {
+            return false;
+        }
+        *cmp = cmp_unicode;
+        item->key.u = PadUni_Getc(key->unicode);
+        break;
+    }
+
+    return true;
+}
+
+static PadObj *
+builtin_array_sort(PadBltFuncArgs *fargs) {
+    PadAST *ref_ast = fargs->ref_ast;
+    PadObjAry *args = fargs->ref_args->objarr;
+
+    if (PadObjAry_Len(args) > 1) {
+        push_err("can't invoke array.sort. too many arguments");
+        return NULL;
+    }
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.sort. invalid owner");
+        return NULL;
+    }
+    PadObjAry *arr = arrobj->objarr;
+    int32_t len = PadObjAry_Len(arr);
+
+    PadObj *key_func = NULL;
+    if (PadObjAry_Len(args) == 1) {
+        key_func = pull_arg(PadObjAry_Get(args, 0));
+        if (!key_func ||
+            (key_func->type != PAD_OBJ_TYPE__FUNC &&
+             key_func->type != PAD_OBJ_TYPE__BLTIN_FUNC)) {
+            push_err("can't invoke array.sort. key is not function");
+            return NULL;
+        }
+    }
+
+    sort_item_t *items = PadMem_Calloc(len + 1, sizeof(sort_item_t));
+    int32_t *order = PadMem_Calloc(len + 1, sizeof(int32_t));
+    PadObjAry *keys = key_func ? PadObjAry_New() : NULL;
+    PadObjAry *elems = key_func ? PadObjAry_New() : arr;
+    PadObj *key_args = NULL;
+    if (!items || !order || !elems || (key_func && !keys)) {
+        push_err("failed to allocate memory");
+        goto fail;
+    }
+
+    if (key_func) {
+        // key function can change the array. sort over snapshot that holds
+        // references of elements and check the length after key calls
+        for (int32_t i = 0; i < len; i++) {
+            if (!PadObjAry_PushBack(elems, PadObjAry_Get(arr, i))) {
+                push_err("failed to allocate memory");
+                goto fail;
+            }
+        }
+
+        key_args = PadObj_NewAry(ref_ast->ref_gc, PadObjAry_New());
+        if (!key_args) {
+            push_err("failed to allocate memory");
+            goto fail;
+        }
+        PadObj_IncRef(key_args);
+    }
+
+    // extract keys. results of key function are kept alive until end of sort
+    sort_cmp_t cmp = NULL;
+    for (int32_t i = 0; i < len; i++) {
+        PadObj *key = PadObjAry_Get(elems, i);
+        if (key_func) {
+            PadObjAry_PushBack(key_args->objarr, key);
+            key = Pad_InvokeFuncObj(
+                ref_ast->error_stack, fargs->ref_node, ref_ast,
+                ref_ast->ref_gc, ref_ast->ref_context, key_func, key_args
+            );
+            PadObj *arg = PadObjAry_PopBack(key_args->objarr);
+            PadObj_DecRef(arg);
+            if (!key) {
+                push_err("failed to invoke key function of array.sort");
+                goto fail;
+            }
+            PadObjAry_PushBack(keys, key);
+            key = pull_arg(key);
+        }
+
+        items[i].index = i;
+        if (!key || !set_sort_key(&items[i], key, &cmp)) {
+            push_err("can't invoke array.sort. can't compare elements");
+            goto fail;
+        }
+    }
+
+    if (PadObjAry_Len(arr) != len) {
+        push_err("can't invoke array.sort. array changed during sort");
+        goto fail;
+    }
+
+    if (len > 1) {
+        int32_t depth = 0;
+        for (int32_t n = len; n > 1; n >>= 1) {
+            depth += 2;
+        }
+        intro_sort(items, len, depth, cmp);
+        for (int32_t i = 0; i < len; i++) {
+            order[i] = items[i].index;
+        }
+        if (elems == arr) {
+            if (!PadObjAry_Permute(arr, order)) {
+                push_err("failed to sort array");
+                goto fail;
+            }
+        } else {
+            for (int32_t i = 0; i < len; i++) {
+                if (!PadObjAry_Set(arr, i, PadObjAry_Get(elems, order[i]))) {
+                    push_err("failed to sort array");
+                    goto fail;
+                }
+            }
+        }
+    }
+
+    free(items);
+    free(order);
+    PadObjAry_Del(keys);
+    if (elems != arr) {
+        PadObjAry_Del(elems);
+    }
+    if (key_args) {
+        PadObj_DecRef(key_args);
+        PadObj_Del(key_args);
+    }
+    return arrobj;
+
+fail:
+    free(items);
+    free(order);
+    PadObjAry_Del(keys);
+    if (elems != arr) {
+        PadObjAry_Del(elems);
+    }
+    if (key_args) {
+        PadObj_DecRef(key_args);
+        PadObj_Del(key_args);
+    }
+    return NULL;
+}
+
+/*********
+* others *
+*********/
+
+/**
+ * normalize index of slice. negative index is counted from end
+ */
+static int32_t
+slice_index(PadIntObj index, int32_t len) {
+    if (index < 0) {
+        index += len;
+    }
+    if (index < 0) {
+        return 0;
+    }
+    if (index > len) {
+        return len;
+    }
+    return index;
+}
+
+static PadObj *
+builtin_array_slice(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < 1 || nargs > 2) {
+        push_err("can't invoke array.slice. need one or two arguments");
+        return NULL;
+    }
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.slice. invalid owner");
+        return NULL;
+    }
+    PadObjAry *arr = arrobj->objarr;
+    int32_t len = PadObjAry_Len(arr);
+
+    PadIntObj idx[2] = {0, len};
+    for (int32_t i = 0; i < nargs; i++) {
+        const PadObj *arg = pull_arg(PadObjAry_Get(args, i));
+        if (!arg || arg->type != PAD_OBJ_TYPE__INT) {
+            push_err("can't invoke array.slice. index is not integer");
+            return NULL;
+        }
+        idx[i] = arg->lvalue;
+    }
+
+    int32_t begin = slice_index(idx[0], len);
+    int32_t end = slice_index(idx[1], len);
+
+    PadObjAry *dst = PadObjAry_New();
+    if (!dst) {
+        push_err("failed to allocate memory");
+        return NULL;
+    }
+    for (int32_t i = begin; i < end; i++) {
+        PadObjAry_PushBack(dst, PadObjAry_Get(arr, i));
+    }
+
+    return PadObj_NewAry(fargs->ref_ast->ref_gc, PadMem_Move(dst));
+}
+
+static PadObj *
+builtin_array_join(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) > 1) {
+        push_err("can't invoke array.join. too many arguments");
+        return NULL;
+    }
+
+    const char *sep = "";
+    if (PadObjAry_Len(args) == 1) {
+        const PadObj *arg = pull_arg(PadObjAry_Get(args, 0));
+        if (!arg || arg->type != PAD_OBJ_TYPE__UNICODE) {
+            push_err("can't invoke array.join. separator is not string");
+            return NULL;
+        }
+        sep = PadUni_GetcMB(arg->unicode);
+    }
+    int32_t seplen = strlen(sep);
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.join. invalid owner");
+        return NULL;
+    }
+    PadObjAry *arr = arrobj->objarr;
+
+    PadStr *buf = PadStr_New();
+    if (!buf) {
+        push_err("failed to allocate memory");
+        return NULL;
+    }
+
+    for (int32_t i = 0; i < PadObjAry_Len(arr); i++) {
+        if (i > 0) {
+            PadStr_AppNStr(buf, sep, seplen);
+        }
+        const PadObj *elem = PadObjAry_Getc(arr, i);
+        if (elem->type == PAD_OBJ_TYPE__UNICODE) {
+            const char *mb = PadUni_GetcMB(elem->unicode);
+            PadStr_AppNStr(buf, mb, strlen(mb));
+        } else {
+            PadStr *s = PadObj_ToStr(elem);
+            if (!s) {
+                push_err("failed to convert element to string");
+                PadStr_Del(buf);
+                return NULL;
+            }
+            PadStr_AppNStr(buf, PadStr_Getc(s), PadStr_Len(s));
+            PadStr_Del(s);
+        }
+    }
+
+    PadObj *ret = PadObj_NewUnicodeCStr(fargs->ref_ast->ref_gc, PadStr_Getc(buf));
+    PadStr_Del(buf);
+    return ret;
+}
+
+static PadObj *
+builtin_array_extend(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke array.extend. need one argument");
+        return NULL;
+    }
+
+    const PadObj *other = pull_arg(PadObjAry_Get(args, 0));
+    if (!other || other->type != PAD_OBJ_TYPE__ARRAY) {
+        push_err("can't invoke array.extend. argument is not array");
+        return NULL;
+    }
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.extend. invalid owner");
+        return NULL;
+    }
+    PadObjAry *arr = arrobj->objarr;
+
+    // length of other is fixed before appends for a.extend(a)
+    int32_t n = PadObjAry_Len(other->objarr);
+    for (int32_t i = 0; i < n; i++) {
+        if (!PadObjAry_PushBack(arr, PadObjAry_Get(other->objarr, i))) {
+            push_err("failed to extend array");
+            return NULL;
+        }
+    }
+
+    return arrobj;
+}
+
+static PadObj *
+builtin_array_reverse(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 0) {
+        push_err("can't invoke array.reverse. too many arguments");
+        return NULL;
+    }
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.reverse. invalid owner");
+        return NULL;
+    }
+
+    if (!PadObjAry_Reverse(arrobj->objarr)) {
+        push_err("failed to reverse array");
+        return NULL;
+    }
+
+    return arrobj;
+}
+
+/**
+ * find index of element that equals argument
+ *
+ * @return found to index
+ * @return not found to -1
+ * @return failed to -2
+ */
+static int32_t
+find_elem(PadBltFuncArgs *fargs, const char *method_name) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke array.%s. need one argument", method_name);
+        return -2;
+    }
+
+    const PadObj *x = pull_arg(PadObjAry_Get(args, 0));
+    if (!x) {
+        push_err("can't invoke array.%s. invalid argument", method_name);
+        return -2;
+    }
+
+    PadObj *arrobj = pull_last_array(fargs->ref_owners);
+    if (!arrobj) {
+        push_err("can't invoke array.%s. invalid owner", method_name);
+        return -2;
+    }
+    PadObjAry *arr = arrobj->objarr;
+
+    for (int32_t i = 0; i < PadObjAry_Len(arr); i++) {
+        if (Pad_IsEqualValue(PadObjAry_Getc(arr, i), x)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static PadObj *
+builtin_array_index(PadBltFuncArgs *fargs) {
+    int32_t i = find_elem(fargs, "index");
+    if (i == -2) {
+        return NULL;
+    }
+    return PadObj_NewInt(fargs->ref_ast->ref_gc, i);
+}
+
+static PadObj *
+builtin_array_contains(PadBltFuncArgs *fargs) {
+    int32_t i = find_elem(fargs, "contains");
+    if (i == -2) {
+        return NULL;
+    }
+    return PadObj_NewBool(fargs->ref_ast->ref_gc, i >= 0);
+}
+
 static PadBltFuncInfo
 builtin_func_infos[] = {
     {"push", builtin_array_push},
     {"pop", builtin_array_pop},
+    {"sort", builtin_array_sort},
+    {"slice", builtin_array_slice},
+    {"join", builtin_array_join},
+    {"extend", builtin_array_extend},
+    {"reverse", builtin_array_reverse},
+    {"index", builtin_array_index},
+    {"contains", builtin_array_contains},
     {0},
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <math.h>
+
 #include <pad/core/config.h>
 #include <pad/lib/string.h>
 #include <pad/lang/object.h>
@@ -0,0 +1,204 @@
+#include <pad/lang/builtin/modules/builder.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+static PadObj *
+pull_builder(PadBltFuncArgs *fargs) {
+    PadObjAry *owns = fargs->ref_owners;
+    if (!owns) {
+        push_err("owners is null");
+        return NULL;
+    }
+
+    PadObj *own_met = PadObjAry_GetLast(owns);
+    if (own_met->type != PAD_OBJ_TYPE__OWNERS_METHOD) {
+        push_err("owner is owner's method");
+        return NULL;
+    }
+
+    PadObj *own = own_met->owners_method.owner;
+    if (own->type != PAD_OBJ_TYPE__BUILDER) {
+        push_err("owner is not a builder");
+        return NULL;
+    }
+
+    return own;
+}
+
+static bool
+append_string(PadBltFuncArgs *fargs, PadObj *builder, PadObj *s) {
+    switch (s->type) {
+    default:
+        push_err("invalid argument type (%d)", s->type);
+        return false;
+    case PAD_OBJ_TYPE__UNICODE:
+        if (!PadObj_AppBuilder(builder, s->unicode)) {
+            push_err("failed to append string");
+            return false;
+        }
+        break;
+    case PAD_OBJ_TYPE__BUILDER: {
+        PadUni *built = PadObj_BuildBuilder(s);
+        if (!built || !PadObj_AppBuilder(builder, built)) {
+            push_err("failed to append builder");
+            return false;
+        }
+    } break;
+    }
+
+    return true;
+}
+
+static PadObj *
+builtin_builder_append(PadBltFuncArgs *fargs) {
+    PadObj *ref_args = fargs->ref_args;
+    if (ref_args->type != PAD_OBJ_TYPE__ARRAY) {
+        push_err("invalid arguments type");
+        return NULL;
+    }
+
+    PadObj *builder = pull_builder(fargs);
+    if (!builder) {
+        push_err("not found builder");
+        return NULL;
+    }
+
+    PadObjAry *args = ref_args->objarr;
+    for (int32_t i = 0; i < PadObjAry_Len(args); i++) {
+        PadObj *s = PadObjAry_Get(args, i);
+        if (!append_string(fargs, builder, s)) {
+            return NULL;
+        }
+    }
+
+    return PadObj_NewNil(fargs->ref_ast->ref_gc);
+}
+
+static PadObj *
+builtin_builder_join(PadBltFuncArgs *fargs) {
+    PadObj *ref_args = fargs->ref_args;
+    if (ref_args->type != PAD_OBJ_TYPE__ARRAY) {
+        push_err("invalid arguments type");
+        return NULL;
+    }
+
+    PadObjAry *args = ref_args->objarr;
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < 1 || nargs > 2) {
+        push_err("invalid arguments length");
+        return NULL;
+    }
+
+    PadObj *ary = PadObjAry_Get(args, 0);
+    if (ary->type != PAD_OBJ_TYPE__ARRAY) {
+        push_err("invalid array type");
+        return NULL;
+    }
+
+    PadObj *sep = NULL;
+    if (nargs == 2) {
+        sep = PadObjAry_Get(args, 1);
+        if (sep->type != PAD_OBJ_TYPE__UNICODE) {
+            push_err("invalid separator type");
+            return NULL;
+        }
+    }
+
+    PadObj *builder = pull_builder(fargs);
+    if (!builder) {
+        push_err("not found builder");
+        return NULL;
+    }
+
+    for (int32_t i = 0; i < PadObjAry_Len(ary->objarr); i++) {
+        if (sep && i > 0) {
+            if (!append_string(fargs, builder, sep)) {
+                return NULL;
+            }
+        }
+        PadObj *s = PadObjAry_Get(ary->objarr, i);
+        if (!append_string(fargs, builder, s)) {
+            return NULL;
+        }
+    }
+
+    return PadObj_NewNil(fargs->ref_ast->ref_gc);
+}
+
+static PadObj *
+builtin_builder_build(PadBltFuncArgs *fargs) {
+    PadObj *ref_args = fargs->ref_args;
+    if (ref_args->type != PAD_OBJ_TYPE__ARRAY) {
+        push_err("invalid arguments type");
+        return NULL;
+    }
+
+    if (PadObjAry_Len(ref_args->objarr) != 0) {
+        push_err("invalid arguments length");
+        return NULL;
+    }
+
+    PadObj *builder = pull_builder(fargs);
+    if (!builder) {
+        push_err("not found builder");
+        return NULL;
+    }
+
+    PadUni *built = PadObj_BuildBuilder(builder);
+    if (!built) {
+        push_err("failed to build string");
+        return NULL;
+    }
+
+    // the result shares buffer with builder (copy on write)
+    PadUni *u = PadUni_ShallowCopy(built);
+    if (!u) {
+        push_err("failed to copy string");
+        return NULL;
+    }
+
+    return PadObj_NewUnicode(fargs->ref_ast->ref_gc, PadMem_Move(u));
+}
+
+static PadObj *
+builtin_builder_len(PadBltFuncArgs *fargs) {
+    PadObj *builder = pull_builder(fargs);
+    if (!builder) {
+        push_err("not found builder");
+        return NULL;
+    }
+
+    return PadObj_NewInt(fargs->ref_ast->ref_gc, builder->builder.length);
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"append", builtin_builder_append},
+    {"join", builtin_builder_join},
+    {"build", builtin_builder_build},
+    {"len", builtin_builder_len},
+    {0},
+};
+
+PadObj *
+Pad_NewBltBuilderMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *func_info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(func_info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "__builder__",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(func_info_ary)
+    );
+}
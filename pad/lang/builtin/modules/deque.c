@@ -0,0 +1,214 @@
+#include <pad/lang/builtin/modules/deque.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+/**
+ * pull deque object of owner of method
+ *
+ * @return success to pointer to deque object
+ * @return failed to NULL
+ */
+static PadObj *
+pull_deque(PadBltFuncArgs *fargs) {
+    PadObjAry *owns = fargs->ref_owners;
+    if (!owns) {
+        push_err("owners is null");
+        return NULL;
+    }
+
+    PadObj *own_met = PadObjAry_GetLast(owns);
+    if (own_met->type != PAD_OBJ_TYPE__OWNERS_METHOD) {
+        push_err("owner is owner's method");
+        return NULL;
+    }
+
+    PadObj *own = Pad_ExtractIdent(own_met->owners_method.owner);
+    if (!own || own->type != PAD_OBJ_TYPE__DEQUE) {
+        push_err("owner is not a deque");
+        return NULL;
+    }
+
+    return own;
+}
+
+/**
+ * pull element for push from arguments
+ * integers and strings are copied like array.push
+ *
+ * @return success to pointer to element
+ * @return failed to NULL
+ */
+static PadObj *
+pull_elem(PadBltFuncArgs *fargs, const char *method) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke deque.%s. need one argument", method);
+        return NULL;
+    }
+
+    PadObj *arg = PadObjAry_Get(args, 0);
+    while (arg && arg->type == PAD_OBJ_TYPE__IDENT) {
+        arg = Pad_PullRefAll(arg);
+    }
+    if (!arg) {
+        push_err("can't invoke deque.%s. argument is not defined", method);
+        return NULL;
+    }
+
+    switch (arg->type) {
+    default:
+        return arg;
+        break;
+    case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__UNICODE:
+        return PadObj_DeepCopy(arg);
+        break;
+    }
+}
+
+static PadObj *
+builtin_deque_push(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObj *elem = pull_elem(fargs, "push");
+    if (!elem) {
+        return NULL;
+    }
+    if (!PadObjDeq_PushBack(deq->objdeq, elem)) {
+        push_err("failed to push element at deque");
+        return NULL;
+    }
+
+    return deq;
+}
+
+static PadObj *
+builtin_deque_push_front(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObj *elem = pull_elem(fargs, "push_front");
+    if (!elem) {
+        return NULL;
+    }
+    if (!PadObjDeq_PushFront(deq->objdeq, elem)) {
+        push_err("failed to push element at deque");
+        return NULL;
+    }
+
+    return deq;
+}
+
+static PadObj *
+builtin_deque_pop(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObj *ret = PadObjDeq_PopBack(deq->objdeq);
+    if (!ret) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+
+    // release reference of deque. the element is owned by caller
+    PadObj_DecRef(ret);
+    return ret;
+}
+
+static PadObj *
+builtin_deque_pop_front(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObj *ret = PadObjDeq_PopFront(deq->objdeq);
+    if (!ret) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+
+    // release reference of deque. the element is owned by caller
+    PadObj_DecRef(ret);
+    return ret;
+}
+
+static PadObj *
+builtin_deque_front(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObj *ret = PadObjDeq_Get(deq->objdeq, 0);
+    if (!ret) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+    return ret;
+}
+
+static PadObj *
+builtin_deque_back(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObjDeq *objdeq = deq->objdeq;
+    PadObj *ret = PadObjDeq_Get(objdeq, PadObjDeq_Len(objdeq) - 1);
+    if (!ret) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+    return ret;
+}
+
+static PadObj *
+builtin_deque_clear(PadBltFuncArgs *fargs) {
+    PadObj *deq = pull_deque(fargs);
+    if (!deq) {
+        return NULL;
+    }
+
+    PadObjDeq_Clear(deq->objdeq);
+    return deq;
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"push", builtin_deque_push},
+    {"push_front", builtin_deque_push_front},
+    {"pop", builtin_deque_pop},
+    {"pop_front", builtin_deque_pop_front},
+    {"front", builtin_deque_front},
+    {"back", builtin_deque_back},
+    {"clear", builtin_deque_clear},
+    {0},
+};
+
+PadObj *
+Pad_NewBltDeqMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *func_info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(func_info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "__deque__",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(func_info_ary)
+    );
+}
@@ -233,40 +233,52 @@ builtin_dict_has(PadBltFuncArgs *fargs) {
     }
 }
 
+/**
+ * construct view of dict of owner. the view does not copy keys and values
+ *
+ * @param[in] *name name of method for error
+ * @param[in] kind  kind of view
+ */
 static PadObj *
-builtin_dict_keys(PadBltFuncArgs *fargs) {
+new_dict_view(PadBltFuncArgs *fargs, const char *name, PadDictViewKind kind) {
     PadAST *ref_ast = fargs->ref_ast;
-    PadGC *ref_gc = ref_ast->ref_gc;
     PadObj *actual_args = fargs->ref_args;
     assert(actual_args);
     assert(actual_args->type == PAD_OBJ_TYPE__ARRAY);
-    PadObjAry *ref_owners = fargs->ref_owners;
-    PadObjAry *ary = PadObjAry_New();
 
-    PadObj *dictobj = pull_last_dict(ref_ast, ref_owners);
+    if (PadObjAry_Len(actual_args->objarr) != 0) {
+        push_err("can't invoke dict.%s(). too many arguments", name);
+        return NULL;
+    }
+
+    PadObj *dictobj = pull_last_dict(ref_ast, fargs->ref_owners);
     if (!dictobj) {
         push_err("invalid owner");
-        goto error;
+        return NULL;
     }
-    PadObjDict *dict = PadObj_GetDict(dictobj);
-
-    int32_t len = PadObjDict_Len(dict);
-    for (int32_t i = 0; i < len; i += 1) {
-        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
-        PadUni *uni = PadUni_New();
-        if (!PadUni_SetMB(uni, item->key)) {
-            push_err("failed to convert strings");
-            goto error;
-        }
 
-        PadObj *elem = PadObj_NewUnicode(ref_gc, PadMem_Move(uni));
-        PadObjAry_MoveBack(ary, PadMem_Move(elem));
+    PadObj *view = PadObj_NewDictView(ref_ast->ref_gc, dictobj, kind);
+    if (!view) {
+        push_err("failed to create view of dict");
+        return NULL;
     }
 
-    return PadObj_NewAry(ref_gc, PadMem_Move(ary));
-error:
-    PadObjAry_Del(ary);
-    return NULL;
+    return view;
+}
+
+static PadObj *
+builtin_dict_keys(PadBltFuncArgs *fargs) {
+    return new_dict_view(fargs, "keys", PAD_DICT_VIEW__KEYS);
+}
+
+static PadObj *
+builtin_dict_values(PadBltFuncArgs *fargs) {
+    return new_dict_view(fargs, "values", PAD_DICT_VIEW__VALUES);
+}
+
+static PadObj *
+builtin_dict_items(PadBltFuncArgs *fargs) {
+    return new_dict_view(fargs, "items", PAD_DICT_VIEW__ITEMS);
 }
 
 static PadBltFuncInfo
@@ -275,6 +287,8 @@ builtin_func_infos[] = {
     {"pop", builtin_dict_pop},
     {"has", builtin_dict_has},
     {"keys", builtin_dict_keys},
+    {"values", builtin_dict_values},
+    {"items", builtin_dict_items},
     {0},
 };
 
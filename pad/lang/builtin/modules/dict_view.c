@@ -0,0 +1,160 @@
+#include <pad/lang/builtin/modules/dict_view.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+/**
+ * pull dict view object of owner of method
+ *
+ * @return success to pointer to dict view object
+ * @return failed to NULL
+ */
+static PadObj *
+pull_dict_view(PadBltFuncArgs *fargs) {
+    PadObjAry *owns = fargs->ref_owners;
+    if (!owns) {
+        push_err("owners is null");
+        return NULL;
+    }
+
+    PadObj *own_met = PadObjAry_GetLast(owns);
+    if (own_met->type != PAD_OBJ_TYPE__OWNERS_METHOD) {
+        push_err("owner is owner's method");
+        return NULL;
+    }
+
+    PadObj *own = Pad_ExtractIdent(own_met->owners_method.owner);
+    if (!own || own->type != PAD_OBJ_TYPE__DICT_VIEW) {
+        push_err("owner is not a dict view");
+        return NULL;
+    }
+
+    return own;
+}
+
+/**
+ * membership test. keys are found by lookup of dict and values are
+ * compared in order (see Pad_IsEqualValue)
+ *
+ *     d.keys().contains("a")
+ *     d.values().contains(1)
+ *     d.items().contains(["a", 1])
+ */
+static PadObj *
+builtin_dict_view_contains(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke contains. need one argument");
+        return NULL;
+    }
+
+    PadObj *own = pull_dict_view(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadObj *x = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+    if (!x) {
+        push_err("can't invoke contains. invalid argument");
+        return NULL;
+    }
+
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    const PadObjDict *dict = own->dict_view.dict->objdict;
+
+    switch (own->dict_view.kind) {
+    case PAD_DICT_VIEW__KEYS: {
+        bool found = x->type == PAD_OBJ_TYPE__UNICODE &&
+                     PadObjDict_Getc(dict, PadUni_GetcMB(x->unicode));
+        return PadObj_NewBool(ref_gc, found);
+    } break;
+    case PAD_DICT_VIEW__VALUES: {
+        for (int32_t i = 0; i < PadObjDict_Len(dict); i++) {
+            if (Pad_IsEqualValue(PadObjDict_GetcIndex(dict, i)->value, x)) {
+                return PadObj_NewBool(ref_gc, true);
+            }
+        }
+        return PadObj_NewBool(ref_gc, false);
+    } break;
+    case PAD_DICT_VIEW__ITEMS: {
+        if (x->type != PAD_OBJ_TYPE__ARRAY || PadObjAry_Len(x->objarr) != 2) {
+            return PadObj_NewBool(ref_gc, false);
+        }
+        const PadObj *key = Pad_ExtractIdent(PadObjAry_Get(x->objarr, 0));
+        const PadObj *val = Pad_ExtractIdent(PadObjAry_Get(x->objarr, 1));
+        if (!key || !val || key->type != PAD_OBJ_TYPE__UNICODE) {
+            return PadObj_NewBool(ref_gc, false);
+        }
+        const PadObjDictItem *item = PadObjDict_Getc(dict, PadUni_GetcMB(key->unicode));
+        return PadObj_NewBool(ref_gc, item && Pad_IsEqualValue(item->value, val));
+    } break;
+    }
+
+    assert(0 && "impossible");
+    return NULL;
+}
+
+/**
+ * materialize elements of view to new array
+ */
+static PadObj *
+builtin_dict_view_to_array(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 0) {
+        push_err("can't invoke to_array. too many arguments");
+        return NULL;
+    }
+
+    PadObj *own = pull_dict_view(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    PadObjAry *arr = PadObjAry_New();
+    if (!arr) {
+        push_err("failed to allocate array");
+        return NULL;
+    }
+
+    int32_t len = PadObj_GetDictViewLen(own);
+    for (int32_t i = 0; i < len; i++) {
+        PadObj *elem = PadObj_NewDictViewItem(ref_gc, own, i);
+        if (!elem || !PadObjAry_PushBack(arr, elem)) {
+            push_err("failed to convert dict view to array");
+            PadObjAry_Del(arr);
+            return NULL;
+        }
+    }
+
+    return PadObj_NewAry(ref_gc, PadMem_Move(arr));
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"contains", builtin_dict_view_contains},
+    {"to_array", builtin_dict_view_to_array},
+    {0},
+};
+
+PadObj *
+Pad_NewBltDictViewMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *func_info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(func_info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "__dict_view__",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(func_info_ary)
+    );
+}
@@ -0,0 +1,272 @@
+#include <pad/lang/builtin/modules/ini.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+enum {
+    ERR_SIZE = 512,
+};
+
+/**
+ * get file of argument at index
+ * if argument is path then file is opened by mode and *opened is true
+ * and caller must close it
+ *
+ * @return success to pointer to FILE
+ * @return failed to NULL
+ */
+static FILE *
+pull_fp(PadBltFuncArgs *fargs, const char *funcname, int32_t index, const char *mode, bool *opened) {
+    PadAST *ref_ast = fargs->ref_ast;
+    PadObjAry *args = fargs->ref_args->objarr;
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    *opened = false;
+
+    if (obj && obj->type == PAD_OBJ_TYPE__UNICODE) {
+        const char *spath = PadUni_GetcMB(obj->unicode);
+        char path[PAD_FILE__NPATH];
+        if (ref_ast->open_fix_path) {
+            if (!ref_ast->open_fix_path(fargs, path, sizeof path, spath)) {
+                push_err("failed to fix path");
+                return NULL;
+            }
+        } else {
+            PadCStr_Copy(path, sizeof path, spath);
+        }
+
+        FILE *fp = fopen(path, mode);
+        if (!fp) {
+            push_err("can't invoke ini.%s(). failed to open \"%s\"", funcname, spath);
+            return NULL;
+        }
+        *opened = true;
+        return fp;
+    }
+
+    if (!obj || obj->type != PAD_OBJ_TYPE__FILE) {
+        push_err("can't invoke ini.%s(). argument is not path or file", funcname);
+        return NULL;
+    }
+    if (!obj->file.fp) {
+        push_err("can't invoke ini.%s(). file is closed", funcname);
+        return NULL;
+    }
+
+    return obj->file.fp;
+}
+
+/**
+ * get flags of decode by optional argument of strict at index
+ * if strict is false then invalid lines of names are skipped
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+pull_flags(PadBltFuncArgs *fargs, const char *funcname, int32_t index, int32_t *flags) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    *flags = 0;
+    if (index >= PadObjAry_Len(args)) {
+        return true;  // strict by default
+    }
+
+    const PadObj *strict = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!strict || strict->type != PAD_OBJ_TYPE__BOOL) {
+        push_err("can't invoke ini.%s(). strict is not bool", funcname);
+        return false;
+    }
+    if (!strict->boolean) {
+        *flags |= PAD_INI__SKIP_INVALID;
+    }
+
+    return true;
+}
+
+static PadObj *
+decode(PadBltFuncArgs *fargs, const char *text, int32_t len, int32_t flags) {
+    char err[ERR_SIZE];
+    PadObj *obj = PadIni_Decode(fargs->ref_ast->ref_gc, text, len, flags, err, sizeof err);
+    if (!obj) {
+        push_err("failed to decode ini. %s", err);
+        return NULL;
+    }
+    return obj;
+}
+
+/**
+ * decode INI text to dict of sections
+ * if strict is false then invalid lines of names are skipped
+ *
+ *     data = ini.decode("[server]\nport = 8080\n")
+ *     data = ini.decode(text, false)
+ */
+static PadObj *
+builtin_ini_decode(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < 1 || nargs > 2) {
+        push_err("can't invoke ini.decode(). need one or two arguments");
+        return NULL;
+    }
+
+    int32_t flags;
+    if (!pull_flags(fargs, "decode", 1, &flags)) {
+        return NULL;
+    }
+
+    PadObj *text = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+    if (!text || text->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("can't invoke ini.decode(). argument is not string");
+        return NULL;
+    }
+
+    const char *s = PadUni_GetcMB(text->unicode);
+    return decode(fargs, s, strlen(s), flags);
+}
+
+/**
+ * encode dict of sections to INI text
+ *
+ *     s = ini.encode({"server": {"port": 8080}})
+ */
+static PadObj *
+builtin_ini_encode(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke ini.encode(). need one argument");
+        return NULL;
+    }
+
+    PadStr *s = PadStr_New();
+    if (!s) {
+        push_err("failed to allocate string");
+        return NULL;
+    }
+
+    char err[ERR_SIZE];
+    if (!PadIni_EncodeToStr(s, PadObjAry_Get(args, 0), err, sizeof err)) {
+        push_err("failed to encode ini. %s", err);
+        PadStr_Del(s);
+        return NULL;
+    }
+
+    PadObj *ret = PadObj_NewUnicodeCStr(fargs->ref_ast->ref_gc, PadStr_Getc(s));
+    PadStr_Del(s);
+    return ret;
+}
+
+/**
+ * decode file of path or rest of file object
+ * if strict is false then invalid lines of names are skipped
+ *
+ *     data = ini.load("settings.ini")
+ *     data = ini.load("settings.ini", false)
+ */
+static PadObj *
+builtin_ini_load(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < 1 || nargs > 2) {
+        push_err("can't invoke ini.load(). need one or two arguments");
+        return NULL;
+    }
+
+    int32_t flags;
+    if (!pull_flags(fargs, "load", 1, &flags)) {
+        return NULL;
+    }
+
+    bool opened;
+    FILE *fp = pull_fp(fargs, "load", 0, "rb", &opened);
+    if (!fp) {
+        return NULL;
+    }
+
+    char *text = PadFile_ReadCopy(fp);
+    if (opened) {
+        fclose(fp);
+    }
+    if (!text) {
+        push_err("failed to read content from file");
+        return NULL;
+    }
+
+    PadObj *obj = decode(fargs, text, strlen(text), flags);
+    free(text);
+    return obj;
+}
+
+/**
+ * encode dict of sections to file of path or file object
+ * output is written through sink while traversing sections
+ *
+ *     ini.dump(data, "settings.ini")
+ */
+static PadObj *
+builtin_ini_dump(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 2) {
+        push_err("can't invoke ini.dump(). need two arguments");
+        return NULL;
+    }
+
+    bool opened;
+    FILE *fp = pull_fp(fargs, "dump", 1, "wb", &opened);
+    if (!fp) {
+        return NULL;
+    }
+
+    PadSink *sink = PadSink_NewFile(fp);
+    if (!sink) {
+        if (opened) {
+            fclose(fp);
+        }
+        push_err("failed to allocate sink");
+        return NULL;
+    }
+
+    char err[ERR_SIZE];
+    bool ok = PadIni_EncodeToSink(sink, PadObjAry_Get(args, 0), err, sizeof err) &&
+              PadSink_Flush(sink);
+    PadSink_Del(sink);
+    if (opened && fclose(fp) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        push_err("failed to encode ini. %s", err[0] ? err : "failed to write");
+        return NULL;
+    }
+
+    return PadObj_NewNil(fargs->ref_ast->ref_gc);
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"decode", builtin_ini_decode},
+    {"encode", builtin_ini_encode},
+    {"load", builtin_ini_load},
+    {"dump", builtin_ini_dump},
+    {0},
+};
+
+PadObj *
+Pad_NewBltIniMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "ini",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(info_ary)
+    );
+}
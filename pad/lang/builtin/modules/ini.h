@@ -0,0 +1,33 @@
+#pragma once
+
+#include <pad/core/config.h>
+#include <pad/lib/file.h>
+#include <pad/lib/sink.h>
+#include <pad/lang/types.h>
+#include <pad/lang/object.h>
+#include <pad/lang/ast.h>
+#include <pad/lang/gc.h>
+#include <pad/lang/tokenizer.h>
+#include <pad/lang/context.h>
+#include <pad/lang/utils.h>
+#include <pad/lang/ini.h>
+#include <pad/lang/arguments.h>
+#include <pad/lang/builtin/func_info.h>
+#include <pad/lang/builtin/func_info_array.h>
+
+/**
+ * construct the built-in ini module
+ * file of load and dump is path or file object
+ *
+ *     ini.decode(text)
+ *     ini.encode(data)
+ *     ini.load(file)
+ *     ini.dump(data, file)
+ *
+ * @param[in] *ref_config
+ * @param[in] *ref_gc
+ *
+ * @return
+ */
+PadObj *
+Pad_NewBltIniMod(const PadConfig *ref_config, PadGC *ref_gc);
@@ -0,0 +1,229 @@
+#include <pad/lang/builtin/modules/json.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+enum {
+    ERR_SIZE = 512,
+};
+
+/**
+ * get optional argument of indent at index
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+pull_indent(PadBltFuncArgs *fargs, const char *funcname, int32_t index, int32_t *indent) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    *indent = 0;
+    if (PadObjAry_Len(args) <= index) {
+        return true;
+    }
+
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__INT || obj->lvalue < 0) {
+        push_err("can't invoke json.%s(). invalid indent", funcname);
+        return false;
+    }
+
+    *indent = obj->lvalue;
+    return true;
+}
+
+/**
+ * get file of argument at index
+ *
+ * @return success to pointer to FILE
+ * @return failed to NULL
+ */
+static FILE *
+pull_fp(PadBltFuncArgs *fargs, const char *funcname, int32_t index) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__FILE) {
+        push_err("can't invoke json.%s(). argument is not file", funcname);
+        return NULL;
+    }
+    if (!obj->file.fp) {
+        push_err("can't invoke json.%s(). file is closed", funcname);
+        return NULL;
+    }
+
+    return obj->file.fp;
+}
+
+static PadObj *
+decode(PadBltFuncArgs *fargs, const char *text, int32_t len) {
+    char err[ERR_SIZE];
+    PadObj *obj = PadJson_Decode(fargs->ref_ast->ref_gc, text, len, err, sizeof err);
+    if (!obj) {
+        push_err("failed to decode json. %s", err);
+        return NULL;
+    }
+    return obj;
+}
+
+/**
+ * decode JSON text
+ *
+ *     data = json.decode("{\"a\": [1, 2.5, null]}")
+ */
+static PadObj *
+builtin_json_decode(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke json.decode(). need one argument");
+        return NULL;
+    }
+
+    PadObj *text = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+    if (!text || text->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("can't invoke json.decode(). argument is not string");
+        return NULL;
+    }
+
+    const char *s = PadUni_GetcMB(text->unicode);
+    return decode(fargs, s, strlen(s));
+}
+
+/**
+ * encode object to JSON text
+ *
+ *     s = json.encode(data)
+ *     s = json.encode(data, 2)
+ */
+static PadObj *
+builtin_json_encode(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 1 || PadObjAry_Len(args) > 2) {
+        push_err("can't invoke json.encode(). need one or two arguments");
+        return NULL;
+    }
+
+    int32_t indent;
+    if (!pull_indent(fargs, "encode", 1, &indent)) {
+        return NULL;
+    }
+
+    PadStr *s = PadStr_New();
+    if (!s) {
+        push_err("failed to allocate string");
+        return NULL;
+    }
+
+    char err[ERR_SIZE];
+    if (!PadJson_EncodeToStr(s, PadObjAry_Get(args, 0), indent, err, sizeof err)) {
+        push_err("failed to encode json. %s", err);
+        PadStr_Del(s);
+        return NULL;
+    }
+
+    PadObj *ret = PadObj_NewUnicodeCStr(fargs->ref_ast->ref_gc, PadStr_Getc(s));
+    PadStr_Del(s);
+    return ret;
+}
+
+/**
+ * decode rest of file
+ *
+ *     f = open("data.json", "r")
+ *     data = json.load(f)
+ */
+static PadObj *
+builtin_json_load(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke json.load(). need one argument");
+        return NULL;
+    }
+
+    FILE *fp = pull_fp(fargs, "load", 0);
+    if (!fp) {
+        return NULL;
+    }
+
+    char *text = PadFile_ReadCopy(fp);
+    if (!text) {
+        push_err("failed to read content from file");
+        return NULL;
+    }
+
+    PadObj *obj = decode(fargs, text, strlen(text));
+    free(text);
+    return obj;
+}
+
+/**
+ * encode object to file
+ * output is written through sink while traversing containers
+ *
+ *     f = open("data.json", "w")
+ *     json.dump(data, f)
+ */
+static PadObj *
+builtin_json_dump(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 2 || PadObjAry_Len(args) > 3) {
+        push_err("can't invoke json.dump(). need two or three arguments");
+        return NULL;
+    }
+
+    int32_t indent;
+    if (!pull_indent(fargs, "dump", 2, &indent)) {
+        return NULL;
+    }
+
+    FILE *fp = pull_fp(fargs, "dump", 1);
+    if (!fp) {
+        return NULL;
+    }
+
+    PadSink *sink = PadSink_NewFile(fp);
+    if (!sink) {
+        push_err("failed to allocate sink");
+        return NULL;
+    }
+
+    char err[ERR_SIZE];
+    bool ok = PadJson_EncodeToSink(sink, PadObjAry_Get(args, 0), indent, err, sizeof err) &&
+              PadSink_Flush(sink);
+    PadSink_Del(sink);
+    if (!ok) {
+        push_err("failed to encode json. %s", err[0] ? err : "failed to write");
+        return NULL;
+    }
+
+    return PadObj_NewNil(fargs->ref_ast->ref_gc);
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"decode", builtin_json_decode},
+    {"encode", builtin_json_encode},
+    {"load", builtin_json_load},
+    {"dump", builtin_json_dump},
+    {0},
+};
+
+PadObj *
+Pad_NewBltJsonMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "json",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(info_ary)
+    );
+}
@@ -0,0 +1,360 @@
+#include <pad/lang/builtin/modules/num_array.h>
+#include <pad/lang/operator.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+/**
+ * pull numeric array object of owner of method
+ *
+ * @return success to pointer to numeric array object
+ * @return failed to NULL
+ */
+static PadObj *
+pull_numarray(PadBltFuncArgs *fargs) {
+    PadObjAry *owns = fargs->ref_owners;
+    if (!owns) {
+        push_err("owners is null");
+        return NULL;
+    }
+
+    PadObj *own_met = PadObjAry_GetLast(owns);
+    if (own_met->type != PAD_OBJ_TYPE__OWNERS_METHOD) {
+        push_err("owner is owner's method");
+        return NULL;
+    }
+
+    PadObj *own = Pad_ExtractIdent(own_met->owners_method.owner);
+    if (!own || own->type != PAD_OBJ_TYPE__NUMARRAY) {
+        push_err("owner is not a numeric array");
+        return NULL;
+    }
+
+    return own;
+}
+
+static PadObj *
+new_num_obj(PadGC *ref_gc, PadNumVal val) {
+    if (val.kind == PAD_NUM_ARY_KIND__INT) {
+        return PadObj_NewInt(ref_gc, val.ivalue);
+    }
+    return PadObj_NewFloat(ref_gc, val.fvalue);
+}
+
+static PadObj *
+builtin_numarray_sum(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    return new_num_obj(fargs->ref_ast->ref_gc, PadNumAry_Sum(own->numarr));
+}
+
+static PadObj *
+builtin_numarray_min(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadNumVal val;
+    if (!PadNumAry_Min(own->numarr, &val)) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+    return new_num_obj(fargs->ref_ast->ref_gc, val);
+}
+
+static PadObj *
+builtin_numarray_max(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadNumVal val;
+    if (!PadNumAry_Max(own->numarr, &val)) {
+        return PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+    return new_num_obj(fargs->ref_ast->ref_gc, val);
+}
+
+/**
+ * dot product of 1-D arrays or matrix product of 2-D array
+ *
+ *     a.dot(b)
+ */
+static PadObj *
+builtin_numarray_dot(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke numarray.dot. need one argument");
+        return NULL;
+    }
+
+    PadObj *other = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+    if (!other || other->type != PAD_OBJ_TYPE__NUMARRAY) {
+        push_err("can't invoke numarray.dot. argument is not numeric array");
+        return NULL;
+    }
+
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    if (PadNumAry_GetNDim(own->numarr) == 1) {
+        PadNumVal val;
+        if (!PadNumAry_Dot(own->numarr, other->numarr, &val)) {
+            push_err("can't invoke numarray.dot. shapes are not aligned");
+            return NULL;
+        }
+        return new_num_obj(ref_gc, val);
+    }
+
+    PadNumAry *result = PadNumAry_MatMul(own->numarr, other->numarr);
+    if (!result) {
+        push_err("can't invoke numarray.dot. shapes are not aligned");
+        return NULL;
+    }
+    return PadObj_NewNumAry(ref_gc, PadMem_Move(result));
+}
+
+/**
+ * transpose of 2-D array. the result shares elements with the array
+ */
+static PadObj *
+builtin_numarray_transpose(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadNumAry *result = PadNumAry_Transpose(own->numarr);
+    if (!result) {
+        push_err("failed to transpose numeric array");
+        return NULL;
+    }
+    return PadObj_NewNumAry(fargs->ref_ast->ref_gc, PadMem_Move(result));
+}
+
+/**
+ * rotate 2-D array by quarter turns clockwise (default 1)
+ *
+ *     m.rotate()
+ *     m.rotate(-1)
+ */
+static PadObj *
+builtin_numarray_rotate(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadObjAry *args = fargs->ref_args->objarr;
+    PadIntObj n = 1;
+    if (PadObjAry_Len(args) > 1) {
+        push_err("can't invoke numarray.rotate. too many arguments");
+        return NULL;
+    } else if (PadObjAry_Len(args) == 1) {
+        PadObj *arg = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+        if (!arg || arg->type != PAD_OBJ_TYPE__INT) {
+            push_err("can't invoke numarray.rotate. argument is not integer");
+            return NULL;
+        }
+        n = arg->lvalue % 4;
+    }
+
+    if (PadNumAry_GetNDim(own->numarr) != 2) {
+        push_err("can't rotate 1-D numeric array");
+        return NULL;
+    }
+
+    PadNumAry *result = PadNumAry_Rotate(own->numarr, n);
+    if (!result) {
+        push_err("failed to rotate numeric array");
+        return NULL;
+    }
+    return PadObj_NewNumAry(fargs->ref_ast->ref_gc, PadMem_Move(result));
+}
+
+/**
+ * get shape as array. [len] or [rows, cols]
+ */
+static PadObj *
+builtin_numarray_shape(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    PadObjAry *shape = PadObjAry_New();
+    PadObjAry_MoveBack(shape, PadObj_NewInt(ref_gc, PadNumAry_Len(own->numarr)));
+    if (PadNumAry_GetNDim(own->numarr) == 2) {
+        PadObjAry_MoveBack(shape, PadObj_NewInt(ref_gc, PadNumAry_Cols(own->numarr)));
+    }
+
+    return PadObj_NewAry(ref_gc, PadMem_Move(shape));
+}
+
+/**
+ * convert to array of numbers (or array of rows)
+ */
+static PadObj *
+builtin_numarray_to_array(PadBltFuncArgs *fargs) {
+    PadObj *own = pull_numarray(fargs);
+    if (!own) {
+        return NULL;
+    }
+
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    const PadNumAry *numarr = own->numarr;
+    bool is_2d = PadNumAry_GetNDim(numarr) == 2;
+    PadObjAry *rows = PadObjAry_New();
+
+    for (int32_t y = 0; y < PadNumAry_Len(numarr); y++) {
+        if (!is_2d) {
+            PadObjAry_MoveBack(rows, new_num_obj(ref_gc, PadNumAry_Get(numarr, y)));
+            continue;
+        }
+        PadObjAry *row = PadObjAry_New();
+        for (int32_t x = 0; x < PadNumAry_Cols(numarr); x++) {
+            PadObjAry_MoveBack(row, new_num_obj(ref_gc, PadNumAry_Get2D(numarr, y, x)));
+        }
+        PadObjAry_MoveBack(rows, PadObj_NewAry(ref_gc, PadMem_Move(row)));
+    }
+
+    return PadObj_NewAry(ref_gc, PadMem_Move(rows));
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"sum", builtin_numarray_sum},
+    {"min", builtin_numarray_min},
+    {"max", builtin_numarray_max},
+    {"dot", builtin_numarray_dot},
+    {"transpose", builtin_numarray_transpose},
+    {"rotate", builtin_numarray_rotate},
+    {"shape", builtin_numarray_shape},
+    {"to_array", builtin_numarray_to_array},
+    {0},
+};
+
+/************
+* operators *
+************/
+
+#undef push_err
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(err, ref_node, fmt, ##__VA_ARGS__)
+
+static PadNumVal
+num_val_of(const PadObj *obj) {
+    switch (obj->type) {
+    default:
+        return (PadNumVal) { .kind = PAD_NUM_ARY_KIND__INT, .ivalue = obj->lvalue };
+        break;
+    case PAD_OBJ_TYPE__FLOAT:
+        return (PadNumVal) { .kind = PAD_NUM_ARY_KIND__FLOAT, .fvalue = obj->float_value };
+        break;
+    }
+}
+
+/**
+ * kernel of elementwise operator. one of operands is numeric array and
+ * other is numeric array or int or float
+ */
+static PadObj *
+calc_numarray(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *lhs,
+    PadObj *rhs,
+    PadNumOp op
+) {
+    PadNumAry *result;
+
+    if (lhs->type == PAD_OBJ_TYPE__NUMARRAY && rhs->type == PAD_OBJ_TYPE__NUMARRAY) {
+        if (!PadNumAry_IsSameShape(lhs->numarr, rhs->numarr)) {
+            push_err("can't calculate numeric arrays of different shapes");
+            return NULL;
+        }
+        result = PadNumAry_Calc(lhs->numarr, op, rhs->numarr);
+    } else if (lhs->type == PAD_OBJ_TYPE__NUMARRAY) {
+        result = PadNumAry_CalcScalar(lhs->numarr, op, num_val_of(rhs), false);
+    } else {
+        result = PadNumAry_CalcScalar(rhs->numarr, op, num_val_of(lhs), true);
+    }
+
+    if (!result) {
+        push_err("zero division error");
+        return NULL;
+    }
+    return PadObj_NewNumAry(ref_gc, PadMem_Move(result));
+}
+
+#define DEF_NUMARRAY_KERNEL(name, op) \
+    static PadObj * \
+    name(PadErrStack *err, const PadNode *ref_node, PadGC *ref_gc, PadObj *lhs, PadObj *rhs) { \
+        return calc_numarray(err, ref_node, ref_gc, lhs, rhs, op); \
+    }
+
+DEF_NUMARRAY_KERNEL(add_numarray, PAD_NUM_OP__ADD)
+DEF_NUMARRAY_KERNEL(sub_numarray, PAD_NUM_OP__SUB)
+DEF_NUMARRAY_KERNEL(mul_numarray, PAD_NUM_OP__MUL)
+DEF_NUMARRAY_KERNEL(div_numarray, PAD_NUM_OP__DIV)
+
+/**
+ * register kernels of + - * / for pairs of numeric array and number
+ */
+static void
+register_op_kernels(void) {
+    static const struct {
+        op_t op;
+        PadOpKernel kernel;
+    } ops[] = {
+        {PAD_OP__ADD, add_numarray},
+        {PAD_OP__SUB, sub_numarray},
+        {PAD_OP__MUL, mul_numarray},
+        {PAD_OP__DIV, div_numarray},
+    };
+    static const PadObjType nums[] = {
+        PAD_OBJ_TYPE__NUMARRAY,
+        PAD_OBJ_TYPE__INT,
+        PAD_OBJ_TYPE__FLOAT,
+    };
+
+    for (int32_t i = 0; i < (int32_t) (sizeof ops / sizeof ops[0]); i++) {
+        for (int32_t j = 0; j < (int32_t) (sizeof nums / sizeof nums[0]); j++) {
+            PadOp_Register(ops[i].op, PAD_OBJ_TYPE__NUMARRAY, nums[j], ops[i].kernel);
+            PadOp_Register(ops[i].op, nums[j], PAD_OBJ_TYPE__NUMARRAY, ops[i].kernel);
+        }
+    }
+}
+
+PadObj *
+Pad_NewBltNumAryMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *func_info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(func_info_ary, builtin_func_infos);
+
+    register_op_kernels();
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "__numarray__",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(func_info_ary)
+    );
+}
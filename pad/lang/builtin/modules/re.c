@@ -0,0 +1,929 @@
+#include <pad/lang/builtin/modules/re.h>
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(fargs->ref_ast->error_stack, fargs->ref_node, fmt, ##__VA_ARGS__)
+
+enum {
+    ERR_SIZE = 512,
+};
+
+/**********
+* helpers *
+**********/
+
+/**
+ * get flags of compile from letters of string at index
+ *
+ *     "i" ignore case
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+pull_flags(PadBltFuncArgs *fargs, const char *funcname, int32_t index, int32_t *flags) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    *flags = 0;
+    if (PadObjAry_Len(args) <= index) {
+        return true;
+    }
+
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("can't invoke %s. flags is not string", funcname);
+        return false;
+    }
+
+    for (const PadUniType *p = PadUni_Getc(obj->unicode); *p; p++) {
+        switch (*p) {
+        case 'i': *flags |= PAD_REGEX__IGNORE_CASE; break;
+        default:
+            push_err("can't invoke %s. invalid flags", funcname);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * get optional count at index. 0 is unlimited
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+pull_count(PadBltFuncArgs *fargs, const char *funcname, int32_t index, int32_t *count) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    *count = 0;
+    if (PadObjAry_Len(args) <= index) {
+        return true;
+    }
+
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__INT || obj->lvalue < 0 || obj->lvalue > INT32_MAX) {
+        push_err("can't invoke %s. invalid count", funcname);
+        return false;
+    }
+
+    *count = obj->lvalue;
+    return true;
+}
+
+/**
+ * get string of argument at index
+ *
+ * @return success to pointer to PadUni
+ * @return failed to NULL
+ */
+static PadUni *
+pull_text(PadBltFuncArgs *fargs, const char *funcname, int32_t index) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("can't invoke %s. argument is not string", funcname);
+        return NULL;
+    }
+    return obj->unicode;
+}
+
+static PadRegex *
+compile(PadBltFuncArgs *fargs, const PadUni *pattern, int32_t flags) {
+    char err[ERR_SIZE];
+    PadRegex *regex = PadRegex_New(PadUni_Getc(pattern), PadUni_Len(pattern), flags, err, sizeof err);
+    if (!regex) {
+        push_err("failed to compile pattern. %s", err);
+        return NULL;
+    }
+    return regex;
+}
+
+/**
+ * get regex of argument at index. if the argument is string then it is
+ * compiled and *owned is true (the caller deletes the regex)
+ *
+ * @return success to pointer to PadRegex
+ * @return failed to NULL
+ */
+static PadRegex *
+pull_regex(PadBltFuncArgs *fargs, const char *funcname, int32_t index, bool *owned) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    *owned = false;
+
+    PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (obj && obj->type == PAD_OBJ_TYPE__REGEX) {
+        return obj->regex;
+    }
+    if (!obj || obj->type != PAD_OBJ_TYPE__UNICODE) {
+        push_err("can't invoke %s. pattern is not string or regex", funcname);
+        return NULL;
+    }
+
+    PadRegex *regex = compile(fargs, obj->unicode, 0);
+    *owned = regex != NULL;
+    return regex;
+}
+
+/**
+ * pull regex object of owner of method
+ *
+ * @return success to pointer to PadRegex
+ * @return failed to NULL
+ */
+static PadRegex *
+pull_owner(PadBltFuncArgs *fargs) {
+    PadObjAry *owns = fargs->ref_owners;
+    if (!owns) {
+        push_err("owners is null");
+        return NULL;
+    }
+
+    PadObj *own_met = PadObjAry_GetLast(owns);
+    if (own_met->type != PAD_OBJ_TYPE__OWNERS_METHOD) {
+        push_err("owner is owner's method");
+        return NULL;
+    }
+
+    PadObj *own = Pad_ExtractIdent(own_met->owners_method.owner);
+    if (!own || own->type != PAD_OBJ_TYPE__REGEX) {
+        push_err("owner is not a regex");
+        return NULL;
+    }
+
+    return own->regex;
+}
+
+static int32_t *
+new_caps(PadBltFuncArgs *fargs, const PadRegex *regex) {
+    int32_t *caps = PadMem_Calloc((PadRegex_GetNGroups(regex) + 1) * 2, sizeof(int32_t));
+    if (!caps) {
+        push_err("failed to allocate captures");
+    }
+    return caps;
+}
+
+/**
+ * find next match from *pos and move *pos to end of it
+ * after empty match *pos moves one more character, so the next match
+ * can be adjacent to the previous match but not at the same position
+ */
+static bool
+next_match(PadRegex *regex, const PadUni *text, int32_t *pos, int32_t *caps) {
+    int32_t len = PadUni_Len(text);
+    if (*pos > len || !PadRegex_Search(regex, PadUni_Getc(text), len, *pos, false, caps)) {
+        return false;
+    }
+    *pos = caps[1] > caps[0] ? caps[1] : caps[1] + 1;
+    return true;
+}
+
+static PadObj *
+new_substr(PadGC *ref_gc, const PadUni *text, int32_t begin, int32_t end) {
+    PadUni *u = PadUni_New();
+    if (!u || !PadUni_AppN(u, PadUni_Getc(text) + begin, end - begin)) {
+        PadUni_Del(u);
+        return NULL;
+    }
+    return PadObj_NewUnicode(ref_gc, PadMem_Move(u));
+}
+
+/**
+ * make string of group. if the group did not participate in the match
+ * then it is nil or empty string
+ */
+static PadObj *
+new_group(PadGC *ref_gc, const PadUni *text, const int32_t *caps, int32_t group, bool nil) {
+    int32_t begin = caps[group * 2];
+    int32_t end = caps[group * 2 + 1];
+    if (begin < 0 || end < 0) {
+        return nil ? PadObj_NewNil(ref_gc) : PadObj_NewUnicodeCStr(ref_gc, "");
+    }
+    return new_substr(ref_gc, text, begin, end);
+}
+
+static bool
+move_back(PadObjAry *arr, PadObj *obj) {
+    if (!obj) {
+        return false;
+    }
+    if (!PadObjAry_MoveBack(arr, obj)) {
+        PadObj_Del(obj);
+        return false;
+    }
+    return true;
+}
+
+static bool
+move_to(PadObjDict *dict, const char *key, PadObj *obj) {
+    if (!obj) {
+        return false;
+    }
+    if (!PadObjDict_Move(dict, key, obj)) {
+        PadObj_Del(obj);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * make dict of match
+ *
+ *     {"groups": [whole, group1, ...], "spans": [[0, 3], ...], "start": 0, "stop": 3}
+ *
+ * groups which did not participate in the match are nil and spans of them
+ * are [-1, -1]. stop is end of whole match (not included) like range,
+ * because end is keyword and m.end can't be written
+ */
+static PadObj *
+new_match(PadBltFuncArgs *fargs, const PadRegex *regex, const PadUni *text, const int32_t *caps) {
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    PadObjAry *groups = PadObjAry_New();
+    PadObjAry *spans = PadObjAry_New();
+    PadObjDict *dict = PadObjDict_New(ref_gc);
+    if (!groups || !spans || !dict) {
+        goto failed;
+    }
+
+    for (int32_t g = 0; g <= PadRegex_GetNGroups(regex); g++) {
+        PadObjAry *span = PadObjAry_New();
+        if (!span) {
+            goto failed;
+        }
+        if (!move_back(span, PadObj_NewInt(ref_gc, caps[g * 2])) ||
+            !move_back(span, PadObj_NewInt(ref_gc, caps[g * 2 + 1]))) {
+            PadObjAry_Del(span);
+            goto failed;
+        }
+        PadObj *spanobj = PadObj_NewAry(ref_gc, span);
+        if (!spanobj) {
+            PadObjAry_Del(span);
+            goto failed;
+        }
+        if (!move_back(spans, spanobj) ||
+            !move_back(groups, new_group(ref_gc, text, caps, g, true))) {
+            goto failed;
+        }
+    }
+
+    PadObj *groupsobj = PadObj_NewAry(ref_gc, groups);
+    if (!groupsobj) {
+        goto failed;
+    }
+    groups = NULL;
+    if (!move_to(dict, "groups", groupsobj)) {
+        goto failed;
+    }
+    PadObj *spansobj = PadObj_NewAry(ref_gc, spans);
+    if (!spansobj) {
+        goto failed;
+    }
+    spans = NULL;
+    if (!move_to(dict, "spans", spansobj) ||
+        !move_to(dict, "start", PadObj_NewInt(ref_gc, caps[0])) ||
+        !move_to(dict, "stop", PadObj_NewInt(ref_gc, caps[1]))) {
+        goto failed;
+    }
+
+    return PadObj_NewDict(ref_gc, PadMem_Move(dict));
+
+failed:
+    push_err("failed to make match");
+    PadObjAry_Del(groups);
+    PadObjAry_Del(spans);
+    PadObjDict_Del(dict);
+    return NULL;
+}
+
+/*************
+* operations *
+*************/
+
+static PadObj *
+do_search(PadBltFuncArgs *fargs, PadRegex *regex, const PadUni *text, int32_t pos, bool anchored) {
+    int32_t *caps = new_caps(fargs, regex);
+    if (!caps) {
+        return NULL;
+    }
+
+    PadObj *ret;
+    int32_t len = PadUni_Len(text);
+    if (pos <= len && PadRegex_Search(regex, PadUni_Getc(text), len, pos, anchored, caps)) {
+        ret = new_match(fargs, regex, text, caps);
+    } else {
+        ret = PadObj_NewNil(fargs->ref_ast->ref_gc);
+    }
+
+    free(caps);
+    return ret;
+}
+
+/**
+ * all matches as array. elements are whole matches if pattern has no
+ * groups, strings of group if it has one group, else arrays of groups
+ */
+static PadObj *
+do_findall(PadBltFuncArgs *fargs, PadRegex *regex, const PadUni *text) {
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    int32_t ngroups = PadRegex_GetNGroups(regex);
+    int32_t *caps = new_caps(fargs, regex);
+    PadObjAry *arr = PadObjAry_New();
+    if (!caps || !arr) {
+        goto failed;
+    }
+
+    int32_t pos = 0;
+    while (next_match(regex, text, &pos, caps)) {
+        if (ngroups <= 1) {
+            if (!move_back(arr, new_group(ref_gc, text, caps, ngroups, false))) {
+                goto failed;
+            }
+            continue;
+        }
+
+        PadObjAry *groups = PadObjAry_New();
+        if (!groups) {
+            goto failed;
+        }
+        for (int32_t g = 1; g <= ngroups; g++) {
+            if (!move_back(groups, new_group(ref_gc, text, caps, g, false))) {
+                PadObjAry_Del(groups);
+                goto failed;
+            }
+        }
+        PadObj *groupsobj = PadObj_NewAry(ref_gc, groups);
+        if (!groupsobj) {
+            PadObjAry_Del(groups);
+            goto failed;
+        }
+        if (!move_back(arr, groupsobj)) {
+            goto failed;
+        }
+    }
+
+    free(caps);
+    return PadObj_NewAry(ref_gc, PadMem_Move(arr));
+
+failed:
+    push_err("failed to find all");
+    free(caps);
+    PadObjAry_Del(arr);
+    return NULL;
+}
+
+/**
+ * split string by matches. groups of matches are put between pieces
+ * empty matches do not split
+ */
+static PadObj *
+do_split(PadBltFuncArgs *fargs, PadRegex *regex, const PadUni *text, int32_t maxsplit) {
+    PadGC *ref_gc = fargs->ref_ast->ref_gc;
+    int32_t ngroups = PadRegex_GetNGroups(regex);
+    int32_t *caps = new_caps(fargs, regex);
+    PadObjAry *arr = PadObjAry_New();
+    if (!caps || !arr) {
+        goto failed;
+    }
+
+    int32_t pos = 0;
+    int32_t last = 0;
+    int32_t nsplits = 0;
+    while ((maxsplit == 0 || nsplits < maxsplit) && next_match(regex, text, &pos, caps)) {
+        if (caps[0] == caps[1]) {
+            continue;
+        }
+        if (!move_back(arr, new_substr(ref_gc, text, last, caps[0]))) {
+            goto failed;
+        }
+        for (int32_t g = 1; g <= ngroups; g++) {
+            if (!move_back(arr, new_group(ref_gc, text, caps, g, true))) {
+                goto failed;
+            }
+        }
+        last = caps[1];
+        nsplits++;
+    }
+    if (!move_back(arr, new_substr(ref_gc, text, last, PadUni_Len(text)))) {
+        goto failed;
+    }
+
+    free(caps);
+    return PadObj_NewAry(ref_gc, PadMem_Move(arr));
+
+failed:
+    push_err("failed to split");
+    free(caps);
+    PadObjAry_Del(arr);
+    return NULL;
+}
+
+/**
+ * append replacement. \0 to \9 are groups and \\ is backslash
+ */
+static bool
+app_repl(PadUni *dst, const PadUni *repl, const PadUni *text, const int32_t *caps) {
+    const PadUniType *r = PadUni_Getc(repl);
+    int32_t len = PadUni_Len(repl);
+    int32_t last = 0;
+    for (int32_t i = 0; i < len; i++) {
+        if (r[i] != '\\' || i + 1 >= len) {
+            continue;
+        }
+
+        PadUniType c = r[i + 1];
+        if (c != '\\' && (c < '0' || c > '9')) {
+            continue;
+        }
+        if (!PadUni_AppN(dst, r + last, i - last)) {
+            return false;
+        }
+        if (c == '\\') {
+            if (!PadUni_AppN(dst, r + i + 1, 1)) {
+                return false;
+            }
+        } else {
+            int32_t g = c - '0';
+            int32_t begin = caps[g * 2];
+            int32_t end = caps[g * 2 + 1];
+            if (begin >= 0 && end >= 0 &&
+                !PadUni_AppN(dst, PadUni_Getc(text) + begin, end - begin)) {
+                return false;
+            }
+        }
+        last = i + 2;
+        i++;
+    }
+
+    return PadUni_AppN(dst, r + last, len - last);
+}
+
+/**
+ * replace matches by repl. count 0 replaces all
+ */
+static PadObj *
+do_sub(PadBltFuncArgs *fargs, const char *funcname, PadRegex *regex, const PadUni *repl, const PadUni *text, int32_t count) {
+    int32_t ngroups = PadRegex_GetNGroups(regex);
+    const PadUniType *r = PadUni_Getc(repl);
+    for (int32_t i = 0; r[i]; i++) {
+        if (r[i] == '\\' && r[i + 1] >= '0' && r[i + 1] <= '9') {
+            if (r[i + 1] - '0' > ngroups) {
+                push_err("can't invoke %s. invalid group reference %d", funcname, (int) (r[i + 1] - '0'));
+                return NULL;
+            }
+            i++;
+        } else if (r[i] == '\\' && r[i + 1] == '\\') {
+            i++;
+        }
+    }
+
+    int32_t *caps = new_caps(fargs, regex);
+    PadUni *out = PadUni_New();
+    if (!caps || !out) {
+        goto failed;
+    }
+
+    const PadUniType *s = PadUni_Getc(text);
+    int32_t pos = 0;
+    int32_t last = 0;
+    int32_t n = 0;
+    while ((count == 0 || n < count) && next_match(regex, text, &pos, caps)) {
+        if (!PadUni_AppN(out, s + last, caps[0] - last) ||
+            !app_repl(out, repl, text, caps)) {
+            goto failed;
+        }
+        last = caps[1];
+        n++;
+    }
+    if (!PadUni_AppN(out, s + last, PadUni_Len(text) - last)) {
+        goto failed;
+    }
+
+    free(caps);
+    return PadObj_NewUnicode(fargs->ref_ast->ref_gc, PadMem_Move(out));
+
+failed:
+    push_err("failed to substitute");
+    free(caps);
+    PadUni_Del(out);
+    return NULL;
+}
+
+/************
+* re module *
+************/
+
+/**
+ * compile pattern to regex object. the object keeps cache of matching,
+ * so compile patterns which are used many times
+ *
+ *     r = re.compile("[a-z]+", "i")
+ */
+static PadObj *
+builtin_re_compile(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 1 || PadObjAry_Len(args) > 2) {
+        push_err("can't invoke re.compile(). need one or two arguments");
+        return NULL;
+    }
+
+    int32_t flags;
+    PadUni *pattern = pull_text(fargs, "re.compile()", 0);
+    if (!pattern || !pull_flags(fargs, "re.compile()", 1, &flags)) {
+        return NULL;
+    }
+
+    PadRegex *regex = compile(fargs, pattern, flags);
+    if (!regex) {
+        return NULL;
+    }
+
+    return PadObj_NewRegex(fargs->ref_ast->ref_gc, PadMem_Move(regex));
+}
+
+static PadObj *
+call_search(PadBltFuncArgs *fargs, const char *funcname, bool anchored) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 2) {
+        push_err("can't invoke %s. need two arguments", funcname);
+        return NULL;
+    }
+
+    PadUni *text = pull_text(fargs, funcname, 1);
+    if (!text) {
+        return NULL;
+    }
+    bool owned;
+    PadRegex *regex = pull_regex(fargs, funcname, 0, &owned);
+    if (!regex) {
+        return NULL;
+    }
+
+    PadObj *ret = do_search(fargs, regex, text, 0, anchored);
+    if (owned) {
+        PadRegex_Del(regex);
+    }
+    return ret;
+}
+
+/**
+ * match pattern at beginning of string
+ *
+ *     m = re.match("(\\w+)=(\\d+)", "a=1")
+ *     m["groups"][1]  // "a"
+ */
+static PadObj *
+builtin_re_match(PadBltFuncArgs *fargs) {
+    return call_search(fargs, "re.match()", true);
+}
+
+/**
+ * search first match in string
+ *
+ *     m = re.search("\\d+", "abc 123")
+ *     m["start"]  // 4
+ */
+static PadObj *
+builtin_re_search(PadBltFuncArgs *fargs) {
+    return call_search(fargs, "re.search()", false);
+}
+
+/**
+ * find all matches
+ *
+ *     re.findall("\\d+", "1 22 333")  // ["1", "22", "333"]
+ */
+static PadObj *
+builtin_re_findall(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 2) {
+        push_err("can't invoke re.findall(). need two arguments");
+        return NULL;
+    }
+
+    PadUni *text = pull_text(fargs, "re.findall()", 1);
+    if (!text) {
+        return NULL;
+    }
+    bool owned;
+    PadRegex *regex = pull_regex(fargs, "re.findall()", 0, &owned);
+    if (!regex) {
+        return NULL;
+    }
+
+    PadObj *ret = do_findall(fargs, regex, text);
+    if (owned) {
+        PadRegex_Del(regex);
+    }
+    return ret;
+}
+
+/**
+ * split string by pattern
+ *
+ *     re.split(",\\s*", "a, b,c")  // ["a", "b", "c"]
+ */
+static PadObj *
+builtin_re_split(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 2 || PadObjAry_Len(args) > 3) {
+        push_err("can't invoke re.split(). need two or three arguments");
+        return NULL;
+    }
+
+    int32_t maxsplit;
+    PadUni *text = pull_text(fargs, "re.split()", 1);
+    if (!text || !pull_count(fargs, "re.split()", 2, &maxsplit)) {
+        return NULL;
+    }
+    bool owned;
+    PadRegex *regex = pull_regex(fargs, "re.split()", 0, &owned);
+    if (!regex) {
+        return NULL;
+    }
+
+    PadObj *ret = do_split(fargs, regex, text, maxsplit);
+    if (owned) {
+        PadRegex_Del(regex);
+    }
+    return ret;
+}
+
+/**
+ * replace matches
+ *
+ *     re.sub("(\\w+)@(\\w+)", "\\2 at \\1", "me@home")  // "home at me"
+ */
+static PadObj *
+builtin_re_sub(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 3 || PadObjAry_Len(args) > 4) {
+        push_err("can't invoke re.sub(). need three or four arguments");
+        return NULL;
+    }
+
+    int32_t count;
+    PadUni *repl = pull_text(fargs, "re.sub()", 1);
+    PadUni *text = repl ? pull_text(fargs, "re.sub()", 2) : NULL;
+    if (!text || !pull_count(fargs, "re.sub()", 3, &count)) {
+        return NULL;
+    }
+    bool owned;
+    PadRegex *regex = pull_regex(fargs, "re.sub()", 0, &owned);
+    if (!regex) {
+        return NULL;
+    }
+
+    PadObj *ret = do_sub(fargs, "re.sub()", regex, repl, text, count);
+    if (owned) {
+        PadRegex_Del(regex);
+    }
+    return ret;
+}
+
+/**
+ * escape special characters of pattern
+ *
+ *     re.escape("1+1")  // "1\\+1"
+ */
+static PadObj *
+builtin_re_escape(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke re.escape(). need one argument");
+        return NULL;
+    }
+
+    PadUni *text = pull_text(fargs, "re.escape()", 0);
+    if (!text) {
+        return NULL;
+    }
+
+    PadUni *out = PadUni_New();
+    if (!out) {
+        push_err("failed to allocate string");
+        return NULL;
+    }
+
+    static const PadUniType backslash = '\\';
+    const PadUniType *s = PadUni_Getc(text);
+    for (int32_t i = 0; i < PadUni_Len(text); i++) {
+        bool special = s[i] && s[i] < 128 && strchr(".^$*+?{}[]\\|()-", s[i]);
+        if ((special && !PadUni_AppN(out, &backslash, 1)) ||
+            !PadUni_AppN(out, s + i, 1)) {
+            push_err("failed to escape");
+            PadUni_Del(out);
+            return NULL;
+        }
+    }
+
+    return PadObj_NewUnicode(fargs->ref_ast->ref_gc, PadMem_Move(out));
+}
+
+static PadBltFuncInfo
+builtin_func_infos[] = {
+    {"compile", builtin_re_compile},
+    {"match", builtin_re_match},
+    {"search", builtin_re_search},
+    {"findall", builtin_re_findall},
+    {"split", builtin_re_split},
+    {"sub", builtin_re_sub},
+    {"escape", builtin_re_escape},
+    {0},
+};
+
+PadObj *
+Pad_NewBltReMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(info_ary, builtin_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "re",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(info_ary)
+    );
+}
+
+/***************
+* regex module *
+***************/
+
+static int32_t
+pull_pos(PadBltFuncArgs *fargs, const char *funcname, int32_t index) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) <= index) {
+        return 0;
+    }
+
+    const PadObj *obj = Pad_ExtractIdent(PadObjAry_Get(args, index));
+    if (!obj || obj->type != PAD_OBJ_TYPE__INT || obj->lvalue < 0 || obj->lvalue > INT32_MAX) {
+        push_err("can't invoke %s. invalid position", funcname);
+        return -1;
+    }
+    return obj->lvalue;
+}
+
+static PadObj *
+call_method_search(PadBltFuncArgs *fargs, const char *funcname, bool anchored) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 1 || PadObjAry_Len(args) > 2) {
+        push_err("can't invoke %s. need one or two arguments", funcname);
+        return NULL;
+    }
+
+    PadRegex *regex = pull_owner(fargs);
+    PadUni *text = regex ? pull_text(fargs, funcname, 0) : NULL;
+    if (!text) {
+        return NULL;
+    }
+    int32_t pos = pull_pos(fargs, funcname, 1);
+    if (pos < 0) {
+        return NULL;
+    }
+
+    return do_search(fargs, regex, text, pos, anchored);
+}
+
+/**
+ * match at position (default 0)
+ *
+ *     r.match(s)
+ *     r.match(s, 3)
+ */
+static PadObj *
+builtin_regex_match(PadBltFuncArgs *fargs) {
+    return call_method_search(fargs, "match", true);
+}
+
+/**
+ * search from position (default 0)
+ *
+ *     r.search(s)
+ *     r.search(s, m.stop)
+ */
+static PadObj *
+builtin_regex_search(PadBltFuncArgs *fargs) {
+    return call_method_search(fargs, "search", false);
+}
+
+static PadObj *
+builtin_regex_findall(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) != 1) {
+        push_err("can't invoke findall. need one argument");
+        return NULL;
+    }
+
+    PadRegex *regex = pull_owner(fargs);
+    PadUni *text = regex ? pull_text(fargs, "findall", 0) : NULL;
+    if (!text) {
+        return NULL;
+    }
+
+    return do_findall(fargs, regex, text);
+}
+
+static PadObj *
+builtin_regex_split(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 1 || PadObjAry_Len(args) > 2) {
+        push_err("can't invoke split. need one or two arguments");
+        return NULL;
+    }
+
+    int32_t maxsplit;
+    PadRegex *regex = pull_owner(fargs);
+    PadUni *text = regex ? pull_text(fargs, "split", 0) : NULL;
+    if (!text || !pull_count(fargs, "split", 1, &maxsplit)) {
+        return NULL;
+    }
+
+    return do_split(fargs, regex, text, maxsplit);
+}
+
+static PadObj *
+builtin_regex_sub(PadBltFuncArgs *fargs) {
+    PadObjAry *args = fargs->ref_args->objarr;
+    if (PadObjAry_Len(args) < 2 || PadObjAry_Len(args) > 3) {
+        push_err("can't invoke sub. need two or three arguments");
+        return NULL;
+    }
+
+    int32_t count;
+    PadRegex *regex = pull_owner(fargs);
+    PadUni *repl = regex ? pull_text(fargs, "sub", 0) : NULL;
+    PadUni *text = repl ? pull_text(fargs, "sub", 1) : NULL;
+    if (!text || !pull_count(fargs, "sub", 2, &count)) {
+        return NULL;
+    }
+
+    return do_sub(fargs, "sub", regex, repl, text, count);
+}
+
+static PadObj *
+builtin_regex_pattern(PadBltFuncArgs *fargs) {
+    PadRegex *regex = pull_owner(fargs);
+    if (!regex) {
+        return NULL;
+    }
+
+    PadUni *u = PadUni_New();
+    if (!u || !PadUni_AppN(u, PadRegex_GetcPattern(regex), PadRegex_GetPatternLen(regex))) {
+        push_err("failed to allocate string");
+        PadUni_Del(u);
+        return NULL;
+    }
+
+    return PadObj_NewUnicode(fargs->ref_ast->ref_gc, PadMem_Move(u));
+}
+
+static PadObj *
+builtin_regex_ngroups(PadBltFuncArgs *fargs) {
+    PadRegex *regex = pull_owner(fargs);
+    if (!regex) {
+        return NULL;
+    }
+
+    return PadObj_NewInt(fargs->ref_ast->ref_gc, PadRegex_GetNGroups(regex));
+}
+
+static PadBltFuncInfo
+builtin_regex_func_infos[] = {
+    {"match", builtin_regex_match},
+    {"search", builtin_regex_search},
+    {"findall", builtin_regex_findall},
+    {"split", builtin_regex_split},
+    {"sub", builtin_regex_sub},
+    {"pattern", builtin_regex_pattern},
+    {"ngroups", builtin_regex_ngroups},
+    {0},
+};
+
+PadObj *
+Pad_NewBltRegexMod(const PadConfig *ref_config, PadGC *ref_gc) {
+    PadTkr *tkr = PadTkr_New(PadMem_Move(PadTkrOpt_New()));
+    PadAST *ast = PadAST_New(ref_config);
+    PadCtx *ctx = PadCtx_New(ref_gc, PAD_CTX_TYPE__MODULE);
+    ast->ref_context = ctx;
+
+    PadBltFuncInfoAry *func_info_ary = PadBltFuncInfoAry_New();
+    PadBltFuncInfoAry_ExtendBackAry(func_info_ary, builtin_regex_func_infos);
+
+    return PadObj_NewModBy(
+        ref_gc,
+        "__regex__",
+        NULL,
+        NULL,
+        PadMem_Move(tkr),
+        PadMem_Move(ast),
+        PadMem_Move(ctx),
+        PadMem_Move(func_info_ary)
+    );
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <pad/core/config.h>
+#include <pad/lib/regex.h>
+#include <pad/lang/types.h>
+#include <pad/lang/object.h>
+#include <pad/lang/ast.h>
+#include <pad/lang/gc.h>
+#include <pad/lang/tokenizer.h>
+#include <pad/lang/context.h>
+#include <pad/lang/utils.h>
+#include <pad/lang/arguments.h>
+#include <pad/lang/builtin/func_info.h>
+#include <pad/lang/builtin/func_info_array.h>
+
+/**
+ * construct the built-in re module
+ * pattern of functions is string or regex object of compile
+ *
+ *     re.compile(pattern [, flags])
+ *     re.match(pattern, s)
+ *     re.search(pattern, s)
+ *     re.findall(pattern, s)
+ *     re.split(pattern, s [, maxsplit])
+ *     re.sub(pattern, repl, s [, count])
+ *     re.escape(s)
+ *
+ * @param[in] *ref_config
+ * @param[in] *ref_gc
+ *
+ * @return
+ */
+PadObj *
+Pad_NewBltReMod(const PadConfig *ref_config, PadGC *ref_gc);
+
+/**
+ * construct the built-in regex module (methods of regex object)
+ *
+ *     r = re.compile("(\\w+)=(\\d+)")
+ *     r.match(s [, pos])
+ *     r.search(s [, pos])
+ *     r.findall(s)
+ *     r.split(s [, maxsplit])
+ *     r.sub(repl, s [, count])
+ *     r.pattern()
+ *     r.ngroups()
+ *
+ * @param[in] *ref_config
+ * @param[in] *ref_gc
+ *
+ * @return
+ */
+PadObj *
+Pad_NewBltRegexMod(const PadConfig *ref_config, PadGC *ref_gc);
@@ -291,6 +291,142 @@ builtin_unicode_isspace(PadBltFuncArgs *fargs) {
     return builtin_unicode_is("isspace", fargs);
 }
  
+/**
+ * get arguments of sub strings methods
+ *
+ * @param[in]  *fargs
+ * @param[in]  *method_name
+ * @param[in]  nstrs        number of strings arguments
+ * @param[out] *strs        pointers to strings of arguments
+ * @param[out] *opt_int     optional integer argument after strings (NULL if not allowed)
+ *
+ * @return success to pointer to owner
+ * @return failed to NULL
+ */
+static PadObj *
+extract_sub_args(
+    PadBltFuncArgs *fargs,
+    const char *method_name,
+    int32_t nstrs,
+    const PadUniType *strs[],
+    PadIntObj *opt_int
+) {
+    PadErrStack *err = fargs->ref_ast->error_stack;
+    const PadNode *ref_node = fargs->ref_node;
+    PadObjAry *args = fargs->ref_args->objarr;
+    assert(args);
+
+    int32_t nargs = PadObjAry_Len(args);
+    if (nargs < nstrs || nargs > nstrs + (opt_int ? 1 : 0)) {
+        push_err("invalid arguments length of %s", method_name);
+        return NULL;
+    }
+
+    for (int32_t i = 0; i < nstrs; i++) {
+        const PadObj *arg = PadObjAry_Getc(args, i);
+        if (arg->type != PAD_OBJ_TYPE__UNICODE) {
+            push_err("invalid argument type of %s", method_name);
+            return NULL;
+        }
+        strs[i] = PadUni_Getc(arg->unicode);
+    }
+
+    if (nargs > nstrs) {
+        const PadObj *arg = PadObjAry_Getc(args, nstrs);
+        if (arg->type != PAD_OBJ_TYPE__INT) {
+            push_err("invalid argument type of %s", method_name);
+            return NULL;
+        }
+        *opt_int = arg->lvalue;
+    }
+
+    PadObj *owner = extract_unicode_object(
+        err, ref_node, fargs->ref_ast,
+        fargs->ref_owners, method_name
+    );
+    if (!owner) {
+        push_err("failed to extract unicode object");
+        return NULL;
+    }
+
+    return owner;
+}
+
+static PadObj *
+builtin_unicode_find(PadBltFuncArgs *fargs) {
+    const PadUniType *strs[1];
+    PadIntObj start = 0;
+    PadObj *owner = extract_sub_args(fargs, "find", 1, strs, &start);
+    if (!owner) {
+        return NULL;
+    }
+    if (start < 0 || start > PadUni_Len(owner->unicode)) {
+        return PadObj_NewInt(fargs->ref_ast->ref_gc, -1);
+    }
+
+    int32_t index = PadUni_Find(owner->unicode, strs[0], start);
+    return PadObj_NewInt(fargs->ref_ast->ref_gc, index);
+}
+
+static PadObj *
+builtin_unicode_count(PadBltFuncArgs *fargs) {
+    const PadUniType *strs[1];
+    PadObj *owner = extract_sub_args(fargs, "count", 1, strs, NULL);
+    if (!owner) {
+        return NULL;
+    }
+
+    int32_t n = PadUni_Count(owner->unicode, strs[0]);
+    return PadObj_NewInt(fargs->ref_ast->ref_gc, n);
+}
+
+static PadObj *
+builtin_unicode_replace(PadBltFuncArgs *fargs) {
+    PadErrStack *err = fargs->ref_ast->error_stack;
+    const PadNode *ref_node = fargs->ref_node;
+    const PadUniType *strs[2];
+    PadIntObj count = -1;
+    PadObj *owner = extract_sub_args(fargs, "replace", 2, strs, &count);
+    if (!owner) {
+        return NULL;
+    }
+    if (count > INT32_MAX) {
+        count = -1;
+    }
+
+    PadUni *result = PadUni_Replace(owner->unicode, strs[0], strs[1], count);
+    if (!result) {
+        push_err("failed to replace");
+        return NULL;
+    }
+
+    return PadObj_NewUnicode(fargs->ref_ast->ref_gc, PadMem_Move(result));
+}
+
+static PadObj *
+builtin_unicode_startswith(PadBltFuncArgs *fargs) {
+    const PadUniType *strs[1];
+    PadObj *owner = extract_sub_args(fargs, "startswith", 1, strs, NULL);
+    if (!owner) {
+        return NULL;
+    }
+
+    bool boolean = PadUni_StartsWith(owner->unicode, strs[0]);
+    return PadObj_NewBool(fargs->ref_ast->ref_gc, boolean);
+}
+
+static PadObj *
+builtin_unicode_endswith(PadBltFuncArgs *fargs) {
+    const PadUniType *strs[1];
+    PadObj *owner = extract_sub_args(fargs, "endswith", 1, strs, NULL);
+    if (!owner) {
+        return NULL;
+    }
+
+    bool boolean = PadUni_EndsWith(owner->unicode, strs[0]);
+    return PadObj_NewBool(fargs->ref_ast->ref_gc, boolean);
+}
+
 static PadBltFuncInfo
 builtin_func_infos[] = {
     {"lower", builtin_unicode_lower},
@@ -306,6 +442,11 @@ builtin_func_infos[] = {
     {"isdigit", builtin_unicode_isdigit},
     {"isalpha", builtin_unicode_isalpha},
     {"isspace", builtin_unicode_isspace},
+    {"find", builtin_unicode_find},
+    {"count", builtin_unicode_count},
+    {"replace", builtin_unicode_replace},
+    {"startswith", builtin_unicode_startswith},
+    {"endswith", builtin_unicode_endswith},
     {0},
 };
 
@@ -609,6 +609,26 @@ cc_call_args(PadAST *ast, PadCCArgs *cargs) {
     assert(0 && "impossible");
 }
 
+/**
+ * look ahead 'identifier [ , identifier ] in' of for statement
+ *
+ * @return found to true
+ * @return not found to false
+ */
+static bool
+is_for_in(PadAST *ast) {
+    PadTok **p = ast->ref_ptr;
+    if (!p[0] || p[0]->type != PAD_TOK_TYPE__IDENTIFIER) {
+        return false;
+    }
+    if (p[1] && p[1]->type == PAD_TOK_TYPE__IN) {
+        return true;
+    }
+    return p[1] && p[1]->type == PAD_TOK_TYPE__COMMA &&
+           p[2] && p[2]->type == PAD_TOK_TYPE__IDENTIFIER &&
+           p[3] && p[3]->type == PAD_TOK_TYPE__IN;
+}
+
 static PadNode *
 cc_for_stmt(PadAST *ast, PadCCArgs *cargs) {
     ready();
@@ -625,6 +645,9 @@ cc_for_stmt(PadAST *ast, PadCCArgs *cargs) {
         PadAST_DelNodes(ast, cur->init_formula); \
         PadAST_DelNodes(ast, cur->comp_formula); \
         PadAST_DelNodes(ast, cur->update_formula); \
+        PadAST_DelNodes(ast, cur->iter_key); \
+        PadAST_DelNodes(ast, cur->iter_value); \
+        PadAST_DelNodes(ast, cur->iter_formula); \
         PadNodeAry_Del(cur->contents); \
         free(cur); \
         if (strlen(fmt)) { \
@@ -734,75 +757,115 @@ cc_for_stmt(PadAST *ast, PadCCArgs *cargs) {
             return_cleanup("reached EOF in for statement (6)");
         }
 
-        check("call cc_assign_list");
-        cargs->depth = depth + 1;
-        cur->init_formula = cc_formula(ast, cargs);
-        if (!cur->init_formula) {
-            if (PadAST_HasErrs(ast)) {
-                return_cleanup("");
+        if (is_for_in(ast)) {
+            // for identifier [ , identifier ] in formula : [ (( '@}' blocks '{@' ) | elems) ]* end
+            check("call cc_identifier");
+            cargs->depth = depth + 1;
+            cur->iter_value = cc_identifier(ast, cargs);
+            if (!cur->iter_value) {
+                return_cleanup("syntax error. not found identifier in for statement");
             }
-            return_cleanup("syntax error. not found initialize assign list in for statement");
-        }
 
-        check("skip newlines");
-        cc_skip_newlines(ast);
-        if (is_end(ast)) {
-            return_cleanup("reached EOF in for statement (7)");
-        }
-
-        t = next_tok(ast);
-        if (t->type == PAD_TOK_TYPE__COLON) {
-            prev_tok(ast);
-            // for <comp_formula> : elems end
-            cur->comp_formula = cur->init_formula;
-            cur->init_formula = NULL;
-        } else if (t->type == PAD_TOK_TYPE__SEMICOLON) {
-            check("read semicolon");
-            // for init_formula ; comp_formula ; update_formula : elems end
+            t = next_tok(ast);
+            if (t->type == PAD_TOK_TYPE__COMMA) {
+                check("read comma");
+                cur->iter_key = cur->iter_value;
+                cargs->depth = depth + 1;
+                cur->iter_value = cc_identifier(ast, cargs);
+                if (!cur->iter_value) {
+                    return_cleanup("syntax error. not found identifier in for statement (2)");
+                }
+                t = next_tok(ast);
+            }
+            assert(t->type == PAD_TOK_TYPE__IN);
+            check("read 'in'");
 
             check("skip newlines");
             cc_skip_newlines(ast);
             if (is_end(ast)) {
-                return_cleanup("reached EOF in for statement (8)");
+                return_cleanup("reached EOF in for statement (16)");
             }
 
-            check("call cc_test");
+            check("call cc_formula");
             cargs->depth = depth + 1;
-            cur->comp_formula = cc_formula(ast, cargs);
-            // allow empty
-            if (PadAST_HasErrs(ast)) {
-                return_cleanup("");
+            cur->iter_formula = cc_formula(ast, cargs);
+            if (!cur->iter_formula) {
+                if (PadAST_HasErrs(ast)) {
+                    return_cleanup("");
+                }
+                return_cleanup("syntax error. not found iterable in for statement");
+            }
+        } else {
+            check("call cc_assign_list");
+            cargs->depth = depth + 1;
+            cur->init_formula = cc_formula(ast, cargs);
+            if (!cur->init_formula) {
+                if (PadAST_HasErrs(ast)) {
+                    return_cleanup("");
+                }
+                return_cleanup("syntax error. not found initialize assign list in for statement");
             }
 
             check("skip newlines");
             cc_skip_newlines(ast);
             if (is_end(ast)) {
-                return_cleanup("reached EOF in for statement (9)");
+                return_cleanup("reached EOF in for statement (7)");
             }
 
             t = next_tok(ast);
-            if (t->type != PAD_TOK_TYPE__SEMICOLON) {
-                return_cleanup("syntax error. not found semicolon (2)");
-            }
-            check("read semicolon");
+            if (t->type == PAD_TOK_TYPE__COLON) {
+                prev_tok(ast);
+                // for <comp_formula> : elems end
+                cur->comp_formula = cur->init_formula;
+                cur->init_formula = NULL;
+            } else if (t->type == PAD_TOK_TYPE__SEMICOLON) {
+                check("read semicolon");
+                // for init_formula ; comp_formula ; update_formula : elems end
 
-            check("skip newlines");
-            cc_skip_newlines(ast);
-            if (is_end(ast)) {
-                return_cleanup("reached EOF in for statement (10)");
-            }
+                check("skip newlines");
+                cc_skip_newlines(ast);
+                if (is_end(ast)) {
+                    return_cleanup("reached EOF in for statement (8)");
+                }
 
-            check("call cc_test_list");
-            cargs->depth = depth + 1;
-            cur->update_formula = cc_formula(ast, cargs);
-            // allow empty
-            if (PadAST_HasErrs(ast)) {
-                return_cleanup("");
+                check("call cc_test");
+                cargs->depth = depth + 1;
+                cur->comp_formula = cc_formula(ast, cargs);
+                // allow empty
+                if (PadAST_HasErrs(ast)) {
+                    return_cleanup("");
+                }
+
+                check("skip newlines");
+                cc_skip_newlines(ast);
+                if (is_end(ast)) {
+                    return_cleanup("reached EOF in for statement (9)");
+                }
+
+                t = next_tok(ast);
+                if (t->type != PAD_TOK_TYPE__SEMICOLON) {
+                    return_cleanup("syntax error. not found semicolon (2)");
+                }
+                check("read semicolon");
+
+                check("skip newlines");
+                cc_skip_newlines(ast);
+                if (is_end(ast)) {
+                    return_cleanup("reached EOF in for statement (10)");
+                }
+
+                check("call cc_test_list");
+                cargs->depth = depth + 1;
+                cur->update_formula = cc_formula(ast, cargs);
+                // allow empty
+                if (PadAST_HasErrs(ast)) {
+                    return_cleanup("");
+                }
+            } else {
+                char msg[1024];
+                snprintf(msg, sizeof msg, "syntax error. unsupported token type (%d) in for statement", t->type);
+                return_cleanup(msg);
             }
-        } else {
-            char msg[1024];
-            snprintf(msg, sizeof msg, "syntax error. unsupported token type (%d) in for statement", t->type);
-            return_cleanup(msg);
         }
 
         check("skip newlines");
@@ -3889,6 +3952,7 @@ cc_text_block(PadAST *ast, PadCCArgs *cargs) {
         pushb_error(ast, t, "failed to duplicate");
         return_parse(NULL);
     }
+    cur->text_len = strlen(cur->text);
 
     return_parse(PadNode_New(PAD_NODE_TYPE__TEXT_BLOCK, cur, t));
 }
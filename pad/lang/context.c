@@ -13,6 +13,7 @@ PadCtx_Del(PadCtx *self) {
     }
 
     // do not delete ref_gc (this is reference)
+    PadCtx_ClearTailCall(self);
     PadAliasInfo_Del(self->alinfo);
     PadStr_Del(self->stdout_buf);
     PadStr_Del(self->stderr_buf);
@@ -26,6 +27,7 @@ PadCtx_EscDelGlobalVarmap(PadCtx *self) {
         return NULL;
     }
 
+    PadCtx_ClearTailCall(self);
     PadAliasInfo_Del(self->alinfo);
     PadStr_Del(self->stdout_buf);
     PadStr_Del(self->stderr_buf);
@@ -79,6 +81,7 @@ PadCtx_Clear(PadCtx *self) {
     PadStr_Clear(self->stdout_buf);
     PadStr_Clear(self->stderr_buf);
     PadScope_Clear(self->scope);
+    PadCtx_ClearTailCall(self);
     self->is_use_buf = true;
 }
 
@@ -109,7 +112,9 @@ PadCtx_GetAliasDesc(PadCtx *self, const char *key) {
 
 PadCtx *
 PadCtx_PushBackStdoutBuf(PadCtx *self, const char *str) {
-    if (self->is_use_buf) {
+    if (self->ref_stdout_sink) {
+        PadSink_WriteCStr(self->ref_stdout_sink, str);
+    } else if (self->is_use_buf) {
         PadStr_App(self->stdout_buf, str);
     } else {
         fprintf(stdout, "%s", str);
@@ -117,9 +122,51 @@ PadCtx_PushBackStdoutBuf(PadCtx *self, const char *str) {
     return self;
 }
 
+PadCtx *
+PadCtx_PushBackStdoutStatic(PadCtx *self, const char *str, int32_t len) {
+    if (self->ref_stdout_sink) {
+        PadSink_WriteStatic(self->ref_stdout_sink, str, len);
+    } else if (self->is_use_buf) {
+        PadStr_App(self->stdout_buf, str);
+    } else {
+        fwrite(str, 1, len, stdout);
+    }
+    return self;
+}
+
+static bool
+write_stdout_sink(void *arg, const char *data, int32_t len) {
+    return PadSink_Write(arg, data, len) != NULL;
+}
+
+static bool
+write_stdout_buf(void *arg, const char *data, int32_t len) {
+    return PadStr_AppNStr(arg, data, len) != NULL;
+}
+
+static bool
+write_stdout(void *arg, const char *data, int32_t len) {
+    return fwrite(data, 1, len, stdout) == (size_t) len;
+}
+
+PadCtx *
+PadCtx_PushBackStdoutEscaped(PadCtx *self, const char *str, int32_t len) {
+    bool ok;
+    if (self->ref_stdout_sink) {
+        ok = PadHtml_Escape(str, len, write_stdout_sink, self->ref_stdout_sink);
+    } else if (self->is_use_buf) {
+        ok = PadHtml_Escape(str, len, write_stdout_buf, self->stdout_buf);
+    } else {
+        ok = PadHtml_Escape(str, len, write_stdout, NULL);
+    }
+    return ok ? self : NULL;
+}
+
 PadCtx *
 PadCtx_PushBackStderrBuf(PadCtx *self, const char *str) {
-    if (self->is_use_buf) {
+    if (self->ref_stderr_sink) {
+        PadSink_WriteCStr(self->ref_stderr_sink, str);
+    } else if (self->is_use_buf) {
         PadStr_App(self->stderr_buf, str);
     } else {
         fprintf(stderr, "%s", str);
@@ -203,6 +250,88 @@ PadCtx_SetDoReturn(PadCtx *self, bool do_return) {
     self->do_return = do_return;
 }
 
+void
+PadCtx_SetTailCall(PadCtx *self, PadObj *func_obj, PadObjAry *move_args) {
+    PadCtx_ClearTailCall(self);
+    PadObj_IncRef(func_obj);
+    self->tail_func = func_obj;
+    self->tail_args = PadMem_Move(move_args);
+}
+
+PadObj *
+PadCtx_PopTailCall(PadCtx *self, PadObjAry **out_args) {
+    PadObj *func_obj = self->tail_func;
+    *out_args = self->tail_args;
+    self->tail_func = NULL;
+    self->tail_args = NULL;
+    return func_obj;
+}
+
+void
+PadCtx_ClearTailCall(PadCtx *self) {
+    if (self->tail_func) {
+        PadObj_DecRef(self->tail_func);
+        PadObj_Del(self->tail_func);
+        self->tail_func = NULL;
+    }
+    PadObjAry_Del(self->tail_args);
+    self->tail_args = NULL;
+}
+
+int32_t
+PadCtx_GetFuncCallDepth(const PadCtx *self) {
+    return self->func_call_depth;
+}
+
+void
+PadCtx_SetFuncCallDepth(PadCtx *self, int32_t depth) {
+    self->func_call_depth = depth;
+}
+
+void
+PadCtx_SetNativeStack(PadCtx *self, uintptr_t base, size_t budget) {
+    self->stack_base = base;
+    self->stack_budget = budget;
+}
+
+uintptr_t
+PadCtx_GetStackBase(const PadCtx *self) {
+    return self->stack_base;
+}
+
+size_t
+PadCtx_GetStackBudget(const PadCtx *self) {
+    return self->stack_budget;
+}
+
+void
+PadCtx_SetStdoutSink(PadCtx *self, PadSink *ref_sink) {
+    if (!self) {
+        return;
+    }
+
+    self->ref_stdout_sink = ref_sink;
+}
+
+void
+PadCtx_SetStderrSink(PadCtx *self, PadSink *ref_sink) {
+    if (!self) {
+        return;
+    }
+
+    self->ref_stderr_sink = ref_sink;
+}
+
+void
+PadCtx_FlushSinks(PadCtx *self) {
+    if (!self) {
+        return;
+    }
+
+    PadSink_Flush(self->ref_stdout_sink);
+    PadSink_Flush(self->ref_stderr_sink);
+}
+
 void
 PadCtx_ClearJumpFlags(PadCtx *self) {
     self->do_break = false;
@@ -212,16 +341,19 @@ PadCtx_ClearJumpFlags(PadCtx *self) {
 
 void
 PadCtx_PushBackScope(PadCtx *self) {
-    PadScope *scope = PadScope_New(self->ref_gc);
     if (self->scope) {
-        PadScope_MoveBack(self->scope, scope);
+        PadScope_PushBackFrame(self->scope);
     } else {
-        self->scope = scope;
+        self->scope = PadScope_New(self->ref_gc);
     }
 }
 
 void
 PadCtx_PopBackScope(PadCtx *self) {
+    if (PadScope_PopBackFrame(self->scope)) {
+        return;  // popped frame was pooled for next push
+    }
+
     PadScope *scope = PadScope_PopBack(self->scope);
     PadScope_Del(scope);
     if (scope == self->scope) {
@@ -496,6 +628,9 @@ PadCtx_DeepCopy(const PadCtx *other) {
     self->do_continue = other->do_continue;
     self->do_return = other->do_return;
     self->is_use_buf = other->is_use_buf;
+    self->is_auto_escape = other->is_auto_escape;
+    self->ref_stdout_sink = other->ref_stdout_sink;
+    self->ref_stderr_sink = other->ref_stderr_sink;
 
     return self;
 }
@@ -518,6 +653,9 @@ PadCtx_ShallowCopy(const PadCtx *other) {
     self->do_continue = other->do_continue;
     self->do_return = other->do_return;
     self->is_use_buf = other->is_use_buf;
+    self->is_auto_escape = other->is_auto_escape;
+    self->ref_stdout_sink = other->ref_stdout_sink;
+    self->ref_stderr_sink = other->ref_stderr_sink;
 
     return self;
 }
@@ -561,6 +699,20 @@ PadCtx_GetIsUseBuf(const PadCtx *self) {
     return self->is_use_buf;
 }
 
+void
+PadCtx_SetAutoEscape(PadCtx *self, bool is_auto_escape) {
+    if (!self) {
+        return;
+    }
+
+    self->is_auto_escape = is_auto_escape;
+}
+
+bool
+PadCtx_GetIsAutoEscape(const PadCtx *self) {
+    return self->is_auto_escape;
+}
+
 void
 PadCtx_SetType(PadCtx *self, PadCtxType type) {
     self->type = type;
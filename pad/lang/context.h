@@ -8,6 +8,8 @@
 #include <pad/lib/string.h>
 #include <pad/lib/unicode.h>
 #include <pad/lib/dict.h>
+#include <pad/lib/sink.h>
+#include <pad/lib/html.h>
 #include <pad/core/alias_info.h>
 #include <pad/lang/types.h>
 #include <pad/lang/object_dict.h>
@@ -38,6 +40,11 @@ struct PadCtx {
     PadStr *stdout_buf;  // stdout buffer in context
     PadStr *stderr_buf;  // stderr buffer in context
 
+    // シンクが設定されていれば出力はバッファに保存されずにシンクに書き込まれる
+    // シンクは固定サイズのバッファを持ち、一定量ごとにフラッシュされるので巨大な出力でもメモリは一定
+    PadSink *ref_stdout_sink;  // reference to sink of stdout (DO NOT DELETE)
+    PadSink *ref_stderr_sink;  // reference to sink of stderr (DO NOT DELETE)
+
     // コンテキストはスコープを管理する
     // 関数などのブロックに入るとスコープがプッシュされ、関数のスコープになる
     // 関数から出るとこのスコープがポップされ、スコープから出る
@@ -47,6 +54,19 @@ struct PadCtx {
     bool do_continue;  // if do continue on current context then store
     bool do_return;
     bool is_use_buf;  // if true then context use stdout/stderr buffer
+    bool is_auto_escape;  // if true then outputs of ref block are escaped for HTML
+
+    // 末尾位置の関数呼び出し (return f(...)) は呼び出さずにここに保存される
+    // 実行中の関数の呼び出し元がスコープをポップした後にこれを呼び出す
+    // これによって末尾再帰がネイティブのスタックを消費しなくなる
+    PadObj *tail_func;  // function of pending tail call
+    PadObjAry *tail_args;  // arguments of pending tail call
+
+    // 関数呼び出しの深さは最も前のコンテキスト (ルート) で数える
+    // インポートしたモジュールの関数呼び出しもルートの深さに含まれる
+    int32_t func_call_depth;  // depth of running pad's functions
+    uintptr_t stack_base;  // address of native stack at outermost function call
+    size_t stack_budget;  // usable bytes of native stack under stack_base
 };
 
 /**
@@ -139,6 +159,34 @@ PadCtx_GetAliasDesc(PadCtx *self, const char *key);
 PadCtx *
 PadCtx_PushBackStdoutBuf(PadCtx *self, const char *str);
 
+/**
+ * push back static strings at stdout buffer in context
+ * if context has stdout sink then strings are referenced without copy until
+ * flush of sink. the caller must keep strings alive until PadCtx_FlushSinks
+ *
+ * @param[in] *self pointer to PadCtx
+ * @param[in] *str  pointer to strings
+ * @param[in] len   length of strings
+ *
+ * @return success to pointer to PadCtx
+ * @return failed to pointer to NULL
+ */
+PadCtx *
+PadCtx_PushBackStdoutStatic(PadCtx *self, const char *str, int32_t len);
+
+/**
+ * push back strings escaped for HTML at stdout buffer in context
+ *
+ * @param[in] *self pointer to PadCtx
+ * @param[in] *str  pointer to strings
+ * @param[in] len   length of strings
+ *
+ * @return success to pointer to PadCtx
+ * @return failed to pointer to NULL
+ */
+PadCtx *
+PadCtx_PushBackStdoutEscaped(PadCtx *self, const char *str, int32_t len);
+
 /**
  * push back strings at stdout buffer in context
  *
@@ -261,6 +309,114 @@ PadCtx_GetDoReturn(const PadCtx *self);
 void
 PadCtx_SetDoReturn(PadCtx *self, bool do_return);
 
+/**
+ * set pending tail call
+ * if already set then discard it
+ *
+ * @param[in] *self      pointer to PadCtx
+ * @param[in] *func_obj  pointer to function object (increment reference count)
+ * @param[in] *move_args pointer to PadObjAry of collected arguments (move semantics)
+ */
+void
+PadCtx_SetTailCall(PadCtx *self, PadObj *func_obj, PadObjAry *move_args);
+
+/**
+ * pop pending tail call
+ *
+ * @param[in]  *self      pointer to PadCtx
+ * @param[out] **out_args store pointer to PadObjAry of arguments (do PadObjAry_Del)
+ *
+ * @return found to pointer to function object (do PadObj_DecRef and PadObj_Del)
+ * @return not found to NULL
+ */
+PadObj *
+PadCtx_PopTailCall(PadCtx *self, PadObjAry **out_args);
+
+/**
+ * discard pending tail call
+ *
+ * @param[in] *self pointer to PadCtx
+ */
+void
+PadCtx_ClearTailCall(PadCtx *self);
+
+/**
+ * get depth of running pad's functions
+ *
+ * @param[in] *self pointer to PadCtx
+ *
+ * @return depth
+ */
+int32_t
+PadCtx_GetFuncCallDepth(const PadCtx *self);
+
+/**
+ * set depth of running pad's functions
+ *
+ * @param[in] *self pointer to PadCtx
+ * @param[in] depth depth
+ */
+void
+PadCtx_SetFuncCallDepth(PadCtx *self, int32_t depth);
+
+/**
+ * set native stack at outermost function call
+ *
+ * @param[in] *self  pointer to PadCtx
+ * @param[in] base   address of native stack
+ * @param[in] budget usable bytes of native stack under base
+ */
+void
+PadCtx_SetNativeStack(PadCtx *self, uintptr_t base, size_t budget);
+
+/**
+ * get address of native stack at outermost function call
+ *
+ * @param[in] *self pointer to PadCtx
+ *
+ * @return address
+ */
+uintptr_t
+PadCtx_GetStackBase(const PadCtx *self);
+
+/**
+ * get usable bytes of native stack under address of stack base
+ *
+ * @param[in] *self pointer to PadCtx
+ *
+ * @return number of bytes
+ */
+size_t
+PadCtx_GetStackBudget(const PadCtx *self);
+
+/**
+ * set sink of stdout
+ * if sink is set then output is written to sink instead of stdout buffer
+ *
+ * @param[in] *self     pointer to PadCtx
+ * @param[in] *ref_sink reference to sink (DO NOT DELETE). if NULL then unset
+ */
+void
+PadCtx_SetStdoutSink(PadCtx *self, PadSink *ref_sink);
+
+/**
+ * set sink of stderr
+ * if sink is set then output is written to sink instead of stderr buffer
+ *
+ * @param[in] *self     pointer to PadCtx
+ * @param[in] *ref_sink reference to sink (DO NOT DELETE). if NULL then unset
+ */
+void
+PadCtx_SetStderrSink(PadCtx *self, PadSink *ref_sink);
+
+/**
+ * flush sinks of stdout and stderr
+ *
+ * @param[in] *self pointer to PadCtx
+ */
+void
+PadCtx_FlushSinks(PadCtx *self);
+
 /**
  * clear do-break, do-continue, do-return flag
  *
@@ -279,6 +435,7 @@ PadCtx_PushBackScope(PadCtx *self);
 
 /**
  * pop back scope from tail of scope chain
+ * popped scope is pooled and reused at next push
  *
  * @param[in] *self pointer to PadCtx
  */
@@ -434,6 +591,19 @@ PadCtx_SetUseBuf(PadCtx *self, bool is_use_buf);
 bool
 PadCtx_GetIsUseBuf(const PadCtx *self);
 
+/**
+ * set auto escape mode
+ * if true then outputs of ref block are escaped for HTML
+ *
+ * @param[in] *self          pointer to PadCtx
+ * @param[in] is_auto_escape true or false
+ */
+void
+PadCtx_SetAutoEscape(PadCtx *self, bool is_auto_escape);
+
+bool
+PadCtx_GetIsAutoEscape(const PadCtx *self);
+
 void
 PadCtx_SetType(PadCtx *self, PadCtxType type);
 
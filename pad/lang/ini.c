@@ -0,0 +1,439 @@
+#include <pad/lang/ini.h>
+#include <pad/lang/object.h>
+#include <pad/lang/utils.h>
+
+#include <stdarg.h>
+
+#define is_blank(c) ((c) == ' ' || (c) == '\t' || (c) == '\r')
+#define is_comment(c) ((c) == ';' || (c) == '#')
+
+/**********
+* decoder *
+**********/
+
+/**
+ * parser of decoder
+ * current line is [p, eol) and names and values are ranges in it
+ */
+typedef struct {
+    PadGC *gc;
+    const char *p;  // head of current line
+    const char *eol;  // end of current line
+    const char *end;  // tail of text
+    int32_t line;  // number of current line
+    PadObj *root;  // dict of sections
+    PadObj *section;  // dict of current section
+    PadStr *buf;  // buffer of values
+    bool skip_invalid;  // if true then skip invalid lines of names
+    char *err;
+    int32_t errsz;
+} parser_t;
+
+/**
+ * set error message with number of current line
+ */
+static void
+parse_err(parser_t *ps, const char *fmt, ...) {
+    if (!ps->err || ps->errsz <= 0) {
+        return;
+    }
+
+    char msg[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof msg, fmt, ap);
+    va_end(ap);
+
+    snprintf(ps->err, ps->errsz, "%s at line %d", msg, ps->line);
+}
+
+/**
+ * trim spaces of both sides of range [*beg, *end)
+ */
+static inline void
+trim(const char **beg, const char **end) {
+    const char *b = *beg;
+    const char *e = *end;
+    for (; b < e && is_blank(*b); b++) {
+    }
+    for (; e > b && is_blank(e[-1]); e--) {
+    }
+    *beg = b;
+    *end = e;
+}
+
+/**
+ * copy range to key of dict
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+copy_key(parser_t *ps, char *key, const char *beg, const char *end, const char *what) {
+    int32_t len = end - beg;
+    if (len <= 0) {
+        parse_err(ps, "empty %s", what);
+        return false;
+    }
+    if (len >= PAD_OBJ_DICT__ITEM_KEY_SIZE) {
+        parse_err(ps, "%s is too long", what);
+        return false;
+    }
+    memcpy(key, beg, len);
+    key[len] = '\0';
+    return true;
+}
+
+/**
+ * parse line of section header. beg is at '['
+ * same sections are merged to first one
+ */
+static bool
+parse_section(parser_t *ps, const char *beg, const char *end) {
+    const char *close = memchr(beg, ']', end - beg);
+    if (!close) {
+        parse_err(ps, "expected ']'");
+        return false;
+    }
+
+    const char *rest = close + 1;
+    const char *rest_end = end;
+    trim(&rest, &rest_end);
+    if (rest < rest_end && !is_comment(*rest)) {
+        parse_err(ps, "extra data after section");
+        return false;
+    }
+
+    const char *name = beg + 1;
+    const char *name_end = close;
+    trim(&name, &name_end);
+    char key[PAD_OBJ_DICT__ITEM_KEY_SIZE];
+    if (!copy_key(ps, key, name, name_end, "section name")) {
+        return false;
+    }
+
+    PadObjDictItem *item = PadObjDict_Get(ps->root->objdict, key);
+    if (item && item->value && item->value->type == PAD_OBJ_TYPE__DICT) {
+        ps->section = item->value;
+        return true;
+    }
+
+    PadObjDict *dict = PadObjDict_New(ps->gc);
+    if (!dict) {
+        parse_err(ps, "failed to allocate dict");
+        return false;
+    }
+    PadObj *obj = PadObj_NewDict(ps->gc, PadMem_Move(dict));
+    if (!obj) {
+        parse_err(ps, "failed to allocate dict");
+        return false;
+    }
+    PadObjDict_Move(ps->root->objdict, key, PadMem_Move(obj));
+    ps->section = obj;
+    return true;
+}
+
+/**
+ * parse line of "name = value"
+ * if ps->skip_invalid then lines without '=' or name and lines outside of
+ * sections are skipped
+ */
+static bool
+parse_item(parser_t *ps, const char *beg, const char *end) {
+    const char *eq = memchr(beg, '=', end - beg);
+    const char *name = beg;
+    const char *name_end = eq ? eq : end;
+    trim(&name, &name_end);
+    if (ps->skip_invalid && (!eq || !ps->section || name == name_end)) {
+        return true;
+    }
+
+    if (!eq) {
+        parse_err(ps, "expected '='");
+        return false;
+    }
+    if (!ps->section) {
+        parse_err(ps, "name outside of section");
+        return false;
+    }
+
+    char key[PAD_OBJ_DICT__ITEM_KEY_SIZE];
+    if (!copy_key(ps, key, name, name_end, "name")) {
+        return false;
+    }
+
+    const char *val = eq + 1;
+    const char *val_end = end;
+    trim(&val, &val_end);
+    PadStr_Clear(ps->buf);
+    if (!PadStr_AppNStr(ps->buf, val, val_end - val)) {
+        parse_err(ps, "failed to append string");
+        return false;
+    }
+
+    PadObj *obj = PadObj_NewUnicodeCStr(ps->gc, PadStr_Getc(ps->buf));
+    if (!obj) {
+        parse_err(ps, "failed to allocate string");
+        return false;
+    }
+    PadObjDict_Move(ps->section->objdict, key, PadMem_Move(obj));
+    return true;
+}
+
+static bool
+parse_lines(parser_t *ps) {
+    for (; ps->p < ps->end; ps->line++) {
+        ps->eol = memchr(ps->p, '\n', ps->end - ps->p);
+        if (!ps->eol) {
+            ps->eol = ps->end;
+        }
+
+        const char *beg = ps->p;
+        const char *end = ps->eol;
+        ps->p = ps->eol < ps->end ? ps->eol + 1 : ps->end;
+        trim(&beg, &end);
+        if (beg == end || is_comment(*beg)) {
+            continue;
+        }
+
+        bool ok = *beg == '['
+            ? parse_section(ps, beg, end)
+            : parse_item(ps, beg, end);
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+PadObj *
+PadIni_Decode(PadGC *ref_gc, const char *src, int32_t len, int32_t flags, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!ref_gc || !src || len < 0) {
+        return NULL;
+    }
+
+    parser_t ps = {
+        .gc = ref_gc,
+        .p = src,
+        .end = src + len,
+        .line = 1,
+        .skip_invalid = flags & PAD_INI__SKIP_INVALID,
+        .err = err,
+        .errsz = errsz,
+    };
+
+    // skip BOM
+    if (len >= 3 && !memcmp(src, "\xef\xbb\xbf", 3)) {
+        ps.p += 3;
+    }
+
+    PadObjDict *dict = PadObjDict_New(ref_gc);
+    if (!dict) {
+        return NULL;
+    }
+    ps.root = PadObj_NewDict(ref_gc, PadMem_Move(dict));
+    if (!ps.root) {
+        return NULL;
+    }
+
+    ps.buf = PadStr_New();
+    if (!ps.buf) {
+        PadObj_Del(ps.root);
+        return NULL;
+    }
+
+    bool ok = parse_lines(&ps);
+    PadStr_Del(ps.buf);
+    if (!ok) {
+        PadObj_Del(ps.root);
+        return NULL;
+    }
+
+    return ps.root;
+}
+
+/**********
+* encoder *
+**********/
+
+/**
+ * writer of encoder
+ * the destination is sink or string
+ */
+typedef struct {
+    PadSink *sink;  // if not NULL then write to sink
+    PadStr *str;  // if not NULL then write to string
+    char *err;
+    int32_t errsz;
+} writer_t;
+
+static bool
+write_err(writer_t *w, const char *fmt, ...) {
+    if (w->err && w->errsz > 0 && !w->err[0]) {
+        va_list ap;
+        va_start(ap, fmt);
+        vsnprintf(w->err, w->errsz, fmt, ap);
+        va_end(ap);
+    }
+    return false;
+}
+
+static bool
+write_n(writer_t *w, const char *data, int32_t len) {
+    bool ok;
+    if (w->sink) {
+        ok = PadSink_Write(w->sink, data, len) != NULL;
+    } else {
+        ok = PadStr_AppNStr(w->str, data, len) != NULL;
+    }
+    return ok || write_err(w, "failed to write");
+}
+
+static bool
+write_s(writer_t *w, const char *s) {
+    return write_n(w, s, strlen(s));
+}
+
+static const PadObj *
+resolve(const PadObj *obj) {
+    if (obj && obj->type == PAD_OBJ_TYPE__IDENT) {
+        return Pad_PullRefAll(obj);
+    }
+    return obj;
+}
+
+/**
+ * write value of name. values of other than string are written as text
+ * string must not have newlines because it is read by lines
+ */
+static bool
+write_value(writer_t *w, const PadObj *obj, const char *section, const char *name) {
+    obj = resolve(obj);
+    if (!obj) {
+        return write_err(w, "value of \"%s\" in section \"%s\" is not defined", name, section);
+    }
+
+    switch (obj->type) {
+    default: {
+        PadStr *s = PadObj_ToStr(obj);
+        write_err(w, "can't encode %s", s ? PadStr_Getc(s) : "object");
+        PadStr_Del(s);
+        return false;
+    } break;
+    case PAD_OBJ_TYPE__UNICODE: {
+        const char *s = PadUni_GetcMB(obj->unicode);
+        if (strpbrk(s, "\r\n")) {
+            return write_err(w, "value of \"%s\" in section \"%s\" has newline", name, section);
+        }
+        return write_s(w, s);
+    } break;
+    case PAD_OBJ_TYPE__NIL:
+    case PAD_OBJ_TYPE__BOOL:
+    case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__FLOAT: {
+        PadStr *s = PadObj_ToStr(obj);
+        if (!s) {
+            return write_err(w, "failed to convert value to string");
+        }
+        bool ok = write_s(w, PadStr_Getc(s));
+        PadStr_Del(s);
+        return ok;
+    } break;
+    }
+}
+
+/**
+ * write section header and lines of "name = value" and empty line
+ */
+static bool
+write_section(writer_t *w, const char *section, const PadObj *obj) {
+    obj = resolve(obj);
+    if (!obj || obj->type != PAD_OBJ_TYPE__DICT) {
+        return write_err(w, "section \"%s\" is not dict", section);
+    }
+    if (!section[0] || strpbrk(section, "]\r\n")) {
+        return write_err(w, "invalid section name \"%s\"", section);
+    }
+    if (!write_s(w, "[") || !write_s(w, section) || !write_s(w, "]\n")) {
+        return false;
+    }
+
+    const PadObjDict *dict = obj->objdict;
+    for (int32_t i = 0; i < PadObjDict_Len(dict); i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (!item) {
+            continue;
+        }
+        const char *name = item->key;
+        if (!name[0] || strchr("[;#", name[0]) || strpbrk(name, "=\r\n")) {
+            return write_err(w, "invalid name \"%s\" in section \"%s\"", name, section);
+        }
+        if (!write_s(w, name) ||
+            !write_s(w, " = ") ||
+            !write_value(w, item->value, section, name) ||
+            !write_s(w, "\n")) {
+            return false;
+        }
+    }
+
+    return write_s(w, "\n");
+}
+
+static bool
+write_ini(writer_t *w, const PadObj *obj) {
+    obj = resolve(obj);
+    if (!obj || obj->type != PAD_OBJ_TYPE__DICT) {
+        return write_err(w, "data is not dict");
+    }
+
+    const PadObjDict *dict = obj->objdict;
+    for (int32_t i = 0; i < PadObjDict_Len(dict); i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (!item) {
+            continue;
+        }
+        if (!write_section(w, item->key, item->value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+PadStr *
+PadIni_EncodeToStr(PadStr *dst, const PadObj *obj, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!dst) {
+        return NULL;
+    }
+
+    writer_t w = { .str = dst, .err = err, .errsz = errsz };
+    if (!write_ini(&w, obj)) {
+        return NULL;
+    }
+
+    return dst;
+}
+
+PadSink *
+PadIni_EncodeToSink(PadSink *sink, const PadObj *obj, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!sink) {
+        return NULL;
+    }
+
+    writer_t w = { .sink = sink, .err = err, .errsz = errsz };
+    if (!write_ini(&w, obj)) {
+        return NULL;
+    }
+
+    return sink;
+}
@@ -0,0 +1,80 @@
+/**
+ * INI decoder and encoder
+ *
+ * INI text is decoded in one pass to dict of sections
+ *
+ *     [section]          -> {"section": {"name": "value"}}
+ *     name = value
+ *
+ * lines are found by memchr and names and values are trimmed spaces and
+ * tabs of both sides and created as unicode objects at once. empty lines
+ * and lines starting with ';' or '#' are skipped. same sections are merged
+ * and same names are over written. names outside of sections and lines
+ * without '=' are error (or skipped by PAD_INI__SKIP_INVALID)
+ *
+ * dict of sections is encoded to string or sink directly in the format
+ * of lib/ini.pad. values of int, float, bool and nil are written as text
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <pad/lib/string.h>
+#include <pad/lib/sink.h>
+#include <pad/lang/types.h>
+
+/**
+ * flags of decode
+ */
+enum {
+    PAD_INI__SKIP_INVALID = 1 << 0,  // skip invalid lines of names like parser of previous lib/ini.pad
+};
+
+/**
+ * decode INI text to dict of sections
+ *
+ * @param[in]  *ref_gc reference to PadGC
+ * @param[in]  *src    pointer to INI text (UTF-8)
+ * @param[in]  len     length of text
+ * @param[in]  flags   flags of decode (PAD_INI__SKIP_INVALID)
+ * @param[out] *err    pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz   size of buffer of error message
+ *
+ * @return success to pointer to PadObj of dict (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadIni_Decode(PadGC *ref_gc, const char *src, int32_t len, int32_t flags, char *err, int32_t errsz);
+
+/**
+ * encode dict of sections to INI and append it at back of string
+ *
+ * @param[in]  *dst   pointer to PadStr
+ * @param[in]  *obj   pointer to PadObj of dict (identifier is resolved to reference)
+ * @param[out] *err   pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz  size of buffer of error message
+ *
+ * @return success to pointer to dst
+ * @return failed to NULL
+ */
+PadStr *
+PadIni_EncodeToStr(PadStr *dst, const PadObj *obj, char *err, int32_t errsz);
+
+/**
+ * encode dict of sections to INI and write it to sink
+ *
+ * @param[in]  *sink  pointer to PadSink
+ * @param[in]  *obj   pointer to PadObj of dict (identifier is resolved to reference)
+ * @param[out] *err   pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz  size of buffer of error message
+ *
+ * @return success to pointer to sink
+ * @return failed to NULL
+ */
+PadSink *
+PadIni_EncodeToSink(PadSink *sink, const PadObj *obj, char *err, int32_t errsz);
@@ -0,0 +1,926 @@
+#include <pad/lang/json.h>
+#include <pad/lib/unicode_kernel.h>
+#include <pad/lang/object.h>
+#include <pad/lang/context.h>
+#include <pad/lang/utils.h>
+
+#include <limits.h>
+#include <stdarg.h>
+
+#define is_digit(c) ((c) >= '0' && (c) <= '9')
+
+/**********
+* decoder *
+**********/
+
+/**
+ * parser of decoder
+ * strings are unescaped to buffer and objects are created from it
+ */
+typedef struct {
+    PadGC *gc;
+    const char *beg;  // head of text
+    const char *p;  // current position
+    const char *end;  // tail of text
+    int32_t depth;  // number of nested containers
+    PadStr *buf;  // buffer of strings
+    char *err;
+    int32_t errsz;
+} parser_t;
+
+/**
+ * set error message with line and column of current position
+ */
+static void
+parse_err(parser_t *ps, const char *fmt, ...) {
+    if (!ps->err || ps->errsz <= 0) {
+        return;
+    }
+
+    int32_t line = 1, col = 1;
+    for (const char *q = ps->beg; q < ps->p && q < ps->end; q++) {
+        if (*q == '\n') {
+            line++;
+            col = 1;
+        } else {
+            col++;
+        }
+    }
+
+    char msg[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof msg, fmt, ap);
+    va_end(ap);
+
+    snprintf(ps->err, ps->errsz, "%s at line %d column %d", msg, line, col);
+}
+
+static inline void
+skip_space(parser_t *ps) {
+    const char *p = ps->p;
+    for (; p < ps->end; p++) {
+        if (*p != ' ' && *p != '\n' && *p != '\r' && *p != '\t') {
+            break;
+        }
+    }
+    ps->p = p;
+}
+
+static PadObj *
+parse_value(parser_t *ps);
+
+/**
+ * read 4 hex digits of \uXXXX
+ *
+ * @return success to code point
+ * @return failed to -1
+ */
+static int32_t
+read_hex4(parser_t *ps) {
+    if (ps->end - ps->p < 4) {
+        return -1;
+    }
+
+    int32_t cp = 0;
+    for (int32_t i = 0; i < 4; i++) {
+        char c = *ps->p++;
+        cp <<= 4;
+        if (is_digit(c)) {
+            cp |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            cp |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            cp |= c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+
+    return cp;
+}
+
+static bool
+app_utf8(PadStr *buf, int32_t cp) {
+    char mb[4];
+    int32_t n = 0;
+    if (cp < 0x80) {
+        mb[n++] = cp;
+    } else if (cp < 0x800) {
+        mb[n++] = 0xc0 | (cp >> 6);
+        mb[n++] = 0x80 | (cp & 0x3f);
+    } else if (cp < 0x10000) {
+        mb[n++] = 0xe0 | (cp >> 12);
+        mb[n++] = 0x80 | ((cp >> 6) & 0x3f);
+        mb[n++] = 0x80 | (cp & 0x3f);
+    } else {
+        mb[n++] = 0xf0 | (cp >> 18);
+        mb[n++] = 0x80 | ((cp >> 12) & 0x3f);
+        mb[n++] = 0x80 | ((cp >> 6) & 0x3f);
+        mb[n++] = 0x80 | (cp & 0x3f);
+    }
+    return PadStr_AppNStr(buf, mb, n) != NULL;
+}
+
+/**
+ * parse escape sequence after '\'
+ */
+static bool
+parse_escape(parser_t *ps) {
+    if (ps->p >= ps->end) {
+        parse_err(ps, "unterminated string");
+        return false;
+    }
+
+    char c = *ps->p++;
+    char ch;
+    switch (c) {
+    case '"': ch = '"'; break;
+    case '\\': ch = '\\'; break;
+    case '/': ch = '/'; break;
+    case 'b': ch = '\b'; break;
+    case 'f': ch = '\f'; break;
+    case 'n': ch = '\n'; break;
+    case 'r': ch = '\r'; break;
+    case 't': ch = '\t'; break;
+    case 'u': {
+        int32_t cp = read_hex4(ps);
+        if (cp < 0) {
+            parse_err(ps, "invalid \\u escape");
+            return false;
+        }
+        if (cp >= 0xd800 && cp <= 0xdbff) {
+            // surrogate pair
+            if (ps->end - ps->p < 2 || ps->p[0] != '\\' || ps->p[1] != 'u') {
+                parse_err(ps, "invalid surrogate pair");
+                return false;
+            }
+            ps->p += 2;
+            int32_t lo = read_hex4(ps);
+            if (lo < 0xdc00 || lo > 0xdfff) {
+                parse_err(ps, "invalid surrogate pair");
+                return false;
+            }
+            cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+        } else if (cp >= 0xdc00 && cp <= 0xdfff) {
+            parse_err(ps, "invalid surrogate pair");
+            return false;
+        } else if (cp == 0) {
+            parse_err(ps, "\\u0000 is not supported");
+            return false;
+        }
+        return app_utf8(ps->buf, cp);
+    } break;
+    default:
+        ps->p--;
+        parse_err(ps, "invalid escape '\\%c'", c);
+        return false;
+        break;
+    }
+
+    return PadStr_PushBack(ps->buf, ch) != NULL;
+}
+
+/**
+ * parse string to buffer. current position is at '"'
+ * runs of characters without escape are copied at once
+ */
+static bool
+parse_string(parser_t *ps) {
+    PadStr_Clear(ps->buf);
+    ps->p++;
+
+    for (;;) {
+        int32_t n = PadUniKernel_SpanJsonSafe(ps->p, ps->end - ps->p);
+        if (n > 0) {
+            if (!PadStr_AppNStr(ps->buf, ps->p, n)) {
+                parse_err(ps, "failed to append string");
+                return false;
+            }
+            ps->p += n;
+        }
+        if (ps->p >= ps->end) {
+            parse_err(ps, "unterminated string");
+            return false;
+        }
+
+        char c = *ps->p;
+        if (c == '"') {
+            ps->p++;
+            return true;
+        } else if (c == '\\') {
+            ps->p++;
+            if (!parse_escape(ps)) {
+                return false;
+            }
+        } else {
+            parse_err(ps, "control character in string");
+            return false;
+        }
+    }
+}
+
+static PadObj *
+parse_number(parser_t *ps) {
+    const char *start = ps->p;
+    const char *p = start;
+    const char *end = ps->end;
+    bool is_float = false;
+
+    if (*p == '-') {
+        p++;
+    }
+    if (p < end && *p == '0') {
+        p++;
+    } else if (p < end && is_digit(*p)) {
+        for (; p < end && is_digit(*p); p++) {
+        }
+    } else {
+        ps->p = p;
+        parse_err(ps, "invalid number");
+        return NULL;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        if (p >= end || !is_digit(*p)) {
+            ps->p = p;
+            parse_err(ps, "invalid number");
+            return NULL;
+        }
+        for (; p < end && is_digit(*p); p++) {
+        }
+        is_float = true;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        if (p < end && (*p == '+' || *p == '-')) {
+            p++;
+        }
+        if (p >= end || !is_digit(*p)) {
+            ps->p = p;
+            parse_err(ps, "invalid number");
+            return NULL;
+        }
+        for (; p < end && is_digit(*p); p++) {
+        }
+        is_float = true;
+    }
+    ps->p = p;
+
+    if (!is_float) {
+        // accumulate to negative side to hold LONG_MIN
+        bool neg = *start == '-';
+        PadIntObj value = 0;
+        const char *q = start + neg;
+        for (; q < p; q++) {
+            int32_t d = *q - '0';
+            if (value < (LONG_MIN + d) / 10) {
+                break;  // overflow. parse as float
+            }
+            value = value * 10 - d;
+        }
+        if (q == p) {
+            if (!neg) {
+                if (value == LONG_MIN) {
+                    return PadObj_NewFloat(ps->gc, -(PadFloatObj) value);
+                }
+                value = -value;
+            }
+            return PadObj_NewInt(ps->gc, value);
+        }
+    }
+
+    // strtod needs null terminated strings
+    int32_t len = p - start;
+    char tmp[64];
+    const char *s = tmp;
+    if (len < (int32_t) sizeof tmp) {
+        memcpy(tmp, start, len);
+        tmp[len] = '\0';
+    } else {
+        PadStr_Clear(ps->buf);
+        PadStr_AppNStr(ps->buf, start, len);
+        s = PadStr_Getc(ps->buf);
+    }
+
+    return PadObj_NewFloat(ps->gc, strtod(s, NULL));
+}
+
+static PadObj *
+parse_literal(parser_t *ps, const char *word, int32_t len) {
+    if (ps->end - ps->p < len || memcmp(ps->p, word, len)) {
+        parse_err(ps, "unexpected character '%c'", *ps->p);
+        return NULL;
+    }
+    ps->p += len;
+
+    switch (word[0]) {
+    case 't': return PadObj_NewBool(ps->gc, true); break;
+    case 'f': return PadObj_NewBool(ps->gc, false); break;
+    }
+    return PadObj_NewNil(ps->gc);
+}
+
+static bool
+enter_container(parser_t *ps) {
+    if (ps->depth >= PAD_JSON__MAX_DEPTH) {
+        parse_err(ps, "too deep nesting");
+        return false;
+    }
+    ps->depth++;
+    ps->p++;  // '[' or '{'
+    skip_space(ps);
+    return true;
+}
+
+static PadObj *
+parse_array(parser_t *ps) {
+    if (!enter_container(ps)) {
+        return NULL;
+    }
+
+    PadObjAry *arr = PadObjAry_New();
+    PadObj *obj = PadObj_NewAry(ps->gc, PadMem_Move(arr));
+    if (ps->p < ps->end && *ps->p == ']') {
+        ps->p++;
+        ps->depth--;
+        return obj;
+    }
+
+    for (;;) {
+        PadObj *elem = parse_value(ps);
+        if (!elem) {
+            goto error;
+        }
+        PadObjAry_MoveBack(obj->objarr, PadMem_Move(elem));
+
+        skip_space(ps);
+        if (ps->p < ps->end && *ps->p == ',') {
+            ps->p++;
+            continue;
+        } else if (ps->p < ps->end && *ps->p == ']') {
+            ps->p++;
+            break;
+        }
+        parse_err(ps, "expected ',' or ']'");
+        goto error;
+    }
+
+    ps->depth--;
+    return obj;
+
+error:
+    PadObj_Del(obj);
+    return NULL;
+}
+
+static PadObj *
+parse_dict(parser_t *ps) {
+    if (!enter_container(ps)) {
+        return NULL;
+    }
+
+    PadObjDict *dict = PadObjDict_New(ps->gc);
+    PadObj *obj = PadObj_NewDict(ps->gc, PadMem_Move(dict));
+    if (ps->p < ps->end && *ps->p == '}') {
+        ps->p++;
+        ps->depth--;
+        return obj;
+    }
+
+    char key[PAD_OBJ_DICT__ITEM_KEY_SIZE];
+    for (;;) {
+        skip_space(ps);
+        if (ps->p >= ps->end || *ps->p != '"') {
+            parse_err(ps, "expected string of key");
+            goto error;
+        }
+        if (!parse_string(ps)) {
+            goto error;
+        }
+        if (PadStr_Len(ps->buf) >= PAD_OBJ_DICT__ITEM_KEY_SIZE) {
+            parse_err(ps, "key is too long");
+            goto error;
+        }
+        memcpy(key, PadStr_Getc(ps->buf), PadStr_Len(ps->buf) + 1);
+
+        skip_space(ps);
+        if (ps->p >= ps->end || *ps->p != ':') {
+            parse_err(ps, "expected ':'");
+            goto error;
+        }
+        ps->p++;
+
+        PadObj *val = parse_value(ps);
+        if (!val) {
+            goto error;
+        }
+        PadObjDict_Move(obj->objdict, key, PadMem_Move(val));
+
+        skip_space(ps);
+        if (ps->p < ps->end && *ps->p == ',') {
+            ps->p++;
+            continue;
+        } else if (ps->p < ps->end && *ps->p == '}') {
+            ps->p++;
+            break;
+        }
+        parse_err(ps, "expected ',' or '}'");
+        goto error;
+    }
+
+    ps->depth--;
+    return obj;
+
+error:
+    PadObj_Del(obj);
+    return NULL;
+}
+
+static PadObj *
+parse_value(parser_t *ps) {
+    skip_space(ps);
+    if (ps->p >= ps->end) {
+        parse_err(ps, "unexpected end of text");
+        return NULL;
+    }
+
+    switch (*ps->p) {
+    case '{':
+        return parse_dict(ps);
+        break;
+    case '[':
+        return parse_array(ps);
+        break;
+    case '"':
+        if (!parse_string(ps)) {
+            return NULL;
+        }
+        return PadObj_NewUnicodeCStr(ps->gc, PadStr_Getc(ps->buf));
+        break;
+    case 't':
+        return parse_literal(ps, "true", 4);
+        break;
+    case 'f':
+        return parse_literal(ps, "false", 5);
+        break;
+    case 'n':
+        return parse_literal(ps, "null", 4);
+        break;
+    case '-':
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+        return parse_number(ps);
+        break;
+    }
+
+    parse_err(ps, "unexpected character '%c'", *ps->p);
+    return NULL;
+}
+
+PadObj *
+PadJson_Decode(PadGC *ref_gc, const char *src, int32_t len, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!ref_gc || !src || len < 0) {
+        return NULL;
+    }
+
+    parser_t ps = {
+        .gc = ref_gc,
+        .beg = src,
+        .p = src,
+        .end = src + len,
+        .err = err,
+        .errsz = errsz,
+    };
+
+    // skip BOM
+    if (len >= 3 && !memcmp(src, "\xef\xbb\xbf", 3)) {
+        ps.p += 3;
+    }
+
+    ps.buf = PadStr_New();
+    if (!ps.buf) {
+        return NULL;
+    }
+
+    PadObj *obj = parse_value(&ps);
+    if (obj) {
+        skip_space(&ps);
+        if (ps.p < ps.end) {
+            parse_err(&ps, "extra data");
+            PadObj_Del(obj);
+            obj = NULL;
+        }
+    }
+
+    PadStr_Del(ps.buf);
+    return obj;
+}
+
+/**********
+* encoder *
+**********/
+
+/**
+ * writer of encoder
+ * the destination is sink or string
+ */
+typedef struct {
+    PadSink *sink;  // if not NULL then write to sink
+    PadStr *str;  // if not NULL then write to string
+    int32_t indent;  // number of spaces of indent. 0 is compact
+    const void *visiting[PAD_JSON__MAX_DEPTH];  // containers of current path
+    int32_t depth;  // number of visiting
+    char *err;
+    int32_t errsz;
+} writer_t;
+
+static bool
+write_err(writer_t *w, const char *fmt, ...) {
+    if (w->err && w->errsz > 0 && !w->err[0]) {
+        va_list ap;
+        va_start(ap, fmt);
+        vsnprintf(w->err, w->errsz, fmt, ap);
+        va_end(ap);
+    }
+    return false;
+}
+
+static bool
+write_n(writer_t *w, const char *data, int32_t len) {
+    bool ok;
+    if (w->sink) {
+        ok = PadSink_Write(w->sink, data, len) != NULL;
+    } else {
+        ok = PadStr_AppNStr(w->str, data, len) != NULL;
+    }
+    return ok || write_err(w, "failed to write");
+}
+
+static bool
+write_quoted(writer_t *w, const char *s, int32_t len) {
+    if (!write_n(w, "\"", 1)) {
+        return false;
+    }
+
+    for (int32_t i = 0; i < len; ) {
+        int32_t n = PadUniKernel_SpanJsonSafe(s + i, len - i);
+        if (n > 0 && !write_n(w, s + i, n)) {
+            return false;
+        }
+        i += n;
+        if (i >= len) {
+            break;
+        }
+
+        char esc[8];
+        int32_t esclen = 2;
+        unsigned char c = s[i++];
+        switch (c) {
+        case '"': memcpy(esc, "\\\"", 2); break;
+        case '\\': memcpy(esc, "\\\\", 2); break;
+        case '\b': memcpy(esc, "\\b", 2); break;
+        case '\f': memcpy(esc, "\\f", 2); break;
+        case '\n': memcpy(esc, "\\n", 2); break;
+        case '\r': memcpy(esc, "\\r", 2); break;
+        case '\t': memcpy(esc, "\\t", 2); break;
+        default: esclen = snprintf(esc, sizeof esc, "\\u%04x", c); break;
+        }
+        if (!write_n(w, esc, esclen)) {
+            return false;
+        }
+    }
+
+    return write_n(w, "\"", 1);
+}
+
+/**
+ * write newline and indent of current depth if writer is not compact
+ */
+static bool
+write_newline(writer_t *w) {
+    static const char spaces[] = "                                ";
+    if (w->indent <= 0) {
+        return true;
+    }
+    if (!write_n(w, "\n", 1)) {
+        return false;
+    }
+    for (int32_t n = w->depth * w->indent; n > 0; ) {
+        int32_t m = n < (int32_t) sizeof spaces - 1 ? n : (int32_t) sizeof spaces - 1;
+        if (!write_n(w, spaces, m)) {
+            return false;
+        }
+        n -= m;
+    }
+    return true;
+}
+
+/**
+ * push container to visiting path and write opening bracket
+ * container of NULL is not checked for recursion (rows of numeric array)
+ */
+static bool
+enter(writer_t *w, const void *container, const char *open) {
+    if (w->depth >= PAD_JSON__MAX_DEPTH) {
+        return write_err(w, "too deep nesting");
+    }
+    for (int32_t i = 0; container && i < w->depth; i++) {
+        if (w->visiting[i] == container) {
+            return write_err(w, "circular reference");
+        }
+    }
+    w->visiting[w->depth++] = container;
+    return write_n(w, open, 1);
+}
+
+/**
+ * pop container from visiting path and write closing bracket
+ * closing bracket is in new line if container has elements
+ */
+static bool
+leave(writer_t *w, int32_t nelems, const char *close) {
+    w->depth--;
+    if (nelems > 0 && !write_newline(w)) {
+        return false;
+    }
+    return write_n(w, close, 1);
+}
+
+/**
+ * write separator before index'th element
+ */
+static bool
+write_sep(writer_t *w, int32_t index) {
+    if (index > 0 && !write_n(w, ",", 1)) {
+        return false;
+    }
+    return write_newline(w);
+}
+
+static bool
+write_key(writer_t *w, int32_t index, const char *key) {
+    return write_sep(w, index) &&
+           write_quoted(w, key, strlen(key)) &&
+           (w->indent > 0 ? write_n(w, ": ", 2) : write_n(w, ":", 1));
+}
+
+static bool
+write_obj(writer_t *w, const PadObj *obj);
+
+static bool
+write_array(writer_t *w, const PadObjAry *arr) {
+    if (!enter(w, arr, "[")) {
+        return false;
+    }
+
+    int32_t len = PadObjAry_Len(arr);
+    for (int32_t i = 0; i < len; i++) {
+        if (!write_sep(w, i) || !write_obj(w, PadObjAry_Getc(arr, i))) {
+            return false;
+        }
+    }
+
+    return leave(w, len, "]");
+}
+
+static bool
+write_deque(writer_t *w, const PadObjDeq *deq) {
+    if (!enter(w, deq, "[")) {
+        return false;
+    }
+
+    int32_t len = PadObjDeq_Len(deq);
+    for (int32_t i = 0; i < len; i++) {
+        if (!write_sep(w, i) || !write_obj(w, PadObjDeq_Get(deq, i))) {
+            return false;
+        }
+    }
+
+    return leave(w, len, "]");
+}
+
+static bool
+write_num_val(writer_t *w, PadNumVal val) {
+    if (val.kind == PAD_NUM_ARY_KIND__INT) {
+        char buf[PAD_NUM__INT_STR_SIZE];
+        return write_n(w, buf, PadNum_IntToStr(buf, val.ivalue));
+    }
+    if (!isfinite(val.fvalue)) {
+        return write_err(w, "can't encode %f", val.fvalue);
+    }
+    char buf[PAD_NUM__FLOAT_STR_SIZE];
+    return write_n(w, buf, PadNum_FloatToStr(buf, val.fvalue));
+}
+
+/**
+ * write numeric array as array of numbers (or array of rows if 2D)
+ */
+static bool
+write_numarray(writer_t *w, const PadNumAry *numarr) {
+    bool is_2d = PadNumAry_GetNDim(numarr) == 2;
+    int32_t cols = is_2d ? PadNumAry_Cols(numarr) : 0;
+    int32_t len = PadNumAry_Len(numarr);
+
+    if (!enter(w, numarr, "[")) {
+        return false;
+    }
+    for (int32_t y = 0; y < len; y++) {
+        if (!write_sep(w, y)) {
+            return false;
+        }
+        if (!is_2d) {
+            if (!write_num_val(w, PadNumAry_Get(numarr, y))) {
+                return false;
+            }
+            continue;
+        }
+        if (!enter(w, NULL, "[")) {
+            return false;
+        }
+        for (int32_t x = 0; x < cols; x++) {
+            if (!write_sep(w, x) || !write_num_val(w, PadNumAry_Get2D(numarr, y, x))) {
+                return false;
+            }
+        }
+        if (!leave(w, cols, "]")) {
+            return false;
+        }
+    }
+
+    return leave(w, len, "]");
+}
+
+/**
+ * write dict view as array of keys, values or items ([key, value])
+ */
+static bool
+write_dict_view(writer_t *w, const PadDictViewObj *view) {
+    const PadObjDict *dict = view->dict->objdict;
+    if (!enter(w, dict, "[")) {
+        return false;
+    }
+
+    int32_t len = PadObjDict_Len(dict);
+    for (int32_t i = 0; i < len; i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (!write_sep(w, i)) {
+            return false;
+        }
+        bool ok = true;
+        switch (view->kind) {
+        case PAD_DICT_VIEW__KEYS:
+            ok = write_quoted(w, item->key, strlen(item->key));
+            break;
+        case PAD_DICT_VIEW__VALUES:
+            ok = write_obj(w, item->value);
+            break;
+        case PAD_DICT_VIEW__ITEMS:
+            ok = enter(w, NULL, "[") &&
+                 write_sep(w, 0) &&
+                 write_quoted(w, item->key, strlen(item->key)) &&
+                 write_sep(w, 1) &&
+                 write_obj(w, item->value) &&
+                 leave(w, 2, "]");
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return leave(w, len, "]");
+}
+
+static bool
+write_dict(writer_t *w, const PadObjDict *dict) {
+    if (!enter(w, dict, "{")) {
+        return false;
+    }
+
+    int32_t n = 0;
+    for (int32_t i = 0; i < PadObjDict_Len(dict); i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (!item) {
+            continue;
+        }
+        if (!write_key(w, n++, item->key) || !write_obj(w, item->value)) {
+            return false;
+        }
+    }
+
+    return leave(w, n, "}");
+}
+
+/**
+ * write instance of struct as object of its fields
+ */
+static bool
+write_object(writer_t *w, const PadObj *obj) {
+    PadObjDict *varmap = PadCtx_GetVarmapAtHeadScope(obj->object.struct_context);
+    if (!varmap) {
+        return write_n(w, "{}", 2);
+    }
+    return write_dict(w, varmap);
+}
+
+static bool
+write_other(writer_t *w, const PadObj *obj) {
+    PadStr *s = PadObj_ToStr(obj);
+    write_err(w, "can't encode %s", s ? PadStr_Getc(s) : "object");
+    PadStr_Del(s);
+    return false;
+}
+
+static bool
+write_obj(writer_t *w, const PadObj *obj) {
+    if (!obj) {
+        return write_n(w, "null", 4);
+    }
+
+    switch (obj->type) {
+    default:
+        return write_other(w, obj);
+        break;
+    case PAD_OBJ_TYPE__NIL:
+        return write_n(w, "null", 4);
+        break;
+    case PAD_OBJ_TYPE__BOOL:
+        return obj->boolean ? write_n(w, "true", 4) : write_n(w, "false", 5);
+        break;
+    case PAD_OBJ_TYPE__INT: {
+        char buf[PAD_NUM__INT_STR_SIZE];
+        return write_n(w, buf, PadNum_IntToStr(buf, obj->lvalue));
+    } break;
+    case PAD_OBJ_TYPE__FLOAT: {
+        PadNumVal val = { .kind = PAD_NUM_ARY_KIND__FLOAT, .fvalue = obj->float_value };
+        return write_num_val(w, val);
+    } break;
+    case PAD_OBJ_TYPE__UNICODE: {
+        const char *s = PadUni_GetcMB(obj->unicode);
+        return write_quoted(w, s, strlen(s));
+    } break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const PadObj *ref = Pad_PullRefAll(obj);
+        if (!ref) {
+            return write_err(w, "\"%s\" is not defined", PadObj_GetcIdentName(obj));
+        }
+        return write_obj(w, ref);
+    } break;
+    case PAD_OBJ_TYPE__ARRAY:
+        return write_array(w, obj->objarr);
+        break;
+    case PAD_OBJ_TYPE__DICT:
+        return write_dict(w, obj->objdict);
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        return write_deque(w, obj->objdeq);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        return write_numarray(w, obj->numarr);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        return write_dict_view(w, &obj->dict_view);
+        break;
+    case PAD_OBJ_TYPE__OBJECT:
+        return write_object(w, obj);
+        break;
+    }
+}
+
+PadStr *
+PadJson_EncodeToStr(PadStr *dst, const PadObj *obj, int32_t indent, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!dst) {
+        return NULL;
+    }
+
+    writer_t w = { .str = dst, .indent = indent, .err = err, .errsz = errsz };
+    if (!write_obj(&w, obj)) {
+        return NULL;
+    }
+
+    return dst;
+}
+
+PadSink *
+PadJson_EncodeToSink(PadSink *sink, const PadObj *obj, int32_t indent, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!sink) {
+        return NULL;
+    }
+
+    writer_t w = { .sink = sink, .indent = indent, .err = err, .errsz = errsz };
+    if (!write_obj(&w, obj)) {
+        return NULL;
+    }
+
+    return sink;
+}
@@ -0,0 +1,75 @@
+/**
+ * JSON decoder and encoder
+ *
+ * JSON text is decoded in one pass to objects
+ *
+ *     object -> dict, array -> array, string -> unicode,
+ *     number -> int or float, true/false -> bool, null -> nil
+ *
+ * and objects are encoded to string or sink directly while traversing
+ * containers. deque, numeric array and dict view are encoded as array.
+ * runs of characters in strings are scanned by PadUniKernel_SpanJsonSafe
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <pad/lib/string.h>
+#include <pad/lib/sink.h>
+#include <pad/lang/types.h>
+
+/**
+ * max depth of nested containers in decode and encode
+ */
+#define PAD_JSON__MAX_DEPTH 256
+
+/**
+ * decode JSON text to object
+ *
+ * @param[in]  *ref_gc reference to PadGC
+ * @param[in]  *src    pointer to JSON text (UTF-8)
+ * @param[in]  len     length of text
+ * @param[out] *err    pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz   size of buffer of error message
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadJson_Decode(PadGC *ref_gc, const char *src, int32_t len, char *err, int32_t errsz);
+
+/**
+ * encode object to JSON and append it at back of string
+ * if indent is greater than 0 then containers are written in lines
+ *
+ * @param[in]  *dst   pointer to PadStr
+ * @param[in]  *obj   pointer to PadObj (identifier is resolved to reference)
+ * @param[in]  indent number of spaces of indent
+ * @param[out] *err   pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz  size of buffer of error message
+ *
+ * @return success to pointer to dst
+ * @return failed to NULL
+ */
+PadStr *
+PadJson_EncodeToStr(PadStr *dst, const PadObj *obj, int32_t indent, char *err, int32_t errsz);
+
+/**
+ * encode object to JSON and write it to sink
+ *
+ * @param[in]  *sink  pointer to PadSink
+ * @param[in]  *obj   pointer to PadObj (identifier is resolved to reference)
+ * @param[in]  indent number of spaces of indent
+ * @param[out] *err   pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz  size of buffer of error message
+ *
+ * @return success to pointer to sink
+ * @return failed to NULL
+ */
+PadSink *
+PadJson_EncodeToSink(PadSink *sink, const PadObj *obj, int32_t indent, char *err, int32_t errsz);
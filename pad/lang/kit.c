@@ -27,6 +27,8 @@ PadKit_Del(PadKit *self) {
         return;
     }
 
+    // sinks were flushed at end of each compile and are not touched here
+    // because they are references and may be already deleted
     free(self->program_source);
     PadTkr_Del(self->tkr);
     PadAST_Del(self->ast);
@@ -203,6 +205,8 @@ PadKit_CompileFromStrArgs(
 
     self->ast->blt_func_infos = self->blt_func_infos;
     PadTrv_Trav(self->ast, self->ctx);
+    // sinks may reference text blocks of AST
+    PadCtx_FlushSinks(self->ctx);
     if (PadAST_HasErrs(self->ast)) {
         const PadErrStack *err = PadAST_GetcErrStack(self->ast);
         PadErrStack_ExtendFrontOther(self->errstack, err);
@@ -275,6 +279,21 @@ PadKit_SetUseBuf(PadKit *self, bool use_buf) {
     PadCtx_SetUseBuf(self->ctx, use_buf);  // no use stdout/stderr buffer
 }
 
+void
+PadKit_SetStdoutSink(PadKit *self, PadSink *ref_sink) {
+    PadCtx_SetStdoutSink(self->ctx, ref_sink);
+}
+
+void
+PadKit_SetStderrSink(PadKit *self, PadSink *ref_sink) {
+    PadCtx_SetStderrSink(self->ctx, ref_sink);
+}
+
+void
+PadKit_SetAutoEscape(PadKit *self, bool is_auto_escape) {
+    PadCtx_SetAutoEscape(self->ctx, is_auto_escape);
+}
+
 void
 PadKit_SetBltFuncInfos(PadKit *self, PadBltFuncInfo *infos) {
     if (!self || !infos) {
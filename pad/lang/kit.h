@@ -68,6 +68,38 @@ PadKit_SetImporterFixPathFunc(PadKit *self, PadImporterFixPathFunc func);
 void
 PadKit_SetUseBuf(PadKit *self, bool use_buf);
 
+/**
+ * set sink of stdout. outputs of compile are streamed to sink
+ * sink is flushed at end of each compile and is not used after that,
+ * so it must be alive while compile only (kit may outlive it)
+ *
+ * @param[in] *self
+ * @param[in] *ref_sink reference to sink (DO NOT DELETE). if NULL then unset
+ */
+void
+PadKit_SetStdoutSink(PadKit *self, PadSink *ref_sink);
+
+/**
+ * set sink of stderr. outputs of compile are streamed to sink
+ * sink is flushed at end of each compile and is not used after that,
+ * so it must be alive while compile only (kit may outlive it)
+ *
+ * @param[in] *self
+ * @param[in] *ref_sink reference to sink (DO NOT DELETE). if NULL then unset
+ */
+void
+PadKit_SetStderrSink(PadKit *self, PadSink *ref_sink);
+
+/**
+ * set auto escape mode. outputs of ref blocks are escaped for HTML
+ * text blocks and outputs of puts are not escaped
+ *
+ * @param[in] *self
+ * @param[in] is_auto_escape true or false
+ */
+void
+PadKit_SetAutoEscape(PadKit *self, bool is_auto_escape);
+
 void
 PadKit_SetBltFuncInfos(PadKit *self, PadBltFuncInfo *infos);
 
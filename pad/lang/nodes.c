@@ -124,6 +124,7 @@ PadNode_DeepCopy(const PadNode *other) {
             PadNode_Del(self);
             return NULL;
         }
+        dst->text_len = src->text_len;
         self->real = dst;
     } break;
     case PAD_NODE_TYPE__ELEMS: {
@@ -214,6 +215,9 @@ PadNode_DeepCopy(const PadNode *other) {
         dst->init_formula = PadNode_DeepCopy(src->init_formula);
         dst->comp_formula = PadNode_DeepCopy(src->comp_formula);
         dst->update_formula = PadNode_DeepCopy(src->update_formula);
+        dst->iter_key = PadNode_DeepCopy(src->iter_key);
+        dst->iter_value = PadNode_DeepCopy(src->iter_value);
+        dst->iter_formula = PadNode_DeepCopy(src->iter_formula);
         copy_node_array(dst, src, contents);
         self->real = dst;
     } break;
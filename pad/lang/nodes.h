@@ -157,6 +157,7 @@ typedef struct {
 
 typedef struct {
     char *text;
+    int32_t text_len;  // length of text. text blocks are emitted by this length
 } PadTextBlockNode;
 
 typedef struct {
@@ -225,6 +226,9 @@ typedef struct {
     PadNode *init_formula;
     PadNode *comp_formula;
     PadNode *update_formula;
+    PadNode *iter_key;  // identifier of key in 'for k, v in formula'
+    PadNode *iter_value;  // identifier of value in 'for v in formula'
+    PadNode *iter_formula;  // iterable of 'for ... in'
     PadNodeAry *contents;
 } PadForStmtNode;
 
@@ -73,6 +73,18 @@ PadObj_Del(PadObj *self) {
         PadObjDict_Del(self->objdict);
         self->objdict = NULL;
         break;
+    case PAD_OBJ_TYPE__DEQUE:
+        PadObjDeq_Del(self->objdeq);
+        self->objdeq = NULL;
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        PadNumAry_Del(self->numarr);
+        self->numarr = NULL;
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        PadRegex_Del(self->regex);
+        self->regex = NULL;
+        break;
     case PAD_OBJ_TYPE__FUNC:
         PadObj_DecRef(self->func.name);
         PadObj_Del(self->func.name);
@@ -137,6 +149,21 @@ PadObj_Del(PadObj *self) {
             self->file.fp = NULL;
         }
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        PadUniAry_Del(self->builder.parts);
+        self->builder.parts = NULL;
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        // nothing todo
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        PadObj_DecRef(self->dict_view.dict);
+        PadObj_Del(self->dict_view.dict);
+        self->dict_view.dict = NULL;
+        break;
+    case PAD_OBJ_TYPE__N:
+        // not a type
+        break;
     }
 
     PadGC_Free(self->ref_gc, &self->gc_item);
@@ -208,7 +235,8 @@ PadObj_DeepCopy(const PadObj *other) {
         self->identifier.name = PadStr_DeepCopy(other->identifier.name);
         break;
     case PAD_OBJ_TYPE__UNICODE:
-        self->unicode = PadUni_DeepCopy(other->unicode);
+        // the buffer is copied at first mutation (copy on write)
+        self->unicode = PadUni_ShallowCopy(other->unicode);
         break;
     case PAD_OBJ_TYPE__ARRAY:
         self->objarr = PadObjAry_DeepCopy(other->objarr);
@@ -216,6 +244,15 @@ PadObj_DeepCopy(const PadObj *other) {
     case PAD_OBJ_TYPE__DICT:
         self->objdict = PadObjDict_DeepCopy(other->objdict);
         break;
+    case PAD_OBJ_TYPE__DEQUE:
+        self->objdeq = PadObjDeq_DeepCopy(other->objdeq);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        self->numarr = PadNumAry_DeepCopy(other->numarr);
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        self->regex = PadRegex_DeepCopy(other->regex);
+        break;
     case PAD_OBJ_TYPE__FUNC:
         self->func.ref_ast = other->func.ref_ast;
         self->func.ref_context = other->func.ref_context;
@@ -285,6 +322,19 @@ PadObj_DeepCopy(const PadObj *other) {
     case PAD_OBJ_TYPE__BLTIN_FUNC:
         self->builtin_func.funcname = other->builtin_func.funcname;
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        // parts are copied at first mutation (copy on write)
+        self->builder.parts = PadUniAry_ShallowCopy(other->builder.parts);
+        self->builder.length = other->builder.length;
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        self->range = other->range;
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        self->dict_view.dict = PadObj_DeepCopy(other->dict_view.dict);
+        PadObj_IncRef(self->dict_view.dict);
+        self->dict_view.kind = other->dict_view.kind;
+        break;
     }
 
     return self;
@@ -321,6 +371,9 @@ PadObj_ShallowCopy(const PadObj *other) {
     case PAD_OBJ_TYPE__INT:
         self->lvalue = other->lvalue;
         break;
+    case PAD_OBJ_TYPE__FLOAT:
+        self->float_value = other->float_value;
+        break;
     case PAD_OBJ_TYPE__BOOL:
         self->boolean = other->boolean;
         break;
@@ -337,6 +390,17 @@ PadObj_ShallowCopy(const PadObj *other) {
     case PAD_OBJ_TYPE__DICT:
         self->objdict = PadObjDict_ShallowCopy(other->objdict);
         break;
+    case PAD_OBJ_TYPE__DEQUE:
+        self->objdeq = PadObjDeq_ShallowCopy(other->objdeq);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        // elements are not objects. copy buffer like array copies references
+        self->numarr = PadNumAry_DeepCopy(other->numarr);
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        // cache of DFA is not shared between copies
+        self->regex = PadRegex_DeepCopy(other->regex);
+        break;
     case PAD_OBJ_TYPE__FUNC:
         self->func.ref_ast = other->func.ref_ast;
         self->func.ref_context = other->func.ref_context;
@@ -398,6 +462,19 @@ PadObj_ShallowCopy(const PadObj *other) {
         self->chain.operand = PadObj_ShallowCopy(other->chain.operand);
         self->chain.chain_objs = PadChainObjs_ShallowCopy(other->chain.chain_objs);
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        self->builder.parts = PadUniAry_ShallowCopy(other->builder.parts);
+        self->builder.length = other->builder.length;
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        self->range = other->range;
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        // the copy is view of same dict
+        self->dict_view.dict = other->dict_view.dict;
+        PadObj_IncRef(self->dict_view.dict);
+        self->dict_view.kind = other->dict_view.kind;
+        break;
     }
 
     return self;
@@ -624,6 +701,135 @@ PadObj_NewDict(PadGC *ref_gc, PadObjDict *move_objdict) {
     return self;
 }
 
+PadObj *
+PadObj_NewDeq(PadGC *ref_gc, PadObjDeq *move_objdeq) {
+    if (!ref_gc || !move_objdeq) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__DEQUE);
+    if (!self) {
+        return NULL;
+    }
+
+    self->objdeq = PadMem_Move(move_objdeq);
+
+    return self;
+}
+
+PadObj *
+PadObj_NewNumAry(PadGC *ref_gc, PadNumAry *move_numarr) {
+    if (!ref_gc || !move_numarr) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__NUMARRAY);
+    if (!self) {
+        return NULL;
+    }
+
+    self->numarr = PadMem_Move(move_numarr);
+
+    return self;
+}
+
+PadObj *
+PadObj_NewRegex(PadGC *ref_gc, PadRegex *move_regex) {
+    if (!ref_gc || !move_regex) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__REGEX);
+    if (!self) {
+        return NULL;
+    }
+
+    self->regex = PadMem_Move(move_regex);
+
+    return self;
+}
+
+PadObj *
+PadObj_NewNumAryItem(PadGC *ref_gc, const PadObj *self, int32_t index) {
+    const PadNumAry *numarr = self->numarr;
+
+    if (PadNumAry_GetNDim(numarr) == 2) {
+        PadNumAry *row = PadNumAry_Row(numarr, index);
+        if (!row) {
+            return NULL;
+        }
+        return PadObj_NewNumAry(ref_gc, PadMem_Move(row));
+    }
+
+    PadNumVal val = PadNumAry_Get(numarr, index);
+    if (val.kind == PAD_NUM_ARY_KIND__INT) {
+        return PadObj_NewInt(ref_gc, val.ivalue);
+    }
+    return PadObj_NewFloat(ref_gc, val.fvalue);
+}
+
+PadObj *
+PadObj_NewDictView(PadGC *ref_gc, PadObj *dictobj, PadDictViewKind kind) {
+    if (!ref_gc || !dictobj || dictobj->type != PAD_OBJ_TYPE__DICT) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__DICT_VIEW);
+    if (!self) {
+        return NULL;
+    }
+
+    PadObj_IncRef(dictobj);
+    self->dict_view.dict = dictobj;
+    self->dict_view.kind = kind;
+
+    return self;
+}
+
+int32_t
+PadObj_GetDictViewLen(const PadObj *self) {
+    if (!self || self->type != PAD_OBJ_TYPE__DICT_VIEW) {
+        return 0;
+    }
+    return PadObjDict_Len(self->dict_view.dict->objdict);
+}
+
+PadObj *
+PadObj_NewDictViewItem(PadGC *ref_gc, const PadObj *self, int32_t index) {
+    if (!ref_gc || !self || self->type != PAD_OBJ_TYPE__DICT_VIEW) {
+        return NULL;
+    }
+
+    const PadObjDictItem *item = PadObjDict_GetcIndex(self->dict_view.dict->objdict, index);
+    if (!item) {
+        return NULL;
+    }
+
+    switch (self->dict_view.kind) {
+    case PAD_DICT_VIEW__KEYS:
+        return PadObj_NewUnicodeCStr(ref_gc, item->key);
+        break;
+    case PAD_DICT_VIEW__VALUES:
+        return item->value;
+        break;
+    case PAD_DICT_VIEW__ITEMS: {
+        PadObjAry *pair = PadObjAry_New();
+        if (!pair) {
+            return NULL;
+        }
+        PadObj *key = PadObj_NewUnicodeCStr(ref_gc, item->key);
+        if (!key || !PadObjAry_MoveBack(pair, PadMem_Move(key)) ||
+            !PadObjAry_PushBack(pair, item->value)) {
+            PadObjAry_Del(pair);
+            return NULL;
+        }
+        return PadObj_NewAry(ref_gc, PadMem_Move(pair));
+    } break;
+    }
+
+    return NULL;
+}
+
 PadObj *
 PadObj_NewFunc(
     PadGC *ref_gc,
@@ -850,6 +1056,156 @@ PadObj_NewFile(PadGC *ref_gc, FILE *move_fp) {
     return self;
 }
 
+PadObj *
+PadObj_NewBuilder(PadGC *ref_gc) {
+    if (!ref_gc) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__BUILDER);
+    if (!self) {
+        return NULL;
+    }
+
+    self->builder.parts = PadUniAry_New();
+    if (!self->builder.parts) {
+        PadObj_Del(self);
+        return NULL;
+    }
+    self->builder.length = 0;
+
+    return self;
+}
+
+PadObj *
+PadObj_AppBuilder(PadObj *self, const PadUni *uni) {
+    if (!self || !uni || self->type != PAD_OBJ_TYPE__BUILDER) {
+        return NULL;
+    }
+
+    int32_t len = PadUni_Len(uni);
+    if (!len) {
+        return self;
+    }
+
+    PadUni *part = PadUni_ShallowCopy(uni);
+    if (!part) {
+        return NULL;
+    }
+    if (!PadUniAry_MoveBack(self->builder.parts, PadMem_Move(part))) {
+        PadUni_Del(part);
+        return NULL;
+    }
+    self->builder.length += len;
+
+    return self;
+}
+
+PadUni *
+PadObj_BuildBuilder(PadObj *self) {
+    if (!self || self->type != PAD_OBJ_TYPE__BUILDER) {
+        return NULL;
+    }
+
+    PadUniAry *parts = self->builder.parts;
+    int32_t nparts = PadUniAry_Len(parts);
+    if (nparts == 1) {
+        return PadUniAry_Get(parts, 0);  // already flattened
+    }
+
+    // reserve whole length at once and concatenate parts
+    PadUni *flat = PadUni_New();
+    if (!flat) {
+        return NULL;
+    }
+    if (!PadUni_Resize(flat, self->builder.length)) {
+        PadUni_Del(flat);
+        return NULL;
+    }
+    for (int32_t i = 0; i < nparts; i++) {
+        if (!PadUni_AppOther(flat, PadUniAry_Getc(parts, i))) {
+            PadUni_Del(flat);
+            return NULL;
+        }
+    }
+
+    // PadUniAry_Clear does not delete elements by deleter
+    for (PadUni *part; (part = PadUniAry_PopMove(parts)); ) {
+        PadUni_Del(part);
+    }
+    if (!PadUniAry_MoveBack(parts, PadMem_Move(flat))) {
+        PadUni_Del(flat);
+        return NULL;
+    }
+
+    return PadUniAry_Get(parts, 0);
+}
+
+PadObj *
+PadObj_NewRange(PadGC *ref_gc, PadIntObj start, PadIntObj stop, PadIntObj step) {
+    if (!ref_gc || !step || PadObj_CalcRangeLen(start, stop, step) < 0) {
+        return NULL;
+    }
+
+    PadObj *self = PadObj_New(ref_gc, PAD_OBJ_TYPE__RANGE);
+    if (!self) {
+        return NULL;
+    }
+
+    self->range.start = start;
+    self->range.stop = stop;
+    self->range.step = step;
+
+    return self;
+}
+
+PadIntObj
+PadObj_CalcRangeLen(PadIntObj start, PadIntObj stop, PadIntObj step) {
+    // calculate by unsigned to avoid overflow of distance
+    unsigned long dist, ustep;
+    if (step > 0) {
+        if (start >= stop) {
+            return 0;
+        }
+        dist = (unsigned long) stop - (unsigned long) start;
+        ustep = (unsigned long) step;
+    } else if (step < 0) {
+        if (start <= stop) {
+            return 0;
+        }
+        dist = (unsigned long) start - (unsigned long) stop;
+        ustep = 0UL - (unsigned long) step;
+    } else {
+        return -1;
+    }
+
+    unsigned long len = (dist - 1) / ustep + 1;
+    if (len > LONG_MAX) {
+        return -1;  // e.g. range(LONG_MIN, LONG_MAX)
+    }
+
+    return (PadIntObj) len;
+}
+
+PadIntObj
+PadObj_GetRangeLen(const PadObj *self) {
+    if (!self || self->type != PAD_OBJ_TYPE__RANGE) {
+        return 0;
+    }
+
+    const PadRangeObj *r = &self->range;
+    return PadObj_CalcRangeLen(r->start, r->stop, r->step);
+}
+
+PadIntObj
+PadObj_GetRangeAt(const PadObj *self, PadIntObj index) {
+    // calculate by unsigned because overflow of signed is undefined.
+    // the result is in range of PadIntObj if index is less than length
+    const PadRangeObj *r = &self->range;
+    return (PadIntObj) ((unsigned long) r->start +
+                        (unsigned long) index * (unsigned long) r->step);
+}
+
 PadStr *
 PadObj_ToStr(const PadObj *self) {
     if (!self) {
@@ -874,8 +1230,9 @@ PadObj_ToStr(const PadObj *self) {
         if (!str) {
             return NULL;
         }
-        char buf[1024];
-        PadStr_AppFmt(str, buf, sizeof buf, "%ld", self->lvalue);
+        char buf[PAD_NUM__INT_STR_SIZE];
+        PadNum_IntToStr(buf, self->lvalue);
+        PadStr_Set(str, buf);
         return str;
     } break;
     case PAD_OBJ_TYPE__FLOAT: {
@@ -883,9 +1240,8 @@ PadObj_ToStr(const PadObj *self) {
         if (!str) {
             return NULL;
         }
-        char buf[1024];
-        snprintf(buf, sizeof buf, "%lf", self->float_value);
-        PadCStr_RStripFloatZero(buf);
+        char buf[PAD_NUM__FLOAT_STR_SIZE];
+        PadNum_FloatToStr(buf, self->float_value);
         PadStr_Set(str, buf);
         return str;
     } break;
@@ -926,6 +1282,30 @@ PadObj_ToStr(const PadObj *self) {
         PadStr_Set(str, "(dict)");
         return str;
     } break;
+    case PAD_OBJ_TYPE__DEQUE: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        PadStr_Set(str, "(deque)");
+        return str;
+    } break;
+    case PAD_OBJ_TYPE__NUMARRAY: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        PadStr_Set(str, "(numarray)");
+        return str;
+    } break;
+    case PAD_OBJ_TYPE__REGEX: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        PadStr_Set(str, "(regex)");
+        return str;
+    } break;
     case PAD_OBJ_TYPE__IDENT: {
         return PadStr_NewCStr(PadObj_GetcIdentName(self));
     } break;
@@ -1001,6 +1381,36 @@ PadObj_ToStr(const PadObj *self) {
         PadStr_Set(str, "(file)");
         return str;
     } break;
+    case PAD_OBJ_TYPE__RANGE: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        PadStr_Set(str, "(range)");
+        return str;
+    } break;
+    case PAD_OBJ_TYPE__DICT_VIEW: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        PadStr_Set(str, "(dict-view)");
+        return str;
+    } break;
+    case PAD_OBJ_TYPE__BUILDER: {
+        PadStr *str = PadStr_New();
+        if (!str) {
+            return NULL;
+        }
+        const PadUniAry *parts = self->builder.parts;
+        for (int32_t i = 0; i < PadUniAry_Len(parts); i++) {
+            PadStr_App(str, PadUni_GetcMB(PadUniAry_Get(parts, i)));
+        }
+        return str;
+    } break;
+    case PAD_OBJ_TYPE__N:
+        // not a type
+        break;
     } // switch
 
     fprintf(stderr, "object is %d\n", self->type);
@@ -1062,6 +1472,30 @@ PadObj_DecRef(PadObj *self) {
     self->gc_item.ref_counts -= 1;
 }
 
+PadObj *
+PadObj_StealUnicode(PadObj *self) {
+    if (!self || self->type != PAD_OBJ_TYPE__UNICODE) {
+        return NULL;
+    }
+    if (self->gc_item.ref_counts > 1) {
+        return NULL;
+    }
+
+    PadUni *empty = PadUni_New();
+    if (!empty) {
+        return NULL;
+    }
+
+    PadObj *obj = PadObj_NewUnicode(self->ref_gc, PadMem_Move(self->unicode));
+    if (!obj) {
+        PadUni_Del(empty);
+        return NULL;
+    }
+    self->unicode = PadMem_Move(empty);
+
+    return obj;
+}
+
 PadGCItem *
 PadObj_GetGcItem(PadObj *self) {
     if (!self) {
@@ -1179,6 +1613,15 @@ PadObj_TypeToStr(const PadObj *self) {
     case PAD_OBJ_TYPE__DICT:
         PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: dict>", self->type);
         break;
+    case PAD_OBJ_TYPE__DEQUE:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: deque>", self->type);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: numarray>", self->type);
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: regex>", self->type);
+        break;
     case PAD_OBJ_TYPE__FUNC:
         PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: func>", self->type);
         break;
@@ -1206,6 +1649,18 @@ PadObj_TypeToStr(const PadObj *self) {
     case PAD_OBJ_TYPE__FILE:
         PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: file>", self->type);
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: builder>", self->type);
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: range>", self->type);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        PadStr_AppFmt(s, tmp, sizeof tmp, "<%d: dict-view>", self->type);
+        break;
+    case PAD_OBJ_TYPE__N:
+        // not a type
+        break;
     }
 
     return s;
@@ -2,17 +2,23 @@
 
 #include <stdbool.h>
 #include <assert.h>
+#include <limits.h>
 
 #include <pad/lib/string.h>
 #include <pad/lib/cstring.h>
 #include <pad/lib/unicode.h>
+#include <pad/lib/unicode_array.h>
 #include <pad/lib/cstring.h>
 #include <pad/lib/memory.h>
 #include <pad/lib/error.h>
+#include <pad/lib/number.h>
+#include <pad/lib/num_array.h>
+#include <pad/lib/regex.h>
 #include <pad/lang/types.h>
 #include <pad/lang/nodes.h>
 #include <pad/lang/object_array.h>
 #include <pad/lang/object_dict.h>
+#include <pad/lang/object_deque.h>
 #include <pad/lang/gc.h>
 #include <pad/lang/ast.h>
 #include <pad/lang/chain_object.h>
@@ -93,6 +99,34 @@ typedef enum {
 
     // A file object
     PAD_OBJ_TYPE__FILE,
+
+    // A string builder object
+    // 文字列の断片を配列で保持し、build() されるまで連結を遅延する
+    PAD_OBJ_TYPE__BUILDER,
+
+    // A range object
+    // 整数の範囲を start, stop, step だけで表し、要素は添字から計算する
+    PAD_OBJ_TYPE__RANGE,
+
+    // A deque object
+    // 両端への push と pop が O(1) のリングバッファ
+    PAD_OBJ_TYPE__DEQUE,
+
+    // A numeric array object
+    // int64 か float64 の要素を連続したバッファに持つ 1 次元か 2 次元の配列
+    PAD_OBJ_TYPE__NUMARRAY,
+
+    // A dict view object
+    // dict.keys() などが返す辞書のビュー。辞書を参照し、要素は添字から作る
+    PAD_OBJ_TYPE__DICT_VIEW,
+
+    // A regular expression object
+    // re.compile() が返すコンパイル済みのパターン。DFA のキャッシュを持つ
+    PAD_OBJ_TYPE__REGEX,
+
+    // Number of object types (not a type)
+    // 型ごとのテーブルの大きさ。新しい型はこの前に追加する
+    PAD_OBJ_TYPE__N,
 } PadObjType;
 
 /**
@@ -184,6 +218,44 @@ struct PadFileObj {
     FILE *fp;
 };
 
+/**
+ * A string builder (rope)
+ * parts are flattened to one part by build()
+ */
+struct PadBuilderObj {
+    PadUniAry *parts;  // appended strings (parts share buffer by copy on write)
+    int32_t length;  // sum of length of parts
+};
+
+/**
+ * A lazy range of integers
+ * elements are computed from index and never materialized
+ */
+struct PadRangeObj {
+    PadIntObj start;
+    PadIntObj stop;  // not included
+    PadIntObj step;  // not zero
+};
+
+/**
+ * kind of dict view
+ */
+typedef enum {
+    PAD_DICT_VIEW__KEYS,  // elements are keys
+    PAD_DICT_VIEW__VALUES,  // elements are values
+    PAD_DICT_VIEW__ITEMS,  // elements are pairs of key and value
+} PadDictViewKind;
+
+/**
+ * A lazy view of dict
+ * the view refers the dict and follows changes of it. elements are made
+ * from index of dict when accessed
+ */
+struct PadDictViewObj {
+    PadObj *dict;  // dict object (the view has one reference of it)
+    PadDictViewKind kind;
+};
+
 /**
  * A abstract object
  */
@@ -195,6 +267,9 @@ struct PadObj {
     PadUni *unicode;  // value of unicode (type == PAD_OBJ_TYPE__UNICODE)
     PadObjAry *objarr;  // value of array (type == PAD_OBJ_TYPE__ARRAY)
     PadObjDict *objdict;  // value of dict (type == PAD_OBJ_TYPE__DICT)
+    PadObjDeq *objdeq;  // value of deque (type == PAD_OBJ_TYPE__DEQUE)
+    PadNumAry *numarr;  // value of numeric array (type == PAD_OBJ_TYPE__NUMARRAY)
+    PadRegex *regex;  // value of regular expression (type == PAD_OBJ_TYPE__REGEX)
     PadIntObj lvalue;  // value of integer (type == PAD_OBJ_TYPE__INT)
     PadFloatObj float_value;  // value of float (type == PAD_OBJ_TYPE__FLOAT)
     bool boolean;  // value of boolean (type == PAD_OBJ_TYPE__BOOL)
@@ -207,6 +282,9 @@ struct PadObj {
     PadTypeObj type_obj;  // structure of type (type == PAD_OBJ_TYPE__TYPE)
     PadBltFuncObj builtin_func;  // structure of builtin func (type == PAD_OBJ_TYPE__BLTIN_FUNC)
     PadFileObj file;  // structure of file object (type == PAD_OBJ_TYPE__FILE)
+    PadBuilderObj builder;  // structure of string builder (type == PAD_OBJ_TYPE__BUILDER)
+    PadRangeObj range;  // structure of range (type == PAD_OBJ_TYPE__RANGE)
+    PadDictViewObj dict_view;  // structure of dict view (type == PAD_OBJ_TYPE__DICT_VIEW)
 };
 
 /**
@@ -414,6 +492,95 @@ PadObj_NewAry(PadGC *ref_gc, PadObjAry *move_objarr);
 PadObj *
 PadObj_NewDict(PadGC *ref_gc, PadObjDict *move_objdict);
 
+/**
+ * construct deque object by PadObjDeq
+ *
+ * @param[in] *ref_gc      reference to PadGC (do not delete)
+ * @param[in] *move_objdeq pointer to PadObjDeq (with move semantics)
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_NewDeq(PadGC *ref_gc, PadObjDeq *move_objdeq);
+
+/**
+ * construct numeric array object by PadNumAry
+ *
+ * @param[in] *ref_gc      reference to PadGC (do not delete)
+ * @param[in] *move_numarr pointer to PadNumAry (with move semantics)
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_NewNumAry(PadGC *ref_gc, PadNumAry *move_numarr);
+
+/**
+ * construct regular expression object by PadRegex
+ *
+ * @param[in] *ref_gc     reference to PadGC (do not delete)
+ * @param[in] *move_regex pointer to PadRegex (with move semantics)
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_NewRegex(PadGC *ref_gc, PadRegex *move_regex);
+
+/**
+ * construct object of element of numeric array
+ * element of 1-D array is int or float and element of 2-D array is row
+ * (1-D view of same buffer). index is not checked (see PadNumAry_Len)
+ *
+ * @param[in] *ref_gc reference to PadGC (do not delete)
+ * @param[in] *self   numeric array object
+ * @param[in] index   number of index
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_NewNumAryItem(PadGC *ref_gc, const PadObj *self, int32_t index);
+
+/**
+ * construct view of dict object
+ *
+ * @param[in] *ref_gc  reference to PadGC (do not delete)
+ * @param[in] *dictobj dict object (type == PAD_OBJ_TYPE__DICT)
+ * @param[in] kind     kind of view
+ *
+ * @return success to pointer to PadObj (new object)
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_NewDictView(PadGC *ref_gc, PadObj *dictobj, PadDictViewKind kind);
+
+/**
+ * get number of elements of dict view
+ *
+ * @param[in] *self pointer to PadObj (type == PAD_OBJ_TYPE__DICT_VIEW)
+ *
+ * @return number of elements
+ */
+int32_t
+PadObj_GetDictViewLen(const PadObj *self);
+
+/**
+ * construct object of element of dict view
+ * key is new unicode, value is reference of value in dict and item is
+ * new array of key and value
+ *
+ * @param[in] *ref_gc reference to PadGC (do not delete)
+ * @param[in] *self   pointer to PadObj (type == PAD_OBJ_TYPE__DICT_VIEW)
+ * @param[in] index   number of index
+ *
+ * @return success to pointer to PadObj
+ * @return out of range to NULL
+ */
+PadObj *
+PadObj_NewDictViewItem(PadGC *ref_gc, const PadObj *self, int32_t index);
+
 /**
  * construct function object by parameters
  * if failed to allocate memory then exit from process
@@ -547,6 +714,90 @@ PadObj_NewBltFunc(PadGC *ref_gc, const char *funcname);
 PadObj *
 PadObj_NewFile(PadGC *ref_gc, FILE *move_fp);
 
+/**
+ * construct string builder object
+ * if failed to allocate memory then exit from process
+ *
+ * @param[in] *ref_gc
+ *
+ * @return pointer to PadObj
+ */
+PadObj *
+PadObj_NewBuilder(PadGC *ref_gc);
+
+/**
+ * append string to string builder
+ * the buffer of string is shared by copy on write
+ *
+ * @param[in] *self pointer to PadObj (type == PAD_OBJ_TYPE__BUILDER)
+ * @param[in] *uni  string
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadObj *
+PadObj_AppBuilder(PadObj *self, const PadUni *uni);
+
+/**
+ * flatten parts of string builder to one string
+ *
+ * @param[in] *self pointer to PadObj (type == PAD_OBJ_TYPE__BUILDER)
+ *
+ * @return success to pointer to flattened PadUni (DO NOT DELETE)
+ * @return failed to NULL
+ */
+PadUni *
+PadObj_BuildBuilder(PadObj *self);
+
+/**
+ * construct range object
+ *
+ * @param[in] *ref_gc
+ * @param[in] start  first value
+ * @param[in] stop   end value (not included)
+ * @param[in] step   step of values (not zero)
+ *
+ * @return success to pointer to PadObj
+ * @return failed to NULL (step is zero or number of values is too large)
+ */
+PadObj *
+PadObj_NewRange(PadGC *ref_gc, PadIntObj start, PadIntObj stop, PadIntObj step);
+
+/**
+ * calculate number of values of range
+ *
+ * @param[in] start first value
+ * @param[in] stop  end value (not included)
+ * @param[in] step  step of values
+ *
+ * @return success to number of values
+ * @return failed to -1 (step is zero or number of values is over PadIntObj)
+ */
+PadIntObj
+PadObj_CalcRangeLen(PadIntObj start, PadIntObj stop, PadIntObj step);
+
+/**
+ * get number of values of range object
+ *
+ * @param[in] *self pointer to PadObj (type == PAD_OBJ_TYPE__RANGE)
+ *
+ * @return number of values
+ */
+PadIntObj
+PadObj_GetRangeLen(const PadObj *self);
+
+/**
+ * get value at index of range object
+ * index is not checked (see PadObj_GetRangeLen)
+ *
+ * @param[in] *self pointer to PadObj (type == PAD_OBJ_TYPE__RANGE)
+ * @param[in] index number of index
+ *
+ * @return value
+ */
+PadIntObj
+PadObj_GetRangeAt(const PadObj *self, PadIntObj index);
+
 /**
  * object to PadStr
  *
@@ -585,6 +836,20 @@ PadObj_IncRef(PadObj *self);
 void
 PadObj_DecRef(PadObj *self);
 
+/**
+ * move unicode of unicode object to new unicode object if the object is
+ * not referenced by others. the source object keeps empty unicode.
+ * in-place operations (s += x) use this for keep identity of strings
+ * without copy of buffer
+ *
+ * @param[in] *self pointer to unicode object
+ *
+ * @return success to pointer to new PadObj
+ * @return failed to NULL (not unicode or referenced by others)
+ */
+PadObj *
+PadObj_StealUnicode(PadObj *self);
+
 /**
  * get reference of PadGCItem in object
  *
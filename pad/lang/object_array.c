@@ -4,12 +4,86 @@ enum {
     OBJARR_INIT_CAPA = 4,
 };
 
-struct PadObjAry {
-    PadGC *ref_gc;
-    int32_t len;
-    int32_t capa;
-    PadObj **parray;
-};
+/*****************
+* copy on write *
+*****************/
+
+/**
+ * if parray is shared with other arrays then release own reference
+ *
+ * @return the parray is still used by other arrays to true
+ * @return else false
+ */
+static bool
+release_shared(PadObjAry *self) {
+    if (!self->parray_refs) {
+        return false;
+    }
+
+    *self->parray_refs -= 1;
+    if (*self->parray_refs > 0) {
+        self->parray = NULL;
+        self->parray_refs = NULL;
+        return true;
+    }
+
+    free(self->parray_refs);
+    self->parray_refs = NULL;
+    return false;
+}
+
+/**
+ * copy on write. the parray of self be own parray before mutation
+ *
+ * @return success to self
+ * @return failed to NULL
+ */
+static PadObjAry *
+unshare(PadObjAry *self) {
+    if (!self->parray_refs) {
+        return self;  // not shared
+    }
+    if (*self->parray_refs == 1) {
+        free(self->parray_refs);  // other arrays were already gone
+        self->parray_refs = NULL;
+        return self;
+    }
+
+    int byte = sizeof(PadObj *);
+    PadObj **parray = PadMem_Calloc(self->capa + 1, byte);
+    if (!parray) {
+        return NULL;
+    }
+    memcpy(parray, self->parray, self->len * byte);
+
+    for (int32_t i = 0; i < self->len; ++i) {
+        PadObj_IncRef(parray[i]);
+    }
+
+    *self->parray_refs -= 1;
+    self->parray_refs = NULL;
+    self->parray = parray;
+
+    return self;
+}
+
+/**
+ * the immutable objects can share between copies of array.
+ * the operators (+=, etc) do not change these objects and make new objects
+ */
+static bool
+is_immutable(const PadObj *obj) {
+    switch (obj->type) {
+    default:
+        return false;
+    case PAD_OBJ_TYPE__NIL:
+    case PAD_OBJ_TYPE__BOOL:
+    case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__FLOAT:
+    case PAD_OBJ_TYPE__UNICODE:
+        return true;
+    }
+}
 
 /*****************
 * delete and new *
@@ -20,6 +94,10 @@ PadObjAry_Del(PadObjAry* self) {
     if (!self) {
         return;
     }
+    if (release_shared(self)) {
+        free(self);
+        return;
+    }
 
     for (int i = 0; i < self->len; ++i) {
         PadObj *obj = self->parray[i];
@@ -31,11 +109,35 @@ PadObjAry_Del(PadObjAry* self) {
     free(self);
 }
 
+void
+PadObjAry_DelFixed(PadObjAry *self) {
+    if (!self) {
+        return;
+    }
+
+    for (int i = 0; i < self->len; ++i) {
+        PadObj *obj = self->parray[i];
+        PadObj_DecRef(obj);
+        PadObj_Del(obj);
+    }
+
+    if (self->parray != self->fixed_parray) {
+        free(self->parray);  // spilled to heap
+    }
+
+    self->parray = NULL;
+    self->len = self->capa = 0;
+}
+
 void
 PadObjAry_DelWithoutObjs(PadObjAry* self) {
     if (!self) {
         return;
     }
+    if (release_shared(self)) {
+        free(self);
+        return;
+    }
 
     free(self->parray);
     free(self);
@@ -59,9 +161,59 @@ PadObjAry_New(void) {
     return self;
 }
 
+PadObjAry *
+PadObjAry_InitFixed(PadObjAry *self, PadObj **buf, int32_t capa) {
+    if (!self || !buf || capa <= 0) {
+        return NULL;
+    }
+
+    *self = (PadObjAry) {0};
+    self->parray = buf;
+    self->fixed_parray = buf;
+    self->capa = capa;
+    self->parray[0] = NULL;
+
+    return self;
+}
+
 PadObj *
 PadObj_DeepCopy(const PadObj *other);
 
+/**
+ * share parray of other with self if the elements are immutable
+ *
+ * @return shared to true
+ * @return else false
+ */
+static bool
+share_parray(PadObjAry *self, const PadObjAry *_other) {
+    PadObjAry *other = (PadObjAry *) _other;
+    if (other->fixed_parray && other->parray == other->fixed_parray) {
+        return false;  // the buffer of caller can't share
+    }
+    for (int32_t i = 0; i < other->len; ++i) {
+        if (!is_immutable(other->parray[i])) {
+            return false;
+        }
+    }
+
+    if (!other->parray_refs) {
+        other->parray_refs = PadMem_Calloc(1, sizeof(int32_t));
+        if (!other->parray_refs) {
+            return false;
+        }
+        *other->parray_refs = 1;
+    }
+
+    self->parray = other->parray;
+    self->parray_refs = other->parray_refs;
+    self->capa = other->capa;
+    self->len = other->len;
+    *self->parray_refs += 1;
+
+    return true;
+}
+
 PadObjAry*
 PadObjAry_DeepCopy(const PadObjAry *other) {
     PadObjAry *self = PadMem_Calloc(1, sizeof(*self));
@@ -69,6 +221,11 @@ PadObjAry_DeepCopy(const PadObjAry *other) {
         return NULL;
     }
 
+    // elements are copied at first mutation (copy on write)
+    if (share_parray(self, other)) {
+        return self;
+    }
+
     self->parray = PadMem_Calloc(other->capa+1, sizeof(PadObj *));
     if (!self->parray) {
         PadObjAry_Del(self);
@@ -161,11 +318,28 @@ PadObjAry_Resize(PadObjAry* self, int32_t capa) {
     if (!self || capa < 0) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     int byte = sizeof(PadObj *);
-    PadObj **tmparr = PadMem_Realloc(self->parray, capa * byte + byte);
-    if (!tmparr) {
-        return NULL;
+    PadObj **tmparr;
+
+    if (self->fixed_parray && self->parray == self->fixed_parray) {
+        // the fixed buffer is not ours. move elements to the heap
+        if (capa < self->len) {
+            return NULL;
+        }
+        tmparr = PadMem_Calloc(capa + 1, byte);
+        if (!tmparr) {
+            return NULL;
+        }
+        memcpy(tmparr, self->parray, self->len * byte);
+    } else {
+        tmparr = PadMem_Realloc(self->parray, capa * byte + byte);
+        if (!tmparr) {
+            return NULL;
+        }
     }
 
     self->parray = tmparr;
@@ -179,6 +353,9 @@ PadObjAry_Move(PadObjAry* self, int32_t index, PadObj *move_obj) {
     if (index < 0 || index >= self->capa) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     PadObj *old = self->parray[index];
     if (old != move_obj) {
@@ -198,6 +375,9 @@ PadObjAry_Set(PadObjAry* self, int32_t index, PadObj *ref_obj) {
 
 PadObjAry *
 PadObjAry_MoveBack(PadObjAry* self, PadObj *obj) {
+    if (!unshare(self)) {
+        return NULL;
+    }
     if (self->len >= self->capa) {
         if (!PadObjAry_Resize(self, self->capa * 2)) {
             return NULL;
@@ -213,6 +393,9 @@ PadObjAry_MoveBack(PadObjAry* self, PadObj *obj) {
 
 PadObjAry *
 PadObjAry_MoveFront(PadObjAry* self, PadObj *obj) {
+    if (!unshare(self)) {
+        return NULL;
+    }
     if (self->len >= self->capa) {
         if (!PadObjAry_Resize(self, self->capa * 2)) {
             return NULL;
@@ -246,6 +429,9 @@ PadObjAry_PopBack(PadObjAry *self) {
     if (self->len <= 0) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     self->len--;
     PadObj *obj = self->parray[self->len];
@@ -274,6 +460,43 @@ PadObjAry_AppOther(PadObjAry *self, PadObjAry *other) {
     return self;
 }
 
+PadObjAry *
+PadObjAry_Reverse(PadObjAry *self) {
+    if (!unshare(self)) {
+        return NULL;
+    }
+
+    for (int32_t i = 0, j = self->len - 1; i < j; ++i, --j) {
+        PadObj *tmp = self->parray[i];
+        self->parray[i] = self->parray[j];
+        self->parray[j] = tmp;
+    }
+
+    return self;
+}
+
+PadObjAry *
+PadObjAry_Permute(PadObjAry *self, const int32_t *order) {
+    if (!order) {
+        return NULL;
+    }
+    if (!unshare(self)) {
+        return NULL;
+    }
+
+    PadObj **parray = PadMem_Calloc(self->len + 1, sizeof(PadObj *));
+    if (!parray) {
+        return NULL;
+    }
+    for (int32_t i = 0; i < self->len; ++i) {
+        parray[i] = self->parray[order[i]];
+    }
+    memcpy(self->parray, parray, self->len * sizeof(PadObj *));
+    free(parray);
+
+    return self;
+}
+
 PadObj *
 PadObjAry_GetLast(PadObjAry *self) {
     if (self->len <= 0) {
@@ -2,13 +2,32 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <pad/lib/memory.h>
 #include <pad/lang/types.h>
 #include <pad/lang/object.h>
 #include <pad/lang/gc.h>
 
-struct PadObjAry;
+enum {
+    // capacity of owners buffer on the stack for chain evaluation
+    PAD_OBJ_ARY__FIXED_CAPA = 8,
+};
+
+struct PadObjAry {
+    PadGC *ref_gc;
+    int32_t len;
+    int32_t capa;
+    PadObj **parray;
+
+    // if not NULL then this is a buffer of caller (see PadObjAry_InitFixed)
+    PadObj **fixed_parray;  // do not delete
+
+    // reference counts of parray shared by PadObjAry_DeepCopy
+    // if NULL then the parray is not shared
+    int32_t *parray_refs;
+};
+
 typedef struct PadObjAry PadObjAry;
 
 /*****************
@@ -21,6 +40,30 @@ PadObjAry_Del(PadObjAry* self);
 void
 PadObjAry_DelWithoutObjs(PadObjAry* self);
 
+/**
+ * initialize array on caller's buffer. the array does not allocate memory
+ * while the number of elements is less than capa. if over then elements
+ * are moved to the heap
+ *
+ * @param[in] *self pointer to array (usually on the stack)
+ * @param[in] **buf buffer of capa+1 elements (+1 for final null)
+ * @param[in] capa  capacity of buffer
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadObjAry *
+PadObjAry_InitFixed(PadObjAry *self, PadObj **buf, int32_t capa);
+
+/**
+ * release elements of array initialized by PadObjAry_InitFixed
+ * this does not free self and caller's buffer
+ *
+ * @param[in] *self
+ */
+void
+PadObjAry_DelFixed(PadObjAry *self);
+
 PadObjAry*
 PadObjAry_New(void);
 
@@ -99,6 +142,30 @@ PadObjAry_GetcLast(const PadObjAry *self);
 PadObjAry *
 PadObjAry_AppOther(PadObjAry *self, PadObjAry *other);
 
+/**
+ * reverse order of elements in place
+ *
+ * @param[in] *self
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadObjAry *
+PadObjAry_Reverse(PadObjAry *self);
+
+/**
+ * reorder elements in place. the element of index order[i] moves to index i
+ * reference counts of elements are not changed
+ *
+ * @param[in] *self
+ * @param[in] *order permutation of indexes (length is length of array)
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadObjAry *
+PadObjAry_Permute(PadObjAry *self, const int32_t *order);
+
 /**
  * dump object array at stream
  *
@@ -0,0 +1,195 @@
+#include <pad/lang/object_deque.h>
+
+enum {
+    OBJDEQ_INIT_CAPA = 8,  // power of 2
+};
+
+/**
+ * index of ring buffer by index from front
+ */
+static inline int32_t
+ring_index(const PadObjDeq *self, int32_t index) {
+    return (self->head + index) & (self->capa - 1);
+}
+
+/**
+ * double capacity and move elements to front of new ring buffer
+ */
+static PadObjDeq *
+grow(PadObjDeq *self) {
+    int32_t capa = self->capa * 2;
+    PadObj **ring = PadMem_Calloc(capa, sizeof(PadObj *));
+    if (!ring) {
+        return NULL;
+    }
+
+    // copy two runs of [head, capa) and [0, tail) at once
+    int32_t first = self->capa - self->head;
+    if (first > self->len) {
+        first = self->len;
+    }
+    memcpy(ring, self->ring + self->head, first * sizeof(PadObj *));
+    memcpy(ring + first, self->ring, (self->len - first) * sizeof(PadObj *));
+
+    free(self->ring);
+    self->ring = ring;
+    self->capa = capa;
+    self->head = 0;
+
+    return self;
+}
+
+/*****************
+* delete and new *
+*****************/
+
+void
+PadObjDeq_Del(PadObjDeq *self) {
+    if (!self) {
+        return;
+    }
+
+    PadObjDeq_Clear(self);
+    free(self->ring);
+    free(self);
+}
+
+PadObjDeq *
+PadObjDeq_New(void) {
+    PadObjDeq *self = PadMem_Calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    self->ring = PadMem_Calloc(OBJDEQ_INIT_CAPA, sizeof(PadObj *));
+    if (!self->ring) {
+        free(self);
+        return NULL;
+    }
+
+    self->capa = OBJDEQ_INIT_CAPA;
+
+    return self;
+}
+
+static PadObjDeq *
+copy(const PadObjDeq *other, PadObj *(*copy_obj)(const PadObj *)) {
+    if (!other) {
+        return NULL;
+    }
+
+    PadObjDeq *self = PadObjDeq_New();
+    if (!self) {
+        return NULL;
+    }
+
+    for (int32_t i = 0; i < other->len; ++i) {
+        PadObj *obj = copy_obj(PadObjDeq_Get(other, i));
+        if (!obj || !PadObjDeq_PushBack(self, obj)) {
+            PadObj_Del(obj);
+            PadObjDeq_Del(self);
+            return NULL;
+        }
+    }
+
+    return self;
+}
+
+PadObjDeq *
+PadObjDeq_DeepCopy(const PadObjDeq *other) {
+    return copy(other, PadObj_DeepCopy);
+}
+
+PadObjDeq *
+PadObjDeq_ShallowCopy(const PadObjDeq *other) {
+    return copy(other, PadObj_ShallowCopy);
+}
+
+/*********
+* getter *
+*********/
+
+int32_t
+PadObjDeq_Len(const PadObjDeq *self) {
+    return self->len;
+}
+
+PadObj *
+PadObjDeq_Get(const PadObjDeq *self, int32_t index) {
+    if (index < 0 || index >= self->len) {
+        return NULL;
+    }
+
+    return self->ring[ring_index(self, index)];
+}
+
+/*********
+* setter *
+*********/
+
+PadObjDeq *
+PadObjDeq_PushBack(PadObjDeq *self, PadObj *ref_obj) {
+    if (self->len >= self->capa && !grow(self)) {
+        return NULL;
+    }
+
+    PadObj_IncRef(ref_obj);
+    self->ring[ring_index(self, self->len)] = ref_obj;
+    self->len++;
+
+    return self;
+}
+
+PadObjDeq *
+PadObjDeq_PushFront(PadObjDeq *self, PadObj *ref_obj) {
+    if (self->len >= self->capa && !grow(self)) {
+        return NULL;
+    }
+
+    PadObj_IncRef(ref_obj);
+    self->head = (self->head - 1) & (self->capa - 1);
+    self->ring[self->head] = ref_obj;
+    self->len++;
+
+    return self;
+}
+
+PadObj *
+PadObjDeq_PopBack(PadObjDeq *self) {
+    if (self->len <= 0) {
+        return NULL;
+    }
+
+    self->len--;
+    int32_t i = ring_index(self, self->len);
+    PadObj *obj = self->ring[i];
+    self->ring[i] = NULL;
+
+    return obj;
+}
+
+PadObj *
+PadObjDeq_PopFront(PadObjDeq *self) {
+    if (self->len <= 0) {
+        return NULL;
+    }
+
+    PadObj *obj = self->ring[self->head];
+    self->ring[self->head] = NULL;
+    self->head = (self->head + 1) & (self->capa - 1);
+    self->len--;
+
+    return obj;
+}
+
+void
+PadObjDeq_Clear(PadObjDeq *self) {
+    for (int32_t i = 0; i < self->len; ++i) {
+        PadObj *obj = PadObjDeq_Get(self, i);
+        PadObj_DecRef(obj);
+        PadObj_Del(obj);
+    }
+
+    self->head = 0;
+    self->len = 0;
+}
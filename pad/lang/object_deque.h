@@ -0,0 +1,155 @@
+/**
+ * Deque of objects
+ *
+ * elements are stored in ring buffer. push and pop at both ends are O(1)
+ * and the buffer grows by double when it is full
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pad/lib/memory.h>
+#include <pad/lang/types.h>
+#include <pad/lang/object.h>
+
+struct PadObjDeq {
+    PadObj **ring;  // ring buffer (capa is power of 2)
+    int32_t capa;  // capacity of ring buffer
+    int32_t head;  // index of first element in ring buffer
+    int32_t len;  // number of elements
+};
+
+/*****************
+* delete and new *
+*****************/
+
+/**
+ * destruct deque and decrement reference counts of elements
+ *
+ * @param[in] *self
+ */
+void
+PadObjDeq_Del(PadObjDeq *self);
+
+/**
+ * construct empty deque
+ *
+ * @return success to pointer to PadObjDeq
+ * @return failed to NULL
+ */
+PadObjDeq *
+PadObjDeq_New(void);
+
+/**
+ * deep copy of deque. elements are deep copied
+ *
+ * @param[in] *other
+ *
+ * @return success to pointer to PadObjDeq
+ * @return failed to NULL
+ */
+PadObjDeq *
+PadObjDeq_DeepCopy(const PadObjDeq *other);
+
+/**
+ * shallow copy of deque. elements are shallow copied
+ *
+ * @param[in] *other
+ *
+ * @return success to pointer to PadObjDeq
+ * @return failed to NULL
+ */
+PadObjDeq *
+PadObjDeq_ShallowCopy(const PadObjDeq *other);
+
+/*********
+* getter *
+*********/
+
+/**
+ * get number of elements
+ *
+ * @param[in] *self
+ *
+ * @return number of elements
+ */
+int32_t
+PadObjDeq_Len(const PadObjDeq *self);
+
+/**
+ * get element by index from front
+ *
+ * @param[in] *self
+ * @param[in] index number of index
+ *
+ * @return success to reference to element
+ * @return out of range to NULL
+ */
+PadObj *
+PadObjDeq_Get(const PadObjDeq *self, int32_t index);
+
+/*********
+* setter *
+*********/
+
+/**
+ * push element at back. increments reference count of element
+ *
+ * @param[in] *self
+ * @param[in] *ref_obj reference to element
+ *
+ * @return success to self
+ * @return failed to NULL
+ */
+PadObjDeq *
+PadObjDeq_PushBack(PadObjDeq *self, PadObj *ref_obj);
+
+/**
+ * push element at front. increments reference count of element
+ *
+ * @param[in] *self
+ * @param[in] *ref_obj reference to element
+ *
+ * @return success to self
+ * @return failed to NULL
+ */
+PadObjDeq *
+PadObjDeq_PushFront(PadObjDeq *self, PadObj *ref_obj);
+
+/**
+ * pop element from back
+ * the reference count of element is not decremented like PadObjAry_PopBack
+ *
+ * @param[in] *self
+ *
+ * @return success to element
+ * @return empty to NULL
+ */
+PadObj *
+PadObjDeq_PopBack(PadObjDeq *self);
+
+/**
+ * pop element from front
+ * the reference count of element is not decremented like PadObjAry_PopBack
+ *
+ * @param[in] *self
+ *
+ * @return success to element
+ * @return empty to NULL
+ */
+PadObj *
+PadObjDeq_PopFront(PadObjDeq *self);
+
+/**
+ * remove all elements
+ *
+ * @param[in] *self
+ */
+void
+PadObjDeq_Clear(PadObjDeq *self);
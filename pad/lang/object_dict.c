@@ -9,6 +9,10 @@ struct PadObjDict {
     PadObjDictItem *map;
     size_t capa;
     size_t len;
+
+    // reference counts of map shared by PadObjDict_DeepCopy
+    // if NULL then the map is not shared
+    int32_t *map_refs;
 };
 
 void
@@ -17,11 +21,129 @@ PadObj_Del(PadObj *self);
 typedef struct PadStr PadStr;
 PadStr * PadObj_ToStr(const PadObj *self);
 
+/*****************
+* copy on write *
+*****************/
+
+/**
+ * if map is shared with other dicts then release own reference
+ *
+ * @return the map is still used by other dicts to true
+ * @return else false
+ */
+static bool
+release_shared(PadObjDict *self) {
+    if (!self->map_refs) {
+        return false;
+    }
+
+    *self->map_refs -= 1;
+    if (*self->map_refs > 0) {
+        self->map = NULL;
+        self->map_refs = NULL;
+        return true;
+    }
+
+    free(self->map_refs);
+    self->map_refs = NULL;
+    return false;
+}
+
+/**
+ * copy on write. the map of self be own map before mutation
+ *
+ * @return success to self
+ * @return failed to NULL
+ */
+static PadObjDict *
+unshare(PadObjDict *self) {
+    if (!self->map_refs) {
+        return self;  // not shared
+    }
+    if (*self->map_refs == 1) {
+        free(self->map_refs);  // other dicts were already gone
+        self->map_refs = NULL;
+        return self;
+    }
+
+    int32_t byte = sizeof(PadObjDictItem);
+    PadObjDictItem *map = PadMem_Calloc(self->capa + 1, byte);
+    if (!map) {
+        return NULL;
+    }
+    memcpy(map, self->map, self->len * byte);
+
+    for (int32_t i = 0; i < self->len; ++i) {
+        PadObj_IncRef(map[i].value);
+    }
+
+    *self->map_refs -= 1;
+    self->map_refs = NULL;
+    self->map = map;
+
+    return self;
+}
+
+/**
+ * the immutable objects can share between copies of dict.
+ * the operators (+=, etc) do not change these objects and make new objects
+ */
+static bool
+is_immutable(const PadObj *obj) {
+    switch (obj->type) {
+    default:
+        return false;
+    case PAD_OBJ_TYPE__NIL:
+    case PAD_OBJ_TYPE__BOOL:
+    case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__FLOAT:
+    case PAD_OBJ_TYPE__UNICODE:
+        return true;
+    }
+}
+
+/**
+ * share map of other with self if the values are immutable
+ *
+ * @return shared to true
+ * @return else false
+ */
+static bool
+share_map(PadObjDict *self, const PadObjDict *_other) {
+    PadObjDict *other = (PadObjDict *) _other;
+    for (int32_t i = 0; i < other->len; ++i) {
+        if (!is_immutable(other->map[i].value)) {
+            return false;
+        }
+    }
+
+    if (!other->map_refs) {
+        other->map_refs = PadMem_Calloc(1, sizeof(int32_t));
+        if (!other->map_refs) {
+            return false;
+        }
+        *other->map_refs = 1;
+    }
+
+    self->ref_gc = other->ref_gc;
+    self->map = other->map;
+    self->map_refs = other->map_refs;
+    self->capa = other->capa;
+    self->len = other->len;
+    *self->map_refs += 1;
+
+    return true;
+}
+
 void
 PadObjDict_Del(PadObjDict *self) {
     if (!self) {
         return;
     }
+    if (release_shared(self)) {
+        free(self);
+        return;
+    }
 
     for (int32_t i = 0; i < self->len; ++i) {
         PadObj *obj = self->map[i].value;
@@ -40,6 +162,9 @@ PadObjDict_EscDel(PadObjDict *self) {
     if (!self) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     PadObjDictItem *map = PadMem_Move(self->map);
     self->map = NULL;
@@ -85,6 +210,11 @@ PadObjDict_DeepCopy(const PadObjDict *other) {
         return NULL;
     }
 
+    // values are copied at first mutation (copy on write)
+    if (share_map(self, other)) {
+        return self;
+    }
+
     self->capa = other->capa;
     self->len = other->len;
     self->map = PadMem_Calloc(self->capa + 1, sizeof(PadObjDictItem));
@@ -145,6 +275,9 @@ PadObjDict_Resize(PadObjDict *self, int32_t newcapa) {
     if (!self || newcapa < 0) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     int32_t byte = sizeof(PadObjDictItem);
     PadObjDictItem *tmpmap = PadMem_Realloc(self->map, newcapa*byte + byte);
@@ -162,6 +295,9 @@ PadObjDict_Move(PadObjDict *self, const char *key, struct PadObj *move_value) {
     if (!self || !key || !move_value) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     // over write by key ?
     for (int i = 0; i < self->len; ++i) {
@@ -197,21 +333,29 @@ PadObjDict_Set(PadObjDict *self, const char *key, PadObj *ref_value) {
     return PadObjDict_Move(self, key, ref_value);
 }
 
+static PadObjDictItem *
+find_item(const PadObjDict *self, const char *key) {
+    for (int i = 0; i < self->len; ++i) {
+        if (PadCStr_Eq(self->map[i].key, key)) {
+            return &self->map[i];
+        }
+    }
+
+    return NULL;
+}
+
 PadObjDictItem *
 PadObjDict_Get(PadObjDict *self, const char *key) {
     if (!self || !key) {
         return NULL;
     }
 
-    for (int i = 0; i < self->len; ++i) {
-        if (PadCStr_Eq(self->map[i].key, key)) {
-            // printf("PadObjDict_Get (%p) key (%s) val (%p)\n", self, key, self->map[i].value);
-            return &self->map[i];
-        }
+    // the item is writable for caller
+    if (!unshare(self)) {
+        return NULL;
     }
 
-    // printf("PadObjDict_Get (%p) not found by (%s)\n", self, key);
-    return NULL;
+    return find_item(self, key);
 }
 
 const PadObjDictItem *
@@ -220,8 +364,7 @@ PadObjDict_Getc(const PadObjDict *self, const char *key) {
         return NULL;
     }
 
-    // const cast danger
-    return PadObjDict_Get((PadObjDict *)self, key);
+    return find_item(self, key);
 }
 
 void
@@ -229,6 +372,9 @@ PadObjDict_Clear(PadObjDict *self) {
     if (!self) {
         return;
     }
+    if (!unshare(self)) {
+        return;
+    }
 
     for (int i = 0; i < self->len; ++i) {
         self->map[i].key[0] = '\0';
@@ -256,13 +402,23 @@ PadObjDict_GetIndex(PadObjDict *self, int32_t index) {
     if (index < 0 || index >= self->len) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     return &self->map[index];
 }
 
 const PadObjDictItem *
 PadObjDict_GetcIndex(const PadObjDict *self, int32_t index) {
-    return PadObjDict_GetIndex((PadObjDict *) self, index);
+    if (!self) {
+        return NULL;
+    }
+    if (index < 0 || index >= self->len) {
+        return NULL;
+    }
+
+    return &self->map[index];
 }
 
 PadObj *
@@ -270,6 +426,9 @@ PadObjDict_Pop(PadObjDict *self, const char *key) {
     if (!self || !key) {
         return NULL;
     }
+    if (!unshare(self)) {
+        return NULL;
+    }
 
     // find item by key
     int32_t found_index = -1;
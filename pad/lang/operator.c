@@ -0,0 +1,444 @@
+#include <pad/lang/operator.h>
+#include <pad/lang/utils.h>
+
+/*********
+* macros *
+*********/
+
+#define push_err(fmt, ...) \
+    Pad_PushBackErrNode(err, ref_node, fmt, ##__VA_ARGS__)
+
+#define KERNEL_ARGS \
+    PadErrStack *err, \
+    const PadNode *ref_node, \
+    PadGC *ref_gc, \
+    PadObj *lhs, \
+    PadObj *rhs
+
+/**
+ * numeric kernels
+ * int, float and bool are numeric. the result is float if float in operands
+ * lv and rv are members of object (lvalue, float_value, boolean)
+ */
+#define DEF_CALC(name, OP, lv, rv, new_obj) \
+    static PadObj * \
+    name(KERNEL_ARGS) { \
+        return new_obj(ref_gc, lhs->lv OP rhs->rv); \
+    }
+
+#define DEF_DIV(name, lv, rv, new_obj) \
+    static PadObj * \
+    name(KERNEL_ARGS) { \
+        if (!rhs->rv) { \
+            push_err("zero division error"); \
+            return NULL; \
+        } \
+        return new_obj(ref_gc, lhs->lv / rhs->rv); \
+    }
+
+#define DEF_MOD(name, lv, rv) \
+    static PadObj * \
+    name(KERNEL_ARGS) { \
+        if (!rhs->rv) { \
+            push_err("zero division error"); \
+            return NULL; \
+        } \
+        PadIntObj result = ((PadIntObj) lhs->lv) % ((PadIntObj) rhs->rv); \
+        return PadObj_NewInt(ref_gc, result); \
+    }
+
+#define DEF_CMP(name, OP, lv, rv) \
+    static PadObj * \
+    name(KERNEL_ARGS) { \
+        return PadObj_NewBool(ref_gc, lhs->lv OP rhs->rv); \
+    }
+
+/**
+ * define kernels of numeric operator for all pairs of int, float and bool
+ */
+#define DEF_CALC_ALL(op, OP) \
+    DEF_CALC(op##_int_int, OP, lvalue, lvalue, PadObj_NewInt) \
+    DEF_CALC(op##_int_float, OP, lvalue, float_value, PadObj_NewFloat) \
+    DEF_CALC(op##_int_bool, OP, lvalue, boolean, PadObj_NewInt) \
+    DEF_CALC(op##_float_int, OP, float_value, lvalue, PadObj_NewFloat) \
+    DEF_CALC(op##_float_float, OP, float_value, float_value, PadObj_NewFloat) \
+    DEF_CALC(op##_float_bool, OP, float_value, boolean, PadObj_NewFloat) \
+    DEF_CALC(op##_bool_int, OP, boolean, lvalue, PadObj_NewInt) \
+    DEF_CALC(op##_bool_float, OP, boolean, float_value, PadObj_NewFloat) \
+    DEF_CALC(op##_bool_bool, OP, boolean, boolean, PadObj_NewInt) \
+
+#define DEF_CMP_ALL(op, OP) \
+    DEF_CMP(op##_int_int, OP, lvalue, lvalue) \
+    DEF_CMP(op##_int_float, OP, lvalue, float_value) \
+    DEF_CMP(op##_int_bool, OP, lvalue, boolean) \
+    DEF_CMP(op##_float_int, OP, float_value, lvalue) \
+    DEF_CMP(op##_float_float, OP, float_value, float_value) \
+    DEF_CMP(op##_float_bool, OP, float_value, boolean) \
+    DEF_CMP(op##_bool_int, OP, boolean, lvalue) \
+    DEF_CMP(op##_bool_float, OP, boolean, float_value) \
+    DEF_CMP(op##_bool_bool, OP, boolean, boolean) \
+
+/**
+ * initializer of table for all pairs of int, float and bool
+ */
+#define NUMERIC_ENTRIES(op, fn) \
+    [op][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__INT] = fn##_int_int, \
+    [op][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__FLOAT] = fn##_int_float, \
+    [op][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__BOOL] = fn##_int_bool, \
+    [op][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__INT] = fn##_float_int, \
+    [op][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__FLOAT] = fn##_float_float, \
+    [op][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__BOOL] = fn##_float_bool, \
+    [op][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__INT] = fn##_bool_int, \
+    [op][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__FLOAT] = fn##_bool_float, \
+    [op][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__BOOL] = fn##_bool_bool, \
+
+/**
+ * initializer of table for right hand operands of types other than
+ * nil, int, float, bool and string
+ */
+#define OTHER_ENTRIES(op, lhs, fn) \
+    [op][lhs][PAD_OBJ_TYPE__ARRAY] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__DICT] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__DEF_STRUCT] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__OBJECT] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__FUNC] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__MODULE] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__OWNERS_METHOD] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__TYPE] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__BLTIN_FUNC] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__FILE] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__BUILDER] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__RANGE] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__DEQUE] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__NUMARRAY] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__DICT_VIEW] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__REGEX] = fn, \
+
+#define ALL_ENTRIES(op, lhs, fn) \
+    [op][lhs][PAD_OBJ_TYPE__NIL] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__INT] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__FLOAT] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__BOOL] = fn, \
+    [op][lhs][PAD_OBJ_TYPE__UNICODE] = fn, \
+    OTHER_ENTRIES(op, lhs, fn) \
+
+/**
+ * initializer of table of == and != for pairs of types those are compared
+ * by identity of objects. pairs of same values are not in this
+ */
+#define SAME_ENTRIES(op, fn) \
+    OTHER_ENTRIES(op, PAD_OBJ_TYPE__NIL, fn) \
+    OTHER_ENTRIES(op, PAD_OBJ_TYPE__INT, fn) \
+    OTHER_ENTRIES(op, PAD_OBJ_TYPE__FLOAT, fn) \
+    OTHER_ENTRIES(op, PAD_OBJ_TYPE__BOOL, fn) \
+    OTHER_ENTRIES(op, PAD_OBJ_TYPE__UNICODE, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__ARRAY, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__DICT, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__DEF_STRUCT, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__OBJECT, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__FUNC, fn) \
+    ALL_ENTRIES(op, PAD_OBJ_TYPE__MODULE, fn) \
+    [op][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__INT] = fn, \
+    [op][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__FLOAT] = fn, \
+    [op][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__BOOL] = fn, \
+    [op][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__UNICODE] = fn, \
+    [op][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__UNICODE] = fn, \
+    [op][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__UNICODE] = fn, \
+    [op][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__UNICODE] = fn, \
+    [op][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__INT] = fn, \
+    [op][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__FLOAT] = fn, \
+    [op][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__BOOL] = fn, \
+
+/**********
+* kernels *
+**********/
+
+DEF_CALC_ALL(add, +)
+DEF_CALC_ALL(sub, -)
+DEF_CALC_ALL(mul, *)
+
+DEF_DIV(div_int_int, lvalue, lvalue, PadObj_NewInt)
+DEF_DIV(div_int_float, lvalue, float_value, PadObj_NewFloat)
+DEF_DIV(div_int_bool, lvalue, boolean, PadObj_NewInt)
+DEF_DIV(div_float_int, float_value, lvalue, PadObj_NewFloat)
+DEF_DIV(div_float_float, float_value, float_value, PadObj_NewFloat)
+DEF_DIV(div_float_bool, float_value, boolean, PadObj_NewFloat)
+DEF_DIV(div_bool_int, boolean, lvalue, PadObj_NewInt)
+DEF_DIV(div_bool_float, boolean, float_value, PadObj_NewFloat)
+DEF_DIV(div_bool_bool, boolean, boolean, PadObj_NewInt)
+
+DEF_MOD(mod_int_int, lvalue, lvalue)
+DEF_MOD(mod_int_bool, lvalue, boolean)
+DEF_MOD(mod_bool_int, boolean, lvalue)
+DEF_MOD(mod_bool_bool, boolean, boolean)
+
+DEF_CMP_ALL(eq, ==)
+DEF_CMP_ALL(not_eq, !=)
+DEF_CMP_ALL(lte, <=)
+DEF_CMP_ALL(gte, >=)
+DEF_CMP_ALL(lt, <)
+DEF_CMP_ALL(gt, >)
+
+static PadObj *
+add_unicode_unicode(KERNEL_ARGS) {
+    PadUni *u = PadUni_New();
+    PadUni_App(u, PadUni_Getc(lhs->unicode));
+    PadUni_App(u, PadUni_Getc(rhs->unicode));
+    return PadObj_NewUnicode(ref_gc, PadMem_Move(u));
+}
+
+static PadObj *
+add_array_array(KERNEL_ARGS) {
+    PadObjAry *dst = PadObjAry_New();
+    PadObjAry *a1 = lhs->objarr;
+    PadObjAry *a2 = rhs->objarr;
+
+    for (int32_t i = 0; i < PadObjAry_Len(a1); ++i) {
+        PadObj *el = PadObjAry_Get(a1, i);
+        assert(el);
+        PadObj_IncRef(el);
+        PadObjAry_PushBack(dst, el);
+    }
+
+    for (int32_t i = 0; i < PadObjAry_Len(a2); ++i) {
+        PadObj *el = PadObjAry_Get(a2, i);
+        assert(el);
+        PadObj_IncRef(el);
+        PadObjAry_PushBack(dst, el);
+    }
+
+    return PadObj_NewAry(ref_gc, PadMem_Move(dst));
+}
+
+static PadObj *
+mul_unicode(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    const PadUni *s,
+    PadIntObj n
+) {
+    if (n < 0) {
+        push_err("can't mul string by negative value");
+        return NULL;
+    }
+
+    PadUni *u = PadUni_Mul(s, n);
+    return PadObj_NewUnicode(ref_gc, PadMem_Move(u));
+}
+
+static PadObj *
+mul_int_unicode(KERNEL_ARGS) {
+    return mul_unicode(err, ref_node, ref_gc, rhs->unicode, lhs->lvalue);
+}
+
+static PadObj *
+mul_unicode_int(KERNEL_ARGS) {
+    return mul_unicode(err, ref_node, ref_gc, lhs->unicode, rhs->lvalue);
+}
+
+static PadObj *
+mul_bool_unicode(KERNEL_ARGS) {
+    return mul_unicode(err, ref_node, ref_gc, rhs->unicode, (PadIntObj) lhs->boolean);
+}
+
+static PadObj *
+mul_unicode_bool(KERNEL_ARGS) {
+    return mul_unicode(err, ref_node, ref_gc, lhs->unicode, (PadIntObj) rhs->boolean);
+}
+
+static PadObj *
+eq_unicode_unicode(KERNEL_ARGS) {
+    bool b = PadU_StrCmp(PadUni_Getc(lhs->unicode), PadUni_Getc(rhs->unicode)) == 0;
+    return PadObj_NewBool(ref_gc, b);
+}
+
+static PadObj *
+not_eq_unicode_unicode(KERNEL_ARGS) {
+    bool b = PadU_StrCmp(PadUni_Getc(lhs->unicode), PadUni_Getc(rhs->unicode)) != 0;
+    return PadObj_NewBool(ref_gc, b);
+}
+
+static PadObj *
+eq_same(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, lhs == rhs);
+}
+
+static PadObj *
+not_eq_same(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, lhs != rhs);
+}
+
+static PadObj *
+eq_type_type(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, lhs->type_obj.type == rhs->type_obj.type);
+}
+
+static PadObj *
+not_eq_type_type(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, lhs->type_obj.type != rhs->type_obj.type);
+}
+
+static PadObj *
+cmp_true(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, true);
+}
+
+static PadObj *
+cmp_false(KERNEL_ARGS) {
+    return PadObj_NewBool(ref_gc, false);
+}
+
+/********
+* table *
+********/
+
+/**
+ * kernels of operators
+ * [operator][type of lhs][type of rhs]
+ * identifier and ring are not in this table. those are resolved by traverser
+ * if the table has not kernel for pair of types then operator is error
+ */
+static PadOpKernel
+op_kernels[PAD_OP__NOPS][PAD_OP__NTYPES][PAD_OP__NTYPES] = {
+    NUMERIC_ENTRIES(PAD_OP__ADD, add)
+    [PAD_OP__ADD][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__UNICODE] = add_unicode_unicode,
+    [PAD_OP__ADD][PAD_OBJ_TYPE__ARRAY][PAD_OBJ_TYPE__ARRAY] = add_array_array,
+
+    NUMERIC_ENTRIES(PAD_OP__SUB, sub)
+
+    NUMERIC_ENTRIES(PAD_OP__MUL, mul)
+    [PAD_OP__MUL][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__UNICODE] = mul_int_unicode,
+    [PAD_OP__MUL][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__INT] = mul_unicode_int,
+    [PAD_OP__MUL][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__UNICODE] = mul_bool_unicode,
+    [PAD_OP__MUL][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__BOOL] = mul_unicode_bool,
+
+    NUMERIC_ENTRIES(PAD_OP__DIV, div)
+
+    [PAD_OP__MOD][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__INT] = mod_int_int,
+    [PAD_OP__MOD][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__BOOL] = mod_int_bool,
+    [PAD_OP__MOD][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__INT] = mod_bool_int,
+    [PAD_OP__MOD][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__BOOL] = mod_bool_bool,
+
+    NUMERIC_ENTRIES(PAD_OP__EQ, eq)
+    [PAD_OP__EQ][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__UNICODE] = eq_unicode_unicode,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__NIL] = cmp_true,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__NIL] = cmp_false,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__NIL] = cmp_false,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__NIL] = cmp_false,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__NIL] = cmp_false,
+    [PAD_OP__EQ][PAD_OBJ_TYPE__TYPE][PAD_OBJ_TYPE__TYPE] = eq_type_type,
+    SAME_ENTRIES(PAD_OP__EQ, eq_same)
+
+    NUMERIC_ENTRIES(PAD_OP__NOT_EQ, not_eq)
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__UNICODE] = not_eq_unicode_unicode,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__NIL][PAD_OBJ_TYPE__NIL] = cmp_false,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__INT][PAD_OBJ_TYPE__NIL] = cmp_true,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__FLOAT][PAD_OBJ_TYPE__NIL] = cmp_true,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__BOOL][PAD_OBJ_TYPE__NIL] = cmp_true,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__UNICODE][PAD_OBJ_TYPE__NIL] = cmp_true,
+    [PAD_OP__NOT_EQ][PAD_OBJ_TYPE__TYPE][PAD_OBJ_TYPE__TYPE] = not_eq_type_type,
+    SAME_ENTRIES(PAD_OP__NOT_EQ, not_eq_same)
+
+    NUMERIC_ENTRIES(PAD_OP__LTE, lte)
+    NUMERIC_ENTRIES(PAD_OP__GTE, gte)
+    NUMERIC_ENTRIES(PAD_OP__LT, lt)
+    NUMERIC_ENTRIES(PAD_OP__GT, gt)
+};
+
+/**
+ * names of operators and types for error messages
+ */
+static const char *
+op_names[PAD_OP__NOPS] = {
+    [PAD_OP__ADD] = "add",
+    [PAD_OP__SUB] = "sub",
+    [PAD_OP__MUL] = "mul",
+    [PAD_OP__DIV] = "div",
+    [PAD_OP__MOD] = "mod",
+    [PAD_OP__EQ] = "eq",
+    [PAD_OP__NOT_EQ] = "not eq",
+    [PAD_OP__LTE] = "lte",
+    [PAD_OP__GTE] = "gte",
+    [PAD_OP__LT] = "lt",
+    [PAD_OP__GT] = "gt",
+};
+
+static const char *
+type_names[PAD_OP__NTYPES] = {
+    [PAD_OBJ_TYPE__NIL] = "nil",
+    [PAD_OBJ_TYPE__INT] = "int",
+    [PAD_OBJ_TYPE__FLOAT] = "float",
+    [PAD_OBJ_TYPE__BOOL] = "bool",
+    [PAD_OBJ_TYPE__IDENT] = "identifier",
+    [PAD_OBJ_TYPE__UNICODE] = "string",
+    [PAD_OBJ_TYPE__ARRAY] = "array",
+    [PAD_OBJ_TYPE__DICT] = "dict",
+    [PAD_OBJ_TYPE__DEF_STRUCT] = "struct",
+    [PAD_OBJ_TYPE__OBJECT] = "object",
+    [PAD_OBJ_TYPE__FUNC] = "func",
+    [PAD_OBJ_TYPE__RING] = "ring",
+    [PAD_OBJ_TYPE__MODULE] = "module",
+    [PAD_OBJ_TYPE__OWNERS_METHOD] = "method",
+    [PAD_OBJ_TYPE__TYPE] = "type",
+    [PAD_OBJ_TYPE__BLTIN_FUNC] = "builtin func",
+    [PAD_OBJ_TYPE__FILE] = "file",
+    [PAD_OBJ_TYPE__BUILDER] = "builder",
+    [PAD_OBJ_TYPE__RANGE] = "range",
+    [PAD_OBJ_TYPE__DEQUE] = "deque",
+    [PAD_OBJ_TYPE__NUMARRAY] = "numarray",
+    [PAD_OBJ_TYPE__DICT_VIEW] = "dict view",
+    [PAD_OBJ_TYPE__REGEX] = "regex",
+};
+
+/************
+* functions *
+************/
+
+PadOpKernel
+PadOp_GetKernel(op_t op, PadObjType lhs_type, PadObjType rhs_type) {
+    if ((unsigned) op >= PAD_OP__NOPS ||
+        (unsigned) lhs_type >= PAD_OP__NTYPES ||
+        (unsigned) rhs_type >= PAD_OP__NTYPES) {
+        return NULL;
+    }
+
+    return op_kernels[op][lhs_type][rhs_type];
+}
+
+bool
+PadOp_Register(
+    op_t op,
+    PadObjType lhs_type,
+    PadObjType rhs_type,
+    PadOpKernel kernel
+) {
+    if ((unsigned) op >= PAD_OP__NOPS ||
+        (unsigned) lhs_type >= PAD_OP__NTYPES ||
+        (unsigned) rhs_type >= PAD_OP__NTYPES) {
+        return false;
+    }
+    if (lhs_type == PAD_OBJ_TYPE__IDENT || lhs_type == PAD_OBJ_TYPE__RING ||
+        rhs_type == PAD_OBJ_TYPE__IDENT || rhs_type == PAD_OBJ_TYPE__RING) {
+        return false;  // references are resolved by traverser
+    }
+
+    op_kernels[op][lhs_type][rhs_type] = kernel;
+    return true;
+}
+
+const char *
+PadOp_GetcName(op_t op) {
+    if ((unsigned) op >= PAD_OP__NOPS || !op_names[op]) {
+        return "?";
+    }
+    return op_names[op];
+}
+
+const char *
+PadOp_GetcTypeName(PadObjType type) {
+    if ((unsigned) type >= PAD_OP__NTYPES || !type_names[type]) {
+        return "?";
+    }
+    return type_names[type];
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <pad/core/error_stack.h>
+#include <pad/lang/types.h>
+#include <pad/lang/nodes.h>
+#include <pad/lang/object.h>
+#include <pad/lang/gc.h>
+
+enum {
+    // number of operators and number of object types of table
+    PAD_OP__NOPS = PAD_OP__DOT + 1,
+    PAD_OP__NTYPES = PAD_OBJ_TYPE__N,
+};
+
+/**
+ * kernel of binary operator
+ * lhs and rhs are already resolved (not identifier and not ring)
+ *
+ * @param[in] *err      error stack for errors (zero division etc)
+ * @param[in] *ref_node reference of node for error
+ * @param[in] *ref_gc   reference of gc for result
+ * @param[in] *lhs      left hand operand
+ * @param[in] *rhs      right hand operand
+ *
+ * @return success to pointer to result object
+ * @return failed to NULL (and push error at err)
+ */
+typedef PadObj *(*PadOpKernel)(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *lhs,
+    PadObj *rhs
+);
+
+/**
+ * get kernel of operator by operator and types of operands
+ *
+ * @param[in] op       number of operator (PAD_OP__ADD, PAD_OP__EQ, etc)
+ * @param[in] lhs_type type of left hand operand
+ * @param[in] rhs_type type of right hand operand
+ *
+ * @return found to pointer to kernel
+ * @return not found to NULL
+ */
+PadOpKernel
+PadOp_GetKernel(op_t op, PadObjType lhs_type, PadObjType rhs_type);
+
+/**
+ * register kernel of operator
+ * builtin types register operators by this function.
+ * if kernel is NULL then unregister
+ *
+ * @param[in] op       number of operator
+ * @param[in] lhs_type type of left hand operand
+ * @param[in] rhs_type type of right hand operand
+ * @param[in] kernel   pointer to kernel
+ *
+ * @return success to true
+ * @return failed to false (out of table)
+ */
+bool
+PadOp_Register(
+    op_t op,
+    PadObjType lhs_type,
+    PadObjType rhs_type,
+    PadOpKernel kernel
+);
+
+/**
+ * get name of operator for error message
+ *
+ * @param[in] op number of operator
+ *
+ * @return pointer to C string ("add", "eq", etc. "?" if unknown)
+ */
+const char *
+PadOp_GetcName(op_t op);
+
+/**
+ * get name of type of operand for error message
+ *
+ * @param[in] type type of object
+ *
+ * @return pointer to C string ("int", "string", etc. "?" if unknown)
+ */
+const char *
+PadOp_GetcTypeName(PadObjType type);
@@ -1,18 +1,67 @@
 #include <pad/lang/scope.h>
 
+static PadScope *
+walk_tail(PadScope *self) {
+    PadScope *last = self;
+    for (PadScope *cur = self; cur; cur = cur->next) {
+        if (!cur->next) {
+            last = cur;
+            break;
+        }
+    }
+
+    return last;
+}
+
+static PadScope *
+find_tail(PadScope *self) {
+    if (!self->prev && self->tail) {
+        return self->tail;  // head scope has cache of tail
+    }
+
+    return walk_tail(self);
+}
+
+/**
+ * update cache of tail on head scope of scope chain
+ */
+static void
+update_tail(PadScope *self) {
+    PadScope *head = self;
+    for (; head->prev; head = head->prev) {
+    }
+
+    head->tail = walk_tail(head);
+}
+
+static void
+del_once(PadScope *self) {
+    if (!self) {
+        return;
+    }
+
+    PadObjDict_Del(self->varmap);
+    PadCStrAry_Del(self->global_names);
+    PadCStrAry_Del(self->nonlocal_names);
+    free(self);
+}
+
 void
 PadScope_Del(PadScope *self) {
     if (!self) {
         return;
     }
 
+    for (PadScope *cur = self->pool; cur; ) {
+        PadScope *del = cur;
+        cur = cur->next;
+        del_once(del);
+    }
+
     for (PadScope *cur = self /* <- look me! */; cur; ) {
         PadScope *del = cur;
         cur = cur->next;
-        PadObjDict_Del(del->varmap);
-        PadCStrAry_Del(del->global_names);
-        PadCStrAry_Del(del->nonlocal_names);
-        free(del);
+        del_once(del);
     }
 
     // free(self);  // not needed
@@ -138,6 +187,7 @@ PadScope_DeepCopy(const PadScope *other) {
         dst = dst->next;
     }
 
+    update_tail(self);
     return self;
 }
 
@@ -214,6 +264,7 @@ PadScope_ShallowCopy(const PadScope *other) {
         dst = dst->next;
     }
 
+    update_tail(self);
     return self;
 }
 
@@ -223,16 +274,10 @@ PadScope_MoveBack(PadScope *self, PadScope *move_scope) {
         return NULL;
     }
 
-    PadScope *tail = NULL;
-    for (PadScope *cur = self; cur; cur = cur->next) {
-        if (!cur->next) {
-            tail = cur;
-            break;
-        }
-    }
-
+    PadScope *tail = find_tail(self);
     tail->next = move_scope;
     move_scope->prev = tail;
+    update_tail(self);
     return self;
 }
 
@@ -254,29 +299,85 @@ PadScope_PopBack(PadScope *self) {
 
     if (prev) {
         prev->next = NULL;
+        update_tail(prev);
     }
     if (tail) {
         tail->prev = NULL;
+        tail->tail = NULL;
     }
 
     return tail;
 }
 
 PadScope *
-PadScope_GetTail(PadScope *self) {
+PadScope_PushBackFrame(PadScope *self) {
     if (!self) {
         return NULL;
     }
 
-    PadScope *tail = NULL;
-    for (PadScope *cur = self; cur; cur = cur->next) {
-        if (!cur->next) {
-            tail = cur;
-            break;
+    PadScope *scope = self->pool;
+    if (scope) {
+        self->pool = scope->next;
+        self->npool--;
+        scope->next = NULL;
+    } else {
+        scope = PadScope_New(self->ref_gc);
+        if (!scope) {
+            return NULL;
         }
     }
 
-    return tail;
+    PadScope *tail = find_tail(self);
+    tail->next = scope;
+    scope->prev = tail;
+    self->tail = scope;
+
+    return scope;
+}
+
+bool
+PadScope_PopBackFrame(PadScope *self) {
+    if (!self) {
+        return false;
+    }
+
+    PadScope *tail = find_tail(self);
+    if (tail == self) {
+        return false;  // can't pop head scope
+    }
+
+    PadScope *prev = tail->prev;
+    prev->next = NULL;
+    self->tail = prev;
+
+    // deep recursion pops many frames. keep buffers of limited number
+    // of frames only
+    if (self->npool >= PAD_SCOPE__POOL_SIZE) {
+        tail->prev = NULL;
+        del_once(tail);
+        return true;
+    }
+
+    // release variables of frame in bulk and keep the buffers
+    PadObjDict_Clear(tail->varmap);
+    PadCStrAry_Clear(tail->global_names);
+    PadCStrAry_Clear(tail->nonlocal_names);
+
+    tail->prev = NULL;
+    tail->next = self->pool;
+    self->pool = tail;
+    self->npool++;
+
+    return true;
+}
+
+PadScope *
+PadScope_GetTail(PadScope *self) {
+    if (!self) {
+        return NULL;
+    }
+
+    return find_tail(self);
 }
 
 const PadScope *
@@ -293,12 +394,11 @@ PadScope_Clear(PadScope *self) {
     for (PadScope *cur = self->next; cur; ) {
         PadScope *del = cur;
         cur = cur->next;
-        PadObjDict_Del(del->varmap);
-        PadCStrAry_Del(del->global_names);
-        free(del);
+        del_once(del);
     }
 
     self->next = NULL;
+    self->tail = self;
     PadObjDict_Clear(self->varmap);  // clear global variables
     return self;
 }
@@ -315,19 +415,6 @@ PadScope_GetcVarmap(const PadScope *self) {
     return PadScope_GetVarmap((PadScope *) self);
 }
 
-static PadScope *
-find_tail(PadScope *self) {
-    PadScope *last = self;
-    for (PadScope *cur = self; cur; cur = cur->next) {
-        if (!cur->next) {
-            last = cur;
-            break;
-        }
-    }
-
-    return last;
-}
-
 PadObj *
 PadScope_FindVarRefAtTail(PadScope *self, const char *key) {
     if (!self) {
@@ -8,6 +8,12 @@
 #include <pad/lang/object_dict.h>
 #include <pad/lang/gc.h>
 
+enum {
+    // max number of popped frame scopes kept for reuse
+    // frames beyond it are deleted at pop
+    PAD_SCOPE__POOL_SIZE = 32,
+};
+
 struct PadScope {
     PadGC *ref_gc; // do not delete (this is reference)
     PadObjDict *varmap;
@@ -15,6 +21,12 @@ struct PadScope {
     PadScope *next;
     PadCStrAry *global_names;
     PadCStrAry *nonlocal_names;
+
+    // frame stack of function call
+    // these members are available at head scope only
+    PadScope *tail;  // cache of tail scope (do not delete)
+    PadScope *pool;  // popped scopes for reuse (linked by next)
+    int32_t npool;  // number of scopes in pool
 };
 
 void
@@ -44,6 +56,32 @@ PadScope_MoveBack(PadScope *self, PadScope *move_scope);
 PadScope *
 PadScope_PopBack(PadScope *self);
 
+/**
+ * push back frame scope at tail of scope chain
+ * the frame scope is reused from pool of head scope if pooled
+ *
+ * @param[in] *self pointer to head scope
+ *
+ * @return success to pointer to pushed scope
+ * @return failed to NULL
+ */
+PadScope *
+PadScope_PushBackFrame(PadScope *self);
+
+/**
+ * pop back frame scope from tail of scope chain
+ * variables of popped scope are released and the scope is pooled
+ * if pool is full (PAD_SCOPE__POOL_SIZE) then the scope is deleted
+ * the head scope is not popped
+ *
+ * @param[in] *self pointer to head scope
+ *
+ * @return success to true
+ * @return failed to false
+ */
+bool
+PadScope_PopBackFrame(PadScope *self);
+
 const PadScope *
 PadScope_GetcTail(const PadScope *self);
 
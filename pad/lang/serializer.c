@@ -0,0 +1,395 @@
+#include <pad/lang/serializer.h>
+#include <pad/lang/object.h>
+#include <pad/lang/context.h>
+#include <pad/lang/utils.h>
+
+/**
+ * writer of serializer
+ * the destination is sink or string
+ */
+typedef struct {
+    PadSink *sink;  // if not NULL then write to sink
+    PadStr *str;  // if not NULL then write to string
+    const void *visiting[PAD_SER__MAX_DEPTH];  // containers of current path
+    int32_t depth;  // number of visiting
+} writer_t;
+
+static bool
+write_n(writer_t *w, const char *data, int32_t len) {
+    if (w->sink) {
+        return PadSink_Write(w->sink, data, len) != NULL;
+    }
+    return PadStr_AppNStr(w->str, data, len) != NULL;
+}
+
+static bool
+write_s(writer_t *w, const char *s) {
+    return write_n(w, s, strlen(s));
+}
+
+static bool
+write_quoted(writer_t *w, const char *s) {
+    if (!write_n(w, "\"", 1)) {
+        return false;
+    }
+
+    // write runs of characters between escapes at once
+    const char *run = s;
+    for (const char *p = s; *p; p++) {
+        const char *esc = NULL;
+        switch (*p) {
+        case '"': esc = "\\\""; break;
+        case '\\': esc = "\\\\"; break;
+        case '\n': esc = "\\n"; break;
+        case '\r': esc = "\\r"; break;
+        case '\t': esc = "\\t"; break;
+        default: continue; break;
+        }
+        if (p > run && !write_n(w, run, p - run)) {
+            return false;
+        }
+        if (!write_n(w, esc, 2)) {
+            return false;
+        }
+        run = p + 1;
+    }
+
+    return write_s(w, run) && write_n(w, "\"", 1);
+}
+
+/**
+ * push container to visiting path
+ *
+ * @return success to true
+ * @return recursive or too deep to false
+ */
+static bool
+enter(writer_t *w, const void *container) {
+    if (w->depth >= PAD_SER__MAX_DEPTH) {
+        return false;
+    }
+    for (int32_t i = 0; i < w->depth; i++) {
+        if (w->visiting[i] == container) {
+            return false;
+        }
+    }
+    w->visiting[w->depth++] = container;
+    return true;
+}
+
+static void
+leave(writer_t *w) {
+    w->depth--;
+}
+
+static bool
+write_obj(writer_t *w, const PadObj *obj);
+
+static bool
+write_deque(writer_t *w, const PadObjDeq *deq) {
+    if (!enter(w, deq)) {
+        return write_n(w, "Deque([...])", 12);
+    }
+
+    bool ok = write_n(w, "Deque([", 7);
+    for (int32_t i = 0; ok && i < PadObjDeq_Len(deq); i++) {
+        if (i > 0) {
+            ok = write_n(w, ", ", 2);
+        }
+        ok = ok && write_obj(w, PadObjDeq_Get(deq, i));
+    }
+
+    leave(w);
+    return ok && write_n(w, "])", 2);
+}
+
+static bool
+write_num_val(writer_t *w, PadNumVal val) {
+    if (val.kind == PAD_NUM_ARY_KIND__INT) {
+        char buf[PAD_NUM__INT_STR_SIZE];
+        return write_n(w, buf, PadNum_IntToStr(buf, val.ivalue));
+    }
+    char buf[PAD_NUM__FLOAT_STR_SIZE];
+    return write_n(w, buf, PadNum_FloatToStr(buf, val.fvalue));
+}
+
+/**
+ * write numeric array as constructor. kind is written if float
+ *
+ *     NumArray([[1, 2], [3, 4]])
+ *     NumArray([1.5, 2], "float")
+ */
+static bool
+write_numarray(writer_t *w, const PadNumAry *numarr) {
+    bool is_2d = PadNumAry_GetNDim(numarr) == 2;
+    int32_t cols = is_2d ? PadNumAry_Cols(numarr) : 1;
+
+    bool ok = write_n(w, "NumArray([", 10);
+    for (int32_t y = 0; ok && y < PadNumAry_Len(numarr); y++) {
+        if (y > 0) {
+            ok = write_n(w, ", ", 2);
+        }
+        if (!is_2d) {
+            ok = ok && write_num_val(w, PadNumAry_Get(numarr, y));
+            continue;
+        }
+        ok = ok && write_n(w, "[", 1);
+        for (int32_t x = 0; ok && x < cols; x++) {
+            if (x > 0) {
+                ok = write_n(w, ", ", 2);
+            }
+            ok = ok && write_num_val(w, PadNumAry_Get2D(numarr, y, x));
+        }
+        ok = ok && write_n(w, "]", 1);
+    }
+
+    if (ok && PadNumAry_GetKind(numarr) == PAD_NUM_ARY_KIND__FLOAT) {
+        ok = write_n(w, "], \"float\")", 11);
+    } else {
+        ok = ok && write_n(w, "])", 2);
+    }
+    return ok;
+}
+
+/**
+ * write elements of dict view in view of name of kind
+ *
+ *     dict_keys(["a", "b"])
+ *     dict_items([["a", 1], ["b", 2]])
+ */
+static bool
+write_dict_view(writer_t *w, const PadDictViewObj *view) {
+    static const char *names[] = {
+        [PAD_DICT_VIEW__KEYS] = "dict_keys([",
+        [PAD_DICT_VIEW__VALUES] = "dict_values([",
+        [PAD_DICT_VIEW__ITEMS] = "dict_items([",
+    };
+    const PadObjDict *dict = view->dict->objdict;
+    if (!write_s(w, names[view->kind])) {
+        return false;
+    }
+    if (!enter(w, dict)) {
+        return write_n(w, "...])", 5);
+    }
+
+    bool ok = true;
+    for (int32_t i = 0; ok && i < PadObjDict_Len(dict); i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (i > 0) {
+            ok = write_n(w, ", ", 2);
+        }
+        switch (view->kind) {
+        case PAD_DICT_VIEW__KEYS:
+            ok = ok && write_quoted(w, item->key);
+            break;
+        case PAD_DICT_VIEW__VALUES:
+            ok = ok && write_obj(w, item->value);
+            break;
+        case PAD_DICT_VIEW__ITEMS:
+            ok = ok && write_n(w, "[", 1) &&
+                 write_quoted(w, item->key) &&
+                 write_n(w, ", ", 2) &&
+                 write_obj(w, item->value) &&
+                 write_n(w, "]", 1);
+            break;
+        }
+    }
+
+    leave(w);
+    return ok && write_n(w, "])", 2);
+}
+
+static bool
+write_array(writer_t *w, const PadObjAry *arr) {
+    if (!enter(w, arr)) {
+        return write_n(w, "[...]", 5);
+    }
+
+    bool ok = write_n(w, "[", 1);
+    for (int32_t i = 0; ok && i < PadObjAry_Len(arr); i++) {
+        if (i > 0) {
+            ok = write_n(w, ", ", 2);
+        }
+        ok = ok && write_obj(w, PadObjAry_Getc(arr, i));
+    }
+
+    leave(w);
+    return ok && write_n(w, "]", 1);
+}
+
+/**
+ * write items of dict
+ *
+ * @param[in] quote_key if true then keys are quoted
+ */
+static bool
+write_items(writer_t *w, const PadObjDict *dict, bool quote_key) {
+    if (!enter(w, dict)) {
+        return write_n(w, "{...}", 5);
+    }
+
+    bool ok = write_n(w, "{", 1);
+    for (int32_t i = 0; ok && i < PadObjDict_Len(dict); i++) {
+        const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+        if (!item) {
+            continue;
+        }
+        if (i > 0) {
+            ok = write_n(w, ", ", 2);
+        }
+        if (quote_key) {
+            ok = ok && write_quoted(w, item->key);
+        } else {
+            ok = ok && write_s(w, item->key);
+        }
+        ok = ok && write_n(w, ": ", 2);
+        ok = ok && write_obj(w, item->value);
+    }
+
+    leave(w);
+    return ok && write_n(w, "}", 1);
+}
+
+static bool
+write_object(writer_t *w, const PadObj *obj) {
+    const PadObj *def_obj = obj->object.ref_def_obj;
+    if (def_obj && !write_s(w, PadObj_GetcDefStructIdentName(def_obj))) {
+        return false;
+    }
+
+    PadObjDict *varmap = PadCtx_GetVarmapAtHeadScope(obj->object.struct_context);
+    if (!varmap) {
+        return write_n(w, "{}", 2);
+    }
+
+    return write_items(w, varmap, false);
+}
+
+static bool
+write_other(writer_t *w, const PadObj *obj) {
+    PadStr *s = PadObj_ToStr(obj);
+    if (!s) {
+        return false;
+    }
+    bool ok = write_n(w, PadStr_Getc(s), PadStr_Len(s));
+    PadStr_Del(s);
+    return ok;
+}
+
+/**
+ * write regular expression in form of compile
+ *
+ *     re.compile("a+", "i")
+ */
+static bool
+write_regex(writer_t *w, const PadRegex *regex) {
+    PadUni *pattern = PadUni_New();
+    if (!pattern || !PadUni_Set(pattern, PadRegex_GetcPattern(regex))) {
+        PadUni_Del(pattern);
+        return false;
+    }
+
+    bool ok = write_s(w, "re.compile(") &&
+              write_quoted(w, PadUni_GetcMB(pattern));
+    if (ok && (PadRegex_GetFlags(regex) & PAD_REGEX__IGNORE_CASE)) {
+        ok = write_s(w, ", \"i\"");
+    }
+    ok = ok && write_n(w, ")", 1);
+
+    PadUni_Del(pattern);
+    return ok;
+}
+
+static bool
+write_obj(writer_t *w, const PadObj *obj) {
+    if (!obj) {
+        return write_n(w, "null", 4);
+    }
+
+    switch (obj->type) {
+    default:
+        return write_other(w, obj);
+        break;
+    case PAD_OBJ_TYPE__NIL:
+        return write_n(w, "nil", 3);
+        break;
+    case PAD_OBJ_TYPE__BOOL:
+        return obj->boolean ? write_n(w, "true", 4) : write_n(w, "false", 5);
+        break;
+    case PAD_OBJ_TYPE__INT: {
+        char buf[PAD_NUM__INT_STR_SIZE];
+        return write_n(w, buf, PadNum_IntToStr(buf, obj->lvalue));
+    } break;
+    case PAD_OBJ_TYPE__FLOAT: {
+        char buf[PAD_NUM__FLOAT_STR_SIZE];
+        return write_n(w, buf, PadNum_FloatToStr(buf, obj->float_value));
+    } break;
+    case PAD_OBJ_TYPE__UNICODE:
+        return write_quoted(w, PadUni_GetcMB(obj->unicode));
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const PadObj *ref = Pad_PullRefAll(obj);
+        if (!ref) {
+            return write_s(w, PadObj_GetcIdentName(obj));
+        }
+        return write_obj(w, ref);
+    } break;
+    case PAD_OBJ_TYPE__ARRAY:
+        return write_array(w, obj->objarr);
+        break;
+    case PAD_OBJ_TYPE__DICT:
+        return write_items(w, obj->objdict, true);
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        return write_deque(w, obj->objdeq);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        return write_numarray(w, obj->numarr);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        return write_dict_view(w, &obj->dict_view);
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        return write_regex(w, obj->regex);
+        break;
+    case PAD_OBJ_TYPE__OBJECT:
+        return write_object(w, obj);
+        break;
+    case PAD_OBJ_TYPE__RANGE: {
+        char buf[PAD_NUM__INT_STR_SIZE * 3 + 16];
+        int32_t n = snprintf(
+            buf, sizeof buf, "range(%ld, %ld, %ld)",
+            obj->range.start, obj->range.stop, obj->range.step
+        );
+        return write_n(w, buf, n);
+    } break;
+    }
+}
+
+PadStr *
+PadSer_ObjToStr(PadStr *dst, const PadObj *obj) {
+    if (!dst) {
+        return NULL;
+    }
+
+    writer_t w = { .str = dst };
+    if (!write_obj(&w, obj)) {
+        return NULL;
+    }
+
+    return dst;
+}
+
+PadSink *
+PadSer_ObjToSink(PadSink *sink, const PadObj *obj) {
+    if (!sink) {
+        return NULL;
+    }
+
+    writer_t w = { .sink = sink };
+    if (!write_obj(&w, obj)) {
+        return NULL;
+    }
+
+    return sink;
+}
@@ -0,0 +1,53 @@
+/**
+ * Serializer of objects
+ *
+ * objects are written to string or sink directly while traversing
+ * containers (array, dict and instance of struct) without temporary strings
+ *
+ *     [1, "x", [2.5, nil], {"k": true}, Point{x: 1, y: 2}]
+ *
+ * strings are quoted and escaped. recursive containers are written as
+ * [...] or {...}
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include <pad/lib/string.h>
+#include <pad/lib/sink.h>
+#include <pad/lang/types.h>
+
+/**
+ * max depth of nested containers
+ * deeper containers are written as [...] or {...}
+ */
+#define PAD_SER__MAX_DEPTH 64
+
+/**
+ * serialize object and append it at back of string
+ * the string can be reused for many objects (see PadStr_Clear)
+ *
+ * @param[in] *dst pointer to PadStr
+ * @param[in] *obj pointer to PadObj (identifier is resolved to reference)
+ *
+ * @return success to pointer to dst
+ * @return failed to NULL
+ */
+PadStr *
+PadSer_ObjToStr(PadStr *dst, const PadObj *obj);
+
+/**
+ * serialize object and write it to sink
+ *
+ * @param[in] *sink pointer to PadSink
+ * @param[in] *obj  pointer to PadObj (identifier is resolved to reference)
+ *
+ * @return success to pointer to sink
+ * @return failed to NULL
+ */
+PadSink *
+PadSer_ObjToSink(PadSink *sink, const PadObj *obj);
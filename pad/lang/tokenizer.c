@@ -81,7 +81,8 @@ struct PadTkr {
     const char *program_source;
     const char *ptr;
     PadTok **tokens;
-    PadStr *buf;
+    const char *text_begin;  // begin of current text block in program source
+    const char *text_end;  // end of current text block in program source
     PadTkrOpt *option;
     int32_t tokens_len;
     int32_t tokens_capa;
@@ -101,7 +102,6 @@ PadTkr_Del(PadTkr *self) {
     free(self->program_filename);
     free(self->tokens);
     PadErrStack_Del(self->error_stack);
-    PadStr_Del(self->buf);
     PadTkrOpt_Del(self->option);
     free(self);
 }
@@ -127,12 +127,6 @@ PadTkr_New(PadTkrOpt *move_option) {
         return NULL;
     }
 
-    self->buf = PadStr_New();
-    if (!self->buf) {
-        PadTkr_Del(self);
-        return NULL;
-    }
-
     self->option = PadMem_Move(move_option);
     self->debug = false;
     self->program_lineno = 1;
@@ -163,11 +157,8 @@ PadTkr_DeepCopy(const PadTkr *other) {
     self->program_lineno = other->program_lineno;
     self->program_source = other->program_source;
     self->ptr = other->ptr;
-    self->buf = PadStr_DeepCopy(other->buf);
-    if (!self->buf) {
-        PadTkr_Del(self);
-        return NULL;
-    }
+    self->text_begin = other->text_begin;
+    self->text_end = other->text_end;
 
     self->tokens_len = other->tokens_len;
     self->tokens_capa = other->tokens_capa;
@@ -490,6 +481,8 @@ PadTkr_Parse_identifier(PadTkr *self) {
         token->type = PAD_TOK_TYPE__STMT_ELSE;
     } else if (PadCStr_Eq(token->text, "for")) {
         token->type = PAD_TOK_TYPE__STMT_FOR;
+    } else if (PadCStr_Eq(token->text, "in")) {
+        token->type = PAD_TOK_TYPE__IN;
     } else if (PadCStr_Eq(token->text, "or")) {
         token->type = PAD_TOK_TYPE__PAD_OP__OR;
     } else if (PadCStr_Eq(token->text, "and")) {
@@ -532,16 +525,41 @@ PadTkr_Parse_identifier(PadTkr *self) {
 
 static PadTkr *
 tkr_store_textblock(PadTkr *self) {
-    if (!PadStr_Len(self->buf)) {
+    if (!self->text_begin) {
         return self;
     }
+
+    // text block is a span of program source. copy it at once
+    int32_t len = self->text_end - self->text_begin;
+    char *text = PadMem_Calloc(len + 1, sizeof(char));
+    if (!text) {
+        return NULL;
+    }
+    memcpy(text, self->text_begin, len);
+    self->text_begin = self->text_end = NULL;
+
     PadTok *textblock = tok_new(PAD_TOK_TYPE__TEXT_BLOCK);
-    PadTok_MoveTxt(textblock, PadMem_Move(PadStr_EscDel(self->buf)));
+    PadTok_MoveTxt(textblock, PadMem_Move(text));
     tkr_move_token(self, PadMem_Move(textblock));
-    self->buf = PadStr_New();
     return self;
 }
 
+/**
+ * extend current text block to end
+ *
+ * @param[in] *self
+ * @param[in] *begin begin of characters in program source
+ * @param[in] *end   end of characters in program source
+ */
+static void
+tkr_extend_textblock(PadTkr *self, const char *begin, const char *end) {
+    if (!self->text_begin) {
+        self->text_begin = begin;
+    }
+    assert(self->text_end == NULL || self->text_end == begin);
+    self->text_end = end;
+}
+
 static PadTkr *
 PadTkr_Parse_op(
     PadTkr *self,
@@ -651,7 +669,7 @@ PadTkr_Parse(PadTkr *self, const char *program_source) {
     self->program_source = program_source;
     self->ptr = program_source;
     PadErrStack_Clear(self->error_stack);
-    PadStr_Clear(self->buf);
+    self->text_begin = self->text_end = NULL;
     tkr_clear_tokens(self);
 
     if (!tkropt_validate(self->option)) {
@@ -664,10 +682,11 @@ PadTkr_Parse(PadTkr *self, const char *program_source) {
     for (; *self->ptr ;) {
         char c = tkr_next(self);
         if (self->debug) {
-            fprintf(stderr, "m[%d] c[%c] buf[%s]\n", m, c, PadStr_Getc(self->buf));
+            fprintf(stderr, "m[%d] c[%c]\n", m, c);
         }
 
         if (m == 0) { // first
+            const char *cp = self->ptr - 1;  // position of c
             if (c == '{' && *self->ptr == '@') {
                 tkr_next(self);
                 PadTok *token = tok_new(PAD_TOK_TYPE__LBRACEAT);
@@ -685,18 +704,18 @@ PadTkr_Parse(PadTkr *self, const char *program_source) {
                 bool next_is_eos = *(self->ptr + 1) == '\0';
                 tkr_next(self);
                 if (!next_is_eos) {
-                    PadStr_App(self->buf, "\r\n");
+                    tkr_extend_textblock(self, cp, self->ptr);
                     self->program_lineno++;                    
                 }
             } else if ((c == '\r' && *self->ptr != '\n') ||
                        (c == '\n')) {
                 bool next_is_eos = *(self->ptr) == '\0';
                 if (!next_is_eos) {
-                    PadStr_PushBack(self->buf, c);
+                    tkr_extend_textblock(self, cp, self->ptr);
                     self->program_lineno++;                    
                 }
             } else {
-                PadStr_PushBack(self->buf, c);
+                tkr_extend_textblock(self, cp, self->ptr);
             }
         } else if (m == 10) { // found '{@'
             if (c == '"') {
@@ -938,7 +957,7 @@ PadTkr_Parse(PadTkr *self, const char *program_source) {
     }
 
     if (self->debug) {
-        fprintf(stderr, "end m[%d] buf[%s]\n", m, PadStr_Getc(self->buf));
+        fprintf(stderr, "end m[%d]\n", m);
     }
 
     tkr_store_textblock(self);
@@ -164,6 +164,7 @@ PadTok_TypeToStr(const PadTok *self) {
     case PAD_TOK_TYPE__STMT_ELSE: return "else"; break;
 
     case PAD_TOK_TYPE__STMT_FOR: return "for"; break;
+    case PAD_TOK_TYPE__IN: return "in"; break;
     case PAD_TOK_TYPE__STMT_BREAK: return "break"; break;
     case PAD_TOK_TYPE__STMT_CONTINUE: return "continue"; break;
     case PAD_TOK_TYPE__STMT_RETURN: return "return"; break;
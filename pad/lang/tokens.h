@@ -64,6 +64,7 @@ typedef enum {
     PAD_TOK_TYPE__STMT_ELIF, // 'if'
     PAD_TOK_TYPE__STMT_ELSE, // 'if'
     PAD_TOK_TYPE__STMT_FOR, // 'for'
+    PAD_TOK_TYPE__IN, // 'in'
     PAD_TOK_TYPE__STMT_BREAK, // 'break'
     PAD_TOK_TYPE__STMT_CONTINUE, // 'continue'
     PAD_TOK_TYPE__STMT_RETURN, // 'return'
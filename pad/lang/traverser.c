@@ -1,4 +1,5 @@
 #include <pad/lang/traverser.h>
+#include <pad/lang/operator.h>
 
 /*********
 * macros *
@@ -78,6 +79,14 @@
 #define _Pad_ReferChainThreeObjs(owns, co) \
     Pad_ReferChainThreeObjs(ast->error_stack, targs->ref_node, ast, ast->ref_gc, ast->ref_context, owns, co)
 
+#undef _Pad_ReferChainElem
+#define _Pad_ReferChainElem(owns, type, elem) \
+    Pad_ReferChainElem(ast->error_stack, targs->ref_node, ast, ast->ref_gc, ast->ref_context, owns, type, elem)
+
+#undef _Pad_ReferChainTailCall
+#define _Pad_ReferChainTailCall(owns, args) \
+    Pad_ReferChainTailCall(ast->error_stack, targs->ref_node, ast, ast->ref_gc, ast->ref_context, owns, args)
+
 #undef _Pad_ParseBool
 #define _Pad_ParseBool(obj) \
     Pad_ParseBool(ast->error_stack, targs->ref_node, ast, ast->ref_gc, ast->ref_context, obj)
@@ -87,59 +96,14 @@
 *************/
 
 static PadObj *
-trv_compare_or(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_or_array(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_or_string(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_or_identifier(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_or_bool(PadAST *ast, PadTrvArgs *targs);
+refer_ring(PadAST *ast, PadTrvArgs *targs, bool is_tail);
 
 static PadObj *
-trv_compare_or_int(PadAST *ast, PadTrvArgs *targs);
+trv_compare_or(PadAST *ast, PadTrvArgs *targs);
 
 static PadObj *
 trv_compare_and(PadAST *ast, PadTrvArgs *targs);
 
-static PadObj *
-trv_compare_comparison_eq(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_eq_def_struct(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_gte(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_lte(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_gt(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_lt(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_calc_expr_add(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_calc_expr_sub(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_calc_term_div(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_calc_term_mul(PadAST *ast, PadTrvArgs *targs);
-
 static PadObj *
 trv_calc_assign_to_idn(PadAST *ast, PadTrvArgs *targs);
 
@@ -149,30 +113,6 @@ trv_multi_assign(PadAST *ast, PadTrvArgs *targs);
 static PadObj *
 trv_calc_assign(PadAST *ast, PadTrvArgs *targs);
 
-static PadObj *
-trv_compare_comparison_not_eq_array(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_unicode(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_bool(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_nil(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_int(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_def_struct(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_not_eq_func(PadAST *ast, PadTrvArgs *targs);
-
-static PadObj *
-trv_compare_comparison_lte_int(PadAST *ast, PadTrvArgs *targs);
-
 /************
 * functions *
 ************/
@@ -264,6 +204,19 @@ trv_code_block(PadAST *ast, PadTrvArgs *targs) {
     return_trav(NULL);
 }
 
+/**
+ * push back strings of ref block to stdout
+ * strings are escaped for HTML if context is in auto escape mode
+ */
+static void
+push_ref_str(PadCtx *context, const char *str) {
+    if (PadCtx_GetIsAutoEscape(context)) {
+        PadCtx_PushBackStdoutEscaped(context, str, strlen(str));
+    } else {
+        PadCtx_PushBackStdoutBuf(context, str);
+    }
+}
+
 static PadObj *
 trv_ref_block(PadAST *ast, PadTrvArgs *targs) {
     tready();
@@ -301,14 +254,13 @@ trv_ref_block(PadAST *ast, PadTrvArgs *targs) {
         PadCtx_PushBackStdoutBuf(context, "nil");
         break;
     case PAD_OBJ_TYPE__INT: {
-        char n[1024]; // very large
-        snprintf(n, sizeof n, "%ld", result->lvalue);
+        char n[PAD_NUM__INT_STR_SIZE];
+        PadNum_IntToStr(n, result->lvalue);
         PadCtx_PushBackStdoutBuf(context, n);
     } break;
     case PAD_OBJ_TYPE__FLOAT: {
-        char n[1024]; // very large
-        snprintf(n, sizeof n, "%lf", result->float_value);
-        PadCStr_RStripFloatZero(n);
+        char n[PAD_NUM__FLOAT_STR_SIZE];
+        PadNum_FloatToStr(n, result->float_value);
         PadCtx_PushBackStdoutBuf(context, n);
     } break;
     case PAD_OBJ_TYPE__BOOL: {
@@ -325,11 +277,11 @@ trv_ref_block(PadAST *ast, PadTrvArgs *targs) {
             return_trav(NULL);
         }
         PadStr *str = PadObj_ToStr(obj);
-        PadCtx_PushBackStdoutBuf(context, PadStr_Getc(str));
+        push_ref_str(context, PadStr_Getc(str));
         PadStr_Del(str);
     } break;
     case PAD_OBJ_TYPE__UNICODE: {
-        PadCtx_PushBackStdoutBuf(context, PadUni_GetcMB(result->unicode));
+        push_ref_str(context, PadUni_GetcMB(result->unicode));
     } break;
     case PAD_OBJ_TYPE__ARRAY: {
         PadCtx_PushBackStdoutBuf(context, "(array)");
@@ -355,6 +307,29 @@ trv_ref_block(PadAST *ast, PadTrvArgs *targs) {
     case PAD_OBJ_TYPE__FILE: {
         PadCtx_PushBackStdoutBuf(context, "(file)");
     } break;
+    case PAD_OBJ_TYPE__RANGE: {
+        PadCtx_PushBackStdoutBuf(context, "(range)");
+    } break;
+    case PAD_OBJ_TYPE__DEQUE: {
+        PadCtx_PushBackStdoutBuf(context, "(deque)");
+    } break;
+    case PAD_OBJ_TYPE__NUMARRAY: {
+        PadCtx_PushBackStdoutBuf(context, "(numarray)");
+    } break;
+    case PAD_OBJ_TYPE__DICT_VIEW: {
+        PadCtx_PushBackStdoutBuf(context, "(dict-view)");
+    } break;
+    case PAD_OBJ_TYPE__REGEX: {
+        PadCtx_PushBackStdoutBuf(context, "(regex)");
+    } break;
+    case PAD_OBJ_TYPE__BUILDER: {
+        PadUni *built = PadObj_BuildBuilder(result);
+        if (!built) {
+            pushb_error("failed to build string");
+            return_trav(NULL);
+        }
+        push_ref_str(context, PadUni_GetcMB(built));
+    } break;
     } // switch
 
     return_trav(NULL);
@@ -370,7 +345,14 @@ trv_text_block(PadAST *ast, PadTrvArgs *targs) {
     PadCtx *context = PadCtx_FindMostPrev(ast->ref_context);
     assert(context);
 
-    if (text_block->text) {
+    if (text_block->text && context == ast->ref_context) {
+        // text of root AST lives until end of render. emit it without copy
+        PadCtx_PushBackStdoutStatic(
+            context, text_block->text, text_block->text_len
+        );
+        check("store text block to buf");
+    } else if (text_block->text) {
+        // text of module may be deleted before flush of sink
         PadCtx_PushBackStdoutBuf(context, text_block->text);
         check("store text block to buf");
     }
@@ -927,6 +909,294 @@ trv_else_stmt(PadAST *ast, PadTrvArgs *targs) {
     return_trav(result);
 }
 
+/**
+ * set loop variable of for-in statement at current varmap
+ *
+ * @param[in] *idn_node identifier node
+ * @param[in] *obj      reference to object
+ */
+static bool
+set_iter_var(PadAST *ast, PadTrvArgs *targs, const PadNode *idn_node, PadObj *obj) {
+    const PadIdentNode *idn = idn_node->real;
+    return Pad_SetRefAtVarmap(
+        ast->error_stack,
+        targs->ref_node,
+        ast->ref_context,
+        NULL,
+        idn->identifier,
+        obj
+    );
+}
+
+/**
+ * set integer at loop variable of for-in statement
+ * if the integer of previous step is referred by only loop variable then
+ * overwrite it without allocation. *held keeps one reference of the integer
+ *
+ * @param[in]     *idn_node identifier node
+ * @param[in,out] **held    integer of previous step or NULL
+ * @param[in]     value     value of integer
+ */
+static bool
+set_iter_int(
+    PadAST *ast,
+    PadTrvArgs *targs,
+    const PadNode *idn_node,
+    PadObj **held,
+    PadIntObj value
+) {
+    PadObj *prev = *held;
+    if (prev && prev->gc_item.ref_counts == 2) {
+        const PadIdentNode *idn = idn_node->real;
+        PadObjDict *varmap = PadCtx_GetVarmapAtCurScope(ast->ref_context);
+        const PadObjDictItem *item = PadObjDict_Getc(varmap, idn->identifier);
+        if (item && item->value == prev) {
+            prev->lvalue = value;
+            return true;
+        }
+    }
+
+    if (prev) {
+        PadObj_DecRef(prev);
+        PadObj_Del(prev);
+    }
+    *held = PadObj_NewInt(ast->ref_gc, value);
+    PadObj_IncRef(*held);
+    return set_iter_var(ast, targs, idn_node, *held);
+}
+
+/**
+ * for-in statement
+ *
+ *     for v in formula : ... end
+ *     for k, v in formula : ... end
+ *
+ * arrays, deques, dicts, strings, ranges, numeric arrays and dict views
+ * are walked on their storage directly. the key is the key of dicts and
+ * items views and the index of others. rows of 2-D numeric array are views
+ * of it. one variable of dict is bound to the key and one variable of
+ * items view is bound to pair of key and value.
+ * if the iterable changes size in contents then pushes error
+ */
+static PadObj *
+trv_for_in_stmt(PadAST *ast, PadTrvArgs *targs) {
+    tready();
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadForStmtNode *for_stmt = node->real;
+    PadDepth depth = targs->depth;
+    PadGC *gc = ast->ref_gc;
+
+    check("call _PadTrv_Trav with iter_formula");
+    targs->ref_node = for_stmt->iter_formula;
+    targs->depth = depth + 1;
+    PadObj *result = _PadTrv_Trav(ast, targs);
+    targs->ref_node = node;
+    if (PadAST_HasErrs(ast)) {
+        return_trav(NULL);
+    }
+
+    PadObj *iterable = _Pad_ExtractRefOfObjAll(result);
+    if (!iterable) {
+        return_trav(NULL);
+    }
+
+    PadIntObj len;
+    switch (iterable->type) {
+    default:
+        pushb_error("can't iterate object (%d)", iterable->type);
+        return_trav(NULL);
+        break;
+    case PAD_OBJ_TYPE__ARRAY:
+        len = PadObjAry_Len(iterable->objarr);
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        len = PadObjDeq_Len(iterable->objdeq);
+        break;
+    case PAD_OBJ_TYPE__DICT:
+        len = PadObjDict_Len(iterable->objdict);
+        break;
+    case PAD_OBJ_TYPE__UNICODE:
+        len = PadUni_Len(iterable->unicode);
+        break;
+    case PAD_OBJ_TYPE__RANGE:
+        len = PadObj_GetRangeLen(iterable);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        len = PadNumAry_Len(iterable->numarr);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        len = PadObj_GetDictViewLen(iterable);
+        break;
+    }
+
+    // keep iterable while contents re-assign the variable of it
+    PadObj_IncRef(iterable);
+    PadObj *key_int = NULL;
+    PadObj *value_int = NULL;
+
+    for (PadIntObj i = 0; ; ++i) {
+        PadObj *value = NULL;
+        targs->ref_node = node;
+
+        switch (iterable->type) {
+        default:
+            break;
+        case PAD_OBJ_TYPE__ARRAY: {
+            PadObjAry *arr = iterable->objarr;
+            if (PadObjAry_Len(arr) != len) {
+                pushb_error("array changed size during iteration");
+                goto done;
+            }
+            if (i >= len) {
+                goto done;
+            }
+            value = PadObjAry_Get(arr, i);
+        } break;
+        case PAD_OBJ_TYPE__DEQUE: {
+            PadObjDeq *deq = iterable->objdeq;
+            if (PadObjDeq_Len(deq) != len) {
+                pushb_error("deque changed size during iteration");
+                goto done;
+            }
+            if (i >= len) {
+                goto done;
+            }
+            value = PadObjDeq_Get(deq, i);
+        } break;
+        case PAD_OBJ_TYPE__DICT: {
+            PadObjDict *dict = iterable->objdict;
+            if (PadObjDict_Len(dict) != len) {
+                pushb_error("dict changed size during iteration");
+                goto done;
+            }
+            if (i >= len) {
+                goto done;
+            }
+            const PadObjDictItem *item = PadObjDict_GetcIndex(dict, i);
+            if (for_stmt->iter_key) {
+                PadObj *key = PadObj_NewUnicodeCStr(gc, item->key);
+                if (!set_iter_var(ast, targs, for_stmt->iter_key, key)) {
+                    goto done;
+                }
+                value = item->value;
+            } else {
+                value = PadObj_NewUnicodeCStr(gc, item->key);
+            }
+        } break;
+        case PAD_OBJ_TYPE__UNICODE: {
+            PadUni *uni = iterable->unicode;
+            if (PadUni_Len(uni) != len) {
+                pushb_error("string changed size during iteration");
+                goto done;
+            }
+            if (i >= len) {
+                goto done;
+            }
+            PadUni *ch = PadUni_New();
+            PadUni_PushBack(ch, PadUni_Getc(uni)[i]);
+            value = PadObj_NewUnicode(gc, PadMem_Move(ch));
+        } break;
+        case PAD_OBJ_TYPE__RANGE: {
+            if (i >= len) {
+                goto done;
+            }
+            PadIntObj n = PadObj_GetRangeAt(iterable, i);
+            if (!set_iter_int(ast, targs, for_stmt->iter_value, &value_int, n)) {
+                goto done;
+            }
+        } break;
+        case PAD_OBJ_TYPE__NUMARRAY: {
+            if (i >= len) {
+                goto done;
+            }
+            PadNumAry *numarr = iterable->numarr;
+            PadNumVal val = PadNumAry_Get(numarr, i);
+            if (PadNumAry_GetNDim(numarr) == 1 && val.kind == PAD_NUM_ARY_KIND__INT) {
+                if (!set_iter_int(ast, targs, for_stmt->iter_value, &value_int, val.ivalue)) {
+                    goto done;
+                }
+                break;
+            }
+            value = PadObj_NewNumAryItem(gc, iterable, i);
+        } break;
+        case PAD_OBJ_TYPE__DICT_VIEW: {
+            if (PadObj_GetDictViewLen(iterable) != len) {
+                pushb_error("dict changed size during iteration");
+                goto done;
+            }
+            if (i >= len) {
+                goto done;
+            }
+            if (iterable->dict_view.kind == PAD_DICT_VIEW__ITEMS && for_stmt->iter_key) {
+                const PadObjDictItem *item = PadObjDict_GetcIndex(iterable->dict_view.dict->objdict, i);
+                PadObj *key = PadObj_NewUnicodeCStr(gc, item->key);
+                if (!set_iter_var(ast, targs, for_stmt->iter_key, key)) {
+                    goto done;
+                }
+                value = item->value;
+            } else {
+                value = PadObj_NewDictViewItem(gc, iterable, i);
+            }
+        } break;
+        }
+
+        bool is_keyed = iterable->type == PAD_OBJ_TYPE__DICT ||
+            (iterable->type == PAD_OBJ_TYPE__DICT_VIEW &&
+             iterable->dict_view.kind == PAD_DICT_VIEW__ITEMS);
+        if (!is_keyed && for_stmt->iter_key &&
+            !set_iter_int(ast, targs, for_stmt->iter_key, &key_int, i)) {
+            goto done;
+        }
+        if (value && !set_iter_var(ast, targs, for_stmt->iter_value, value)) {
+            goto done;
+        }
+
+        PadCtx_ClearJumpFlags(ast->ref_context);
+        check("call _PadTrv_Trav with contents");
+
+        for (int32_t j = 0; j < PadNodeAry_Len(for_stmt->contents); ++j) {
+            targs->ref_node = PadNodeAry_Get(for_stmt->contents, j);
+            targs->depth = depth + 1;
+            result = _PadTrv_Trav(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                goto done;
+            }
+
+            if (PadCtx_GetDoReturn(ast->ref_context)) {
+                PadObj_DecRef(key_int);
+                PadObj_Del(key_int);
+                PadObj_DecRef(value_int);
+                PadObj_Del(value_int);
+                PadObj_DecRef(iterable);
+                PadObj_Del(iterable);
+                return_trav(result);
+            } else if (PadCtx_GetDoBreak(ast->ref_context) ||
+                       PadCtx_GetDoContinue(ast->ref_context)) {
+                PadObj_Del(result);
+                break;
+            }
+
+            PadObj_Del(result);
+        }  // for
+
+        if (PadCtx_GetDoBreak(ast->ref_context)) {
+            break;
+        }
+    }  // for
+
+done:
+    // integers are left at loop variables
+    PadObj_DecRef(key_int);
+    PadObj_Del(key_int);
+    PadObj_DecRef(value_int);
+    PadObj_Del(value_int);
+    PadObj_DecRef(iterable);
+    PadObj_Del(iterable);
+    PadCtx_ClearJumpFlags(ast->ref_context);
+    return_trav(NULL);
+}
+
 static PadObj *
 trv_for_stmt(PadAST *ast, PadTrvArgs *targs) {
     tready();
@@ -935,6 +1205,10 @@ trv_for_stmt(PadAST *ast, PadTrvArgs *targs) {
     PadForStmtNode *for_stmt = node->real;
     PadDepth depth = targs->depth;
 
+    if (for_stmt->iter_formula) {
+        return trv_for_in_stmt(ast, targs);
+    }
+
     check("call _PadTrv_Trav with init_formula");
     PadObj *result = NULL;
     if (for_stmt->init_formula) {
@@ -1034,6 +1308,122 @@ trv_continue_stmt(PadAST *ast, PadTrvArgs *targs) {
     return_trav(NULL);
 }
 
+/**
+ * find ring node of call in tail position of formula (return f(...))
+ * the formula must be only one call without operators
+ *
+ * @param[in] *node pointer to formula node
+ *
+ * @return found to pointer to ring node
+ * @return not found to NULL
+ */
+static PadNode *
+find_tail_call(PadNode *node) {
+    PadNodeAry *nodearr = NULL;
+
+    for (; node; ) {
+        switch (node->type) {
+        default:
+            return NULL;
+            break;
+        case PAD_NODE_TYPE__FORMULA: {
+            PadFormulaNode *formula = node->real;
+            if (formula->assign_list) {
+                node = formula->assign_list;
+            } else {
+                node = formula->multi_assign;
+            }
+            continue;
+        } break;
+        case PAD_NODE_TYPE__MULTI_ASSIGN: {
+            PadMultiAssignNode *multi_assign = node->real;
+            nodearr = multi_assign->nodearr;
+        } break;
+        case PAD_NODE_TYPE__ASSIGN_LIST: {
+            PadAssignListNode *assign_list = node->real;
+            nodearr = assign_list->nodearr;
+        } break;
+        case PAD_NODE_TYPE__ASSIGN: {
+            PadAssignNode *assign = node->real;
+            nodearr = assign->nodearr;
+        } break;
+        case PAD_NODE_TYPE__SIMPLE_ASSIGN: {
+            PadSimpleAssignNode *simple_assign = node->real;
+            nodearr = simple_assign->nodearr;
+        } break;
+        case PAD_NODE_TYPE__TEST_LIST: {
+            PadTestListNode *test_list = node->real;
+            nodearr = test_list->nodearr;
+        } break;
+        case PAD_NODE_TYPE__TEST: {
+            PadTestNode *test = node->real;
+            node = test->or_test;
+            continue;
+        } break;
+        case PAD_NODE_TYPE__OR_TEST: {
+            PadOrTestNode *or_test = node->real;
+            nodearr = or_test->nodearr;
+        } break;
+        case PAD_NODE_TYPE__AND_TEST: {
+            PadAndTestNode *and_test = node->real;
+            nodearr = and_test->nodearr;
+        } break;
+        case PAD_NODE_TYPE__NOT_TEST: {
+            PadNotTestNode *not_test = node->real;
+            if (not_test->not_test) {
+                return NULL;
+            }
+            node = not_test->comparison;
+            continue;
+        } break;
+        case PAD_NODE_TYPE__COMPARISON: {
+            PadComparisonNode *comparison = node->real;
+            nodearr = comparison->nodearr;
+        } break;
+        case PAD_NODE_TYPE__ASSCALC: {
+            PadAssCalcNode *asscalc = node->real;
+            nodearr = asscalc->nodearr;
+        } break;
+        case PAD_NODE_TYPE__EXPR: {
+            PadExprNode *expr = node->real;
+            nodearr = expr->nodearr;
+        } break;
+        case PAD_NODE_TYPE__TERM: {
+            PadTermNode *term = node->real;
+            nodearr = term->nodearr;
+        } break;
+        case PAD_NODE_TYPE__NEGATIVE: {
+            PadNegativeNode *negative = node->real;
+            if (negative->is_negative) {
+                return NULL;
+            }
+            node = negative->chain;
+            continue;
+        } break;
+        case PAD_NODE_TYPE__RING: {
+            PadRingNode *ring = node->real;
+            int32_t len = PadChainNodes_Len(ring->chain_nodes);
+            if (!len) {
+                return NULL;
+            }
+            PadChainNode *last = PadChainNodes_Get(ring->chain_nodes, len - 1);
+            if (PadChainNode_GetcType(last) != PAD_CHAIN_NODE_TYPE___CALL) {
+                return NULL;
+            }
+            return node;
+        } break;
+        }
+
+        // operators are in array of node. descend if the node has only one operand
+        if (PadNodeAry_Len(nodearr) != 1) {
+            return NULL;
+        }
+        node = PadNodeAry_Get(nodearr, 0);
+    }
+
+    return NULL;
+}
+
 static PadObj *
 trv_return_stmt(PadAST *ast, PadTrvArgs *targs) {
     tready();
@@ -1053,10 +1443,25 @@ trv_return_stmt(PadAST *ast, PadTrvArgs *targs) {
         return_trav(ret);
     }
 
-    check("call _PadTrv_Trav with formula");
-    targs->ref_node = return_stmt->formula;
-    targs->depth = depth + 1;
-    PadObj *result = _PadTrv_Trav(ast, targs);
+    // call in tail position of function is pending on context.
+    // the function invokes it after pop own scope
+    PadNode *tail_ring = NULL;
+    if (targs->func_obj) {
+        tail_ring = find_tail_call(return_stmt->formula);
+    }
+
+    PadObj *result = NULL;
+    if (tail_ring) {
+        check("call refer_ring with tail call");
+        targs->ref_node = tail_ring;
+        targs->depth = depth + 1;
+        result = refer_ring(ast, targs, true);
+    } else {
+        check("call _PadTrv_Trav with formula");
+        targs->ref_node = return_stmt->formula;
+        targs->depth = depth + 1;
+        result = _PadTrv_Trav(ast, targs);
+    }
     if (PadAST_HasErrs(ast)) {
         pushb_error("failed to traverse formula");
         return_trav(NULL);
@@ -1088,15 +1493,22 @@ again:
     } break;
     case PAD_OBJ_TYPE__ARRAY:
     case PAD_OBJ_TYPE__DICT:
+    case PAD_OBJ_TYPE__DEQUE:
         ret = _Pad_ExtractRefOfObjAll(result);
         break;
     case PAD_OBJ_TYPE__NIL:
     case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__FLOAT:
     case PAD_OBJ_TYPE__BOOL:
     case PAD_OBJ_TYPE__UNICODE:
     case PAD_OBJ_TYPE__MODULE:
     case PAD_OBJ_TYPE__FUNC:
     case PAD_OBJ_TYPE__OBJECT:
+    case PAD_OBJ_TYPE__BUILDER:
+    case PAD_OBJ_TYPE__RANGE:
+    case PAD_OBJ_TYPE__NUMARRAY:
+    case PAD_OBJ_TYPE__DICT_VIEW:
+    case PAD_OBJ_TYPE__REGEX:
         ret = result;
         break;
     }
@@ -1734,10 +2146,75 @@ marley:
 }
 
 static PadObj *
-assign_to_chain_index(
+assign_to_chain_numarray_index(
     PadAST *ast,
     PadTrvArgs *targs,
-    PadObjAry *owners,
+    PadObj *owner,
+    PadChainObj *co,
+    PadObj *rhs
+) {
+    assert(owner->type == PAD_OBJ_TYPE__NUMARRAY);
+    PadObj *idxobj = Pad_ExtractIdent(PadChainObj_GetObj(co));
+    if (!idxobj || idxobj->type != PAD_OBJ_TYPE__INT) {
+        pushb_error("index isn't integer");
+        return NULL;
+    }
+
+    PadNumAry *numarr = owner->numarr;
+    if (PadNumAry_GetNDim(numarr) != 1) {
+        pushb_error("can't assign to row of numeric array");
+        return NULL;
+    }
+
+again:
+    switch (rhs->type) {
+    default:
+        pushb_error("can't assign (%d) to numeric array", rhs->type);
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(rhs);
+        rhs = Pad_PullRefAll(rhs);
+        if (!rhs) {
+            pushb_error("\"%s\" is not defined", idn);
+            return NULL;
+        }
+        goto again;
+    } break;
+    case PAD_OBJ_TYPE__RING: {
+        rhs = _Pad_ReferRingObjWithRef(rhs);
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to refer ring object");
+            return NULL;
+        }
+        goto again;
+    } break;
+    case PAD_OBJ_TYPE__INT:
+    case PAD_OBJ_TYPE__BOOL:
+    case PAD_OBJ_TYPE__FLOAT:
+        break;
+    }
+
+    PadNumVal val;
+    if (rhs->type == PAD_OBJ_TYPE__FLOAT) {
+        val = (PadNumVal) { .kind = PAD_NUM_ARY_KIND__FLOAT, .fvalue = rhs->float_value };
+    } else {
+        val = (PadNumVal) { .kind = PAD_NUM_ARY_KIND__INT, .ivalue = rhs->type == PAD_OBJ_TYPE__INT ? rhs->lvalue : rhs->boolean };
+    }
+
+    if (!PadNumAry_Set(numarr, idxobj->lvalue, val)) {
+        pushb_error("index out of range");
+        return NULL;
+    }
+
+    return rhs;
+}
+
+static PadObj *
+assign_to_chain_index(
+    PadAST *ast,
+    PadTrvArgs *targs,
+    PadObjAry *owners,
     PadChainObj *co,
     PadObj *rhs
 ) {
@@ -1778,6 +2255,14 @@ again:
         }
         return result;
     } break;
+    case PAD_OBJ_TYPE__NUMARRAY: {
+        PadObj *result = assign_to_chain_numarray_index(ast, targs, owner, co, rhs);
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to assign to numeric array");
+            return NULL;
+        }
+        return result;
+    } break;
     }
 
     assert(0 && "impossible");
@@ -2294,7824 +2779,990 @@ trv_test(PadAST *ast, PadTrvArgs *targs) {
     return_trav(obj);
 }
 
+/**
+ * resolve operand of operator
+ * identifier is resolved to its variable and ring is resolved to object
+ * referred by the ring
+ */
+static PadObj *
+extract_idn_and_chain(PadAST *ast, PadTrvArgs *targs, PadObj *obj) {
+    if (!ast || !targs || !obj) {
+        return NULL;
+    }
+
+again:
+    switch (obj->type) {
+    default: {
+        return_trav(obj);
+    } break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(obj);
+        obj = Pad_PullRefAll(obj);
+        if (!obj) {
+            pushb_error("\"%s\" is not defined", idn);
+            return_trav(NULL);
+        }
+        goto again;
+    } break;
+    case PAD_OBJ_TYPE__RING: {
+        obj = _Pad_ReferRingObjWithRef(obj);
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to refer ring object");
+            return_trav(NULL);
+        }
+        assert(obj);
+        goto again;
+    } break;
+    }
+}
+
+/**
+ * calculate binary operator by kernel of operator (see operator.h)
+ * operands are resolved in here at once. if the table has not kernel for
+ * pair of types of operands then this is error
+ *
+ * @param[in] *ast   pointer to PadAST
+ * @param[in] *targs lhs_obj and rhs_obj are operands
+ * @param[in] op     number of operator
+ *
+ * @return success to pointer to result object
+ * @return failed to NULL
+ */
 static PadObj *
-trv_roll_identifier_lhs(PadAST *ast, PadTrvArgs *targs) {
+trv_calc_op(PadAST *ast, PadTrvArgs *targs, op_t op) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__IDENT);
 
-    PadDepth depth = targs->depth;
+    PadObj *lhs = extract_idn_and_chain(ast, targs, targs->lhs_obj);
+    if (!lhs) {
+        return_trav(NULL);
+    }
 
-    PadCtx *ref_context = PadObj_GetIdentRefCtx(lhs);
-    assert(ref_context);
-    const char *idn = PadObj_GetcIdentName(lhs);
-    PadObj *lvar = PadCtx_FindVarRefAll(ref_context, idn);
-    if (!lvar) {
-        pushb_error("\"%s\" is not defined", idn);
+    PadObj *rhs = extract_idn_and_chain(ast, targs, targs->rhs_obj);
+    if (!rhs) {
         return_trav(NULL);
     }
 
-    check("call function pointer");
-    targs->lhs_obj = lvar;
-    targs->rhs_obj = rhs;
-    targs->depth = depth + 1;
-    PadObj *result = targs->callback(ast, targs);
-    return_trav(result);
+    PadOpKernel kernel = PadOp_GetKernel(op, lhs->type, rhs->type);
+    if (!kernel) {
+        pushb_error(
+            "can't %s %s with %s",
+            PadOp_GetcName(op),
+            PadOp_GetcTypeName(lhs->type),
+            PadOp_GetcTypeName(rhs->type)
+        );
+        return_trav(NULL);
+    }
+
+    PadObj *obj = kernel(ast->error_stack, targs->ref_node, ast->ref_gc, lhs, rhs);
+    return_trav(obj);
 }
 
-static PadObj*
-trv_roll_identifier_rhs(PadAST *ast, PadTrvArgs *targs) {
+/**
+ * left hand operand if it is true else right hand operand
+ */
+static PadObj *
+trv_compare_or(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs && targs->callback);
-    assert(rhs->type == PAD_OBJ_TYPE__IDENT);
 
-    PadDepth depth = targs->depth;
+    PadObj *lhs = extract_idn_and_chain(ast, targs, targs->lhs_obj);
+    if (!lhs) {
+        return_trav(NULL);
+    }
 
-    PadCtx *ref_context = PadObj_GetIdentRefCtx(rhs);
-    const char *idn = PadObj_GetcIdentName(rhs);
-    PadObj *rvar = PadCtx_FindVarRefAll(ref_context, idn);
-    if (!rvar) {
-        pushb_error("\"%s\" is not defined in roll identifier rhs",
-            PadObj_GetcIdentName(rhs));
+    PadObj *rhs = extract_idn_and_chain(ast, targs, targs->rhs_obj);
+    if (!rhs) {
         return_trav(NULL);
     }
 
-    check("call function pointer");
-    targs->lhs_obj = lhs;
-    targs->rhs_obj = rvar;
-    targs->depth = depth + 1;
-    PadObj *result = targs->callback(ast, targs);
-    return_trav(result);
+    bool is_true = _Pad_ParseBool(lhs);
+    if (PadAST_HasErrs(ast)) {
+        return_trav(NULL);
+    }
+
+    PadObj *obj = PadObj_DeepCopy(is_true ? lhs : rhs);
+    return_trav(obj);
 }
 
 static PadObj *
-trv_compare_or_int(PadAST *ast, PadTrvArgs *targs) {
+trv_or_test(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    assert(node->type == PAD_NODE_TYPE__OR_TEST);
+    PadOrTestNode *or_test = node->real;
 
     PadDepth depth = targs->depth;
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->lvalue && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->lvalue && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rvar = Pad_PullRefAll(rhs);
-        if (!rvar) {
-            pushb_error("%s is not defined in compare or int", PadObj_GetcIdentName(rhs));
+    PadNode *lnode = PadNodeAry_Get(or_test->nodearr, 0);
+
+    check("call _PadTrv_Trav");
+    targs->ref_node = lnode;
+    targs->depth = depth + 1;
+    PadObj *lhs = _PadTrv_Trav(ast, targs);
+    if (PadAST_HasErrs(ast)) {
+        return_trav(NULL);
+    }
+    assert(lhs);
+
+    for (int i = 1; i < PadNodeAry_Len(or_test->nodearr); ++i) {
+        PadNode *rnode = PadNodeAry_Get(or_test->nodearr, i);
+        check("call _PadTrv_Trav");
+        targs->ref_node = rnode;
+        targs->depth = depth + 1;
+        PadObj *rhs = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        if (!rhs) {
+            return_trav(lhs);
+        }
 
-        check("call trv_compare_or with rvar");
+        check("call trv_compare_or");
         targs->lhs_obj = lhs;
-        targs->rhs_obj = rvar;
+        targs->rhs_obj = rhs;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or int. index object value is null");
+        PadObj *result = trv_compare_or(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        assert(result);
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_int(ast, targs);
-        return_trav(obj);
-    } break;
+        lhs = result;
     }
 
-    assert(0 && "impossible. failed to compare or int");
-    return_trav(NULL);
+    return_trav(lhs);
 }
 
+/**
+ * right hand operand if both operands are true or right hand operand is false
+ * else left hand operand (false). nil at left hand side is always the result
+ */
 static PadObj *
-trv_compare_or_bool(PadAST *ast, PadTrvArgs *targs) {
+trv_compare_and(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
 
+    PadObj *lhs = extract_idn_and_chain(ast, targs, targs->lhs_obj);
+    if (!lhs) {
+        return_trav(NULL);
+    }
+
+    PadObj *rhs = extract_idn_and_chain(ast, targs, targs->rhs_obj);
+    if (!rhs) {
+        return_trav(NULL);
+    }
+
+    bool lhs_is_true = _Pad_ParseBool(lhs);
+    bool rhs_is_true = _Pad_ParseBool(rhs);
+    if (PadAST_HasErrs(ast)) {
+        return_trav(NULL);
+    }
+
+    PadObj *obj = rhs;
+    if (lhs->type == PAD_OBJ_TYPE__NIL || (!lhs_is_true && rhs_is_true)) {
+        obj = lhs;
+    }
+
+    obj = PadObj_DeepCopy(obj);
+    return_trav(obj);
+}
+
+static PadObj *
+trv_and_test(PadAST *ast, PadTrvArgs *targs) {
+    tready();
+    PadNode *node = targs->ref_node;
+    assert(node);
+    assert(node->type == PAD_NODE_TYPE__AND_TEST);
+    PadAndTestNode *and_test = node->real;
     PadDepth depth = targs->depth;
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
+    PadNode *lnode = PadNodeAry_Get(and_test->nodearr, 0);
+    check("call _PadTrv_Trav with not_test");
+    targs->ref_node = lnode;
+    targs->depth = depth + 1;
+    PadObj *lhs = _PadTrv_Trav(ast, targs);
+    if (PadAST_HasErrs(ast)) {
+        return_trav(NULL);
+    }
+    assert(lhs);
+
+    for (int i = 1; i < PadNodeAry_Len(and_test->nodearr); ++i) {
+        PadNode *rnode = PadNodeAry_Get(and_test->nodearr, i);
+        check("call _PadTrv_Trav with not_test");
+        targs->ref_node = rnode;
+        targs->depth = depth + 1;
+        PadObj *rhs = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
+            return_trav(NULL);
         }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs->boolean && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs->boolean && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rvar = PadCtx_FindVarRef(ast->ref_context, PadObj_GetcIdentName(rhs));
-        if (!rvar) {
-            pushb_error("%s is not defined compare or bool", PadStr_Getc(rhs->identifier.name));
-            return_trav(NULL);
+        if (!rhs) {
+            return_trav(lhs);
         }
 
-        check("call trv_compare_or");
+        check("call trv_compare_and");
         targs->lhs_obj = lhs;
-        targs->rhs_obj = rvar;
+        targs->rhs_obj = rhs;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or bool. index object value is null");
+        PadObj *result = trv_compare_and(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        assert(result);
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_bool(ast, targs);
-        return_trav(obj);
-    } break;
+        lhs = result;
     }
 
-    assert(0 && "impossible. failed to compare or bool");
-    return_trav(NULL);
+    return_trav(lhs);
 }
 
 static PadObj *
-trv_compare_or_string(PadAST *ast, PadTrvArgs *targs) {
+trv_compare_not(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
+    PadObj *operand = targs->ref_obj;
+    assert(operand);
 
     PadDepth depth = targs->depth;
-    int32_t slen = PadUni_Len(lhs->unicode);
 
-    switch (rhs->type) {
+    switch (operand->type) {
     default: {
-        PadObj *obj = NULL;
-        if (slen && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand);
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (slen && NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (slen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand->lvalue);
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (slen && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand->boolean);
+        return_trav(obj);
+    } break;
+    case PAD_OBJ_TYPE__IDENT: {
+        PadObj *var = PadCtx_FindVarRef(ast->ref_context, PadStr_Getc(operand->identifier.name));
+        if (!var) {
+            pushb_error("\"%s\" is not defined compare not", PadStr_Getc(operand->identifier.name));
+            return_trav(NULL);
         }
+
+        check("call trv_compare_not");
+        targs->ref_obj = var;
+        targs->depth = depth + 1;
+        PadObj *obj = trv_compare_not(ast, targs);
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (slen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadUni_Len(operand->unicode));
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (slen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadObjAry_Len(operand->objarr));
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (slen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (slen && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!slen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
+        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadObjDict_Len(operand->objdict));
         return_trav(obj);
     } break;
     case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or string. index object value is null");
+        PadObj *val = _Pad_ExtractRefOfObjAll(operand);
+        if (!val) {
+            pushb_error("can't compare not. index object value is null");
             return_trav(NULL);
         }
 
-        targs->rhs_obj = rval;
+        targs->ref_obj = val;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_string(ast, targs);
+        PadObj *obj = trv_compare_not(ast, targs);
         return_trav(obj);
     } break;
     }
 
-    assert(0 && "impossible. failed to compare or string");
+    assert(0 && "impossible. failed to compare not");
     return_trav(NULL);
 }
 
 static PadObj *
-trv_compare_or_array(PadAST *ast, PadTrvArgs *targs) {
+trv_not_test(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__ARRAY);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadNotTestNode *not_test = node->real;
 
     PadDepth depth = targs->depth;
-    int32_t arrlen = PadObjAry_Len(lhs->objarr);
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (arrlen && NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (arrlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (arrlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (arrlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (arrlen && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!arrlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
+    if (not_test->not_test) {
+        targs->ref_node = not_test->not_test;
         targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or array. index object value is null");
+        PadObj *operand = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
+            return_trav(NULL);
+        }
+        if (!operand) {
+            pushb_error("failed to not test");
             return_trav(NULL);
         }
 
-        targs->rhs_obj = rval;
+        check("call trv_compare_not");
+        targs->ref_obj = operand;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_array(ast, targs);
+        PadObj *obj = trv_compare_not(ast, targs);
         return_trav(obj);
-    } break;
+    } else if (not_test->comparison) {
+        check("call _PadTrv_Trav with comparision");
+        targs->ref_node = not_test->comparison;
+        targs->depth = depth + 1;
+        PadObj *result = _PadTrv_Trav(ast, targs);
+        return_trav(result);
     }
 
-    assert(0 && "impossible. failed to compare or array");
     return_trav(NULL);
 }
 
 static PadObj *
-trv_compare_or_dict(PadAST *ast, PadTrvArgs *targs) {
+trv_compare_comparison(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DICT);
-
-    PadDepth depth = targs->depth;
-    int32_t dictlen = PadObjDict_Len(lhs->objdict);
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (dictlen && NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (dictlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (dictlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (dictlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (dictlen && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!dictlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or dict. index object value is null");
-            return_trav(NULL);
-        }
+    PadCompOpNode *comp_op = targs->comp_op_node;
+    assert(comp_op);
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    }
+    targs->depth += 1;
 
-    assert(0 && "impossible. failed to compare or dict");
-    return_trav(NULL);
+    check("call trv_calc_op");
+    PadObj *obj = trv_calc_op(ast, targs, comp_op->op);
+    return_trav(obj);
 }
 
 static PadObj *
-trv_compare_or_nil(PadAST *ast, PadTrvArgs *targs) {
+trv_comparison(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__NIL);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadComparisonNode *comparison = node->real;
+    assert(comparison);
 
     PadDepth depth = targs->depth;
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
+    if (PadNodeAry_Len(comparison->nodearr) == 1) {
+        PadNode *node = PadNodeAry_Get(comparison->nodearr, 0);
+        assert(node->type == PAD_NODE_TYPE__ASSCALC);
+
+        check("call _PadTrv_Trav with asscalc");
+        targs->ref_node = node;
         targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FUNC: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or nil. index object value is null");
+        PadObj *result = _PadTrv_Trav(ast, targs);
+        return_trav(result);
+    } else if (PadNodeAry_Len(comparison->nodearr) >= 3) {
+        PadNode *lnode = PadNodeAry_Get(comparison->nodearr, 0);
+        assert(lnode->type == PAD_NODE_TYPE__ASSCALC);
+        check("call _PadTrv_Trav with asscalc");
+        targs->ref_node = lnode;
+        targs->depth = depth + 1;
+        PadObj *lhs = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        assert(lhs);
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare or nil");
-    return_trav(NULL);
-}
+        for (int i = 1; i < PadNodeAry_Len(comparison->nodearr); i += 2) {
+            PadNode *node = PadNodeAry_Get(comparison->nodearr, i);
+            assert(node->type == PAD_NODE_TYPE__COMP_OP);
+            PadCompOpNode *node_comp_op = node->real;
+            assert(node_comp_op);
 
-static PadObj *
-trv_compare_or_func(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FUNC);
+            PadNode *rnode = PadNodeAry_Get(comparison->nodearr, i+1);
+            assert(rnode->type == PAD_NODE_TYPE__ASSCALC);
+            assert(rnode);
+            check("call _PadTrv_Trav with asscalc");
+            targs->ref_node = rnode;
+            targs->depth = depth + 1;
+            PadObj *rhs = _PadTrv_Trav(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
+            }
+            assert(rnode);
 
-    PadDepth depth = targs->depth;
+            check("call trv_compare_comparison");
+            targs->lhs_obj = lhs;
+            targs->comp_op_node = node_comp_op;
+            targs->rhs_obj = rhs;
+            targs->depth = depth + 1;
+            PadObj *result = trv_compare_comparison(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
+            }
 
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs && NULL) {
-        } else if (lhs && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or func. index object value is null");
-            return_trav(NULL);
+            lhs = result;
         }
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_func(ast, targs);
-        return_trav(obj);
-    } break;
+        return_trav(lhs);
     }
 
-    assert(0 && "impossible. failed to compare or array");
+    assert(0 && "impossible. failed to traverse comparison");
     return_trav(NULL);
 }
 
 static PadObj *
-trv_compare_or_module(PadAST *ast, PadTrvArgs *targs) {
+trv_calc_expr(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__MODULE);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs && rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs && NULL) {
-        } else if (lhs && !NULL) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !rhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (lhs && !PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(lhs);
-        } else if (!lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else {
-            obj = PadObj_DeepCopy(rhs);
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_or;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare or func. index object value is null");
-            return_trav(NULL);
-        }
+    PadAddSubOpNode *add_sub_op = targs->add_sub_op_node;
+    assert(add_sub_op);
 
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_func(ast, targs);
-        return_trav(obj);
-    } break;
-    }
+    targs->depth += 1;
 
-    assert(0 && "impossible. failed to compare or array");
-    return_trav(NULL);
+    check("call trv_calc_op");
+    PadObj *obj = trv_calc_op(ast, targs, add_sub_op->op);
+    return_trav(obj);
 }
 
 static PadObj *
-trv_compare_or(PadAST *ast, PadTrvArgs *targs) {
+trv_expr(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadExprNode *expr = node->real;
+    assert(expr);
 
     PadDepth depth = targs->depth;
 
-    switch (lhs->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return NULL;
-        break;
-    case PAD_OBJ_TYPE__NIL: {
-        check("call trv_compare_or_nil");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_or_int");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_or_bool");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_compare_or_string");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_string(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        check("call trv_compare_or_array");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_array(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        check("call trv_compare_or_dict");
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_or;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FUNC: {
-        check("call trv_compare_or_func");
+    if (PadNodeAry_Len(expr->nodearr) == 1) {
+        PadNode *node = PadNodeAry_Get(expr->nodearr, 0);
+        check("call _PadTrv_Trav");
+        targs->ref_node = node;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_func(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__MODULE: {
-        check("call trv_compare_or_module");
+        PadObj *result = _PadTrv_Trav(ast, targs);
+        return_trav(result);
+    } else if (PadNodeAry_Len(expr->nodearr) >= 3) {
+        PadNode *lnode = PadNodeAry_Get(expr->nodearr, 0);
+        targs->ref_node = lnode;
         targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or_module(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't compare or. index object value is null");
+        PadObj *lhs = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        assert(lhs);
 
-        targs->lhs_obj = lval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_or(ast, targs);
-        return_trav(obj);
-    } break;
-    }
+        for (int i = 1; i < PadNodeAry_Len(expr->nodearr); i += 2) {
+            PadNode *node = PadNodeAry_Get(expr->nodearr, i);
+            PadAddSubOpNode *op = node->real;
+            assert(op);
 
-    assert(0 && "impossible. failed to compare or");
-    return_trav(NULL);
-}
+            PadNode *rnode = PadNodeAry_Get(expr->nodearr, i+1);
+            assert(rnode);
+            check("call _PadTrv_Trav");
+            targs->ref_node = rnode;
+            targs->depth = depth + 1;
+            PadObj *rhs = _PadTrv_Trav(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
+            }
+            assert(rnode);
 
-static PadObj *
-trv_or_test(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    assert(node->type == PAD_NODE_TYPE__OR_TEST);
-    PadOrTestNode *or_test = node->real;
-
-    PadDepth depth = targs->depth;
-
-    PadNode *lnode = PadNodeAry_Get(or_test->nodearr, 0);
-
-    check("call _PadTrv_Trav");
-    targs->ref_node = lnode;
-    targs->depth = depth + 1;
-    PadObj *lhs = _PadTrv_Trav(ast, targs);
-    if (PadAST_HasErrs(ast)) {
-        return_trav(NULL);
-    }
-    assert(lhs);
-
-    for (int i = 1; i < PadNodeAry_Len(or_test->nodearr); ++i) {
-        PadNode *rnode = PadNodeAry_Get(or_test->nodearr, i);
-        check("call _PadTrv_Trav");
-        targs->ref_node = rnode;
-        targs->depth = depth + 1;
-        PadObj *rhs = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        if (!rhs) {
-            return_trav(lhs);
-        }
-
-        check("call trv_compare_or");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->depth = depth + 1;
-        PadObj *result = trv_compare_or(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        assert(result);
-
-        lhs = result;
-    }
-
-    return_trav(lhs);
-}
-
-static PadObj *
-trv_compare_and_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs->lvalue && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->lvalue) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs->boolean && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs->boolean) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
-
-    PadDepth depth = targs->depth;
-    int32_t slen = PadUni_Len(lhs->unicode);
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (slen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = NULL;
-        if (slen && NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!NULL) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (slen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (slen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (slen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (slen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (slen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!slen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and string. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_string(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and string");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_array(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__ARRAY);
-
-    PadDepth depth = targs->depth;
-    int32_t arrlen = PadObjAry_Len(lhs->objarr);
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (arrlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (arrlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (arrlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (arrlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!arrlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and array. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_array(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_dict(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DICT);
-
-    PadDepth depth = targs->depth;
-    int32_t dictlen = PadObjDict_Len(lhs->objdict);
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (dictlen && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (dictlen && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (dictlen && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (dictlen && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!dictlen) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and dict. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and dict");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_nil(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__NIL);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_DeepCopy(lhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and nil. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and nil");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_func(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FUNC);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_func(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and_module(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__MODULE);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = NULL;
-        if (lhs && rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_DeepCopy(rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->lvalue) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = NULL;
-        if (lhs && rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!rhs->boolean) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = NULL;
-        if (lhs && PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadUni_Len(rhs->unicode)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjAry_Len(rhs->objarr)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = NULL;
-        if (lhs && PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!PadObjDict_Len(rhs->objdict)) {
-            obj = PadObj_DeepCopy(rhs);
-        } else if (!lhs) {
-            obj = PadObj_DeepCopy(lhs);
-        } else {
-            assert(0 && "impossible. obj is not should be null");
-        }
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't compare and func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_and_func(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_and(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    PadDepth depth = targs->depth;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return NULL;
-        break;
-    case PAD_OBJ_TYPE__NIL: {
-        check("call trv_compare_and_nil");
-        PadObj *obj = trv_compare_and_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_and_int");
-        PadObj *obj = trv_compare_and_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_and_bool");
-        PadObj *obj = trv_compare_and_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_compare_and_string");
-        PadObj *obj = trv_compare_and_string(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        check("call trv_compare_and_array");
-        PadObj *obj = trv_compare_and_array(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        check("call trv_compare_and_dict");
-        PadObj *obj = trv_compare_and_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_and");
-        targs->callback = trv_compare_and;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FUNC: {
-        check("call trv_compare_and_func");
-        PadObj *obj = trv_compare_and_func(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__MODULE: {
-        check("call trv_compare_and_module");
-        PadObj *obj = trv_compare_and_module(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't compare and. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        targs->depth = depth + 1;
-        PadObj *result = trv_compare_and(ast, targs);
-        return_trav(result);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare and");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_and_test(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    assert(node->type == PAD_NODE_TYPE__AND_TEST);
-    PadAndTestNode *and_test = node->real;
-    PadDepth depth = targs->depth;
-
-    PadNode *lnode = PadNodeAry_Get(and_test->nodearr, 0);
-    check("call _PadTrv_Trav with not_test");
-    targs->ref_node = lnode;
-    targs->depth = depth + 1;
-    PadObj *lhs = _PadTrv_Trav(ast, targs);
-    if (PadAST_HasErrs(ast)) {
-        return_trav(NULL);
-    }
-    assert(lhs);
-
-    for (int i = 1; i < PadNodeAry_Len(and_test->nodearr); ++i) {
-        PadNode *rnode = PadNodeAry_Get(and_test->nodearr, i);
-        check("call _PadTrv_Trav with not_test");
-        targs->ref_node = rnode;
-        targs->depth = depth + 1;
-        PadObj *rhs = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        if (!rhs) {
-            return_trav(lhs);
-        }
-
-        check("call trv_compare_and");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->depth = depth + 1;
-        PadObj *result = trv_compare_and(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        assert(result);
-
-        lhs = result;
-    }
-
-    return_trav(lhs);
-}
-
-static PadObj *
-trv_compare_not(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *operand = targs->ref_obj;
-    assert(operand);
-
-    PadDepth depth = targs->depth;
-
-    switch (operand->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !operand->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *var = PadCtx_FindVarRef(ast->ref_context, PadStr_Getc(operand->identifier.name));
-        if (!var) {
-            pushb_error("\"%s\" is not defined compare not", PadStr_Getc(operand->identifier.name));
-            return_trav(NULL);
-        }
-
-        check("call trv_compare_not");
-        targs->ref_obj = var;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_not(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadUni_Len(operand->unicode));
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadObjAry_Len(operand->objarr));
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, !PadObjDict_Len(operand->objdict));
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *val = _Pad_ExtractRefOfObjAll(operand);
-        if (!val) {
-            pushb_error("can't compare not. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->ref_obj = val;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_not(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare not");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_not_test(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadNotTestNode *not_test = node->real;
-
-    PadDepth depth = targs->depth;
-
-    if (not_test->not_test) {
-        targs->ref_node = not_test->not_test;
-        targs->depth = depth + 1;
-        PadObj *operand = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        if (!operand) {
-            pushb_error("failed to not test");
-            return_trav(NULL);
-        }
-
-        check("call trv_compare_not");
-        targs->ref_obj = operand;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_not(ast, targs);
-        return_trav(obj);
-    } else if (not_test->comparison) {
-        check("call _PadTrv_Trav with comparision");
-        targs->ref_node = not_test->comparison;
-        targs->depth = depth + 1;
-        PadObj *result = _PadTrv_Trav(ast, targs);
-        return_trav(result);
-    }
-
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue == rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue == rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue == rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison eq int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value == rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value == rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value == rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison eq int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean == rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean == rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean == rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_not_eq_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison eq bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->lhs_obj = lhs;
-        targs->rhs_obj = rhs;
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        bool b = PadU_StrCmp(PadUni_Getc(lhs->unicode), PadUni_Getc(rhs->unicode)) == 0;
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, b);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq unicode. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_string(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison unicode");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_array(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__ARRAY);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq array. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_array(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_dict(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DICT);
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq dict. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison dict");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_nil(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__NIL);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq nil. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_not_eq_nil(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to compare not equal to nil");
-            return_trav(NULL);
-        }
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison eq nil");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_func(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FUNC);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_not_eq_func(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_object(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__OBJECT);
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_object(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_def_struct(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DEF_STRUCT);
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq struct. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_def_struct(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison def struct");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_module(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__MODULE);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs == rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_compare_comparison_eq_module(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-    assert(lhs->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-    if (!lval) {
-        pushb_error("ring object value is null");
-        return_trav(NULL);
-    }
-
-    PadDepth depth = targs->depth;
-
-    PadObj_IncRef(lval);
-    targs->lhs_obj = lval;
-    targs->depth = depth + 1;
-    PadObj *ret = trv_compare_comparison_eq(ast, targs);
-    PadObj_DecRef(lval);
-    PadObj_Del(lval);
-    return ret;
-}
-
-static PadObj *
-trv_compare_comparison_eq_type(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__TYPE);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default: {
-        pushb_error("can't comparision");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_eq;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__TYPE: {
-        bool b = lhs->type_obj.type == rhs->type_obj.type;
-        return PadObj_NewBool(ast->ref_gc, b);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison type");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_eq(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        check("call trv_compare_comparison_eq_nil");
-        PadObj *obj = trv_compare_comparison_eq_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_eq_int");
-        PadObj *obj = trv_compare_comparison_eq_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_eq_float");
-        PadObj *obj = trv_compare_comparison_eq_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_eq_bool");
-        PadObj *obj = trv_compare_comparison_eq_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_compare_comparison_eq_string");
-        PadObj *obj = trv_compare_comparison_eq_string(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        check("call trv_compare_comparison_eq_array");
-        PadObj *obj = trv_compare_comparison_eq_array(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        check("call trv_compare_comparison_eq_dict");
-        PadObj *obj = trv_compare_comparison_eq_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_eq");
-        targs->callback = trv_compare_comparison_eq;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FUNC: {
-        check("call trv_compare_comparison_eq_func");
-        PadObj *obj = trv_compare_comparison_eq_func(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__OBJECT: {
-        check("call trv_compare_comparison_eq_object");
-        PadObj *obj = trv_compare_comparison_eq_object(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DEF_STRUCT: {
-        check("call trv_compare_comparison_not_eq_def_struct");
-        PadObj *obj = trv_compare_comparison_eq_def_struct(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__MODULE: {
-        check("call trv_compare_comparison_eq_module");
-        PadObj *obj = trv_compare_comparison_eq_module(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        check("call trv_compare_comparison_eq_chain");
-        PadObj *obj = trv_compare_comparison_eq_chain(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__TYPE: {
-        check("call trv_compare_comparison_eq_type");
-        PadObj *obj = trv_compare_comparison_eq_type(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison eq");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue != rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue != rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue != rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_not_eq");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value != rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value != rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value != rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_not_eq");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean != rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean != rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean != rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_unicode(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        bool b = PadU_StrCmp(PadUni_Getc(lhs->unicode), PadUni_Getc(rhs->unicode)) != 0;
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, b);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq string. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_unicode(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq string");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_array(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__ARRAY);
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq array. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_array(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_dict(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DICT);
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq dict. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq dict");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_nil(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__NIL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, false);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_not_eq");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq nil. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq nil");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_func(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FUNC);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_func(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_module(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__MODULE);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_module(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_object(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__OBJECT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq func. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_object(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq array");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_def_struct(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__DEF_STRUCT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs != rhs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__NIL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, true);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison not eq struct. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_not_eq_def_struct(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq struct");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq_type(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__TYPE);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default: {
-        pushb_error("can't comparison");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__TYPE: {
-        bool b = lhs->type_obj.type != rhs->type_obj.type;
-        return PadObj_NewBool(ast->ref_gc, b);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq type");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_not_eq(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return NULL;
-        break;
-    case PAD_OBJ_TYPE__NIL: {
-        check("call trv_compare_comparison_not_eq_nil");
-        PadObj *obj = trv_compare_comparison_not_eq_nil(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_not_eq_int");
-        PadObj *obj = trv_compare_comparison_not_eq_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_not_eq_float");
-        PadObj *obj = trv_compare_comparison_not_eq_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_not_eq_bool");
-        PadObj *obj = trv_compare_comparison_not_eq_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_compare_comparison_not_eq_unicode");
-        PadObj *obj = trv_compare_comparison_not_eq_unicode(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        check("call trv_compare_comparison_not_eq_array");
-        PadObj *obj = trv_compare_comparison_not_eq_array(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DICT: {
-        check("call trv_compare_comparison_not_eq_dict");
-        PadObj *obj = trv_compare_comparison_not_eq_dict(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_not_eq");
-        targs->callback = trv_compare_comparison_not_eq;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FUNC: {
-        check("call trv_compare_comparison_not_eq_func");
-        PadObj *obj = trv_compare_comparison_not_eq_func(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__MODULE: {
-        check("call trv_compare_comparison_not_eq_module");
-        PadObj *obj = trv_compare_comparison_not_eq_module(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__OBJECT: {
-        check("call trv_compare_comparison_not_eq_object");
-        PadObj *obj = trv_compare_comparison_not_eq_object(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__DEF_STRUCT: {
-        check("call trv_compare_comparison_not_eq_object");
-        PadObj *obj = trv_compare_comparison_not_eq_def_struct(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't comparison not eq. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_compare_comparison_not_eq(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__TYPE: {
-        check("call trv_compare_comparison_not_eq_type");
-        PadObj *obj = trv_compare_comparison_not_eq_type(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lte_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lte with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue <= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue <= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue <= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lte");
-        targs->callback = trv_compare_comparison_lte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lte int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lte_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lte int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lte_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lte with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value <= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value <= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value <= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lte");
-        targs->callback = trv_compare_comparison_lte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lte int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lte_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lte int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lte_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lte with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean <= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean <= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean <= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lte");
-        targs->callback = trv_compare_comparison_lte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lte bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lte_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lte bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lte(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("can't compare with lte");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_lte_int");
-        PadObj *obj = trv_compare_comparison_lte_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_lte_float");
-        PadObj *obj = trv_compare_comparison_lte_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_lte_bool");
-        PadObj *obj = trv_compare_comparison_lte_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_lte");
-        targs->callback = trv_compare_comparison_lte;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't comparison lte. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_compare_comparison_lte(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison not eq");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gte_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gte with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue >= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue >= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue >= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gte");
-        targs->callback = trv_compare_comparison_gte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gte int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gte_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gte int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gte_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gte with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value >= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value >= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value >= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gte");
-        targs->callback = trv_compare_comparison_gte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gte int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gte_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gte int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gte_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gte with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean >= rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean >= rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean >= rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gte");
-        targs->callback = trv_compare_comparison_gte;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gte bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gte_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gte bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gte(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("can't compare with gte");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_gte_int");
-        PadObj *obj = trv_compare_comparison_gte_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_gte_float");
-        PadObj *obj = trv_compare_comparison_gte_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_gte_bool");
-        PadObj *obj = trv_compare_comparison_gte_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_gte");
-        targs->callback = trv_compare_comparison_gte;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't comparison gte. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_compare_comparison_gte(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gte");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lt_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lt with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue < rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue < rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue < rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lt");
-        targs->callback = trv_compare_comparison_lt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lt int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lt_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lt int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lt_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lt with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value < rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value < rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value < rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lt");
-        targs->callback = trv_compare_comparison_lt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lt int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lt_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lt int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lt_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare lt with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean < rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean < rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean < rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_lt");
-        targs->callback = trv_compare_comparison_lt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison lt bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_lt_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lt bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_lt(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("can't compare with lt (%d)", lhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_lt_int");
-        PadObj *obj = trv_compare_comparison_lt_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_lt_float");
-        PadObj *obj = trv_compare_comparison_lt_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_lt_bool");
-        PadObj *obj = trv_compare_comparison_lt_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_lt");
-        targs->callback = trv_compare_comparison_lt;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't comparison lt. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_compare_comparison_lt(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison lt");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gt_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gt with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue > rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue > rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->lvalue > rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gt");
-        targs->callback = trv_compare_comparison_gt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gt int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gt_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gt int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gt_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gt with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value > rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value > rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->float_value > rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gt");
-        targs->callback = trv_compare_comparison_gt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gt int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gt_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gt int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gt_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't compare gt with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean > rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean > rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewBool(ast->ref_gc, lhs->boolean > rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs with trv_compare_comparison_gt");
-        targs->callback = trv_compare_comparison_gt;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't comparison gt bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_compare_comparison_gt_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gt bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison_gt(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("can't compare with gt");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_compare_comparison_gt_int");
-        PadObj *obj = trv_compare_comparison_gt_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_compare_comparison_gt_float");
-        PadObj *obj = trv_compare_comparison_gt_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_compare_comparison_gt_bool");
-        PadObj *obj = trv_compare_comparison_gt_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_compare_comparison_gt");
-        targs->callback = trv_compare_comparison_gt;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't comparison gt. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_compare_comparison_gt(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison gt");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_compare_comparison(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-
-    PadCompOpNode *comp_op = targs->comp_op_node;
-    assert(comp_op);
-
-    targs->depth += 1;
-
-    switch (comp_op->op) {
-    default: break;
-    case PAD_OP__EQ: {
-        check("call trv_compare_comparison_eq");
-        PadObj *obj = trv_compare_comparison_eq(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__NOT_EQ: {
-        check("call trv_compare_comparison_not_eq");
-        PadObj *obj = trv_compare_comparison_not_eq(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__LTE: {
-        check("call trv_compare_comparison_lte");
-        PadObj *obj = trv_compare_comparison_lte(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__GTE: {
-        check("call trv_compare_comparison_gte");
-        PadObj *obj = trv_compare_comparison_gte(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__LT: {
-        check("call trv_compare_comparison_lt");
-        PadObj *obj = trv_compare_comparison_lt(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__GT: {
-        check("call trv_compare_comparison_gt");
-        PadObj *obj = trv_compare_comparison_gt(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to compare comparison");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_comparison(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadComparisonNode *comparison = node->real;
-    assert(comparison);
-
-    PadDepth depth = targs->depth;
-
-    if (PadNodeAry_Len(comparison->nodearr) == 1) {
-        PadNode *node = PadNodeAry_Get(comparison->nodearr, 0);
-        assert(node->type == PAD_NODE_TYPE__ASSCALC);
-
-        check("call _PadTrv_Trav with asscalc");
-        targs->ref_node = node;
-        targs->depth = depth + 1;
-        PadObj *result = _PadTrv_Trav(ast, targs);
-        return_trav(result);
-    } else if (PadNodeAry_Len(comparison->nodearr) >= 3) {
-        PadNode *lnode = PadNodeAry_Get(comparison->nodearr, 0);
-        assert(lnode->type == PAD_NODE_TYPE__ASSCALC);
-        check("call _PadTrv_Trav with asscalc");
-        targs->ref_node = lnode;
-        targs->depth = depth + 1;
-        PadObj *lhs = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        assert(lhs);
-
-        for (int i = 1; i < PadNodeAry_Len(comparison->nodearr); i += 2) {
-            PadNode *node = PadNodeAry_Get(comparison->nodearr, i);
-            assert(node->type == PAD_NODE_TYPE__COMP_OP);
-            PadCompOpNode *node_comp_op = node->real;
-            assert(node_comp_op);
-
-            PadNode *rnode = PadNodeAry_Get(comparison->nodearr, i+1);
-            assert(rnode->type == PAD_NODE_TYPE__ASSCALC);
-            assert(rnode);
-            check("call _PadTrv_Trav with asscalc");
-            targs->ref_node = rnode;
-            targs->depth = depth + 1;
-            PadObj *rhs = _PadTrv_Trav(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-            assert(rnode);
-
-            check("call trv_compare_comparison");
-            targs->lhs_obj = lhs;
-            targs->comp_op_node = node_comp_op;
-            targs->rhs_obj = rhs;
-            targs->depth = depth + 1;
-            PadObj *result = trv_compare_comparison(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-
-            lhs = result;
-        }
-
-        return_trav(lhs);
-    }
-
-    assert(0 && "impossible. failed to traverse comparison");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_add_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't add with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue + rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->lvalue + rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue + rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_add;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't add with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_add_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't add with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value + rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value + rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value + rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_add;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't add with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr float");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_add_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't add with bool");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean + rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->boolean + rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean + rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_add;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't add with bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_add_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't add %d with string", rhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_add;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadUni *u = PadUni_New();
-        PadUni_App(u, PadUni_Getc(lhs->unicode));
-        PadUni_App(u, PadUni_Getc(rhs->unicode));
-        PadObj *obj = PadObj_NewUnicode(ast->ref_gc, u);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't add with string. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr string");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_add_array(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__ARRAY);
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return NULL;
-    }
-
-    switch (rref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rref->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        PadObjAry *dst = PadObjAry_New();
-        PadObjAry *a1 = lhs->objarr;
-        PadObjAry *a2 = rref->objarr;
-
-        for (int32_t i = 0; i < PadObjAry_Len(a1); ++i) {
-            PadObj *el = PadObjAry_Get(a1, i);
-            assert(el);
-            PadObj_IncRef(el);
-            PadObjAry_PushBack(dst, el);
-        }
-
-        for (int32_t i = 0; i < PadObjAry_Len(a2); ++i) {
-            PadObj *el = PadObjAry_Get(a2, i);
-            assert(el);
-            PadObj_IncRef(el);
-            PadObjAry_PushBack(dst, el);
-        }
-
-        return PadObj_NewAry(ast->ref_gc, PadMem_Move(dst));
-    } break;
-    }
-}
-
-static PadObj *
-trv_calc_expr_add(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("can't add");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_expr_add_int");
-        PadObj *obj = trv_calc_expr_add_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_expr_add_float");
-        PadObj *obj = trv_calc_expr_add_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_expr_add_bool");
-        PadObj *obj = trv_calc_expr_add_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_calc_expr_add_string");
-        PadObj *obj = trv_calc_expr_add_string(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_calc_expr_add");
-        targs->callback = trv_calc_expr_add;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't add with string. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        check("call trv_calc_expr_add_array");
-        PadObj *obj = trv_calc_expr_add_array(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr add");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_sub_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't sub with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue - rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->lvalue - rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue - rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_sub;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't sub with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_sub(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr sub int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_sub_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't sub with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value - rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value - rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value - rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_sub;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't sub with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_sub(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr sub int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_sub_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't sub with bool");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean - rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->boolean - rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean - rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_sub;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't sub with bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_expr_sub(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr sub bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr_sub(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("can't sub");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_expr_sub_int");
-        PadObj *obj = trv_calc_expr_sub_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_expr_sub_float");
-        PadObj *obj = trv_calc_expr_sub_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_expr_sub_bool");
-        PadObj *obj = trv_calc_expr_sub_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_expr_sub;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't sub. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_calc_expr_sub(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr sub");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_expr(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadAddSubOpNode *add_sub_op = targs->add_sub_op_node;
-    assert(add_sub_op);
-
-    targs->depth += 1;
-
-    switch (add_sub_op->op) {
-    default:
-        break;
-    case PAD_OP__ADD: {
-        check("call trv_calc_expr_add");
-        PadObj *obj = trv_calc_expr_add(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__SUB: {
-        check("call trv_calc_expr_sub");
-        PadObj *obj = trv_calc_expr_sub(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc expr");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_expr(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadExprNode *expr = node->real;
-    assert(expr);
-
-    PadDepth depth = targs->depth;
-
-    if (PadNodeAry_Len(expr->nodearr) == 1) {
-        PadNode *node = PadNodeAry_Get(expr->nodearr, 0);
-        check("call _PadTrv_Trav");
-        targs->ref_node = node;
-        targs->depth = depth + 1;
-        PadObj *result = _PadTrv_Trav(ast, targs);
-        return_trav(result);
-    } else if (PadNodeAry_Len(expr->nodearr) >= 3) {
-        PadNode *lnode = PadNodeAry_Get(expr->nodearr, 0);
-        targs->ref_node = lnode;
-        targs->depth = depth + 1;
-        PadObj *lhs = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        assert(lhs);
-
-        for (int i = 1; i < PadNodeAry_Len(expr->nodearr); i += 2) {
-            PadNode *node = PadNodeAry_Get(expr->nodearr, i);
-            PadAddSubOpNode *op = node->real;
-            assert(op);
-
-            PadNode *rnode = PadNodeAry_Get(expr->nodearr, i+1);
-            assert(rnode);
-            check("call _PadTrv_Trav");
-            targs->ref_node = rnode;
-            targs->depth = depth + 1;
-            PadObj *rhs = _PadTrv_Trav(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-            assert(rnode);
-
-            check("call trv_calc_expr");
-            targs->lhs_obj = lhs;
-            targs->add_sub_op_node = op;
-            targs->rhs_obj = rhs;
-            targs->depth = depth + 1;
-            PadObj *result = trv_calc_expr(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-
-            lhs = result;
-        }
-
-        return_trav(lhs);
-    }
-
-    assert(0 && "impossible. failed to traverse expr");
-    return_trav(NULL);
-}
-
-static PadObj *
-mul_unicode_object(PadAST *ast, PadTrvArgs *targs, const PadUni *s, int32_t n) {
-    if (n < 0) {
-        pushb_error("can't mul string by negative value");
-        return NULL;
-    }
-
-    PadUni *u = PadUni_Mul(s, n);
-    return PadObj_NewUnicode(ast->ref_gc, PadMem_Move(u));
-}
-
-static PadObj *
-trv_calc_term_mul_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't mul with int");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue * rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->lvalue * rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue * rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_mul;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *obj = mul_unicode_object(ast, targs, rhs->unicode, lhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't mul with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term mul int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mul_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't mul with float");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value * rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value * rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value * rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_mul;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't mul with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term mul int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mul_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't mul with bool");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean * rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->boolean * rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->boolean * rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_mul;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't mul with bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term mul bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mul_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__UNICODE);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't mul with string");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *obj = mul_unicode_object(ast, targs, lhs->unicode, rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_mul;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE:
-        PadErr_Die("TODO: mul string 2");
-        break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't mul with string. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term mul string");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mul(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("can't mul");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_term_mul_int");
-        PadObj *obj = trv_calc_term_mul_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_term_mul_float");
-        PadObj *obj = trv_calc_term_mul_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_term_mul_bool");
-        PadObj *obj = trv_calc_term_mul_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_lhs with trv_calc_term_mul");
-        targs->callback = trv_calc_term_mul;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_calc_term_mul_string");
-        PadObj *obj = trv_calc_term_mul_string(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = _Pad_ExtractRefOfObjAll(lhs);
-        if (!lval) {
-            pushb_error("can't mul. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term mul");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_div_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        if (!rhs->lvalue) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue / rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        if (!rhs->float_value) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->lvalue / rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhs->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, lhs->lvalue / rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_div;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't division with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_div(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term div int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_div_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        if (!rhs->lvalue) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value / rhs->lvalue);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        if (!rhs->float_value) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value / rhs->float_value);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhs->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        PadObj *obj = PadObj_NewFloat(ast->ref_gc, lhs->float_value / rhs->boolean);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_div;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't division with int. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_div(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term div int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_div_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    targs->depth += 1;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("can't division with bool");
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT:
-        if (!rhs->lvalue) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        return PadObj_NewInt(ast->ref_gc, lhs->boolean / rhs->lvalue);
-    case PAD_OBJ_TYPE__FLOAT:
-        if (!rhs->float_value) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        return PadObj_NewFloat(ast->ref_gc, lhs->boolean / rhs->float_value);
-    case PAD_OBJ_TYPE__BOOL:
-        if (!rhs->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-        return PadObj_NewInt(ast->ref_gc, lhs->boolean / rhs->boolean);
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_div;
-        PadObj *obj = trv_roll_identifier_rhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *rval = _Pad_ExtractRefOfObjAll(rhs);
-        if (!rval) {
-            pushb_error("can't division with bool. index object value is null");
-            return_trav(NULL);
-        }
-
-        targs->rhs_obj = rval;
-        PadObj *obj = trv_calc_term_div(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term div bool");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_div(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("can't division");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_term_div_int");
-        PadObj *obj = trv_calc_term_div_int(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_term_div_float");
-        PadObj *obj = trv_calc_term_div_float(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_term_div_bool");
-        PadObj *obj = trv_calc_term_div_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_roll_identifier_rhs");
-        targs->callback = trv_calc_term_div;
-        PadObj *obj = trv_roll_identifier_lhs(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        PadObj *lval = Pad_ExtractCopyOfObj(
-            ast->error_stack, targs->ref_node, ast,
-            ast->ref_gc, ast->ref_context, lhs
-        );
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("can't division. index object value is null");
-            return_trav(NULL);
-        }
-        assert(lval);
-
-        PadObj_IncRef(lval);
-        targs->lhs_obj = lval;
-        PadObj *obj = trv_calc_term_div(ast, targs);
-        PadObj_DecRef(lval);
-        PadObj_Del(lval);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term div");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mod_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        // TODO: need imp float!
-        PadIntObj result = lhs->lvalue % ((PadIntObj) rhsref->boolean);
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, result);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (!rhsref->lvalue) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        // TODO: need imp float!
-        PadIntObj result = lhs->lvalue % rhsref->lvalue;
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, result);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mod_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        // TODO: need imp float!
-        PadIntObj result = ((PadIntObj) lhs->boolean) % ((PadIntObj) rhsref->boolean);
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, result);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (!rhsref->lvalue) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        // TODO: need imp float!
-        PadIntObj result = ((PadIntObj) lhs->boolean) % rhsref->lvalue;
-        PadObj *obj = PadObj_NewInt(ast->ref_gc, result);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term_mod(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadMulDivOpNode *op = targs->mul_div_op_node;
-    PadObj *lhs = targs->lhs_obj;
-    assert(op->op == PAD_OP__MOD);
-    assert(lhs);
-
-    targs->depth += 1;
-
-    PadObj *lhsref = _Pad_ExtractRefOfObjAll(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (lhsref->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhsref->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_term_mod_int");
-        targs->lhs_obj = lhsref;
-        PadObj *result = trv_calc_term_mod_bool(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_term_mod_int");
-        targs->lhs_obj = lhsref;
-        PadObj *result = trv_calc_term_mod_int(ast, targs);
-        return_trav(result);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_term(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-
-    PadMulDivOpNode *mul_div_op = targs->mul_div_op_node;
-    assert(mul_div_op);
-
-    targs->depth += 1;
-
-    switch (mul_div_op->op) {
-    default: break;
-    case PAD_OP__MUL: {
-        check("call trv_calc_term_mul");
-        PadObj *obj = trv_calc_term_mul(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__DIV: {
-        check("call trv_calc_term_div");
-        PadObj *obj = trv_calc_term_div(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__MOD: {
-        check("call trv_call_term_mod");
-        PadObj *obj = trv_calc_term_mod(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc term");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_term(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadTermNode *term = node->real;
-    assert(term);
-
-    PadDepth depth = targs->depth;
-
-    if (PadNodeAry_Len(term->nodearr) == 1) {
-        PadNode *node = PadNodeAry_Get(term->nodearr, 0);
-        assert(node->type == PAD_NODE_TYPE__NEGATIVE);
-        check("call _PadTrv_Trav with dot");
-        targs->ref_node = node;
-        targs->depth = depth + 1;
-        PadObj *result = _PadTrv_Trav(ast, targs);
-        return_trav(result);
-    } else if (PadNodeAry_Len(term->nodearr) >= 3) {
-        PadNode *lnode = PadNodeAry_Get(term->nodearr, 0);
-        assert(lnode->type == PAD_NODE_TYPE__NEGATIVE);
-        check("call _PadTrv_Trav with dot");
-        targs->ref_node = lnode;
-        targs->depth = depth + 1;
-        PadObj *lhs = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            return_trav(NULL);
-        }
-        assert(lhs);
-
-        for (int i = 1; i < PadNodeAry_Len(term->nodearr); i += 2) {
-            PadNode *node = PadNodeAry_Get(term->nodearr, i);
-            assert(node->type == PAD_NODE_TYPE__MUL_DIV_OP);
-            PadMulDivOpNode *op = node->real;
-            assert(op);
-
-            PadNode *rnode = PadNodeAry_Get(term->nodearr, i+1);
-            assert(rnode->type == PAD_NODE_TYPE__NEGATIVE);
-            check("call _PadTrv_Trav with index");
-            targs->ref_node = rnode;
-            targs->depth = depth + 1;
-            PadObj *rhs = _PadTrv_Trav(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-            assert(rnode);
-
-            check("trv_calc_term");
-            targs->lhs_obj = lhs;
-            targs->mul_div_op_node = op;
-            targs->rhs_obj = rhs;
-            targs->depth = depth + 1;
-            PadObj *result = trv_calc_term(ast, targs);
-            if (PadAST_HasErrs(ast)) {
-                return_trav(NULL);
-            }
-
-            lhs = result;
-        }
-
-        return_trav(lhs);
-    }
-
-    assert(0 && "impossible. failed to traverse term");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_negative(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadNegativeNode *negative = node->real;
-    assert(negative);
-
-    PadDepth depth = targs->depth;
-
-    check("call _PadTrv_Trav with negative's dot")
-    targs->ref_node = negative->chain;
-    targs->depth = depth + 1;
-    PadObj *operand = _PadTrv_Trav(ast, targs);
-    if (PadAST_HasErrs(ast)) {
-        return_trav(NULL);
-    }
-    if (!operand) {
-        pushb_error("not found operand in negative");
-        return_trav(NULL);
-    }
-
-again:
-    switch (operand->type) {
-    default:
-        if (negative->is_negative) {
-            pushb_error("invalid operand type (%d) in negative", operand->type);
-            return_trav(NULL);
-        }
-        return operand;
-    break;
-    case PAD_OBJ_TYPE__INT: {
-        if (negative->is_negative) {
-            PadObj *obj = PadObj_NewInt(ast->ref_gc, -operand->lvalue);
-            return_trav(obj);
-        }
-        return_trav(operand);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (negative->is_negative) {
-            PadObj *obj = PadObj_NewInt(ast->ref_gc, -operand->boolean);
-            return_trav(obj);
-        }
-        return_trav(operand);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        if (negative->is_negative) {
-            PadObj *obj = PadObj_NewFloat(ast->ref_gc, -operand->float_value);
-            return_trav(obj);
-        }
-        return_trav(operand);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        if (negative->is_negative) {
-            operand = _Pad_ExtractRefOfObjAll(operand);
-            goto again;
-        }
-        return_trav(operand);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to traverse negative");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_ring(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadNode *node = targs->ref_node;
-    assert(node);
-    PadRingNode *ring = node->real;
-    assert(ring);
-
-    PadDepth depth = targs->depth;
-
-    // get operand
-    PadNode *factor = ring->factor;
-    assert(factor);
-
-    targs->ref_node = factor;
-    targs->depth = depth + 1;
-    PadObj *operand = _PadTrv_Trav(ast, targs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to traverse factor");
-        return_trav(NULL);
-    }
-    assert(operand);
-
-    // get objects
-    PadChainNodes *cns = ring->chain_nodes;
-    assert(cns);
-    if (!PadChainNodes_Len(cns)) {
-        return_trav(operand);
-    }
-
-    // convert ring-nodes to ring-objects
-    PadChainObjs *chobjs = PadChainObjs_New();
-
-    for (int32_t i = 0; i < PadChainNodes_Len(cns); ++i) {
-        PadChainNode *cn = PadChainNodes_Get(cns, i);
-        assert(cn);
-        PadNode *node = PadChainNode_GetNode(cn);
-        assert(node);
-
-        targs->ref_node = node;
-        targs->depth = depth + 1;
-        PadObj *elem = _PadTrv_Trav(ast, targs);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to traverse node");
-            goto fail;
-        }
-
-        PadChainObjType type;
-        switch (PadChainNode_GetcType(cn)) {
-        case PAD_CHAIN_NODE_TYPE___DOT:
-            type = PAD_CHAIN_PAD_OBJ_TYPE___DOT;
-            break;
-        case PAD_CHAIN_NODE_TYPE___INDEX:
-            type = PAD_CHAIN_PAD_OBJ_TYPE___INDEX;
-            break;
-        case PAD_CHAIN_NODE_TYPE___CALL:
-            type = PAD_CHAIN_PAD_OBJ_TYPE___CALL;
-            break;
-        default:
-            pushb_error("invalid ring node type (%d)", PadChainNode_GetcType(cn));
-            goto fail;
-            break;
-        }
-
-        PadObj_IncRef(elem);
-        PadChainObj *chobj = PadChainObj_New(type, PadMem_Move(elem));
-        PadChainObjs_MoveBack(chobjs, PadMem_Move(chobj));
-    }
-    assert(PadChainObjs_Len(chobjs) != 0);
-
-    // done
-    PadObj_IncRef(operand);
-    PadObj *obj_ring = PadObj_NewRing(
-        ast->ref_gc,
-        PadMem_Move(operand),
-        PadMem_Move(chobjs)
-    );
-    operand = NULL;
-    chobjs = NULL;
-
-    // do refer ring objects ?
-    if (targs->do_not_refer_ring) {
-        return_trav(obj_ring);
-    } else {
-        PadObj *result = _Pad_ReferRingObjWithRef(obj_ring);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to refer ring object");
-            goto fail;
-        }
-
-        PadObj_Del(obj_ring);
-        return_trav(result);
-    }
-
-fail:
-    PadObj_Del(operand);
-    PadChainObjs_Del(chobjs);
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_assign_to_idn(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__IDENT);
-    PadObjAry *ref_owners = targs->ref_owners;
-    const char *idn = PadStr_Getc(lhs->identifier.name);
-
-    switch (rhs->type) {
-    default: {
-        check("set reference of (%d) at (%s) of varmap", rhs->type, idn);
-        Pad_SetRefAtVarmap(
-            ast->error_stack,
-            targs->ref_node,
-            ast->ref_context,
-            ref_owners,
-            idn,
-            rhs
-        );
-        return_trav(rhs);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        // TODO: fix me!
-        // what?
-        PadObj *val = _Pad_ExtractRefOfObjAll(rhs);
-        Pad_SetRefAtVarmap(
-            ast->error_stack,
-            targs->ref_node,
-            ast->ref_context,
-            ref_owners,
-            idn,
-            val
-        );
-        return_trav(val);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rval = Pad_PullRefAll(rhs);
-        if (!rval) {
-            pushb_error("\"%s\" is not defined in asscalc ass idn", PadObj_GetcIdentName(rhs));
-            return_trav(NULL);
-        }
-
-        check("set reference of (%d) at (%s) of current varmap", rval->type, idn);
-        PadObj_IncRef(rval);
-
-        Pad_SetRefAtVarmap(
-            ast->error_stack,
-            targs->ref_node,
-            ast->ref_context,
-            ref_owners,
-            idn,
-            rval
-        );
-        return_trav(rval);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc ass idn");
-    return_trav(NULL);
-}
-
-static PadObjDict *
-get_varmap_by_idn(PadCtx *ctx, const char *idn) {
-    PadScope *curscope = PadCtx_GetCurScope(ctx);
-
-    if (PadCStrAry_IsContain(curscope->global_names, idn)) {
-        return PadCtx_GetVarmapAtGlobal(ctx);
-    } else {
-        return PadCtx_GetVarmapAtCurScope(ctx);
-    }
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_identifier_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *intobj = Pad_PullRefAll(idnobj);
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue += rhs->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->float_value = lhs->lvalue + rhs->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue += (PadIntObj) rhs->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rvar = _Pad_ExtractRefOfObjAll(rhs);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to extract object");
-            return_trav(NULL);
-        }
-
-        check("call trv_calc_asscalc_add_ass_identifier_int");
-        targs->lhs_obj = idnobj;
-        targs->rhs_obj = rvar;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_calc_asscalc_add_ass_identifier_int(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc add ass identifier int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_identifier_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObj *floatobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value += rhs->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value += rhs->float_value;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value += (PadIntObj) rhs->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rvar = _Pad_ExtractRefOfObjAll(rhs);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to extract object");
-            return_trav(NULL);
-        }
-
-        check("call trv_calc_asscalc_add_ass_identifier_int");
-        targs->lhs_obj = idnobj;
-        targs->rhs_obj = rvar;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_calc_asscalc_add_ass_identifier_float(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc add ass identifier int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_identifier_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObj *boolobj = Pad_PullRefAll(idnobj);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadDepth depth = targs->depth;
-
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean + rhs->lvalue;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->float_value = lhs->boolean + rhs->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean + rhs->boolean;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        PadObj *rvar = _Pad_ExtractRefOfObjAll(rhs);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to extract object");
-            return_trav(NULL);
-        }
-
-        check("call trv_calc_asscalc_add_ass_identifier_bool");
-        targs->lhs_obj = idnobj;
-        targs->rhs_obj = rvar;
-        targs->depth = depth + 1;
-        PadObj *obj = trv_calc_asscalc_add_ass_identifier_bool(ast, targs);
-        return_trav(obj);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc add ass identifier int");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_identifier_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *unicodeobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    const char *idn = targs->identifier;
-    assert(idnobj && rhs && idn);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-again:
-    switch (rhs->type) {
-    default:
-        pushb_error("invalid right hand operand (%d)", rhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__IDENT: {
-        const char *idn = PadObj_GetcIdentName(rhs);
-        rhs = Pad_PullRefAll(rhs);
-        if (!rhs) {
-            pushb_error("not found \"%s\"", idn);
-            return_trav(NULL);
-        }
-        goto again;
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        PadObj *lhs = PadObj_DeepCopy(unicodeobj);
-        PadUni_App(lhs->unicode, PadUni_Getc(rhs->unicode));
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        rhs = _Pad_ExtractRefOfObjAll(rhs);
-        if (PadErrStack_Len(ast->error_stack)) {
-            pushb_error("failed to extract ring object");
-            return_trav(NULL);
-        }
-        goto again;
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc add ass identifier string");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_identifier(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-    assert(lhs->type == PAD_OBJ_TYPE__IDENT);
-
-    const char *idn = PadObj_GetcIdentName(lhs);
-    PadObj *lhsref = _Pad_ExtractRefOfObj(lhs);
-    if (!lhsref) {
-        pushb_error("failed to extract object");
-        return_trav(NULL);
-    }
-
-    PadDepth depth = targs->depth;
-    PadObj *result = NULL;
-
-    switch (lhsref->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhsref->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_asscalc_add_ass_identifier_int");
-        targs->lhs_obj = lhs;
-        targs->depth = depth + 1;
-        result = trv_calc_asscalc_add_ass_identifier_int(ast, targs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_asscalc_add_ass_identifier_float");
-        targs->lhs_obj = lhs;
-        targs->depth = depth + 1;
-        result = trv_calc_asscalc_add_ass_identifier_float(ast, targs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_asscalc_add_ass_identifier_bool");
-        targs->lhs_obj = lhs;
-        targs->depth = depth + 1;
-        result = trv_calc_asscalc_add_ass_identifier_bool(ast, targs);
-    } break;
-    case PAD_OBJ_TYPE__IDENT:
-        check("call trv_calc_asscalc_add_ass_identifier");
-        targs->lhs_obj = lhsref;
-        targs->depth = depth + 1;
-        result = trv_calc_asscalc_add_ass_identifier(ast, targs);
-        break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_calc_asscalc_add_ass_identifier_string");
-        targs->lhs_obj = lhs;
-        targs->identifier = idn;
-        targs->depth = depth + 1;
-        result = trv_calc_asscalc_add_ass_identifier_string(ast, targs);
-    } break;
-    }
-
-    return_trav(result);
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *chainobj = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(chainobj && rhs);
-    assert(chainobj->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lref = _Pad_ReferRingObjWithRef(chainobj);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to refer ring object");
-        return_trav(NULL);
-    }
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (lref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return_trav(NULL);
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue += rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = lref->lvalue + rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue += (PadIntObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return_trav(NULL);
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value += rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value += rref->float_value;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value += (PadFloatObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return_trav(NULL);
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) + rref->lvalue;
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = ((PadFloatObj) lref->boolean) + rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) + ((PadIntObj) rref->boolean);
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return_trav(NULL);
-        } break;
-        case PAD_OBJ_TYPE__UNICODE: {
-            lref = PadObj_DeepCopy(lref);
-            PadUni_AppOther(lref->unicode, rref->unicode);
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__ARRAY: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return_trav(NULL);
-        } break;
-        case PAD_OBJ_TYPE__ARRAY: {
-            lref = PadObj_DeepCopy(lref);
-            PadObjAry_AppOther(lref->objarr, rref->objarr);
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    }
-
-    return lref;
-}
-
-/**
- * TODO: use me!
- * TODO: test
- */
-static PadObj *
-trv_calc_asscalc_sub_ass_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *chainobj = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(chainobj && rhs);
-    assert(chainobj->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lref = _Pad_ReferRingObjWithRef(chainobj);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to refer ring object");
-        return NULL;
-    }
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return NULL;
-    }
-
-    switch (lref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lref->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue -= rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = lref->lvalue - rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue -= (PadIntObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value -= rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value -= rref->float_value;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value -= (PadFloatObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) - rref->lvalue;
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = ((PadFloatObj) lref->boolean) - rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) - ((PadIntObj) rref->boolean);
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    }
-
-    return lref;
-}
-
-/**
- * TODO: use me!
- * TODO: test
- */
-static PadObj *
-trv_calc_asscalc_mul_ass_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *chainobj = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(chainobj && rhs);
-    assert(chainobj->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lref = _Pad_ReferRingObjWithRef(chainobj);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to refer ring object");
-        return NULL;
-    }
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return NULL;
-    }
-
-    switch (lref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lref->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue *= rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = lref->lvalue * rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue *= (PadIntObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value *= rref->lvalue;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value *= rref->float_value;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value *= (PadFloatObj) rref->boolean;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) * rref->lvalue;
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            lref = PadObj_DeepCopy(lref);
-            lref->float_value = ((PadFloatObj) lref->boolean) * rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            lref = PadObj_DeepCopy(lref);
-            lref->lvalue = ((PadIntObj) lref->boolean) * ((PadIntObj) rref->boolean);
-            lref->type = PAD_OBJ_TYPE__INT;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            lref = PadObj_DeepCopy(lref);
-            PadUni *u = PadUni_Mul(lref->unicode, rref->lvalue);
-            PadUni_Del(lref->unicode);
-            lref->unicode = u;
-            _Pad_ReferAndSetRef(chainobj, lref);
-        } break;
-        }
-    } break;
-    }
-
-    return lref;
-}
-
-/**
- * TODO: use me!
- * TODO: test
- */
-static PadObj *
-trv_calc_asscalc_div_ass_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lref = _Pad_ReferRingObjWithRef(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to refer ring object");
-        return NULL;
-    }
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return NULL;
-    }
-
-    switch (lref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lref->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            if (rref->lvalue == 0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue /= rref->lvalue;
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            if (rref->float_value == 0.0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->float_value = lref->lvalue / rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            if (!rref->boolean) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue /= (PadIntObj) rref->boolean;
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            if (rref->lvalue == 0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->float_value /= rref->lvalue;
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            if (rref->float_value == 0.0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->float_value /= rref->float_value;
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            if (!rref->boolean) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->float_value /= (PadFloatObj) rref->boolean;
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            if (rref->lvalue == 0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue = ((PadIntObj) lref->boolean) / rref->lvalue;
-            lref->type = PAD_OBJ_TYPE__INT;
-        } break;
-        case PAD_OBJ_TYPE__FLOAT: {
-            if (rref->float_value == 0.0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->float_value = ((PadFloatObj) lref->boolean) / rref->float_value;
-            lref->type = PAD_OBJ_TYPE__FLOAT;
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            if (!rref->boolean) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue = ((PadIntObj) lref->boolean) / ((PadIntObj) rref->boolean);
-            lref->type = PAD_OBJ_TYPE__INT;
-        } break;
-        }
-    } break;
-    }
-
-    return lref;
-}
-
-/**
- * TODO: use me!
- * TODO: test
- */
-static PadObj *
-trv_calc_asscalc_mod_ass_chain(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__RING);
-
-    PadObj *lref = _Pad_ReferRingObjWithRef(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to refer ring object");
-        return NULL;
-    }
-
-    PadObj *rref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return NULL;
-    }
-
-    switch (lref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lref->type);
-        return NULL;
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            if (rref->lvalue == 0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue %= rref->lvalue;
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            if (!rref->boolean) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue %= (PadIntObj) rref->boolean;
-        } break;
-        }
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        switch (rref->type) {
-        default: {
-            pushb_error("invalid right hand operand (%d)", rref->type);
-            return NULL;
-        } break;
-        case PAD_OBJ_TYPE__INT: {
-            if (rref->lvalue == 0) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue = ((PadIntObj) lref->boolean) % rref->lvalue;
-            lref->type = PAD_OBJ_TYPE__INT;
-        } break;
-        case PAD_OBJ_TYPE__BOOL: {
-            if (!rref->boolean) {
-                pushb_error("zero division error");
-                return NULL;
-            }
-            lref->lvalue = ((PadIntObj) lref->boolean) % ((PadIntObj) rref->boolean);
-            lref->type = PAD_OBJ_TYPE__INT;
-        } break;
-        }
-    } break;
-    }
-
-    return lref;
-}
-
-static PadObj *
-extract_idn_and_chain(PadAST *ast, PadTrvArgs *targs, PadObj *obj) {
-    if (!ast || !targs || !obj) {
-        return NULL;
-    }
-
-again:
-    switch (obj->type) {
-    default: {
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        const char *idn = PadObj_GetcIdentName(obj);
-        obj = Pad_PullRefAll(obj);
-        if (!obj) {
-            pushb_error("\"%s\" is not defined", idn);
-            return_trav(NULL);
-        }
-        goto again;
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        obj = _Pad_ReferRingObjWithRef(obj);
-        if (PadAST_HasErrs(ast)) {
-            pushb_error("failed to refer ring object");
-            return_trav(NULL);
-        }
-        assert(obj);
-        goto again;
-    } break;
-    }
-}
-
-static PadObj *
-trv_calc_asscalc_add_ass(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default:
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return_trav(NULL);
-        break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_calc_asscalc_add_ass_identifier");
-        PadObj *result = trv_calc_asscalc_add_ass_identifier(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        check("call trv_calc_asscalc_add_ass_chain");
-        PadObj *result = trv_calc_asscalc_add_ass_chain(ast, targs);
-        return_trav(result);
-    } break;
-    }
-
-    assert(0 && "impossible. failed to calc asscalc add ass");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_sub_ass_idn_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *intobj = Pad_PullRefAll(idnobj);
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand type (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue -= rhsref->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->float_value = lhs->lvalue - rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue -= (PadIntObj) rhsref->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_sub_ass_idn_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *floatobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand type (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value -= rhsref->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value -= rhsref->float_value;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value -= (PadFloatObj) rhsref->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_sub_ass_idn_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *boolobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand type (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean - rhsref->lvalue;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->float_value = lhs->boolean - rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean - rhsref->boolean;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_sub_ass_idn(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-    assert(lhs->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *lhsref = _Pad_ExtractRefOfObjAll(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to pull reference");
-        return_trav(NULL);
-    }
-
-    switch (lhsref->type) {
-    default: {
-        pushb_error("invalid left hand operand type (%d)", lhs->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_sub_ass_idn_int(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_sub_ass_idn_float(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_sub_ass_idn_bool(ast, targs);
-        return_trav(result);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_sub_ass(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    targs->depth += 1;
-
-    switch (lhs->type) {
-    default: {
-        pushb_error("invalid left hand operand type (%d)", lhs->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__IDENT: {
-        check("call trv_asscalc_sub_ass_idn");
-        PadObj *obj = trv_calc_asscalc_sub_ass_idn(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OBJ_TYPE__RING: {
-        check("call trv_calc_asscalc_sub_ass_chain");
-        PadObj *result = trv_calc_asscalc_sub_ass_chain(ast, targs);
-        return_trav(result);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_mul_ass_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *intobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue *= rhsref->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->float_value = lhs->lvalue * rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(intobj);
-        lhs->lvalue *= (PadIntObj) rhsref->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_mul_ass_float(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *floatobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value *= rhsref->lvalue;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value *= rhsref->float_value;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(floatobj);
-        lhs->float_value *= (PadFloatObj) rhsref->boolean;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_mul_ass_bool(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *boolobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean * rhsref->lvalue;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->float_value = lhs->boolean * rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(boolobj);
-        lhs->lvalue = lhs->boolean * rhsref->boolean;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_mul_ass_string(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *idnobj = targs->lhs_obj;
-    const char *idnname = PadStr_Getc(idnobj->identifier.name);
-    PadObjDict *varmap = get_varmap_by_idn(idnobj->identifier.ref_context, idnname);
-    PadObj *unicodeobj = Pad_PullRefAll(idnobj);
-    PadObj *rhs = targs->rhs_obj;
-    assert(idnobj && rhs);
-    assert(idnobj->type == PAD_OBJ_TYPE__IDENT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *lhs = PadObj_DeepCopy(unicodeobj);
-        if (rhsref->lvalue < 0) {
-            pushb_error("can't mul by negative value");
-            return_trav(NULL);
-        } else if (rhsref->lvalue == 0) {
-            PadUni_Clear(lhs->unicode);
-        } else {
-            PadUni *other = PadUni_DeepCopy(lhs->unicode);
-            for (PadIntObj i = 0; i < rhsref->lvalue-1; ++i) {
-                PadUni_AppOther(lhs->unicode, other);
+            check("call trv_calc_expr");
+            targs->lhs_obj = lhs;
+            targs->add_sub_op_node = op;
+            targs->rhs_obj = rhs;
+            targs->depth = depth + 1;
+            PadObj *result = trv_calc_expr(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
             }
-            PadUni_Del(other);
-        }
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *lhs = PadObj_DeepCopy(unicodeobj);
-        if (!rhsref->boolean) {
-            PadUni_Clear(lhs->unicode);
-        }
-        Pad_SetRef(varmap, idnname, lhs);
-        return_trav(lhs);
-    } break;
-    }
-
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_mul_ass(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-
-    if (lhs->type == PAD_OBJ_TYPE__RING) {
-        check("call trv_calc_asscalc_mul_ass_chain");
-        PadObj *result = trv_calc_asscalc_mul_ass_chain(ast, targs);
-        return_trav(result);
-    } else if (lhs->type != PAD_OBJ_TYPE__IDENT) {
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return_trav(NULL);
-    }
-
-    PadObj *lhsref = _Pad_ExtractRefOfObjAll(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (lhsref->type) {
-    default: {
-        pushb_error("invalid left hand operand (%d)", lhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("call trv_calc_asscalc_mul_ass_int");
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_mul_ass_int(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        check("call trv_calc_asscalc_mul_ass_float");
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_mul_ass_float(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("call trv_calc_asscalc_mul_ass_bool");
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_mul_ass_bool(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__UNICODE: {
-        check("call trv_calc_asscalc_mul_ass_string");
-        targs->lhs_obj = lhs;
-        PadObj *result = trv_calc_asscalc_mul_ass_string(ast, targs);
-        return_trav(result);
-    } break;
-    }
 
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
-
-static PadObj *
-trv_calc_asscalc_div_ass_int(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (rhsref->lvalue == 0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        lhs->lvalue /= rhsref->lvalue;
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        if (rhsref->float_value == 0.0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        lhs->float_value = lhs->lvalue / rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+            lhs = result;
         }
 
-        lhs->lvalue /= (PadIntObj) rhsref->boolean;
         return_trav(lhs);
-    } break;
     }
 
-    assert(0 && "impossible");
+    assert(0 && "impossible. failed to traverse expr");
     return_trav(NULL);
 }
 
 static PadObj *
-trv_calc_asscalc_div_ass_float(PadAST *ast, PadTrvArgs *targs) {
+trv_calc_term(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__FLOAT);
 
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
+    PadMulDivOpNode *mul_div_op = targs->mul_div_op_node;
+    assert(mul_div_op);
 
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (rhsref->lvalue == 0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
+    targs->depth += 1;
 
-        lhs->float_value /= rhsref->lvalue;
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        if (rhsref->float_value == 0.0) {
-            pushb_error("zero division error");
+    check("call trv_calc_op");
+    PadObj *obj = trv_calc_op(ast, targs, mul_div_op->op);
+    return_trav(obj);
+}
+
+static PadObj *
+trv_term(PadAST *ast, PadTrvArgs *targs) {
+    tready();
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadTermNode *term = node->real;
+    assert(term);
+
+    PadDepth depth = targs->depth;
+
+    if (PadNodeAry_Len(term->nodearr) == 1) {
+        PadNode *node = PadNodeAry_Get(term->nodearr, 0);
+        assert(node->type == PAD_NODE_TYPE__NEGATIVE);
+        check("call _PadTrv_Trav with dot");
+        targs->ref_node = node;
+        targs->depth = depth + 1;
+        PadObj *result = _PadTrv_Trav(ast, targs);
+        return_trav(result);
+    } else if (PadNodeAry_Len(term->nodearr) >= 3) {
+        PadNode *lnode = PadNodeAry_Get(term->nodearr, 0);
+        assert(lnode->type == PAD_NODE_TYPE__NEGATIVE);
+        check("call _PadTrv_Trav with dot");
+        targs->ref_node = lnode;
+        targs->depth = depth + 1;
+        PadObj *lhs = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
             return_trav(NULL);
         }
+        assert(lhs);
 
-        lhs->float_value /= rhsref->float_value;
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+        for (int i = 1; i < PadNodeAry_Len(term->nodearr); i += 2) {
+            PadNode *node = PadNodeAry_Get(term->nodearr, i);
+            assert(node->type == PAD_NODE_TYPE__MUL_DIV_OP);
+            PadMulDivOpNode *op = node->real;
+            assert(op);
+
+            PadNode *rnode = PadNodeAry_Get(term->nodearr, i+1);
+            assert(rnode->type == PAD_NODE_TYPE__NEGATIVE);
+            check("call _PadTrv_Trav with index");
+            targs->ref_node = rnode;
+            targs->depth = depth + 1;
+            PadObj *rhs = _PadTrv_Trav(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
+            }
+            assert(rnode);
+
+            check("trv_calc_term");
+            targs->lhs_obj = lhs;
+            targs->mul_div_op_node = op;
+            targs->rhs_obj = rhs;
+            targs->depth = depth + 1;
+            PadObj *result = trv_calc_term(ast, targs);
+            if (PadAST_HasErrs(ast)) {
+                return_trav(NULL);
+            }
+
+            lhs = result;
         }
 
-        lhs->float_value /= (PadFloatObj) rhsref->boolean;
         return_trav(lhs);
-    } break;
     }
 
-    assert(0 && "impossible");
+    assert(0 && "impossible. failed to traverse term");
     return_trav(NULL);
 }
 
 static PadObj *
-trv_calc_asscalc_div_ass_bool(PadAST *ast, PadTrvArgs *targs) {
+trv_negative(PadAST *ast, PadTrvArgs *targs) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadNegativeNode *negative = node->real;
+    assert(negative);
+
+    PadDepth depth = targs->depth;
 
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
+    check("call _PadTrv_Trav with negative's dot")
+    targs->ref_node = negative->chain;
+    targs->depth = depth + 1;
+    PadObj *operand = _PadTrv_Trav(ast, targs);
     if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
         return_trav(NULL);
     }
-
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand");
+    if (!operand) {
+        pushb_error("not found operand in negative");
         return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (rhsref->lvalue == 0) {
-            pushb_error("zero division error");
+    }
+
+again:
+    switch (operand->type) {
+    default:
+        if (negative->is_negative) {
+            pushb_error("invalid operand type (%d) in negative", operand->type);
             return_trav(NULL);
         }
-
-        PadIntObj result = ((PadIntObj)lhs->boolean) / rhsref->lvalue;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        lhs->lvalue = result;
-        return_trav(lhs);
+        return operand;
+    break;
+    case PAD_OBJ_TYPE__INT: {
+        if (negative->is_negative) {
+            PadObj *obj = PadObj_NewInt(ast->ref_gc, -operand->lvalue);
+            return_trav(obj);
+        }
+        return_trav(operand);
+    } break;
+    case PAD_OBJ_TYPE__BOOL: {
+        if (negative->is_negative) {
+            PadObj *obj = PadObj_NewInt(ast->ref_gc, -operand->boolean);
+            return_trav(obj);
+        }
+        return_trav(operand);
     } break;
     case PAD_OBJ_TYPE__FLOAT: {
-        if (rhsref->float_value == 0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+        if (negative->is_negative) {
+            PadObj *obj = PadObj_NewFloat(ast->ref_gc, -operand->float_value);
+            return_trav(obj);
         }
-
-        PadFloatObj result = ((PadFloatObj)lhs->boolean) / rhsref->float_value;
-        lhs->type = PAD_OBJ_TYPE__FLOAT;
-        lhs->float_value = result;
-        return_trav(lhs);
+        return_trav(operand);
     } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+    case PAD_OBJ_TYPE__IDENT: {
+        if (negative->is_negative) {
+            operand = _Pad_ExtractRefOfObjAll(operand);
+            goto again;
         }
-
-        PadIntObj result = ((PadIntObj)lhs->boolean) / ((PadIntObj)rhsref->boolean);
-        lhs->type = PAD_OBJ_TYPE__INT;
-        lhs->lvalue = result;
-        return_trav(lhs);
+        return_trav(operand);
     } break;
     }
 
-    assert(0 && "impossible");
+    assert(0 && "impossible. failed to traverse negative");
     return_trav(NULL);
 }
 
+static bool
+cvt_chain_node_type(PadChainObjType *dst, PadChainNodeType type) {
+    switch (type) {
+    case PAD_CHAIN_NODE_TYPE___DOT:
+        *dst = PAD_CHAIN_PAD_OBJ_TYPE___DOT;
+        return true;
+    case PAD_CHAIN_NODE_TYPE___INDEX:
+        *dst = PAD_CHAIN_PAD_OBJ_TYPE___INDEX;
+        return true;
+    case PAD_CHAIN_NODE_TYPE___CALL:
+        *dst = PAD_CHAIN_PAD_OBJ_TYPE___CALL;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * convert ring-nodes to ring-object
+ * ring object is needed by assignment (see trv_assign_to_chain)
+ */
 static PadObj *
-trv_calc_asscalc_div_ass(PadAST *ast, PadTrvArgs *targs) {
-    PadObj *lhs = targs->lhs_obj;
-    assert(lhs);
-    tready();
+gen_ring_obj(
+    PadAST *ast,
+    PadTrvArgs *targs,
+    PadNode *ring_node,
+    PadDepth depth,
+    PadObj *operand
+) {
+    PadRingNode *ring = ring_node->real;
+    PadChainNodes *cns = ring->chain_nodes;
+    PadChainObjs *chobjs = PadChainObjs_New();
 
-    if (lhs->type == PAD_OBJ_TYPE__RING) {
-        check("call trv_calc_asscalc_div_ass_chain");
-        PadObj *result = trv_calc_asscalc_div_ass_chain(ast, targs);
-        return_trav(result);
-    } else if (lhs->type != PAD_OBJ_TYPE__IDENT) {
-        pushb_error("invalid left hand operand (%d)", lhs->type);
-        return_trav(NULL);
-    }
+    for (int32_t i = 0; i < PadChainNodes_Len(cns); ++i) {
+        PadChainNode *cn = PadChainNodes_Get(cns, i);
+        assert(cn);
+        PadNode *node = PadChainNode_GetNode(cn);
+        assert(node);
 
-    PadObj *lhsref = _Pad_ExtractRefOfObjAll(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
+        targs->ref_node = node;
+        targs->depth = depth + 1;
+        PadObj *elem = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to traverse node");
+            goto fail;
+        }
 
-    targs->lhs_obj = lhsref;
-    targs->depth += 1;
+        PadChainObjType type;
+        if (!cvt_chain_node_type(&type, PadChainNode_GetcType(cn))) {
+            pushb_error("invalid ring node type (%d)", PadChainNode_GetcType(cn));
+            goto fail;
+        }
 
-    switch (lhsref->type) {
-    default: {
-        pushb_error("invalid left hand operand");
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        PadObj *result = trv_calc_asscalc_div_ass_bool(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        PadObj *result = trv_calc_asscalc_div_ass_int(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__FLOAT: {
-        PadObj *result = trv_calc_asscalc_div_ass_float(ast, targs);
-        return_trav(result);
-    } break;
+        PadObj_IncRef(elem);
+        PadChainObj *chobj = PadChainObj_New(type, PadMem_Move(elem));
+        PadChainObjs_MoveBack(chobjs, PadMem_Move(chobj));
     }
+    assert(PadChainObjs_Len(chobjs) != 0);
 
-    assert(0 && "impossible");
-    return_trav(NULL);
+    PadObj_IncRef(operand);
+    return PadObj_NewRing(
+        ast->ref_gc,
+        PadMem_Move(operand),
+        PadMem_Move(chobjs)
+    );
+
+fail:
+    PadObj_Del(operand);
+    PadChainObjs_Del(chobjs);
+    return NULL;
 }
 
+/**
+ * refer ring node
+ * if is_tail is true then last call of chain is pending (see trv_return_stmt)
+ */
 static PadObj *
-trv_calc_asscalc_mod_ass_int(PadAST *ast, PadTrvArgs *targs) {
+refer_ring(PadAST *ast, PadTrvArgs *targs, bool is_tail) {
     tready();
-    PadObj *lhs = targs->lhs_obj;
-    PadObj *rhs = targs->rhs_obj;
-    assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__INT);
+    PadNode *node = targs->ref_node;
+    assert(node);
+    PadRingNode *ring = node->real;
+    assert(ring);
 
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
+    PadDepth depth = targs->depth;
+
+    // get operand
+    PadNode *factor = ring->factor;
+    assert(factor);
+
+    targs->ref_node = factor;
+    targs->depth = depth + 1;
+    PadObj *operand = _PadTrv_Trav(ast, targs);
     if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
+        pushb_error("failed to traverse factor");
         return_trav(NULL);
     }
+    assert(operand);
+
+    // get objects
+    PadChainNodes *cns = ring->chain_nodes;
+    assert(cns);
+    if (!PadChainNodes_Len(cns)) {
+        return_trav(operand);
+    }
+
+    // assignment targets need ring object
+    if (targs->do_not_refer_ring) {
+        return_trav(gen_ring_obj(ast, targs, node, depth, operand));
+    }
+
+    // refer chain nodes in single pass. owners are on the stack while
+    // chain is short
+    PadObj *owns_buf[PAD_OBJ_ARY__FIXED_CAPA + 1];
+    PadObj *elems_buf[PAD_OBJ_ARY__FIXED_CAPA + 1];
+    PadObjAry owns, elems;
+    PadObjAry_InitFixed(&owns, owns_buf, PAD_OBJ_ARY__FIXED_CAPA);
+    PadObjAry_InitFixed(&elems, elems_buf, PAD_OBJ_ARY__FIXED_CAPA);
+
+    PadObj_IncRef(operand);
+    PadObjAry_PushBack(&owns, operand);
+    PadObj *result = NULL;
+
+    for (int32_t i = 0; i < PadChainNodes_Len(cns); ++i) {
+        PadChainNode *cn = PadChainNodes_Get(cns, i);
+        assert(cn);
+        PadChainObjType type;
+        if (!cvt_chain_node_type(&type, PadChainNode_GetcType(cn))) {
+            pushb_error("invalid ring node type (%d)", PadChainNode_GetcType(cn));
+            goto fail;
+        }
 
-    switch (rhsref->type) {
-    default: {
-        pushb_error("invalid right hand operand (%d)", rhsref->type);
-        return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (rhsref->lvalue == 0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+        targs->ref_node = PadChainNode_GetNode(cn);
+        targs->depth = depth + 1;
+        PadObj *elem = _PadTrv_Trav(ast, targs);
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to traverse node");
+            goto fail;
         }
 
-        // TODO: need imp float!
-        lhs->lvalue %= rhsref->lvalue;
-        return_trav(lhs);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
-            return_trav(NULL);
+        // keep elements alive until the chain is done
+        PadObj_IncRef(elem);
+        PadObjAry_PushBack(&elems, elem);
+
+        if (is_tail &&
+            type == PAD_CHAIN_PAD_OBJ_TYPE___CALL &&
+            i == PadChainNodes_Len(cns) - 1) {
+            result = _Pad_ReferChainTailCall(&owns, elem);
+        } else {
+            result = _Pad_ReferChainElem(&owns, type, elem);
+        }
+        if (PadAST_HasErrs(ast)) {
+            pushb_error("failed to refer ring object");
+            goto fail;
         }
 
-        // TODO: need imp float!
-        lhs->lvalue %= (PadIntObj) rhsref->boolean;
-        return_trav(lhs);
-    } break;
+        PadObj_IncRef(result);
+        PadObjAry_PushBack(&owns, result);
     }
 
-    assert(0 && "impossible");
+    PadObjAry_DelFixed(&owns);
+    PadObjAry_DelFixed(&elems);
+    PadObj_DecRef(operand);
+    PadObj_Del(operand);
+    return_trav(result);
+
+fail:
+    PadObjAry_DelFixed(&owns);
+    PadObjAry_DelFixed(&elems);
+    PadObj_DecRef(operand);
+    PadObj_Del(operand);
     return_trav(NULL);
 }
 
 static PadObj *
-trv_calc_asscalc_mod_ass_bool(PadAST *ast, PadTrvArgs *targs) {
+trv_ring(PadAST *ast, PadTrvArgs *targs) {
+    return refer_ring(ast, targs, false);
+}
+
+static PadObj *
+trv_calc_assign_to_idn(PadAST *ast, PadTrvArgs *targs) {
     tready();
+
     PadObj *lhs = targs->lhs_obj;
     PadObj *rhs = targs->rhs_obj;
     assert(lhs && rhs);
-    assert(lhs->type == PAD_OBJ_TYPE__BOOL);
-
-    PadObj *rhsref = _Pad_ExtractRefOfObjAll(rhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
-        return_trav(NULL);
-    }
+    assert(lhs->type == PAD_OBJ_TYPE__IDENT);
+    PadObjAry *ref_owners = targs->ref_owners;
+    const char *idn = PadStr_Getc(lhs->identifier.name);
 
-    switch (rhsref->type) {
+    switch (rhs->type) {
     default: {
-        pushb_error("invalid right hand operand");
-        return_trav(NULL);
+        check("set reference of (%d) at (%s) of varmap", rhs->type, idn);
+        Pad_SetRefAtVarmap(
+            ast->error_stack,
+            targs->ref_node,
+            ast->ref_context,
+            ref_owners,
+            idn,
+            rhs
+        );
+        return_trav(rhs);
     } break;
-    case PAD_OBJ_TYPE__INT: {
-        if (rhsref->lvalue == 0) {
-            pushb_error("zero division error");
-            return_trav(NULL);
-        }
-
-        // TODO: need imp float!
-        PadIntObj result = ((PadIntObj)lhs->boolean) % rhsref->lvalue;
-        lhs->type = PAD_OBJ_TYPE__INT;
-        lhs->lvalue = result;
-        return_trav(lhs);
+    case PAD_OBJ_TYPE__RING: {
+        // TODO: fix me!
+        // what?
+        PadObj *val = _Pad_ExtractRefOfObjAll(rhs);
+        Pad_SetRefAtVarmap(
+            ast->error_stack,
+            targs->ref_node,
+            ast->ref_context,
+            ref_owners,
+            idn,
+            val
+        );
+        return_trav(val);
     } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        if (!rhsref->boolean) {
-            pushb_error("zero division error");
+    case PAD_OBJ_TYPE__IDENT: {
+        PadObj *rval = Pad_PullRefAll(rhs);
+        if (!rval) {
+            pushb_error("\"%s\" is not defined in asscalc ass idn", PadObj_GetcIdentName(rhs));
             return_trav(NULL);
         }
 
-        // TODO: need imp float!
-        PadIntObj result = ((PadIntObj)lhs->boolean) % ((PadIntObj)rhsref->boolean);
-        lhs->type = PAD_OBJ_TYPE__INT;
-        lhs->lvalue = result;
-        return_trav(lhs);
+        check("set reference of (%d) at (%s) of current varmap", rval->type, idn);
+        PadObj_IncRef(rval);
+
+        Pad_SetRefAtVarmap(
+            ast->error_stack,
+            targs->ref_node,
+            ast->ref_context,
+            ref_owners,
+            idn,
+            rval
+        );
+        return_trav(rval);
     } break;
     }
 
-    assert(0 && "impossible");
+    assert(0 && "impossible. failed to calc asscalc ass idn");
     return_trav(NULL);
 }
 
+static PadObjDict *
+get_varmap_by_idn(PadCtx *ctx, const char *idn) {
+    PadScope *curscope = PadCtx_GetCurScope(ctx);
+
+    if (PadCStrAry_IsContain(curscope->global_names, idn)) {
+        return PadCtx_GetVarmapAtGlobal(ctx);
+    } else {
+        return PadCtx_GetVarmapAtCurScope(ctx);
+    }
+}
+
+/**
+ * calculate augmented assignment (+=, -=, etc) by kernel of operator and
+ * set the result to identifier or ring at left hand side
+ */
 static PadObj *
-trv_calc_asscalc_mod_ass(PadAST *ast, PadTrvArgs *targs) {
+trv_calc_asscalc(PadAST *ast, PadTrvArgs *targs) {
+    tready();
+    PadAugassignNode *augassign = targs->augassign_op_node;
+    assert(augassign);
     PadObj *lhs = targs->lhs_obj;
     assert(lhs);
-    tready();
 
-    if (lhs->type == PAD_OBJ_TYPE__RING) {
-        check("call trv_calc_asscalc_mod_ass_chain");
-        PadObj *result = trv_calc_asscalc_mod_ass_chain(ast, targs);
-        return_trav(result);
-    } else if (lhs->type != PAD_OBJ_TYPE__IDENT) {
-        pushb_error("invalid left hand operand (%d)", lhs->type);
+    op_t op;
+    switch (augassign->op) {
+    default:
+        assert(0 && "impossible. invalid operator of asscalc");
         return_trav(NULL);
+        break;
+    case PAD_OP__ADD_ASS: op = PAD_OP__ADD; break;
+    case PAD_OP__SUB_ASS: op = PAD_OP__SUB; break;
+    case PAD_OP__MUL_ASS: op = PAD_OP__MUL; break;
+    case PAD_OP__DIV_ASS: op = PAD_OP__DIV; break;
+    case PAD_OP__MOD_ASS: op = PAD_OP__MOD; break;
     }
 
-    PadObj *lhsref = _Pad_ExtractRefOfObjAll(lhs);
-    if (PadAST_HasErrs(ast)) {
-        pushb_error("failed to extract reference");
+    if (lhs->type != PAD_OBJ_TYPE__IDENT && lhs->type != PAD_OBJ_TYPE__RING) {
+        pushb_error("invalid left hand operand (%d)", lhs->type);
         return_trav(NULL);
     }
 
-    targs->lhs_obj = lhsref;
     targs->depth += 1;
 
-    switch (lhsref->type) {
-    default: {
-        pushb_error("invalid left hand operand");
+    // identifier of left hand side is looked up in the current scope only
+    // because augmented assignment does not declare the variable
+    PadObj *lref = lhs;
+    if (lhs->type == PAD_OBJ_TYPE__IDENT) {
+        lref = _Pad_ExtractRefOfObj(lhs);
+        if (!lref) {
+            return_trav(NULL);
+        }
+    }
+
+    lref = extract_idn_and_chain(ast, targs, lref);
+    if (!lref) {
         return_trav(NULL);
-    } break;
-    case PAD_OBJ_TYPE__BOOL: {
-        check("trv_calc_asscalc_mod_ass_bool");
-        PadObj *result = trv_calc_asscalc_mod_ass_bool(ast, targs);
-        return_trav(result);
-    } break;
-    case PAD_OBJ_TYPE__INT: {
-        check("trv_calc_asscalc_mod_ass_int");
-        PadObj *result = trv_calc_asscalc_mod_ass_int(ast, targs);
-        return_trav(result);
-    } break;
     }
 
-    assert(0 && "impossible");
-    return_trav(NULL);
-}
+    PadObj *rref = extract_idn_and_chain(ast, targs, targs->rhs_obj);
+    if (!rref) {
+        return_trav(NULL);
+    }
 
-static PadObj *
-trv_calc_asscalc(PadAST *ast, PadTrvArgs *targs) {
-    tready();
-    PadAugassignNode *augassign = targs->augassign_op_node;
-    assert(augassign);
+    PadObj *result = NULL;
 
-    targs->depth += 1;
+    if (op == PAD_OP__ADD &&
+        lhs->type == PAD_OBJ_TYPE__IDENT &&
+        lref->type == PAD_OBJ_TYPE__UNICODE &&
+        rref->type == PAD_OBJ_TYPE__UNICODE) {
+        // if the string is referenced by this variable only then move
+        // buffer to new object and append to it (amortized O(1))
+        if (lref != rref) {
+            result = PadObj_StealUnicode(lref);
+        }
+        if (!result) {
+            result = PadObj_DeepCopy(lref);
+        }
+        PadUni_App(result->unicode, PadUni_Getc(rref->unicode));
+    } else {
+        targs->lhs_obj = lref;
+        targs->rhs_obj = rref;
+        check("call trv_calc_op");
+        result = trv_calc_op(ast, targs, op);
+        if (!result) {
+            return_trav(NULL);
+        }
+    }
 
-    switch (augassign->op) {
-    default: break;
-    case PAD_OP__ADD_ASS: {
-        check("call trv_calc_asscalc_add_ass");
-        PadObj *obj = trv_calc_asscalc_add_ass(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__SUB_ASS: {
-        check("call trv_calc_asscalc_sub_ass");
-        PadObj *obj = trv_calc_asscalc_sub_ass(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__MUL_ASS: {
-        check("call trv_calc_asscalc_mul_ass");
-        PadObj *obj = trv_calc_asscalc_mul_ass(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__DIV_ASS: {
-        check("call trv_calc_asscalc_div_ass");
-        PadObj *obj = trv_calc_asscalc_div_ass(ast, targs);
-        return_trav(obj);
-    } break;
-    case PAD_OP__MOD_ASS: {
-        check("call trv_calc_asscalc_mod_ass");
-        PadObj *obj = trv_calc_asscalc_mod_ass(ast, targs);
-        return_trav(obj);
-    } break;
+    if (lhs->type == PAD_OBJ_TYPE__IDENT) {
+        const char *idn = PadObj_GetcIdentName(lhs);
+        PadObjDict *varmap = get_varmap_by_idn(lhs->identifier.ref_context, idn);
+        Pad_SetRef(varmap, idn, result);
+    } else {
+        _Pad_ReferAndSetRef(lhs, result);
     }
 
-    assert(0 && "impossible. failed to calc asscalc");
-    return_trav(NULL);
+    return_trav(result);
 }
 
 /**
@@ -10840,319 +4491,261 @@ _PadTrv_Trav(PadAST *ast, PadTrvArgs *targs) {
 
     targs->depth++;
 
+    // result is returned at one place. this keeps frame of this function
+    // small because this function is on native stack at each depth of nodes
+    PadObj *obj = NULL;
+
     switch (node->type) {
     default: {
         PadErr_Die("impossible. unsupported node type %d in traverse", PadNode_GetcType(node));
     } break;
     case PAD_NODE_TYPE__PROGRAM: {
         check("call trv_program");
-        PadObj *obj = trv_program(ast, targs);
-        return_trav(obj);
+        obj = trv_program(ast, targs);
     } break;
     case PAD_NODE_TYPE__BLOCKS: {
         check("call trv_blocks");
-        PadObj *obj = trv_blocks(ast, targs);
-        return_trav(obj);
+        obj = trv_blocks(ast, targs);
     } break;
     case PAD_NODE_TYPE__CODE_BLOCK: {
         check("call trv_code_block");
-        PadObj *obj = trv_code_block(ast, targs);
-        return_trav(obj);
+        obj = trv_code_block(ast, targs);
     } break;
     case PAD_NODE_TYPE__REF_BLOCK: {
         check("call trv_ref_block");
-        PadObj *obj = trv_ref_block(ast, targs);
-        return_trav(obj);
+        obj = trv_ref_block(ast, targs);
     } break;
     case PAD_NODE_TYPE__TEXT_BLOCK: {
         check("call trv_text_block");
-        PadObj *obj = trv_text_block(ast, targs);
-        return_trav(obj);
+        obj = trv_text_block(ast, targs);
     } break;
     case PAD_NODE_TYPE__ELEMS: {
         check("call trv_elems");
-        PadObj *obj = trv_elems(ast, targs);
-        return_trav(obj);
+        obj = trv_elems(ast, targs);
     } break;
     case PAD_NODE_TYPE__FORMULA: {
         check("call trv_formula");
-        PadObj *obj = trv_formula(ast, targs);
-        return_trav(obj);
+        obj = trv_formula(ast, targs);
     } break;
     case PAD_NODE_TYPE__ASSIGN_LIST: {
         check("call trv_assign_list");
-        PadObj *obj = trv_assign_list(ast, targs);
-        return_trav(obj);
+        obj = trv_assign_list(ast, targs);
     } break;
     case PAD_NODE_TYPE__ASSIGN: {
         check("call trv_assign");
-        PadObj *obj = trv_assign(ast, targs);
-        return_trav(obj);
+        obj = trv_assign(ast, targs);
     } break;
     case PAD_NODE_TYPE__SIMPLE_ASSIGN: {
         check("call trv_simple_assign");
-        PadObj *obj = trv_simple_assign(ast, targs);
-        return_trav(obj);
+        obj = trv_simple_assign(ast, targs);
     } break;
     case PAD_NODE_TYPE__MULTI_ASSIGN: {
         check("call trv_multi_assign");
-        PadObj *obj = trv_multi_assign(ast, targs);
-        return_trav(obj);
+        obj = trv_multi_assign(ast, targs);
     } break;
     case PAD_NODE_TYPE__DEF: {
         check("call trv_def");
-        PadObj *obj = trv_def(ast, targs);
-        return_trav(obj);
+        obj = trv_def(ast, targs);
     } break;
     case PAD_NODE_TYPE__FUNC_DEF: {
         check("call trv_func_def");
-        PadObj *obj = trv_func_def(ast, targs);
-        return_trav(obj);
+        obj = trv_func_def(ast, targs);
     } break;
     case PAD_NODE_TYPE__FUNC_DEF_PARAMS: {
         check("call trv_func_def_params");
-        PadObj *obj = trv_func_def_params(ast, targs);
-        return_trav(obj);
+        obj = trv_func_def_params(ast, targs);
     } break;
     case PAD_NODE_TYPE__FUNC_DEF_ARGS: {
         check("call trv_func_def_args");
-        PadObj *obj = trv_func_def_args(ast, targs);
-        return_trav(obj);
+        obj = trv_func_def_args(ast, targs);
     } break;
     case PAD_NODE_TYPE__FUNC_EXTENDS: {
         check("call trv_func_extends");
-        PadObj *obj = trv_func_extends(ast, targs);
-        return_trav(obj);
+        obj = trv_func_extends(ast, targs);
     } break;
     case PAD_NODE_TYPE__STMT: {
         check("call trv_stmt");
-        PadObj *obj = trv_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__IMPORT_STMT: {
         check("call trv_import_stmt with import statement");
-        PadObj *obj = trv_import_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_import_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__IMPORT_AS_STMT: {
         check("call trv_import_stmt with import as statement");
-        PadObj *obj = trv_import_as_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_import_as_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__FROM_IMPORT_STMT: {
         check("call trv_import_stmt with from import statement");
-        PadObj *obj = trv_from_import_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_from_import_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__IMPORT_VARS: {
         check("call trv_import_stmt with import vars");
-        PadObj *obj = trv_import_vars(ast, targs);
-        return_trav(obj);
+        obj = trv_import_vars(ast, targs);
     } break;
     case PAD_NODE_TYPE__IMPORT_VAR: {
         check("call trv_import_stmt with import var");
-        PadObj *obj = trv_import_var(ast, targs);
-        return_trav(obj);
+        obj = trv_import_var(ast, targs);
     } break;
     case PAD_NODE_TYPE__IF_STMT: {
         check("call trv_if_stmt");
-        PadObj *obj = trv_if_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_if_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__ELIF_STMT: {
         check("call trv_elif_stmt");
-        PadObj *obj = trv_if_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_if_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__ELSE_STMT: {
         check("call trv_else_stmt");
-        PadObj *obj = trv_else_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_else_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__FOR_STMT: {
         check("call trv_for_stmt");
-        PadObj *obj = trv_for_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_for_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__BREAK_STMT: {
         check("call trv_break_stmt");
-        PadObj *obj = trv_break_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_break_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__CONTINUE_STMT: {
         check("call trv_continue_stmt");
-        PadObj *obj = trv_continue_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_continue_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__RETURN_STMT: {
         check("call trv_return_stmt");
-        PadObj *obj = trv_return_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_return_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__CONTENT: {
         check("call trv_content");
-        PadObj *obj = trv_content(ast, targs);
-        return_trav(obj);
+        obj = trv_content(ast, targs);
     } break;
     case PAD_NODE_TYPE__BLOCK_STMT: {
         check("call trv_block_stmt");
-        PadObj *obj = trv_block_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_block_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__INJECT_STMT: {
         check("call trv_inject_stmt");
-        PadObj *obj = trv_inject_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_inject_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__GLOBAL_STMT: {
         check("call trv_global_stmt");
-        PadObj *obj = trv_global_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_global_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__NONLOCAL_STMT: {
         check("call trv_nonlocal_stmt");
-        PadObj *obj = trv_nonlocal_stmt(ast, targs);
-        return_trav(obj);
+        obj = trv_nonlocal_stmt(ast, targs);
     } break;
     case PAD_NODE_TYPE__STRUCT: {
         check("call trv_def_struct");
-        PadObj *obj = trv_def_struct(ast, targs);
-        return_trav(obj);
+        obj = trv_def_struct(ast, targs);
     } break;
     case PAD_NODE_TYPE__TEST_LIST: {
         check("call trv_test_list");
-        PadObj *obj = trv_test_list(ast, targs);
-        return_trav(obj);
+        obj = trv_test_list(ast, targs);
     } break;
     case PAD_NODE_TYPE__CALL_ARGS: {
         check("call trv_call_args");
-        PadObj *obj = trv_call_args(ast, targs);
-        return_trav(obj);
+        obj = trv_call_args(ast, targs);
     } break;
     case PAD_NODE_TYPE__TEST: {
         check("call trv_test");
-        PadObj *obj = trv_test(ast, targs);
-        return_trav(obj);
+        obj = trv_test(ast, targs);
     } break;
     case PAD_NODE_TYPE__OR_TEST: {
         check("call trv_or_test");
-        PadObj *obj = trv_or_test(ast, targs);
-        return_trav(obj);
+        obj = trv_or_test(ast, targs);
     } break;
     case PAD_NODE_TYPE__AND_TEST: {
         check("call trv_and_test");
-        PadObj *obj = trv_and_test(ast, targs);
-        return_trav(obj);
+        obj = trv_and_test(ast, targs);
     } break;
     case PAD_NODE_TYPE__NOT_TEST: {
         check("call trv_not_test");
-        PadObj *obj = trv_not_test(ast, targs);
-        return_trav(obj);
+        obj = trv_not_test(ast, targs);
     } break;
     case PAD_NODE_TYPE__COMPARISON: {
         check("call trv_comparison");
-        PadObj *obj = trv_comparison(ast, targs);
-        return_trav(obj);
+        obj = trv_comparison(ast, targs);
     } break;
     case PAD_NODE_TYPE__EXPR: {
         check("call trv_expr");
-        PadObj *obj = trv_expr(ast, targs);
-        return_trav(obj);
+        obj = trv_expr(ast, targs);
     } break;
     case PAD_NODE_TYPE__TERM: {
         check("call trv_term");
-        PadObj *obj = trv_term(ast, targs);
-        return_trav(obj);
+        obj = trv_term(ast, targs);
     } break;
     case PAD_NODE_TYPE__NEGATIVE: {
         check("call trv_negative");
-        PadObj *obj = trv_negative(ast, targs);
-        return_trav(obj);
+        obj = trv_negative(ast, targs);
     } break;
     case PAD_NODE_TYPE__RING: {
         check("call trv_ring");
-        PadObj *obj = trv_ring(ast, targs);
-        return_trav(obj);
+        obj = trv_ring(ast, targs);
     } break;
     case PAD_NODE_TYPE__ASSCALC: {
         check("call trv_asscalc");
-        PadObj *obj = trv_asscalc(ast, targs);
-        return_trav(obj);
+        obj = trv_asscalc(ast, targs);
     } break;
     case PAD_NODE_TYPE__FACTOR: {
         check("call trv_factor");
-        PadObj *obj = trv_factor(ast, targs);
-        return_trav(obj);
+        obj = trv_factor(ast, targs);
     } break;
     case PAD_NODE_TYPE__ATOM: {
         check("call trv_atom");
-        PadObj *obj = trv_atom(ast, targs);
-        return_trav(obj);
+        obj = trv_atom(ast, targs);
     } break;
     case PAD_NODE_TYPE__NIL: {
         check("call trv_nil");
-        PadObj *obj = trv_nil(ast, targs);
-        return_trav(obj);
+        obj = trv_nil(ast, targs);
     } break;
     case PAD_NODE_TYPE__FALSE: {
         check("call trv_false");
-        PadObj *obj = trv_false(ast, targs);
-        return_trav(obj);
+        obj = trv_false(ast, targs);
     } break;
     case PAD_NODE_TYPE__TRUE: {
         check("call trv_true");
-        PadObj *obj = trv_true(ast, targs);
-        return_trav(obj);
+        obj = trv_true(ast, targs);
     } break;
     case PAD_NODE_TYPE__DIGIT: {
         check("call trv_digit");
-        PadObj *obj = trv_digit(ast, targs);
-        return_trav(obj);
+        obj = trv_digit(ast, targs);
     } break;
     case PAD_NODE_TYPE__FLOAT: {
         check("call trv_digit");
-        PadObj *obj = trv_float(ast, targs);
-        return_trav(obj);
+        obj = trv_float(ast, targs);
     } break;
     case PAD_NODE_TYPE__STRING: {
         check("call trv_string");
-        PadObj *obj = trv_string(ast, targs);
-        return_trav(obj);
+        obj = trv_string(ast, targs);
     } break;
     case PAD_NODE_TYPE__ARRAY: {
         check("call trv_array");
-        PadObj *obj = trv_array(ast, targs);
-        return_trav(obj);
+        obj = trv_array(ast, targs);
     } break;
     case PAD_NODE_TYPE__ARRAY_ELEMS: {
         check("call trv_array_elems");
-        PadObj *obj = trv_array_elems(ast, targs);
-        return_trav(obj);
+        obj = trv_array_elems(ast, targs);
     } break;
     case PAD_NODE_TYPE__DICT: {
         check("call trv_dict");
-        PadObj *obj = trv_dict(ast, targs);
-        return_trav(obj);
+        obj = trv_dict(ast, targs);
     } break;
     case PAD_NODE_TYPE__DICT_ELEMS: {
         check("call trv_dict_elems");
-        PadObj *obj = trv_dict_elems(ast, targs);
-        return_trav(obj);
+        obj = trv_dict_elems(ast, targs);
     } break;
     case PAD_NODE_TYPE__DICT_ELEM: {
         check("call trv_dict_elem");
-        PadObj *obj = trv_dict_elem(ast, targs);
-        return_trav(obj);
+        obj = trv_dict_elem(ast, targs);
     } break;
     case PAD_NODE_TYPE__IDENTIFIER: {
         check("call trv_identifier");
-        PadObj *obj = trv_identifier(ast, targs);
-        return_trav(obj);
+        obj = trv_identifier(ast, targs);
     } break;
     }
 
-    assert(0 && "impossible. failed to traverse");
-    return_trav(NULL);
+    return_trav(obj);
 }
 
 PadAST *
@@ -11200,6 +4793,46 @@ PadTrv_ImportBltMods(PadAST *ast) {
     PadObj_IncRef(mod);
     PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
 
+    // builtin string builder module
+    mod = Pad_NewBltBuilderMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin deque module (__deque__)
+    mod = Pad_NewBltDeqMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin numeric array module (__numarray__)
+    mod = Pad_NewBltNumAryMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin dict view module (__dict_view__)
+    mod = Pad_NewBltDictViewMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin json module
+    mod = Pad_NewBltJsonMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin re module
+    mod = Pad_NewBltReMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin regex module (__regex__)
+    mod = Pad_NewBltRegexMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
+    // builtin ini module
+    mod = Pad_NewBltIniMod(ast->ref_config, ast->ref_gc);
+    PadObj_IncRef(mod);
+    PadObjDict_Move(varmap, mod->module.name, PadMem_Move(mod));
+
     return ast;
 }
 
@@ -11214,6 +4847,12 @@ trv_define_builtin_types(PadAST *ast) {
     obj = PadObj_NewType(ast->ref_gc, PAD_OBJ_TYPE__DICT);
     PadObjDict_Move(varmap, "Dict", PadMem_Move(obj));
 
+    obj = PadObj_NewType(ast->ref_gc, PAD_OBJ_TYPE__DEQUE);
+    PadObjDict_Move(varmap, "Deque", PadMem_Move(obj));
+
+    obj = PadObj_NewType(ast->ref_gc, PAD_OBJ_TYPE__NUMARRAY);
+    PadObjDict_Move(varmap, "NumArray", PadMem_Move(obj));
+
     obj = PadObj_NewType(ast->ref_gc, PAD_OBJ_TYPE__UNICODE);
     PadObjDict_Move(varmap, "String", PadMem_Move(obj));
 
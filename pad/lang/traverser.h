@@ -17,6 +17,13 @@
 #include <pad/lang/builtin/modules/alias.h>
 #include <pad/lang/builtin/modules/opts.h>
 #include <pad/lang/builtin/modules/file.h>
+#include <pad/lang/builtin/modules/builder.h>
+#include <pad/lang/builtin/modules/deque.h>
+#include <pad/lang/builtin/modules/num_array.h>
+#include <pad/lang/builtin/modules/dict_view.h>
+#include <pad/lang/builtin/modules/json.h>
+#include <pad/lang/builtin/modules/re.h>
+#include <pad/lang/builtin/modules/ini.h>
 
 void
 PadTrv_Trav(PadAST *ast, PadCtx *context);
@@ -7,6 +7,9 @@ typedef struct PadObjDict PadObjDict;
 struct PadObjAry;
 typedef struct PadObjAry PadObjAry;
 
+struct PadObjDeq;
+typedef struct PadObjDeq PadObjDeq;
+
 struct PadObj;
 typedef struct PadObj PadObj;
 
@@ -43,6 +46,15 @@ typedef struct PadBltFuncObj PadBltFuncObj;
 struct PadFileObj;
 typedef struct PadFileObj PadFileObj;
 
+struct PadBuilderObj;
+typedef struct PadBuilderObj PadBuilderObj;
+
+struct PadRangeObj;
+typedef struct PadRangeObj PadRangeObj;
+
+struct PadDictViewObj;
+typedef struct PadDictViewObj PadDictViewObj;
+
 struct PadNodeAry;
 typedef struct PadNodeAry PadNodeAry;
 
@@ -247,15 +247,12 @@ Pad_SetRef(PadObjDict *varmap, const char *identifier, PadObj *ref_obj) {
         return false;
     }
 
+    // PadObjDict_Set increments reference count of ref_obj.
+    // release popped after set because popped may be ref_obj
     PadObj *popped = PadObjDict_Pop(varmap, identifier);
-    if (popped == ref_obj) {
-        PadObjDict_Set(varmap, identifier, ref_obj);
-    } else {
-        PadObj_IncRef(ref_obj);
-        PadObj_DecRef(popped);
-        PadObj_Del(popped);
-        PadObjDict_Set(varmap, identifier, ref_obj);
-    }
+    PadObjDict_Set(varmap, identifier, ref_obj);
+    PadObj_DecRef(popped);
+    PadObj_Del(popped);
 
     return true;
 }
@@ -271,14 +268,13 @@ refer_chain_dot(
     PadGC *ref_gc,
     PadCtx *ref_context,
     PadObjAry *owns,
-    PadChainObj *co
+    PadObj *rhs_obj
 ) {
-    if (!err || !ref_node || !ref_gc || !ref_context || !owns || !co) {
+    if (!err || !ref_node || !ref_gc || !ref_context || !owns || !rhs_obj) {
         return NULL;
     }
     PadObj *own = PadObjAry_GetLast(owns);
     assert(own);
-    PadObj *rhs_obj = PadChainObj_GetObj(co);
 
 again1:
     switch (own->type) {
@@ -298,11 +294,19 @@ again1:
         const char *modname = PadObj_GetcModName(own);
         if (!(PadCStr_Eq(modname, "__builtin__") ||
               PadCStr_Eq(modname, "alias") ||
-              PadCStr_Eq(modname, "opts"))) {
+              PadCStr_Eq(modname, "opts") ||
+              PadCStr_Eq(modname, "json") ||
+              PadCStr_Eq(modname, "re") ||
+              PadCStr_Eq(modname, "ini"))) {
             break;
         }
     } // fallthrough
     case PAD_OBJ_TYPE__FILE:
+    case PAD_OBJ_TYPE__BUILDER:
+    case PAD_OBJ_TYPE__DEQUE:
+    case PAD_OBJ_TYPE__NUMARRAY:
+    case PAD_OBJ_TYPE__DICT_VIEW:
+    case PAD_OBJ_TYPE__REGEX:
     case PAD_OBJ_TYPE__UNICODE:
     case PAD_OBJ_TYPE__ARRAY: {
         // create builtin module function object
@@ -558,6 +562,21 @@ invoke_owner_func_obj(
     case PAD_OBJ_TYPE__FILE:
         mod = PadCtx_FindVarRefAll(ref_context, "__file__");
         break;
+    case PAD_OBJ_TYPE__BUILDER:
+        mod = PadCtx_FindVarRefAll(ref_context, "__builder__");
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        mod = PadCtx_FindVarRefAll(ref_context, "__deque__");
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        mod = PadCtx_FindVarRefAll(ref_context, "__numarray__");
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        mod = PadCtx_FindVarRefAll(ref_context, "__dict_view__");
+        break;
+    case PAD_OBJ_TYPE__REGEX:
+        mod = PadCtx_FindVarRefAll(ref_context, "__regex__");
+        break;
     }
 
     if (!mod) {
@@ -610,46 +629,53 @@ invoke_builtin_module_func(
     return NULL;
 }
 
-static PadObj *
-copy_func_args(
+/**
+ * collect actual arguments of function to dstarr
+ * int, float and unicode are passed by value. these are shallow copied
+ * and the unicode buffer is shared until first mutation (copy on write)
+ * other objects are passed by reference
+ *
+ * @param[in]  *self_obj owner object of method (NULL if not method)
+ * @param[in]  *drtargs  array object of actual arguments
+ * @param[out] *dstarr   destination array (caller initialized)
+ *
+ * @return success to true
+ * @return failed to false
+ */
+static bool
+collect_func_args(
     PadErrStack *err,
     const PadNode *ref_node,
     PadAST *ref_ast,
     PadGC *ref_gc,
     PadCtx *ref_context,
-    PadObj *drtargs
+    PadObj *self_obj,
+    PadObj *drtargs,
+    PadObjAry *dstarr
 ) {
     assert(drtargs->type == PAD_OBJ_TYPE__ARRAY);
-    PadObjAry *dstarr = PadObjAry_New();
     PadObjAry *srcarr = drtargs->objarr;
 
+    // self is first argument of method. do not shift arguments
+    if (self_obj) {
+        PadObj_IncRef(self_obj);
+        PadObjAry_PushBack(dstarr, self_obj);
+    }
+
     for (int32_t i = 0; i < PadObjAry_Len(srcarr); ++i) {
         PadObj *arg = PadObjAry_Get(srcarr, i);
-        PadObj *savearg = NULL;
         assert(arg);
 
     again:
         switch (arg->type) {
-        case PAD_OBJ_TYPE__NIL:
-        case PAD_OBJ_TYPE__BOOL:
-        case PAD_OBJ_TYPE__OWNERS_METHOD:
-        case PAD_OBJ_TYPE__ARRAY:
-        case PAD_OBJ_TYPE__DICT:
-        case PAD_OBJ_TYPE__FUNC:
-        case PAD_OBJ_TYPE__DEF_STRUCT:
-        case PAD_OBJ_TYPE__OBJECT:
-        case PAD_OBJ_TYPE__MODULE:
-        case PAD_OBJ_TYPE__TYPE:
-        case PAD_OBJ_TYPE__BLTIN_FUNC:
-        case PAD_OBJ_TYPE__FILE:
+        default:
             // reference
-            savearg = arg;
             break;
         case PAD_OBJ_TYPE__UNICODE:
         case PAD_OBJ_TYPE__INT:
         case PAD_OBJ_TYPE__FLOAT:
-            // copy
-            savearg = PadObj_DeepCopy(arg);
+            // value
+            arg = PadObj_ShallowCopy(arg);
             break;
         case PAD_OBJ_TYPE__RING:
             arg = Pad_ReferRingObjWithRef(
@@ -657,7 +683,7 @@ copy_func_args(
             );
             if (PadErrStack_Len(err)) {
                 push_err("failed to refer chain object");
-                return NULL;
+                return false;
             }
             goto again;
         case PAD_OBJ_TYPE__IDENT: {
@@ -665,17 +691,17 @@ copy_func_args(
             arg = Pad_PullRefAll(arg);
             if (!arg) {
                 push_err("\"%s\" is not defined", idn);
-                return NULL;
+                return false;
             }
             goto again;
         } break;
         }
 
-        PadObj_IncRef(savearg);
-        PadObjAry_PushBack(dstarr, savearg);
+        PadObj_IncRef(arg);
+        PadObjAry_PushBack(dstarr, arg);
     }
 
-    return PadObj_NewAry(ref_gc, PadMem_Move(dstarr));
+    return true;
 }
 
 static PadObj *
@@ -713,6 +739,12 @@ copy_array_args(
         case PAD_OBJ_TYPE__FLOAT:
         case PAD_OBJ_TYPE__BLTIN_FUNC:
         case PAD_OBJ_TYPE__FILE:
+        case PAD_OBJ_TYPE__BUILDER:
+        case PAD_OBJ_TYPE__RANGE:
+        case PAD_OBJ_TYPE__DEQUE:
+        case PAD_OBJ_TYPE__NUMARRAY:
+        case PAD_OBJ_TYPE__DICT_VIEW:
+        case PAD_OBJ_TYPE__REGEX:
             // reference
             savearg = arg;
             break;
@@ -734,6 +766,9 @@ copy_array_args(
             }
             goto again;
         } break;
+        case PAD_OBJ_TYPE__N:
+            // not a type
+            break;
         }
 
         PadObj_IncRef(savearg);
@@ -755,26 +790,17 @@ extract_func_args(
     const PadNode *ref_node,
     PadObjAry *owns,  // TODO const
     PadObj *func_obj,
-    PadObj *args
+    PadObjAry *actual_args
 ) {
-    if (!func_obj || !args) {
+    if (!func_obj || !actual_args) {
         return;
     }
 
-    PadObj *ownpar = PadObjAry_GetLast2(owns);
     PadFuncObj *func = &func_obj->func;
     const PadObjAry *formal_args = func->args->objarr;
-    PadObjAry *actual_args = args->objarr;
-
-    if (ownpar && func->is_met) {
-        ownpar = Pad_ExtractIdent(ownpar);
-        PadObjAry_PushFront(actual_args, ownpar);
-    }
 
     if (PadObjAry_Len(formal_args) != PadObjAry_Len(actual_args)) {
         push_err("arguments not same length");
-        PadObj_Del(args);
-        PadCtx_PopBackScope(func->ref_ast->ref_context);
         return;
     }
 
@@ -790,7 +816,6 @@ extract_func_args(
             ref_aarg = Pad_PullRefAll(aarg);
             if (!ref_aarg) {
                 push_err("\"%s\" is not defined in invoke function", PadObj_GetcIdentName(aarg));
-                PadObj_Del(args);
                 return;
             }
         }
@@ -829,7 +854,10 @@ exec_func_suites(PadErrStack *err, PadObj *func_obj) {
             .func_obj = func_obj,
         });
         if (PadAST_HasErrs(func->ref_ast)) {
-            PadErrStack_ExtendBackOther(err, func->ref_ast->error_stack);
+            // on recursion err is error stack of same ast. do not extend self
+            if (err != func->ref_ast->error_stack) {
+                PadErrStack_ExtendBackOther(err, func->ref_ast->error_stack);
+            }
             return NULL;
         }
         if (PadCtx_GetDoReturn(func->ref_ast->ref_context)) {
@@ -840,6 +868,83 @@ exec_func_suites(PadErrStack *err, PadObj *func_obj) {
     return result;
 }
 
+/**
+ * usable bytes of native stack of current thread
+ * this guard wins if recursion limit is larger than this stack can hold
+ */
+static size_t
+native_stack_budget(void) {
+#if defined(PAD_UTILS__WINDOWS)
+    size_t size = 1024 * 1024;  // default of main thread
+#else
+    size_t size = 8 * 1024 * 1024;
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_STACK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY) {
+        size = rl.rlim_cur;
+    }
+#endif
+    // keep room for builtin functions and frames under outermost call
+    return size - size / 4;
+}
+
+/**
+ * enter to function call
+ * raise error instead of overflow of native stack
+ * the depth is counted on most previous context of caller
+ *
+ * @return success to true (do leave_func_call)
+ * @return failed to false
+ */
+static bool
+enter_func_call(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    const PadAST *ref_ast,
+    PadCtx *ref_context
+) {
+    char here;
+    uintptr_t addr = (uintptr_t) &here;
+    PadCtx *root = PadCtx_FindMostPrev(ref_context);
+    int32_t depth = PadCtx_GetFuncCallDepth(root);
+
+    if (depth == 0) {
+        PadCtx_SetNativeStack(root, addr, native_stack_budget());
+    }
+
+    int32_t limit = PAD_CONFIG__RECURSION_LIMIT;
+    if (ref_ast->ref_config && ref_ast->ref_config->recursion_limit > 0) {
+        limit = ref_ast->ref_config->recursion_limit;
+    }
+    if (depth >= limit) {
+        push_err("maximum recursion depth exceeded (%d)", limit);
+        return false;
+    }
+
+    uintptr_t base = PadCtx_GetStackBase(root);
+    uintptr_t used = base > addr ? base - addr : addr - base;
+    if (used > PadCtx_GetStackBudget(root)) {
+        push_err("maximum recursion depth exceeded (native stack)");
+        return false;
+    }
+
+    PadCtx_SetFuncCallDepth(root, depth + 1);
+    return true;
+}
+
+static void
+leave_func_call(PadCtx *ref_context) {
+    PadCtx *root = PadCtx_FindMostPrev(ref_context);
+    int32_t depth = PadCtx_GetFuncCallDepth(root);
+    assert(depth > 0);
+    PadCtx_SetFuncCallDepth(root, depth - 1);
+}
+
+/**
+ * invoke function object
+ * tail calls in function (return f(...)) are pending on context and
+ * invoked by this loop after pop scope. therefore tail recursion does
+ * not consume native stack
+ */
 static PadObj *
 invoke_func_obj(
     PadErrStack *err,
@@ -861,57 +966,117 @@ invoke_func_obj(
         return NULL;
     }
 
-    PadObj *args = NULL;
-    if (drtargs) {
-        args = copy_func_args(
-            err, ref_node, ref_ast, ref_gc, ref_context, drtargs
-        );
-        if (PadErrStack_Len(err)) {
-            push_err("failed to copy function arguments");
-            return NULL;
-        }
-    }
-
     PadFuncObj *func = &func_obj->func;
     assert(func->args->type == PAD_OBJ_TYPE__ARRAY);
     assert(func->ref_ast);
     assert(func->ref_context);
 
-    // push scope
-    PadCtx_PushBackScope(func->ref_context);
+    if (!enter_func_call(err, ref_node, ref_ast, ref_context)) {
+        return NULL;
+    }
 
-    // this function has extends-function ? does set super ?
-    if (func->extends_func) {
-        Pad_SetRefAtVarmap(
-            err,
-            ref_node,
-            func->ref_context,
-            owns,
-            "super",
-            func->extends_func
-        );
+    // the owner is passed as self to method
+    PadObj *self_obj = NULL;
+    PadObj *ownpar = PadObjAry_GetLast2(owns);
+    if (ownpar && func->is_met) {
+        self_obj = Pad_ExtractIdent(ownpar);
     }
 
-    // extract function arguments to function's varmap in current context
-    extract_func_args(err, ref_ast, ref_gc, ref_context, ref_node, owns, func_obj, args);
-    if (PadErrStack_Len(err)) {
-        push_err("failed to extract function arguments");
+    // actual arguments are borrowed on the stack buffer
+    PadObj *args_buf[PAD_OBJ_ARY__FIXED_CAPA + 1];
+    PadObjAry args;
+    PadObjAry_InitFixed(&args, args_buf, PAD_OBJ_ARY__FIXED_CAPA);
+
+    if (!collect_func_args(
+        err, ref_node, ref_ast, ref_gc, ref_context, self_obj, drtargs, &args
+    )) {
+        push_err("failed to collect function arguments");
+        PadObjAry_DelFixed(&args);
+        leave_func_call(ref_context);
         return NULL;
     }
-    PadObj_Del(args);
 
-    // execute function suites
-    PadObj *result = exec_func_suites(err, func_obj);
-    if (PadErrStack_Len(err)) {
-        push_err("failed to execute function suites");
-        return NULL;
+    PadObjAry *cur_args = &args;
+    PadObj *tail_func = NULL;  // keep alive pending function while running
+    PadObj *result = NULL;
+
+    for (;;) {
+        func = &func_obj->func;
+
+        // push scope
+        PadCtx_PushBackScope(func->ref_context);
+
+        // this function has extends-function ? does set super ?
+        if (func->extends_func) {
+            Pad_SetRefAtVarmap(
+                err,
+                ref_node,
+                func->ref_context,
+                owns,
+                "super",
+                func->extends_func
+            );
+        }
+
+        // extract function arguments to function's varmap in current context
+        extract_func_args(err, ref_ast, ref_gc, ref_context, ref_node, owns, func_obj, cur_args);
+        if (cur_args == &args) {
+            PadObjAry_DelFixed(&args);
+        } else {
+            PadObjAry_Del(cur_args);
+        }
+        cur_args = NULL;
+        if (PadErrStack_Len(err)) {
+            push_err("failed to extract function arguments");
+            PadCtx_PopBackScope(func->ref_context);
+            result = NULL;
+            break;
+        }
+
+        // execute function suites
+        result = exec_func_suites(err, func_obj);
+        if (PadErrStack_Len(err)) {
+            push_err("failed to execute function suites");
+            PadCtx_ClearTailCall(func->ref_context);
+            result = NULL;
+            break;
+        }
+
+        // reset status
+        PadCtx_SetDoReturn(func->ref_context, false);
+
+        // pop scope
+        // the result may be owned by the popped varmap only, keep it alive
+        if (result) {
+            PadObj_IncRef(result);
+        }
+        PadCtx_PopBackScope(func->ref_context);
+        if (result) {
+            PadObj_DecRef(result);
+        }
+
+        // invoke pending tail call in this frame
+        PadObj *next_func = PadCtx_PopTailCall(func->ref_context, &cur_args);
+        if (tail_func) {
+            PadObj_DecRef(tail_func);
+            PadObj_Del(tail_func);
+        }
+        tail_func = next_func;
+        if (!next_func) {
+            break;
+        }
+        func_obj = next_func;
     }
 
-    // reset status
-    PadCtx_SetDoReturn(func->ref_context, false);
+    if (tail_func) {
+        PadObj_DecRef(tail_func);
+        PadObj_Del(tail_func);
+    }
+    leave_func_call(ref_context);
 
-    // pop scope
-    PadCtx_PopBackScope(func->ref_context);
+    if (PadErrStack_Len(err)) {
+        return NULL;
+    }
 
     // done
     if (!result) {
@@ -921,6 +1086,41 @@ invoke_func_obj(
     return result;
 }
 
+/**
+ * set pending call of function at context of running function
+ */
+static PadObj *
+defer_func_obj(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,  // TODO const
+    PadObj *func_obj,
+    PadObj *drtargs
+) {
+    PadFuncObj *func = &func_obj->func;
+
+    PadObj *self_obj = NULL;
+    PadObj *ownpar = PadObjAry_GetLast2(owns);
+    if (ownpar && func->is_met) {
+        self_obj = Pad_ExtractIdent(ownpar);
+    }
+
+    PadObjAry *args = PadObjAry_New();
+    if (!collect_func_args(
+        err, ref_node, ref_ast, ref_gc, ref_context, self_obj, drtargs, args
+    )) {
+        push_err("failed to collect function arguments");
+        PadObjAry_Del(args);
+        return NULL;
+    }
+
+    PadCtx_SetTailCall(ref_context, func_obj, PadMem_Move(args));
+    return PadObj_NewNil(ref_gc);
+}
+
 static const char *
 extract_idn_name(const PadObj *obj) {
     if (!obj) {
@@ -1106,6 +1306,119 @@ gen_struct(
     );
 }
 
+/**
+ * pull value of element of numeric array
+ *
+ * @return success to true
+ * @return not number to false
+ */
+static bool
+pull_num_val(PadObj *obj, PadNumVal *val) {
+    obj = Pad_ExtractIdent(obj);
+    if (!obj) {
+        return false;
+    }
+
+    switch (obj->type) {
+    default:
+        return false;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        *val = (PadNumVal) { .kind = PAD_NUM_ARY_KIND__INT, .ivalue = obj->lvalue };
+        break;
+    case PAD_OBJ_TYPE__BOOL:
+        *val = (PadNumVal) { .kind = PAD_NUM_ARY_KIND__INT, .ivalue = obj->boolean };
+        break;
+    case PAD_OBJ_TYPE__FLOAT:
+        *val = (PadNumVal) { .kind = PAD_NUM_ARY_KIND__FLOAT, .fvalue = obj->float_value };
+        break;
+    }
+
+    return true;
+}
+
+/**
+ * construct numeric array by array of numbers or array of rows
+ * if kind is NULL then kind is float if elements have float otherwise int
+ *
+ *     NumArray([1, 2, 3])
+ *     NumArray([[1, 2], [3, 4]], "float")
+ */
+static PadObj *
+new_numarray(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *values,
+    const char *kind
+) {
+    PadObjAry *rows = values->objarr;
+    int32_t len = PadObjAry_Len(rows);
+    PadObj *first = len ? Pad_ExtractIdent(PadObjAry_Get(rows, 0)) : NULL;
+    bool is_2d = first && first->type == PAD_OBJ_TYPE__ARRAY;
+    int32_t cols = is_2d ? PadObjAry_Len(first->objarr) : 1;
+    PadNumVal val;
+
+    // check elements and find float
+    bool has_float = false;
+    for (int32_t y = 0; y < len; y++) {
+        PadObj *row = Pad_ExtractIdent(PadObjAry_Get(rows, y));
+        if (!is_2d) {
+            if (!pull_num_val(row, &val)) {
+                push_err("invalid element of numeric array");
+                return NULL;
+            }
+            has_float |= val.kind == PAD_NUM_ARY_KIND__FLOAT;
+            continue;
+        }
+        if (!row || row->type != PAD_OBJ_TYPE__ARRAY ||
+            PadObjAry_Len(row->objarr) != cols) {
+            push_err("rows of numeric array are not same length");
+            return NULL;
+        }
+        for (int32_t x = 0; x < cols; x++) {
+            if (!pull_num_val(PadObjAry_Get(row->objarr, x), &val)) {
+                push_err("invalid element of numeric array");
+                return NULL;
+            }
+            has_float |= val.kind == PAD_NUM_ARY_KIND__FLOAT;
+        }
+    }
+
+    PadNumAryKind numkind = has_float ? PAD_NUM_ARY_KIND__FLOAT : PAD_NUM_ARY_KIND__INT;
+    if (PadCStr_Eq(kind, "int")) {
+        numkind = PAD_NUM_ARY_KIND__INT;
+    } else if (PadCStr_Eq(kind, "float")) {
+        numkind = PAD_NUM_ARY_KIND__FLOAT;
+    } else if (kind) {
+        push_err("invalid kind of numeric array \"%s\"", kind);
+        return NULL;
+    }
+
+    PadNumAry *numarr = is_2d ?
+        PadNumAry_New2D(numkind, len, cols) :
+        PadNumAry_New(numkind, len);
+    if (!numarr) {
+        push_err("failed to allocate numeric array");
+        return NULL;
+    }
+
+    for (int32_t y = 0; y < len; y++) {
+        PadObj *row = Pad_ExtractIdent(PadObjAry_Get(rows, y));
+        if (!is_2d) {
+            pull_num_val(row, &val);
+            PadNumAry_Set(numarr, y, val);
+            continue;
+        }
+        for (int32_t x = 0; x < cols; x++) {
+            pull_num_val(PadObjAry_Get(row->objarr, x), &val);
+            PadNumAry_Set2D(numarr, y, x, val);
+        }
+    }
+
+    return PadObj_NewNumAry(ref_gc, PadMem_Move(numarr));
+}
+
 static PadObj *
 invoke_type_obj(
     PadErrStack *err,
@@ -1203,6 +1516,52 @@ invoke_type_obj(
         PadObj *ret = PadObj_NewDict(ref_gc, PadMem_Move(dict));
         return ret;
     } break;
+    case PAD_OBJ_TYPE__DEQUE: {
+        PadObjDeq *deq = PadObjDeq_New();
+        if (!deq) {
+            push_err("failed to allocate deque");
+            return NULL;
+        }
+        if (PadObjAry_Len(args)) {
+            PadObj *ary = PadObjAry_Get(args, 0);
+            if (ary->type != PAD_OBJ_TYPE__ARRAY) {
+                PadObjDeq_Del(deq);
+                push_err("invalid argument type. expected array but given other");
+                return NULL;
+            }
+            ary = copy_array_args(err, ref_ast, ref_gc, ref_context, ref_node, ary);
+            for (int32_t i = 0; i < PadObjAry_Len(ary->objarr); i++) {
+                PadObjDeq_PushBack(deq, PadObjAry_Get(ary->objarr, i));
+            }
+            PadObj_Del(ary);
+        }
+        return PadObj_NewDeq(ref_gc, PadMem_Move(deq));
+    } break;
+    case PAD_OBJ_TYPE__NUMARRAY: {
+        int32_t nargs = PadObjAry_Len(args);
+        if (nargs < 1 || nargs > 2) {
+            push_err("NumArray need one or two arguments");
+            return NULL;
+        }
+
+        PadObj *values = Pad_ExtractIdent(PadObjAry_Get(args, 0));
+        if (!values || values->type != PAD_OBJ_TYPE__ARRAY) {
+            push_err("invalid argument type. expected array but given other");
+            return NULL;
+        }
+
+        const char *kind = NULL;
+        if (nargs == 2) {
+            PadObj *kindobj = Pad_ExtractIdent(PadObjAry_Get(args, 1));
+            if (!kindobj || kindobj->type != PAD_OBJ_TYPE__UNICODE) {
+                push_err("kind of numeric array is not string");
+                return NULL;
+            }
+            kind = PadUni_GetcMB(kindobj->unicode);
+        }
+
+        return new_numarray(err, ref_node, ref_gc, values, kind);
+    } break;
     case PAD_OBJ_TYPE__UNICODE: {
         PadUni *u;
         if (PadObjAry_Len(args)) {
@@ -1273,15 +1632,16 @@ again:
     }
 }
 
-PadObj *
-Pad_ReferChainCall(
+static PadObj *
+refer_chain_call(
     PadErrStack *err,
     const PadNode *ref_node,
     PadAST *ref_ast,
     PadGC *ref_gc,
     PadCtx *ref_context,
     PadObjAry *owns,  // TODO: const
-    PadChainObj *co
+    PadObj *actual_args,
+    bool is_tail
 ) {
 #define _invoke_func_obj(func_obj, actual_args) \
     invoke_func_obj(err, ref_node, ref_ast, ref_gc, ref_context, owns, func_obj, actual_args)
@@ -1301,7 +1661,6 @@ Pad_ReferChainCall(
         return NULL;
     }
 
-    PadObj *actual_args = PadChainObj_GetObj(co);
     if (actual_args->type != PAD_OBJ_TYPE__ARRAY) {
         push_err("arguments isn't array");
         return NULL;
@@ -1324,7 +1683,16 @@ Pad_ReferChainCall(
     }
 
     PadObj *func_obj = extract_func(own);
-    if (func_obj) {
+    if (func_obj && is_tail) {
+        result = defer_func_obj(
+            err, ref_node, ref_ast, ref_gc, ref_context, owns, func_obj, actual_args
+        );
+        if (PadErrStack_Len(err)) {
+            push_err("failed to defer func obj");
+            return NULL;
+        }
+        return result;
+    } else if (func_obj) {
         result = _invoke_func_obj(func_obj, actual_args);
         if (PadErrStack_Len(err)) {
             push_err("failed to invoke func obj");
@@ -1359,6 +1727,86 @@ Pad_ReferChainCall(
     return NULL;
 }
 
+PadObj *
+Pad_ReferChainCall(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,  // TODO: const
+    PadChainObj *co
+) {
+    return refer_chain_call(
+        err, ref_node, ref_ast, ref_gc, ref_context, owns,
+        PadChainObj_GetObj(co), false
+    );
+}
+
+PadObj *
+Pad_ReferChainTailCall(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,  // TODO: const
+    PadObj *args
+) {
+    PadObj *result = refer_chain_call(
+        err, ref_node, ref_ast, ref_gc, ref_context, owns, args, true
+    );
+    if (PadErrStack_Len(err)) {
+        push_err("failed to refer chain call");
+        return NULL;
+    }
+    return result;
+}
+
+PadObj *
+Pad_InvokeFuncObj(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObj *func_obj,
+    PadObj *args
+) {
+    if (!func_obj || !args || args->type != PAD_OBJ_TYPE__ARRAY) {
+        return NULL;
+    }
+
+    // the function is the only owner. it is not invoked as method
+    PadObj *owns_buf[PAD_OBJ_ARY__FIXED_CAPA + 1];
+    PadObjAry owns;
+    PadObjAry_InitFixed(&owns, owns_buf, PAD_OBJ_ARY__FIXED_CAPA);
+    PadObjAry_PushBack(&owns, func_obj);
+
+    PadObj *result = NULL;
+    switch (func_obj->type) {
+    default:
+        push_err("can't invoke object (%d)", func_obj->type);
+        break;
+    case PAD_OBJ_TYPE__FUNC:
+        result = invoke_func_obj(
+            err, ref_node, ref_ast, ref_gc, ref_context, &owns, func_obj, args
+        );
+        break;
+    case PAD_OBJ_TYPE__BLTIN_FUNC:
+        result = invoke_builtin_modules(
+            err, ref_node, ref_ast, ref_gc, ref_context, &owns, args
+        );
+        break;
+    }
+
+    PadObjAry_DelFixed(&owns);
+    if (PadErrStack_Len(err)) {
+        return NULL;
+    }
+    return result;
+}
+
 static PadObj *
 refer_unicode_index(
     PadErrStack *err,
@@ -1445,6 +1893,159 @@ again:
     return obj;
 }
 
+static PadObj *
+refer_deque_index(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadObj *owner,
+    PadObj *indexobj
+) {
+    assert(owner->type == PAD_OBJ_TYPE__DEQUE);
+
+again:
+    switch (indexobj->type) {
+    default:
+        push_err("index isn't integer");
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(indexobj);
+        indexobj = Pad_PullRefAll(indexobj);
+        if (!indexobj) {
+            push_err("\"%s\" is not defined", idn);
+            return NULL;
+        }
+        goto again;
+    } break;
+    }
+
+    PadIntObj index = indexobj->lvalue;
+    PadObjDeq *objdeq = owner->objdeq;
+
+    if (index < 0 || index >= PadObjDeq_Len(objdeq)) {
+        push_err("index out of range");
+        return NULL;
+    }
+
+    return PadObjDeq_Get(objdeq, index);
+}
+
+static PadObj *
+refer_numarray_index(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *owner,
+    PadObj *indexobj
+) {
+    assert(owner->type == PAD_OBJ_TYPE__NUMARRAY);
+
+again:
+    switch (indexobj->type) {
+    default:
+        push_err("index isn't integer");
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(indexobj);
+        indexobj = Pad_PullRefAll(indexobj);
+        if (!indexobj) {
+            push_err("\"%s\" is not defined", idn);
+            return NULL;
+        }
+        goto again;
+    } break;
+    }
+
+    PadIntObj index = indexobj->lvalue;
+    if (index < 0 || index >= PadNumAry_Len(owner->numarr)) {
+        push_err("index out of range");
+        return NULL;
+    }
+
+    return PadObj_NewNumAryItem(ref_gc, owner, index);
+}
+
+static PadObj *
+refer_dict_view_index(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *owner,
+    PadObj *indexobj
+) {
+    assert(owner->type == PAD_OBJ_TYPE__DICT_VIEW);
+
+again:
+    switch (indexobj->type) {
+    default:
+        push_err("index isn't integer");
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(indexobj);
+        indexobj = Pad_PullRefAll(indexobj);
+        if (!indexobj) {
+            push_err("\"%s\" is not defined", idn);
+            return NULL;
+        }
+        goto again;
+    } break;
+    }
+
+    PadIntObj index = indexobj->lvalue;
+    if (index < 0 || index >= PadObj_GetDictViewLen(owner)) {
+        push_err("index out of range");
+        return NULL;
+    }
+
+    return PadObj_NewDictViewItem(ref_gc, owner, index);
+}
+
+static PadObj *
+refer_range_index(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadGC *ref_gc,
+    PadObj *owner,
+    PadObj *indexobj
+) {
+    assert(owner->type == PAD_OBJ_TYPE__RANGE);
+
+again:
+    switch (indexobj->type) {
+    default:
+        push_err("index isn't integer");
+        return NULL;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        break;
+    case PAD_OBJ_TYPE__IDENT: {
+        const char *idn = PadObj_GetcIdentName(indexobj);
+        indexobj = Pad_PullRefAll(indexobj);
+        if (!indexobj) {
+            push_err("\"%s\" is not defined", idn);
+            return NULL;
+        }
+        goto again;
+    } break;
+    }
+
+    PadIntObj index = indexobj->lvalue;
+    if (index < 0 || index >= PadObj_GetRangeLen(owner)) {
+        push_err("index out of range");
+        return NULL;
+    }
+
+    return PadObj_NewInt(ref_gc, PadObj_GetRangeAt(owner, index));
+}
+
 static PadObj *
 Pad_ReferAndSetRefAryIndex(
     PadErrStack *err,
@@ -1595,7 +2196,7 @@ refer_chain_index(
     PadGC *ref_gc,
     PadCtx *ref_context,
     PadObjAry *owns,
-    PadChainObj *co
+    PadObj *indexobj
 ) {
     PadObj *owner = PadObjAry_GetLast(owns);
     if (!owner) {
@@ -1603,8 +2204,6 @@ refer_chain_index(
         return NULL;
     }
 
-    PadObj *indexobj = PadChainObj_GetObj(co);
-
 again:
     switch (owner->type) {
     default:
@@ -1626,6 +2225,18 @@ again:
     case PAD_OBJ_TYPE__ARRAY:
         return refer_array_index(err, ref_node, owner, indexobj);
         break;
+    case PAD_OBJ_TYPE__RANGE:
+        return refer_range_index(err, ref_node, ref_gc, owner, indexobj);
+        break;
+    case PAD_OBJ_TYPE__DEQUE:
+        return refer_deque_index(err, ref_node, owner, indexobj);
+        break;
+    case PAD_OBJ_TYPE__NUMARRAY:
+        return refer_numarray_index(err, ref_node, ref_gc, owner, indexobj);
+        break;
+    case PAD_OBJ_TYPE__DICT_VIEW:
+        return refer_dict_view_index(err, ref_node, ref_gc, owner, indexobj);
+        break;
     case PAD_OBJ_TYPE__DICT:
         return refer_dict_index(
             err, ref_node, ref_ast, ref_gc, ref_context, owner, indexobj
@@ -1686,21 +2297,22 @@ again:
 }
 
 PadObj *
-Pad_ReferChainThreeObjs(
+Pad_ReferChainElem(
     PadErrStack *err,
     const PadNode *ref_node,
     PadAST *ref_ast,
     PadGC *ref_gc,
     PadCtx *ref_context,
     PadObjAry *owns,
-    PadChainObj *co
+    PadChainObjType type,
+    PadObj *elem
 ) {
     PadObj *operand = NULL;
 
-    switch (PadChainObj_GetcType(co)) {
+    switch (type) {
     case PAD_CHAIN_PAD_OBJ_TYPE___DOT: {
         operand = refer_chain_dot(
-            err, ref_node, ref_gc, ref_context, owns, co
+            err, ref_node, ref_gc, ref_context, owns, elem
         );
         if (PadErrStack_Len(err)) {
             push_err("failed to refer chain dot");
@@ -1708,8 +2320,8 @@ Pad_ReferChainThreeObjs(
         }
     } break;
     case PAD_CHAIN_PAD_OBJ_TYPE___CALL: {
-        operand = Pad_ReferChainCall(
-            err, ref_node, ref_ast, ref_gc, ref_context, owns, co
+        operand = refer_chain_call(
+            err, ref_node, ref_ast, ref_gc, ref_context, owns, elem, false
         );
         if (PadErrStack_Len(err)) {
             push_err("failed to refer chain call");
@@ -1718,7 +2330,7 @@ Pad_ReferChainThreeObjs(
     } break;
     case PAD_CHAIN_PAD_OBJ_TYPE___INDEX: {
         operand = refer_chain_index(
-            err, ref_node, ref_ast, ref_gc, ref_context, owns, co
+            err, ref_node, ref_ast, ref_gc, ref_context, owns, elem
         );
         if (PadErrStack_Len(err)) {
             push_err("failed to refer chain index");
@@ -1730,6 +2342,22 @@ Pad_ReferChainThreeObjs(
     return operand;
 }
 
+PadObj *
+Pad_ReferChainThreeObjs(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,
+    PadChainObj *co
+) {
+    return Pad_ReferChainElem(
+        err, ref_node, ref_ast, ref_gc, ref_context, owns,
+        PadChainObj_GetcType(co), PadChainObj_GetObj(co)
+    );
+}
+
 PadObj *
 Pad_ReferAndSetRefChainThreeObjs(
     PadErrStack *err,
@@ -2108,6 +2736,9 @@ Pad_ParseBool(
     case PAD_OBJ_TYPE__UNICODE: return PadUni_Len(obj->unicode); break;
     case PAD_OBJ_TYPE__ARRAY: return PadObjAry_Len(obj->objarr); break;
     case PAD_OBJ_TYPE__DICT: return PadObjDict_Len(obj->objdict); break;
+    case PAD_OBJ_TYPE__DEQUE: return PadObjDeq_Len(obj->objdeq); break;
+    case PAD_OBJ_TYPE__NUMARRAY: return PadNumAry_Len(obj->numarr); break;
+    case PAD_OBJ_TYPE__DICT_VIEW: return PadObj_GetDictViewLen(obj); break;
     case PAD_OBJ_TYPE__RING: {
         PadObj *ref = Pad_ReferRingObjWithRef(
             err, ref_node, ref_ast, ref_gc, ref_context, obj
@@ -2172,6 +2803,9 @@ Pad_ParseInt(
     } break;
     case PAD_OBJ_TYPE__ARRAY: return PadObjAry_Len(obj->objarr); break;
     case PAD_OBJ_TYPE__DICT: return PadObjDict_Len(obj->objdict); break;
+    case PAD_OBJ_TYPE__DEQUE: return PadObjDeq_Len(obj->objdeq); break;
+    case PAD_OBJ_TYPE__NUMARRAY: return PadNumAry_Len(obj->numarr); break;
+    case PAD_OBJ_TYPE__DICT_VIEW: return PadObj_GetDictViewLen(obj); break;
     case PAD_OBJ_TYPE__RING: {
         PadObj *ref = Pad_ReferRingObjWithRef(
             err, ref_node, ref_ast, ref_gc, ref_context, obj
@@ -2236,6 +2870,9 @@ Pad_ParseFloat(
     } break;
     case PAD_OBJ_TYPE__ARRAY: return PadObjAry_Len(obj->objarr); break;
     case PAD_OBJ_TYPE__DICT: return PadObjDict_Len(obj->objdict); break;
+    case PAD_OBJ_TYPE__DEQUE: return PadObjDeq_Len(obj->objdeq); break;
+    case PAD_OBJ_TYPE__NUMARRAY: return PadNumAry_Len(obj->numarr); break;
+    case PAD_OBJ_TYPE__DICT_VIEW: return PadObj_GetDictViewLen(obj); break;
     case PAD_OBJ_TYPE__RING: {
         PadObj *ref = Pad_ReferRingObjWithRef(
             err, ref_node, ref_ast, ref_gc, ref_context, obj
@@ -2265,3 +2902,38 @@ Pad_IsVarInCurScope(const PadObj *idnobj) {
     PadCtx *ref_ctx = PadObj_GetIdentRefCtx(idnobj);
     return PadCtx_VarInCurScope(ref_ctx, idn);
 }
+
+bool
+Pad_IsEqualValue(const PadObj *a, const PadObj *b) {
+    if (a == b) {
+        return true;
+    }
+
+    switch (a->type) {
+    default:
+        return false;
+        break;
+    case PAD_OBJ_TYPE__NIL:
+        return b->type == PAD_OBJ_TYPE__NIL;
+        break;
+    case PAD_OBJ_TYPE__BOOL:
+        return b->type == PAD_OBJ_TYPE__BOOL && a->boolean == b->boolean;
+        break;
+    case PAD_OBJ_TYPE__INT:
+        if (b->type == PAD_OBJ_TYPE__INT) {
+            return a->lvalue == b->lvalue;
+        }
+        return b->type == PAD_OBJ_TYPE__FLOAT && a->lvalue == b->float_value;
+        break;
+    case PAD_OBJ_TYPE__FLOAT:
+        if (b->type == PAD_OBJ_TYPE__FLOAT) {
+            return a->float_value == b->float_value;
+        }
+        return b->type == PAD_OBJ_TYPE__INT && a->float_value == b->lvalue;
+        break;
+    case PAD_OBJ_TYPE__UNICODE:
+        return b->type == PAD_OBJ_TYPE__UNICODE &&
+               PadUni_Compare(a->unicode, b->unicode) == 0;
+        break;
+    }
+}
@@ -7,8 +7,19 @@
 #include <pad/lang/object.h>
 #include <pad/lang/context.h>
 #include <pad/lang/nodes.h>
+#include <pad/lang/chain_object.h>
 #include <pad/lang/arguments.h>
 
+#if defined(_WIN32) || defined(_WIN64)
+# define PAD_UTILS__WINDOWS 1 /* cap: utils.h */
+#else
+# undef PAD_UTILS__WINDOWS
+#endif
+
+#if !defined(PAD_UTILS__WINDOWS)
+# include <sys/resource.h>
+#endif
+
 /*********
 * macros *
 *********/
@@ -201,6 +212,30 @@ Pad_ReferChainThreeObjs(
     PadChainObj *co
 );
 
+/**
+ * refer chain element without chain object
+ * this is the one step of chain evaluation. trv_ring calls this for each
+ * chain node so that read path doesn't need ring objects
+ *
+ * @param[in] *owns owner objects (contain first operand)
+ * @param[in] type  type of chain element
+ * @param[in] *elem object of chain element (factor, call args or index)
+ *
+ * @return success to refer object
+ * @return failed to NULL
+ */
+PadObj *
+Pad_ReferChainElem(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,
+    PadChainObjType type,
+    PadObj *elem
+);
+
 /**
  * refer chain call
  *
@@ -222,6 +257,49 @@ Pad_ReferChainCall(
     PadChainObj *co
 );
 
+/**
+ * refer chain call in tail position (return f(...))
+ * if callee is pad's function then do not invoke it and set pending tail call
+ * at context. the running function invokes it after pop own scope
+ *
+ * @param[in] *owns owner objects (contain first operand)
+ * @param[in] *args array object of actual arguments
+ *
+ * @return success to refer object (nil if call is pending)
+ * @return failed to NULL
+ */
+PadObj *
+Pad_ReferChainTailCall(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObjAry *owns,  // TODO: const
+    PadObj *args
+);
+
+/**
+ * invoke function object (pad's function or builtin function) with arguments
+ * for builtin functions that call back function of user (key of sort etc)
+ *
+ * @param[in] *func_obj function object
+ * @param[in] *args     array object of actual arguments
+ *
+ * @return success to pointer to result object
+ * @return failed to NULL
+ */
+PadObj *
+Pad_InvokeFuncObj(
+    PadErrStack *err,
+    const PadNode *ref_node,
+    PadAST *ref_ast,
+    PadGC *ref_gc,
+    PadCtx *ref_context,
+    PadObj *func_obj,
+    PadObj *args
+);
+
 PadObj *
 Pad_ReferAndSetRef(
     PadErrStack *err,
@@ -300,3 +378,17 @@ Pad_IsVarInCurScope(const PadObj *idnobj);
 PadObj *
 Pad_ExtractIdent(PadObj *obj);
 
+
+/**
+ * check equality of values for array.contains and others
+ * numbers and strings are compared by value. other objects are compared
+ * by identity
+ *
+ * @param[in] *a
+ * @param[in] *b
+ *
+ * @return equal to true
+ * @return not equal to false
+ */
+bool
+Pad_IsEqualValue(const PadObj *a, const PadObj *b);
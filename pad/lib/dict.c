@@ -27,13 +27,10 @@ PadDict_New(size_t capa) {
         return NULL;
     }
 
+    // map is allocated at first set. contexts of builtin modules have
+    // dicts of alias info and options that are never set
     self->capa = capa;
     self->len = 0;
-    self->map = PadMem_Calloc(self->capa + 1, sizeof(PadDictItem));
-    if (!self->map) {
-        free(self);
-        return NULL;
-    }
 
     return self;
 }
@@ -51,6 +48,10 @@ PadDict_DeepCopy(const PadDict *other) {
     
     self->capa = other->capa;
     self->len = 0;
+    if (!other->map) {
+        return self;
+    }
+
     self->map = PadMem_Calloc(other->capa + 1, sizeof(PadDictItem));
     if (!self->map) {
         free(self);
@@ -103,7 +104,11 @@ PadDict_Set(PadDict *self, const char *key, const char *value) {
         }
     }
     
-    if (self->len >= self->capa) {
+    if (!self->map) {
+        if (!PadDict_Resize(self, self->capa)) {
+            return NULL;
+        }
+    } else if (self->len >= self->capa) {
         if (!PadDict_Resize(self, self->capa * 2)) {
             return NULL;
         }
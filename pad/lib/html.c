@@ -0,0 +1,65 @@
+#include <pad/lib/html.h>
+#include <pad/lib/unicode_kernel.h>
+
+static const char *
+get_entity(char ch, int32_t *len) {
+    switch (ch) {
+    case '<': *len = 4; return "&lt;"; break;
+    case '>': *len = 4; return "&gt;"; break;
+    case '&': *len = 5; return "&amp;"; break;
+    case '"': *len = 6; return "&quot;"; break;
+    case '\'': *len = 5; return "&#39;"; break;
+    }
+    *len = 1;
+    return NULL;
+}
+
+bool
+PadHtml_Escape(const char *s, int32_t len, PadHtmlWriteFunc func, void *arg) {
+    if (!s || !func) {
+        return false;
+    }
+
+    for (int32_t i = 0; i < len; ) {
+        int32_t n = PadUniKernel_SpanHtmlSafe(s + i, len - i);
+        if (n > 0 && !func(arg, s + i, n)) {
+            return false;
+        }
+        i += n;
+        if (i >= len) {
+            break;
+        }
+
+        int32_t elen;
+        const char *ent = get_entity(s[i], &elen);
+        if (!func(arg, ent, elen)) {
+            return false;
+        }
+        i++;
+    }
+
+    return true;
+}
+
+static bool
+write_str(void *arg, const char *data, int32_t len) {
+    return PadStr_AppNStr(arg, data, len) != NULL;
+}
+
+PadStr *
+PadHtml_EscapeApp(PadStr *dst, const char *s, int32_t len) {
+    if (!dst) {
+        return NULL;
+    }
+
+    if (!PadHtml_Escape(s, len, write_str, dst)) {
+        return NULL;
+    }
+
+    return dst;
+}
+
+bool
+PadHtml_NeedEscape(const char *s, int32_t len) {
+    return PadUniKernel_SpanHtmlSafe(s, len) < len;
+}
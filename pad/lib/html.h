@@ -0,0 +1,67 @@
+/**
+ * HTML escaping
+ *
+ * '<', '>', '&', '"' and '\'' are replaced by entities
+ * runs of other bytes are found by kernel and written at once
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <pad/lib/string.h>
+
+/**
+ * write function for escaped strings
+ *
+ * @param[in] *arg  argument of function
+ * @param[in] *data pointer to data (not null terminated)
+ * @param[in] len   length of data
+ *
+ * @return success to true
+ * @return failed to false
+ */
+typedef bool (*PadHtmlWriteFunc)(void *arg, const char *data, int32_t len);
+
+/**
+ * escape strings and write it by function
+ *
+ * @param[in] *s    pointer to multi byte strings
+ * @param[in] len   length of strings
+ * @param[in] func  write function
+ * @param[in] *arg  argument of write function
+ *
+ * @return success to true
+ * @return failed to false
+ */
+bool
+PadHtml_Escape(const char *s, int32_t len, PadHtmlWriteFunc func, void *arg);
+
+/**
+ * escape strings and append it at back of string
+ *
+ * @param[in] *dst pointer to PadStr
+ * @param[in] *s   pointer to multi byte strings
+ * @param[in] len  length of strings
+ *
+ * @return success to pointer to dst
+ * @return failed to NULL
+ */
+PadStr *
+PadHtml_EscapeApp(PadStr *dst, const char *s, int32_t len);
+
+/**
+ * check strings need escape
+ *
+ * @param[in] *s  pointer to multi byte strings
+ * @param[in] len length of strings
+ *
+ * @return need to true
+ * @return not need to false
+ */
+bool
+PadHtml_NeedEscape(const char *s, int32_t len);
@@ -0,0 +1,597 @@
+#include <pad/lib/num_array.h>
+
+enum {
+    ELEM_SIZE = 8,  // sizeof(int64_t) and sizeof(double)
+};
+
+/**
+ * buffer of elements shared by views
+ */
+typedef struct {
+    int32_t ref_counts;
+    void *data;
+} buffer_t;
+
+struct PadNumAry {
+    PadNumAryKind kind;  // kind of elements
+    int32_t ndim;  // number of dimensions (1 or 2)
+    int32_t shape[2];  // lengths of dimensions. shape[1] is 1 if 1-D
+    int32_t strides[2];  // number of elements to next index of dimensions
+    int32_t offset;  // index of first element in buffer
+    buffer_t *buf;  // buffer of elements
+};
+
+/**********
+* helpers *
+**********/
+
+static PadNumAry *
+new_ary(PadNumAryKind kind, int32_t ndim, int32_t rows, int32_t cols) {
+    if (rows < 0 || cols < 0 || (cols && rows > INT32_MAX / cols)) {
+        return NULL;
+    }
+
+    PadNumAry *self = PadMem_Calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    self->buf = PadMem_Calloc(1, sizeof(buffer_t));
+    if (!self->buf) {
+        free(self);
+        return NULL;
+    }
+
+    int32_t size = rows * cols;
+    self->buf->data = PadMem_Calloc(size ? size : 1, ELEM_SIZE);
+    if (!self->buf->data) {
+        free(self->buf);
+        free(self);
+        return NULL;
+    }
+
+    self->buf->ref_counts = 1;
+    self->kind = kind;
+    self->ndim = ndim;
+    self->shape[0] = rows;
+    self->shape[1] = cols;
+    self->strides[0] = ndim == 2 ? cols : 1;
+    self->strides[1] = ndim == 2 ? 1 : 0;
+
+    return self;
+}
+
+static PadNumAry *
+new_view(const PadNumAry *other) {
+    PadNumAry *self = PadMem_Calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    *self = *other;
+    self->buf->ref_counts++;
+
+    return self;
+}
+
+/**
+ * address of element in buffer
+ */
+static inline char *
+at(const PadNumAry *self, int32_t y, int32_t x) {
+    int32_t index = self->offset + y * self->strides[0] + x * self->strides[1];
+    return (char *) self->buf->data + (size_t) index * ELEM_SIZE;
+}
+
+static inline bool
+is_contiguous(const PadNumAry *self) {
+    if (self->ndim == 1) {
+        return self->strides[0] == 1 || self->shape[0] <= 1;
+    }
+    return (self->strides[1] == 1 || self->shape[1] <= 1) &&
+           (self->strides[0] == self->shape[1] || self->shape[0] <= 1);
+}
+
+static inline PadNumVal
+new_val(PadNumAryKind kind, int64_t ivalue, double fvalue) {
+    PadNumVal val = { .kind = kind };
+    if (kind == PAD_NUM_ARY_KIND__INT) {
+        val.ivalue = ivalue;
+    } else {
+        val.fvalue = fvalue;
+    }
+    return val;
+}
+
+static inline PadNumVal
+convert_val(PadNumVal val, PadNumAryKind kind) {
+    if (val.kind == kind) {
+        return val;
+    }
+    if (kind == PAD_NUM_ARY_KIND__INT) {
+        return new_val(kind, (int64_t) val.fvalue, 0);
+    }
+    return new_val(kind, 0, (double) val.ivalue);
+}
+
+static PadNumVal
+get_at(const PadNumAry *self, int32_t y, int32_t x) {
+    const char *p = at(self, y, x);
+    if (self->kind == PAD_NUM_ARY_KIND__INT) {
+        return new_val(self->kind, *(const int64_t *) p, 0);
+    }
+    return new_val(self->kind, 0, *(const double *) p);
+}
+
+static void
+set_at(PadNumAry *self, int32_t y, int32_t x, PadNumVal val) {
+    char *p = at(self, y, x);
+    val = convert_val(val, self->kind);
+    if (self->kind == PAD_NUM_ARY_KIND__INT) {
+        *(int64_t *) p = val.ivalue;
+    } else {
+        *(double *) p = val.fvalue;
+    }
+}
+
+/**
+ * get contiguous array of kind. if self is it then returns self
+ * otherwise returns copy and sets it at *tmp for delete by caller
+ */
+static const PadNumAry *
+prepare(const PadNumAry *self, PadNumAryKind kind, PadNumAry **tmp) {
+    *tmp = NULL;
+    if (self->kind == kind && is_contiguous(self)) {
+        return self;
+    }
+    *tmp = PadNumAry_ToKind(self, kind);
+    return *tmp;
+}
+
+static inline PadNumAryKind
+result_kind(PadNumAryKind a, PadNumAryKind b) {
+    if (a == PAD_NUM_ARY_KIND__FLOAT || b == PAD_NUM_ARY_KIND__FLOAT) {
+        return PAD_NUM_ARY_KIND__FLOAT;
+    }
+    return PAD_NUM_ARY_KIND__INT;
+}
+
+static inline int64_t *
+ints(const PadNumAry *self) {
+    return (int64_t *) at(self, 0, 0);
+}
+
+static inline double *
+floats(const PadNumAry *self) {
+    return (double *) at(self, 0, 0);
+}
+
+/*****************
+* delete and new *
+*****************/
+
+void
+PadNumAry_Del(PadNumAry *self) {
+    if (!self) {
+        return;
+    }
+
+    if (--self->buf->ref_counts <= 0) {
+        free(self->buf->data);
+        free(self->buf);
+    }
+    free(self);
+}
+
+PadNumAry *
+PadNumAry_New(PadNumAryKind kind, int32_t len) {
+    return new_ary(kind, 1, len, 1);
+}
+
+PadNumAry *
+PadNumAry_New2D(PadNumAryKind kind, int32_t rows, int32_t cols) {
+    return new_ary(kind, 2, rows, cols);
+}
+
+PadNumAry *
+PadNumAry_DeepCopy(const PadNumAry *other) {
+    if (!other) {
+        return NULL;
+    }
+    return PadNumAry_ToKind(other, other->kind);
+}
+
+PadNumAry *
+PadNumAry_ShallowCopy(const PadNumAry *other) {
+    if (!other) {
+        return NULL;
+    }
+    return new_view(other);
+}
+
+PadNumAry *
+PadNumAry_ToKind(const PadNumAry *other, PadNumAryKind kind) {
+    if (!other) {
+        return NULL;
+    }
+
+    PadNumAry *self = new_ary(kind, other->ndim, other->shape[0], other->shape[1]);
+    if (!self) {
+        return NULL;
+    }
+
+    if (other->kind == kind && is_contiguous(other)) {
+        memcpy(self->buf->data, at(other, 0, 0), (size_t) PadNumAry_Size(other) * ELEM_SIZE);
+        return self;
+    }
+
+    for (int32_t y = 0; y < other->shape[0]; y++) {
+        for (int32_t x = 0; x < other->shape[1]; x++) {
+            set_at(self, y, x, get_at(other, y, x));
+        }
+    }
+
+    return self;
+}
+
+/*********
+* getter *
+*********/
+
+PadNumAryKind
+PadNumAry_GetKind(const PadNumAry *self) {
+    return self->kind;
+}
+
+int32_t
+PadNumAry_GetNDim(const PadNumAry *self) {
+    return self->ndim;
+}
+
+int32_t
+PadNumAry_Len(const PadNumAry *self) {
+    return self->shape[0];
+}
+
+int32_t
+PadNumAry_Cols(const PadNumAry *self) {
+    return self->ndim == 2 ? self->shape[1] : 0;
+}
+
+int32_t
+PadNumAry_Size(const PadNumAry *self) {
+    return self->shape[0] * self->shape[1];
+}
+
+bool
+PadNumAry_IsSameShape(const PadNumAry *self, const PadNumAry *other) {
+    return self->ndim == other->ndim &&
+           self->shape[0] == other->shape[0] &&
+           self->shape[1] == other->shape[1];
+}
+
+PadNumVal
+PadNumAry_Get(const PadNumAry *self, int32_t index) {
+    if (index < 0 || index >= self->shape[0]) {
+        return new_val(self->kind, 0, 0);
+    }
+    return get_at(self, index, 0);
+}
+
+PadNumVal
+PadNumAry_Get2D(const PadNumAry *self, int32_t y, int32_t x) {
+    if (y < 0 || y >= self->shape[0] || x < 0 || x >= self->shape[1]) {
+        return new_val(self->kind, 0, 0);
+    }
+    return get_at(self, y, x);
+}
+
+PadNumAry *
+PadNumAry_Row(const PadNumAry *self, int32_t y) {
+    if (!self || self->ndim != 2 || y < 0 || y >= self->shape[0]) {
+        return NULL;
+    }
+
+    PadNumAry *row = new_view(self);
+    if (!row) {
+        return NULL;
+    }
+
+    row->ndim = 1;
+    row->offset += y * self->strides[0];
+    row->shape[0] = self->shape[1];
+    row->shape[1] = 1;
+    row->strides[0] = self->strides[1];
+    row->strides[1] = 0;
+
+    return row;
+}
+
+/*********
+* setter *
+*********/
+
+PadNumAry *
+PadNumAry_Set(PadNumAry *self, int32_t index, PadNumVal val) {
+    if (index < 0 || index >= self->shape[0]) {
+        return NULL;
+    }
+    set_at(self, index, 0, val);
+    return self;
+}
+
+PadNumAry *
+PadNumAry_Set2D(PadNumAry *self, int32_t y, int32_t x, PadNumVal val) {
+    if (y < 0 || y >= self->shape[0] || x < 0 || x >= self->shape[1]) {
+        return NULL;
+    }
+    set_at(self, y, x, val);
+    return self;
+}
+
+/*******
+* bulk *
+*******/
+
+PadNumVal
+PadNumAry_Sum(const PadNumAry *self) {
+    PadNumAry *tmp;
+    const PadNumAry *a = prepare(self, self->kind, &tmp);
+    if (!a) {
+        return new_val(self->kind, 0, 0);
+    }
+
+    int32_t n = PadNumAry_Size(a);
+    PadNumVal val = new_val(
+        self->kind,
+        self->kind == PAD_NUM_ARY_KIND__INT ? PadNumKernel_SumInt(ints(a), n) : 0,
+        self->kind == PAD_NUM_ARY_KIND__FLOAT ? PadNumKernel_SumFloat(floats(a), n) : 0
+    );
+
+    PadNumAry_Del(tmp);
+    return val;
+}
+
+static bool
+min_max(const PadNumAry *self, PadNumVal *out, bool is_max) {
+    if (!PadNumAry_Size(self)) {
+        return false;
+    }
+
+    PadNumAry *tmp;
+    const PadNumAry *a = prepare(self, self->kind, &tmp);
+    if (!a) {
+        return false;
+    }
+
+    int32_t n = PadNumAry_Size(a);
+    if (self->kind == PAD_NUM_ARY_KIND__INT) {
+        int64_t m = is_max ? PadNumKernel_MaxInt(ints(a), n) : PadNumKernel_MinInt(ints(a), n);
+        *out = new_val(self->kind, m, 0);
+    } else {
+        double m = is_max ? PadNumKernel_MaxFloat(floats(a), n) : PadNumKernel_MinFloat(floats(a), n);
+        *out = new_val(self->kind, 0, m);
+    }
+
+    PadNumAry_Del(tmp);
+    return true;
+}
+
+bool
+PadNumAry_Min(const PadNumAry *self, PadNumVal *out) {
+    return min_max(self, out, false);
+}
+
+bool
+PadNumAry_Max(const PadNumAry *self, PadNumVal *out) {
+    return min_max(self, out, true);
+}
+
+bool
+PadNumAry_Dot(const PadNumAry *self, const PadNumAry *other, PadNumVal *out) {
+    if (self->ndim != 1 || !PadNumAry_IsSameShape(self, other)) {
+        return false;
+    }
+
+    PadNumAryKind kind = result_kind(self->kind, other->kind);
+    PadNumAry *tmpa, *tmpb;
+    const PadNumAry *a = prepare(self, kind, &tmpa);
+    const PadNumAry *b = prepare(other, kind, &tmpb);
+    bool ok = a && b;
+
+    if (ok) {
+        int32_t n = PadNumAry_Size(a);
+        if (kind == PAD_NUM_ARY_KIND__INT) {
+            *out = new_val(kind, PadNumKernel_DotInt(ints(a), ints(b), n), 0);
+        } else {
+            *out = new_val(kind, 0, PadNumKernel_DotFloat(floats(a), floats(b), n));
+        }
+    }
+
+    PadNumAry_Del(tmpa);
+    PadNumAry_Del(tmpb);
+    return ok;
+}
+
+PadNumAry *
+PadNumAry_MatMul(const PadNumAry *self, const PadNumAry *other) {
+    if (self->ndim != 2 || self->shape[1] != other->shape[0]) {
+        return NULL;
+    }
+
+    // rows of self and rows of transposed other are contiguous, so each
+    // element of result is dot product of those
+    PadNumAryKind kind = result_kind(self->kind, other->kind);
+    PadNumAry *trans = PadNumAry_Transpose(other);
+    PadNumAry *tmpa, *tmpb;
+    const PadNumAry *a = prepare(self, kind, &tmpa);
+    const PadNumAry *b = trans ? prepare(trans, kind, &tmpb) : NULL;
+    PadNumAry *dst = NULL;
+    if (!a || !b) {
+        goto done;
+    }
+
+    int32_t rows = a->shape[0];
+    int32_t k = a->shape[1];
+    int32_t cols = other->ndim == 2 ? other->shape[1] : 1;
+    dst = other->ndim == 2 ? new_ary(kind, 2, rows, cols) : new_ary(kind, 1, rows, 1);
+    if (!dst) {
+        goto done;
+    }
+
+    for (int32_t y = 0; y < rows; y++) {
+        for (int32_t x = 0; x < cols; x++) {
+            int32_t ai = y * k;
+            int32_t bi = x * k;
+            if (kind == PAD_NUM_ARY_KIND__INT) {
+                ints(dst)[y * cols + x] = PadNumKernel_DotInt(ints(a) + ai, ints(b) + bi, k);
+            } else {
+                floats(dst)[y * cols + x] = PadNumKernel_DotFloat(floats(a) + ai, floats(b) + bi, k);
+            }
+        }
+    }
+
+done:
+    PadNumAry_Del(tmpa);
+    if (trans) {
+        PadNumAry_Del(tmpb);
+    }
+    PadNumAry_Del(trans);
+    return dst;
+}
+
+/**
+ * calculate by kernel over contiguous buffers of same kind
+ * step of operand is 0 for scalar
+ */
+static PadNumAry *
+calc(
+    PadNumAryKind kind,
+    int32_t ndim,
+    const int32_t shape[2],
+    PadNumOp op,
+    const void *a,
+    int32_t astep,
+    const void *b,
+    int32_t bstep
+) {
+    int32_t n = shape[0] * shape[1];
+    if (op == PAD_NUM_OP__DIV && kind == PAD_NUM_ARY_KIND__INT &&
+        PadNumKernel_HasZeroInt(b, bstep ? n : 1)) {
+        return NULL;
+    }
+    if (op == PAD_NUM_OP__DIV && kind == PAD_NUM_ARY_KIND__FLOAT &&
+        PadNumKernel_HasZeroFloat(b, bstep ? n : 1)) {
+        return NULL;
+    }
+
+    PadNumAry *dst = new_ary(kind, ndim, shape[0], shape[1]);
+    if (!dst) {
+        return NULL;
+    }
+
+    if (kind == PAD_NUM_ARY_KIND__INT) {
+        PadNumKernel_CalcInt(op, ints(dst), a, astep, b, bstep, n);
+    } else {
+        PadNumKernel_CalcFloat(op, floats(dst), a, astep, b, bstep, n);
+    }
+
+    return dst;
+}
+
+PadNumAry *
+PadNumAry_Calc(const PadNumAry *lhs, PadNumOp op, const PadNumAry *rhs) {
+    if (!lhs || !rhs || !PadNumAry_IsSameShape(lhs, rhs)) {
+        return NULL;
+    }
+
+    PadNumAryKind kind = result_kind(lhs->kind, rhs->kind);
+    PadNumAry *tmpa, *tmpb;
+    const PadNumAry *a = prepare(lhs, kind, &tmpa);
+    const PadNumAry *b = prepare(rhs, kind, &tmpb);
+    PadNumAry *dst = NULL;
+
+    if (a && b) {
+        dst = calc(kind, lhs->ndim, lhs->shape, op, at(a, 0, 0), 1, at(b, 0, 0), 1);
+    }
+
+    PadNumAry_Del(tmpa);
+    PadNumAry_Del(tmpb);
+    return dst;
+}
+
+PadNumAry *
+PadNumAry_CalcScalar(const PadNumAry *self, PadNumOp op, PadNumVal val, bool swap) {
+    if (!self) {
+        return NULL;
+    }
+
+    PadNumAryKind kind = result_kind(self->kind, val.kind);
+    val = convert_val(val, kind);
+    const void *s = kind == PAD_NUM_ARY_KIND__INT ? (const void *) &val.ivalue : (const void *) &val.fvalue;
+    PadNumAry *tmp;
+    const PadNumAry *a = prepare(self, kind, &tmp);
+    PadNumAry *dst = NULL;
+
+    if (a) {
+        if (swap) {
+            dst = calc(kind, self->ndim, self->shape, op, s, 0, at(a, 0, 0), 1);
+        } else {
+            dst = calc(kind, self->ndim, self->shape, op, at(a, 0, 0), 1, s, 0);
+        }
+    }
+
+    PadNumAry_Del(tmp);
+    return dst;
+}
+
+PadNumAry *
+PadNumAry_Transpose(const PadNumAry *self) {
+    if (!self) {
+        return NULL;
+    }
+
+    PadNumAry *trans = new_view(self);
+    if (!trans || self->ndim != 2) {
+        return trans;
+    }
+
+    trans->shape[0] = self->shape[1];
+    trans->shape[1] = self->shape[0];
+    trans->strides[0] = self->strides[1];
+    trans->strides[1] = self->strides[0];
+
+    return trans;
+}
+
+PadNumAry *
+PadNumAry_Rotate(const PadNumAry *self, int32_t n) {
+    if (!self || self->ndim != 2) {
+        return NULL;
+    }
+
+    n = ((n % 4) + 4) % 4;
+    int32_t rows = self->shape[0];
+    int32_t cols = self->shape[1];
+    PadNumAry *dst = n % 2 ?
+        new_ary(self->kind, 2, cols, rows) :
+        new_ary(self->kind, 2, rows, cols);
+    if (!dst) {
+        return NULL;
+    }
+
+    for (int32_t y = 0; y < dst->shape[0]; y++) {
+        for (int32_t x = 0; x < dst->shape[1]; x++) {
+            const char *src;
+            switch (n) {
+            default: src = at(self, y, x); break;
+            case 1: src = at(self, rows - 1 - x, y); break;
+            case 2: src = at(self, rows - 1 - y, cols - 1 - x); break;
+            case 3: src = at(self, x, cols - 1 - y); break;
+            }
+            memcpy(at(dst, y, x), src, ELEM_SIZE);
+        }
+    }
+
+    return dst;
+}
@@ -0,0 +1,360 @@
+/**
+ * Typed numeric array
+ *
+ * elements are int64_t or double in one contiguous buffer without boxing.
+ * the array has 1 or 2 dimensions and elements are addressed by shape and
+ * stride, so rows and transposed arrays are views that share the buffer
+ * bulk operations run on kernels (see num_kernel.h)
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <pad/lib/memory.h>
+#include <pad/lib/num_kernel.h>
+
+typedef enum {
+    PAD_NUM_ARY_KIND__INT,  // elements are int64_t
+    PAD_NUM_ARY_KIND__FLOAT,  // elements are double
+} PadNumAryKind;
+
+/**
+ * value of element
+ */
+typedef struct {
+    PadNumAryKind kind;
+    union {
+        int64_t ivalue;  // value if kind is int
+        double fvalue;  // value if kind is float
+    };
+} PadNumVal;
+
+struct PadNumAry;
+typedef struct PadNumAry PadNumAry;
+
+/*****************
+* delete and new *
+*****************/
+
+/**
+ * destruct array. buffer is freed when last view is destructed
+ *
+ * @param[in] *self
+ */
+void
+PadNumAry_Del(PadNumAry *self);
+
+/**
+ * construct 1-D array of zeros
+ *
+ * @param[in] kind kind of elements
+ * @param[in] len  number of elements
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_New(PadNumAryKind kind, int32_t len);
+
+/**
+ * construct 2-D array of zeros
+ *
+ * @param[in] kind kind of elements
+ * @param[in] rows number of rows
+ * @param[in] cols number of columns
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_New2D(PadNumAryKind kind, int32_t rows, int32_t cols);
+
+/**
+ * deep copy. the copy has own contiguous buffer
+ *
+ * @param[in] *other
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_DeepCopy(const PadNumAry *other);
+
+/**
+ * shallow copy. the copy is view of same buffer
+ *
+ * @param[in] *other
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_ShallowCopy(const PadNumAry *other);
+
+/**
+ * copy with conversion of kind of elements
+ *
+ * @param[in] *other
+ * @param[in] kind   kind of elements of copy
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_ToKind(const PadNumAry *other, PadNumAryKind kind);
+
+/*********
+* getter *
+*********/
+
+/**
+ * get kind of elements
+ *
+ * @param[in] *self
+ *
+ * @return kind
+ */
+PadNumAryKind
+PadNumAry_GetKind(const PadNumAry *self);
+
+/**
+ * get number of dimensions
+ *
+ * @param[in] *self
+ *
+ * @return 1 or 2
+ */
+int32_t
+PadNumAry_GetNDim(const PadNumAry *self);
+
+/**
+ * get length of first dimension (number of elements or number of rows)
+ *
+ * @param[in] *self
+ *
+ * @return number of length
+ */
+int32_t
+PadNumAry_Len(const PadNumAry *self);
+
+/**
+ * get number of columns of 2-D array
+ *
+ * @param[in] *self
+ *
+ * @return number of columns (0 if 1-D array)
+ */
+int32_t
+PadNumAry_Cols(const PadNumAry *self);
+
+/**
+ * get number of all elements
+ *
+ * @param[in] *self
+ *
+ * @return number of elements
+ */
+int32_t
+PadNumAry_Size(const PadNumAry *self);
+
+/**
+ * compare shapes of arrays
+ *
+ * @param[in] *self
+ * @param[in] *other
+ *
+ * @return same to true
+ * @return not same to false
+ */
+bool
+PadNumAry_IsSameShape(const PadNumAry *self, const PadNumAry *other);
+
+/**
+ * get element of 1-D array
+ *
+ * @param[in] *self
+ * @param[in] index number of index (0 <= index < len)
+ *
+ * @return value of element
+ */
+PadNumVal
+PadNumAry_Get(const PadNumAry *self, int32_t index);
+
+/**
+ * get element of 2-D array
+ *
+ * @param[in] *self
+ * @param[in] y     number of row
+ * @param[in] x     number of column
+ *
+ * @return value of element
+ */
+PadNumVal
+PadNumAry_Get2D(const PadNumAry *self, int32_t y, int32_t x);
+
+/**
+ * get row of 2-D array. the row is 1-D view of same buffer
+ *
+ * @param[in] *self
+ * @param[in] y     number of row (0 <= y < len)
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_Row(const PadNumAry *self, int32_t y);
+
+/*********
+* setter *
+*********/
+
+/**
+ * set element of 1-D array. the value is converted to kind of array
+ *
+ * @param[in] *self
+ * @param[in] index number of index (0 <= index < len)
+ * @param[in] val   value
+ *
+ * @return success to self
+ * @return out of range to NULL
+ */
+PadNumAry *
+PadNumAry_Set(PadNumAry *self, int32_t index, PadNumVal val);
+
+/**
+ * set element of 2-D array. the value is converted to kind of array
+ *
+ * @param[in] *self
+ * @param[in] y     number of row
+ * @param[in] x     number of column
+ * @param[in] val   value
+ *
+ * @return success to self
+ * @return out of range to NULL
+ */
+PadNumAry *
+PadNumAry_Set2D(PadNumAry *self, int32_t y, int32_t x, PadNumVal val);
+
+/*******
+* bulk *
+*******/
+
+/**
+ * get sum of elements
+ *
+ * @param[in] *self
+ *
+ * @return sum (kind of array)
+ */
+PadNumVal
+PadNumAry_Sum(const PadNumAry *self);
+
+/**
+ * get minimum of elements
+ *
+ * @param[in]  *self
+ * @param[out] *out  minimum
+ *
+ * @return success to true
+ * @return empty to false
+ */
+bool
+PadNumAry_Min(const PadNumAry *self, PadNumVal *out);
+
+/**
+ * get maximum of elements
+ *
+ * @param[in]  *self
+ * @param[out] *out  maximum
+ *
+ * @return success to true
+ * @return empty to false
+ */
+bool
+PadNumAry_Max(const PadNumAry *self, PadNumVal *out);
+
+/**
+ * get dot product of 1-D arrays of same length
+ * the result is float if one of arrays is float
+ *
+ * @param[in]  *self
+ * @param[in]  *other
+ * @param[out] *out   dot product
+ *
+ * @return success to true
+ * @return not same shape to false
+ */
+bool
+PadNumAry_Dot(const PadNumAry *self, const PadNumAry *other, PadNumVal *out);
+
+/**
+ * matrix product of 2-D array and 2-D array (or 1-D array as column)
+ * columns of self and length of other must be same
+ *
+ * @param[in] *self
+ * @param[in] *other
+ *
+ * @return success to pointer to PadNumAry (2-D, or 1-D if other is 1-D)
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_MatMul(const PadNumAry *self, const PadNumAry *other);
+
+/**
+ * elementwise operation of arrays of same shape
+ * the result is float if one of arrays is float
+ *
+ * @param[in] *lhs
+ * @param[in] op   number of operator
+ * @param[in] *rhs
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL (not same shape or division by zero)
+ */
+PadNumAry *
+PadNumAry_Calc(const PadNumAry *lhs, PadNumOp op, const PadNumAry *rhs);
+
+/**
+ * elementwise operation of array and scalar
+ * the result is float if array or scalar is float
+ *
+ * @param[in] *self
+ * @param[in] op    number of operator
+ * @param[in] val   scalar
+ * @param[in] swap  if true then scalar is left hand operand
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL (division by zero)
+ */
+PadNumAry *
+PadNumAry_CalcScalar(const PadNumAry *self, PadNumOp op, PadNumVal val, bool swap);
+
+/**
+ * transpose of 2-D array. the result is view of same buffer
+ * transpose of 1-D array is view of itself
+ *
+ * @param[in] *self
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL
+ */
+PadNumAry *
+PadNumAry_Transpose(const PadNumAry *self);
+
+/**
+ * rotate 2-D array by quarter turns. the result has own buffer
+ *
+ * @param[in] *self
+ * @param[in] n     number of quarter turns clockwise (negative is counter clockwise)
+ *
+ * @return success to pointer to PadNumAry
+ * @return failed to NULL (1-D array)
+ */
+PadNumAry *
+PadNumAry_Rotate(const PadNumAry *self, int32_t n);
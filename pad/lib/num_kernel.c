@@ -0,0 +1,680 @@
+#include <pad/lib/num_kernel.h>
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define PAD_NUM_KERNEL__X86 1
+# include <immintrin.h>
+#else
+# undef PAD_NUM_KERNEL__X86
+#endif
+
+typedef void (*calc_int_t)(
+    int64_t *dst,
+    const int64_t *a,
+    int32_t astep,
+    const int64_t *b,
+    int32_t bstep,
+    int32_t n
+);
+
+typedef void (*calc_float_t)(
+    double *dst,
+    const double *a,
+    int32_t astep,
+    const double *b,
+    int32_t bstep,
+    int32_t n
+);
+
+/**
+ * table of kernels for each level
+ * calc kernels are indexed by PadNumOp
+ */
+typedef struct {
+    calc_int_t calc_int[PAD_NUM_OP__NOPS];
+    calc_float_t calc_float[PAD_NUM_OP__NOPS];
+    int64_t (*sum_int)(const int64_t *s, int32_t n);
+    double (*sum_float)(const double *s, int32_t n);
+    int64_t (*min_int)(const int64_t *s, int32_t n);
+    int64_t (*max_int)(const int64_t *s, int32_t n);
+    double (*min_float)(const double *s, int32_t n);
+    double (*max_float)(const double *s, int32_t n);
+    int64_t (*dot_int)(const int64_t *a, const int64_t *b, int32_t n);
+    double (*dot_float)(const double *a, const double *b, int32_t n);
+} kernels_t;
+
+/*********
+* scalar *
+*********/
+
+// integers wrap around on overflow like SIMD lanes
+
+#define DEF_SCALAR_CALC_INT(name, OP) \
+    static void \
+    name(int64_t *dst, const int64_t *a, int32_t astep, const int64_t *b, int32_t bstep, int32_t n) { \
+        for (int32_t i = 0; i < n; i++) { \
+            dst[i] = (int64_t) ((uint64_t) a[i * astep] OP (uint64_t) b[i * bstep]); \
+        } \
+    }
+
+#define DEF_SCALAR_CALC_FLOAT(name, OP) \
+    static void \
+    name(double *dst, const double *a, int32_t astep, const double *b, int32_t bstep, int32_t n) { \
+        for (int32_t i = 0; i < n; i++) { \
+            dst[i] = a[i * astep] OP b[i * bstep]; \
+        } \
+    }
+
+DEF_SCALAR_CALC_INT(scalar_add_int, +)
+DEF_SCALAR_CALC_INT(scalar_sub_int, -)
+DEF_SCALAR_CALC_INT(scalar_mul_int, *)
+DEF_SCALAR_CALC_FLOAT(scalar_add_float, +)
+DEF_SCALAR_CALC_FLOAT(scalar_sub_float, -)
+DEF_SCALAR_CALC_FLOAT(scalar_mul_float, *)
+DEF_SCALAR_CALC_FLOAT(scalar_div_float, /)
+
+static void
+scalar_div_int(int64_t *dst, const int64_t *a, int32_t astep, const int64_t *b, int32_t bstep, int32_t n) {
+    for (int32_t i = 0; i < n; i++) {
+        int64_t x = a[i * astep];
+        int64_t y = b[i * bstep];
+        // INT64_MIN / -1 traps on x86
+        dst[i] = y == -1 ? (int64_t) (0 - (uint64_t) x) : x / y;
+    }
+}
+
+static int64_t
+scalar_sum_int(const int64_t *s, int32_t n) {
+    uint64_t sum = 0;
+    for (int32_t i = 0; i < n; i++) {
+        sum += (uint64_t) s[i];
+    }
+    return (int64_t) sum;
+}
+
+static double
+scalar_sum_float(const double *s, int32_t n) {
+    double sum = 0;
+    for (int32_t i = 0; i < n; i++) {
+        sum += s[i];
+    }
+    return sum;
+}
+
+static int64_t
+scalar_min_int(const int64_t *s, int32_t n) {
+    int64_t m = s[0];
+    for (int32_t i = 1; i < n; i++) {
+        m = s[i] < m ? s[i] : m;
+    }
+    return m;
+}
+
+static int64_t
+scalar_max_int(const int64_t *s, int32_t n) {
+    int64_t m = s[0];
+    for (int32_t i = 1; i < n; i++) {
+        m = s[i] > m ? s[i] : m;
+    }
+    return m;
+}
+
+static double
+scalar_min_float(const double *s, int32_t n) {
+    double m = s[0];
+    for (int32_t i = 1; i < n; i++) {
+        m = s[i] < m ? s[i] : m;
+    }
+    return m;
+}
+
+static double
+scalar_max_float(const double *s, int32_t n) {
+    double m = s[0];
+    for (int32_t i = 1; i < n; i++) {
+        m = s[i] > m ? s[i] : m;
+    }
+    return m;
+}
+
+static int64_t
+scalar_dot_int(const int64_t *a, const int64_t *b, int32_t n) {
+    uint64_t sum = 0;
+    for (int32_t i = 0; i < n; i++) {
+        sum += (uint64_t) a[i] * (uint64_t) b[i];
+    }
+    return (int64_t) sum;
+}
+
+static double
+scalar_dot_float(const double *a, const double *b, int32_t n) {
+    double sum = 0;
+    for (int32_t i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+static const kernels_t
+scalar_kernels = {
+    {scalar_add_int, scalar_sub_int, scalar_mul_int, scalar_div_int},
+    {scalar_add_float, scalar_sub_float, scalar_mul_float, scalar_div_float},
+    scalar_sum_int,
+    scalar_sum_float,
+    scalar_min_int,
+    scalar_max_int,
+    scalar_min_float,
+    scalar_max_float,
+    scalar_dot_int,
+    scalar_dot_float,
+};
+
+#if defined(PAD_NUM_KERNEL__X86)
+
+/*******
+* sse2 *
+*******/
+
+// SSE2 and AVX2 have no multiplication and division of 64 bit integers
+// those are scalar loops in all levels
+
+#define DEF_SSE2_CALC_INT(name, INTRIN, scalar) \
+    __attribute__((target("sse2"))) \
+    static void \
+    name(int64_t *dst, const int64_t *a, int32_t astep, const int64_t *b, int32_t bstep, int32_t n) { \
+        __m128i va = _mm_set1_epi64x(a[0]); \
+        __m128i vb = _mm_set1_epi64x(b[0]); \
+        int32_t i = 0; \
+        for (; i + 2 <= n; i += 2) { \
+            __m128i x = astep ? _mm_loadu_si128((const __m128i *) (a + i)) : va; \
+            __m128i y = bstep ? _mm_loadu_si128((const __m128i *) (b + i)) : vb; \
+            _mm_storeu_si128((__m128i *) (dst + i), INTRIN(x, y)); \
+        } \
+        scalar(dst + i, a + i * astep, astep, b + i * bstep, bstep, n - i); \
+    }
+
+#define DEF_SSE2_CALC_FLOAT(name, INTRIN, scalar) \
+    __attribute__((target("sse2"))) \
+    static void \
+    name(double *dst, const double *a, int32_t astep, const double *b, int32_t bstep, int32_t n) { \
+        __m128d va = _mm_set1_pd(a[0]); \
+        __m128d vb = _mm_set1_pd(b[0]); \
+        int32_t i = 0; \
+        for (; i + 2 <= n; i += 2) { \
+            __m128d x = astep ? _mm_loadu_pd(a + i) : va; \
+            __m128d y = bstep ? _mm_loadu_pd(b + i) : vb; \
+            _mm_storeu_pd(dst + i, INTRIN(x, y)); \
+        } \
+        scalar(dst + i, a + i * astep, astep, b + i * bstep, bstep, n - i); \
+    }
+
+DEF_SSE2_CALC_INT(sse2_add_int, _mm_add_epi64, scalar_add_int)
+DEF_SSE2_CALC_INT(sse2_sub_int, _mm_sub_epi64, scalar_sub_int)
+DEF_SSE2_CALC_FLOAT(sse2_add_float, _mm_add_pd, scalar_add_float)
+DEF_SSE2_CALC_FLOAT(sse2_sub_float, _mm_sub_pd, scalar_sub_float)
+DEF_SSE2_CALC_FLOAT(sse2_mul_float, _mm_mul_pd, scalar_mul_float)
+DEF_SSE2_CALC_FLOAT(sse2_div_float, _mm_div_pd, scalar_div_float)
+
+__attribute__((target("sse2")))
+static int64_t
+sse2_sum_int(const int64_t *s, int32_t n) {
+    __m128i acc = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        acc = _mm_add_epi64(acc, _mm_loadu_si128((const __m128i *) (s + i)));
+    }
+    int64_t t[2];
+    _mm_storeu_si128((__m128i *) t, acc);
+    uint64_t sum = (uint64_t) t[0] + (uint64_t) t[1];
+    return (int64_t) (sum + (uint64_t) scalar_sum_int(s + i, n - i));
+}
+
+__attribute__((target("sse2")))
+static double
+sse2_sum_float(const double *s, int32_t n) {
+    // two accumulators hide latency of addition
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    int32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_pd(acc0, _mm_loadu_pd(s + i));
+        acc1 = _mm_add_pd(acc1, _mm_loadu_pd(s + i + 2));
+    }
+    double t[2];
+    _mm_storeu_pd(t, _mm_add_pd(acc0, acc1));
+    return t[0] + t[1] + scalar_sum_float(s + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static double
+sse2_min_float(const double *s, int32_t n) {
+    if (n < 2) {
+        return scalar_min_float(s, n);
+    }
+    __m128d m = _mm_loadu_pd(s);
+    int32_t i = 2;
+    for (; i + 2 <= n; i += 2) {
+        m = _mm_min_pd(m, _mm_loadu_pd(s + i));
+    }
+    double t[2];
+    _mm_storeu_pd(t, m);
+    double r = t[0] < t[1] ? t[0] : t[1];
+    for (; i < n; i++) {
+        r = s[i] < r ? s[i] : r;
+    }
+    return r;
+}
+
+__attribute__((target("sse2")))
+static double
+sse2_max_float(const double *s, int32_t n) {
+    if (n < 2) {
+        return scalar_max_float(s, n);
+    }
+    __m128d m = _mm_loadu_pd(s);
+    int32_t i = 2;
+    for (; i + 2 <= n; i += 2) {
+        m = _mm_max_pd(m, _mm_loadu_pd(s + i));
+    }
+    double t[2];
+    _mm_storeu_pd(t, m);
+    double r = t[0] > t[1] ? t[0] : t[1];
+    for (; i < n; i++) {
+        r = s[i] > r ? s[i] : r;
+    }
+    return r;
+}
+
+__attribute__((target("sse2")))
+static double
+sse2_dot_float(const double *a, const double *b, int32_t n) {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    int32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    double t[2];
+    _mm_storeu_pd(t, _mm_add_pd(acc0, acc1));
+    return t[0] + t[1] + scalar_dot_float(a + i, b + i, n - i);
+}
+
+static const kernels_t
+sse2_kernels = {
+    {sse2_add_int, sse2_sub_int, scalar_mul_int, scalar_div_int},
+    {sse2_add_float, sse2_sub_float, sse2_mul_float, sse2_div_float},
+    sse2_sum_int,
+    sse2_sum_float,
+    scalar_min_int,  // SSE2 has no comparison of 64 bit integers
+    scalar_max_int,
+    sse2_min_float,
+    sse2_max_float,
+    scalar_dot_int,
+    sse2_dot_float,
+};
+
+/*******
+* avx2 *
+*******/
+
+#define DEF_AVX2_CALC_INT(name, INTRIN, scalar) \
+    __attribute__((target("avx2"))) \
+    static void \
+    name(int64_t *dst, const int64_t *a, int32_t astep, const int64_t *b, int32_t bstep, int32_t n) { \
+        __m256i va = _mm256_set1_epi64x(a[0]); \
+        __m256i vb = _mm256_set1_epi64x(b[0]); \
+        int32_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            __m256i x = astep ? _mm256_loadu_si256((const __m256i *) (a + i)) : va; \
+            __m256i y = bstep ? _mm256_loadu_si256((const __m256i *) (b + i)) : vb; \
+            _mm256_storeu_si256((__m256i *) (dst + i), INTRIN(x, y)); \
+        } \
+        scalar(dst + i, a + i * astep, astep, b + i * bstep, bstep, n - i); \
+    }
+
+#define DEF_AVX2_CALC_FLOAT(name, INTRIN, scalar) \
+    __attribute__((target("avx2"))) \
+    static void \
+    name(double *dst, const double *a, int32_t astep, const double *b, int32_t bstep, int32_t n) { \
+        __m256d va = _mm256_set1_pd(a[0]); \
+        __m256d vb = _mm256_set1_pd(b[0]); \
+        int32_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            __m256d x = astep ? _mm256_loadu_pd(a + i) : va; \
+            __m256d y = bstep ? _mm256_loadu_pd(b + i) : vb; \
+            _mm256_storeu_pd(dst + i, INTRIN(x, y)); \
+        } \
+        scalar(dst + i, a + i * astep, astep, b + i * bstep, bstep, n - i); \
+    }
+
+DEF_AVX2_CALC_INT(avx2_add_int, _mm256_add_epi64, scalar_add_int)
+DEF_AVX2_CALC_INT(avx2_sub_int, _mm256_sub_epi64, scalar_sub_int)
+DEF_AVX2_CALC_FLOAT(avx2_add_float, _mm256_add_pd, scalar_add_float)
+DEF_AVX2_CALC_FLOAT(avx2_sub_float, _mm256_sub_pd, scalar_sub_float)
+DEF_AVX2_CALC_FLOAT(avx2_mul_float, _mm256_mul_pd, scalar_mul_float)
+DEF_AVX2_CALC_FLOAT(avx2_div_float, _mm256_div_pd, scalar_div_float)
+
+__attribute__((target("avx2")))
+static int64_t
+avx2_sum_int(const int64_t *s, int32_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i *) (s + i)));
+    }
+    int64_t t[4];
+    _mm256_storeu_si256((__m256i *) t, acc);
+    uint64_t sum = (uint64_t) t[0] + (uint64_t) t[1] + (uint64_t) t[2] + (uint64_t) t[3];
+    return (int64_t) (sum + (uint64_t) scalar_sum_int(s + i, n - i));
+}
+
+__attribute__((target("avx2")))
+static double
+avx2_sum_float(const double *s, int32_t n) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    int32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(s + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(s + i + 4));
+    }
+    double t[4];
+    _mm256_storeu_pd(t, _mm256_add_pd(acc0, acc1));
+    return t[0] + t[1] + t[2] + t[3] + scalar_sum_float(s + i, n - i);
+}
+
+/**
+ * minimum (or maximum) of integers by comparison and blend
+ * CMPGT(x, y) is true if y should replace x. two accumulators hide latency
+ */
+#define DEF_AVX2_MIN_MAX_INT(name, CMPGT, scalar) \
+    __attribute__((target("avx2"))) \
+    static int64_t \
+    name(const int64_t *s, int32_t n) { \
+        if (n < 8) { \
+            return scalar(s, n); \
+        } \
+        __m256i m0 = _mm256_loadu_si256((const __m256i *) s); \
+        __m256i m1 = _mm256_loadu_si256((const __m256i *) (s + 4)); \
+        int32_t i = 8; \
+        for (; i + 8 <= n; i += 8) { \
+            __m256i v0 = _mm256_loadu_si256((const __m256i *) (s + i)); \
+            __m256i v1 = _mm256_loadu_si256((const __m256i *) (s + i + 4)); \
+            m0 = _mm256_blendv_epi8(m0, v0, CMPGT(m0, v0)); \
+            m1 = _mm256_blendv_epi8(m1, v1, CMPGT(m1, v1)); \
+        } \
+        m0 = _mm256_blendv_epi8(m0, m1, CMPGT(m0, m1)); \
+        int64_t t[4 + 8]; \
+        _mm256_storeu_si256((__m256i *) t, m0); \
+        int32_t rest = n - i; \
+        memcpy(t + 4, s + i, rest * sizeof(int64_t)); \
+        return scalar(t, 4 + rest); \
+    }
+
+#define AVX2_MIN_GT(x, y) _mm256_cmpgt_epi64(x, y)
+#define AVX2_MAX_GT(x, y) _mm256_cmpgt_epi64(y, x)
+
+DEF_AVX2_MIN_MAX_INT(avx2_min_int, AVX2_MIN_GT, scalar_min_int)
+DEF_AVX2_MIN_MAX_INT(avx2_max_int, AVX2_MAX_GT, scalar_max_int)
+
+__attribute__((target("avx2")))
+static double
+avx2_min_float(const double *s, int32_t n) {
+    if (n < 4) {
+        return scalar_min_float(s, n);
+    }
+    __m256d m = _mm256_loadu_pd(s);
+    int32_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        m = _mm256_min_pd(m, _mm256_loadu_pd(s + i));
+    }
+    double t[4];
+    _mm256_storeu_pd(t, m);
+    double r = scalar_min_float(t, 4);
+    for (; i < n; i++) {
+        r = s[i] < r ? s[i] : r;
+    }
+    return r;
+}
+
+__attribute__((target("avx2")))
+static double
+avx2_max_float(const double *s, int32_t n) {
+    if (n < 4) {
+        return scalar_max_float(s, n);
+    }
+    __m256d m = _mm256_loadu_pd(s);
+    int32_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        m = _mm256_max_pd(m, _mm256_loadu_pd(s + i));
+    }
+    double t[4];
+    _mm256_storeu_pd(t, m);
+    double r = scalar_max_float(t, 4);
+    for (; i < n; i++) {
+        r = s[i] > r ? s[i] : r;
+    }
+    return r;
+}
+
+__attribute__((target("avx2")))
+static double
+avx2_dot_float(const double *a, const double *b, int32_t n) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    int32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+    }
+    double t[4];
+    _mm256_storeu_pd(t, _mm256_add_pd(acc0, acc1));
+    return t[0] + t[1] + t[2] + t[3] + scalar_dot_float(a + i, b + i, n - i);
+}
+
+static const kernels_t
+avx2_kernels = {
+    {avx2_add_int, avx2_sub_int, scalar_mul_int, scalar_div_int},
+    {avx2_add_float, avx2_sub_float, avx2_mul_float, avx2_div_float},
+    avx2_sum_int,
+    avx2_sum_float,
+    avx2_min_int,
+    avx2_max_int,
+    avx2_min_float,
+    avx2_max_float,
+    scalar_dot_int,
+    avx2_dot_float,
+};
+
+#endif  // PAD_NUM_KERNEL__X86
+
+/***********
+* dispatch *
+***********/
+
+static const kernels_t *kernels;  // selected kernels. NULL until first use
+static PadNumKernelLevel kernels_level;
+
+PadNumKernelLevel
+PadNumKernel_GetMaxLevel(void) {
+#if defined(PAD_NUM_KERNEL__X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return PAD_NUM_KERNEL__AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return PAD_NUM_KERNEL__SSE2;
+    }
+#endif
+    return PAD_NUM_KERNEL__SCALAR;
+}
+
+PadNumKernelLevel
+PadNumKernel_SetLevel(PadNumKernelLevel level) {
+    PadNumKernelLevel max = PadNumKernel_GetMaxLevel();
+    if (level > max) {
+        level = max;
+    }
+
+    switch (level) {
+    default:
+        kernels = &scalar_kernels;
+        level = PAD_NUM_KERNEL__SCALAR;
+        break;
+#if defined(PAD_NUM_KERNEL__X86)
+    case PAD_NUM_KERNEL__SSE2:
+        kernels = &sse2_kernels;
+        break;
+    case PAD_NUM_KERNEL__AVX2:
+        kernels = &avx2_kernels;
+        break;
+#endif
+    }
+
+    kernels_level = level;
+    return level;
+}
+
+PadNumKernelLevel
+PadNumKernel_GetLevel(void) {
+    if (!kernels) {
+        PadNumKernel_SetLevel(PadNumKernel_GetMaxLevel());
+    }
+    return kernels_level;
+}
+
+const char *
+PadNumKernel_GetLevelName(PadNumKernelLevel level) {
+    switch (level) {
+    case PAD_NUM_KERNEL__SCALAR: return "scalar"; break;
+    case PAD_NUM_KERNEL__SSE2: return "sse2"; break;
+    case PAD_NUM_KERNEL__AVX2: return "avx2"; break;
+    }
+    return "unknown";
+}
+
+static inline const kernels_t *
+get_kernels(void) {
+    if (!kernels) {
+        PadNumKernel_GetLevel();
+    }
+    return kernels;
+}
+
+void
+PadNumKernel_CalcInt(
+    PadNumOp op,
+    int64_t *dst,
+    const int64_t *a,
+    int32_t astep,
+    const int64_t *b,
+    int32_t bstep,
+    int32_t n
+) {
+    if (!dst || !a || !b || n <= 0 || (unsigned) op >= PAD_NUM_OP__NOPS) {
+        return;
+    }
+    get_kernels()->calc_int[op](dst, a, astep != 0, b, bstep != 0, n);
+}
+
+void
+PadNumKernel_CalcFloat(
+    PadNumOp op,
+    double *dst,
+    const double *a,
+    int32_t astep,
+    const double *b,
+    int32_t bstep,
+    int32_t n
+) {
+    if (!dst || !a || !b || n <= 0 || (unsigned) op >= PAD_NUM_OP__NOPS) {
+        return;
+    }
+    get_kernels()->calc_float[op](dst, a, astep != 0, b, bstep != 0, n);
+}
+
+int64_t
+PadNumKernel_SumInt(const int64_t *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->sum_int(s, n);
+}
+
+double
+PadNumKernel_SumFloat(const double *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->sum_float(s, n);
+}
+
+int64_t
+PadNumKernel_MinInt(const int64_t *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->min_int(s, n);
+}
+
+int64_t
+PadNumKernel_MaxInt(const int64_t *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->max_int(s, n);
+}
+
+double
+PadNumKernel_MinFloat(const double *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->min_float(s, n);
+}
+
+double
+PadNumKernel_MaxFloat(const double *s, int32_t n) {
+    if (!s || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->max_float(s, n);
+}
+
+int64_t
+PadNumKernel_DotInt(const int64_t *a, const int64_t *b, int32_t n) {
+    if (!a || !b || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->dot_int(a, b, n);
+}
+
+double
+PadNumKernel_DotFloat(const double *a, const double *b, int32_t n) {
+    if (!a || !b || n <= 0) {
+        return 0;
+    }
+    return get_kernels()->dot_float(a, b, n);
+}
+
+bool
+PadNumKernel_HasZeroInt(const int64_t *s, int32_t n) {
+    for (int32_t i = 0; s && i < n; i++) {
+        if (!s[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+PadNumKernel_HasZeroFloat(const double *s, int32_t n) {
+    for (int32_t i = 0; s && i < n; i++) {
+        if (s[i] == 0) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,230 @@
+/**
+ * Kernels of numeric arrays
+ *
+ * elementwise arithmetic and reductions over contiguous buffers of int64_t
+ * and double. the kernels use SSE2 or AVX2 if CPU supports it (selected at
+ * runtime) otherwise scalar loops are used
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    PAD_NUM_KERNEL__SCALAR,
+    PAD_NUM_KERNEL__SSE2,
+    PAD_NUM_KERNEL__AVX2,
+} PadNumKernelLevel;
+
+typedef enum {
+    PAD_NUM_OP__ADD,
+    PAD_NUM_OP__SUB,
+    PAD_NUM_OP__MUL,
+    PAD_NUM_OP__DIV,
+    PAD_NUM_OP__NOPS,  // number of operators
+} PadNumOp;
+
+/**
+ * get level of kernels in use
+ * the level is detected by CPU at first call
+ *
+ * @return number of level
+ */
+PadNumKernelLevel
+PadNumKernel_GetLevel(void);
+
+/**
+ * get best level of kernels on this CPU
+ *
+ * @return number of level
+ */
+PadNumKernelLevel
+PadNumKernel_GetMaxLevel(void);
+
+/**
+ * set level of kernels. for tests and benchmarks
+ * if CPU does not support level then best supported level is used
+ *
+ * @param[in] level number of level
+ *
+ * @return number of level in use
+ */
+PadNumKernelLevel
+PadNumKernel_SetLevel(PadNumKernelLevel level);
+
+/**
+ * get name of level
+ *
+ * @param[in] level number of level
+ *
+ * @return pointer to strings ("scalar", "sse2" or "avx2")
+ */
+const char *
+PadNumKernel_GetLevelName(PadNumKernelLevel level);
+
+/**
+ * calculate dst[i] = a[i] op b[i] over integers
+ * step of operand is 1 for buffer or 0 for broadcast of a[0] (or b[0])
+ * integer division by zero is not checked. caller checks it
+ *
+ * @param[in]  op    number of operator
+ * @param[out] *dst  pointer to destination (needs n elements)
+ * @param[in]  *a    pointer to left hand operand
+ * @param[in]  astep step of left hand operand (0 or 1)
+ * @param[in]  *b    pointer to right hand operand
+ * @param[in]  bstep step of right hand operand (0 or 1)
+ * @param[in]  n     number of elements
+ */
+void
+PadNumKernel_CalcInt(
+    PadNumOp op,
+    int64_t *dst,
+    const int64_t *a,
+    int32_t astep,
+    const int64_t *b,
+    int32_t bstep,
+    int32_t n
+);
+
+/**
+ * calculate dst[i] = a[i] op b[i] over floats
+ * step of operand is 1 for buffer or 0 for broadcast of a[0] (or b[0])
+ *
+ * @param[in]  op    number of operator
+ * @param[out] *dst  pointer to destination (needs n elements)
+ * @param[in]  *a    pointer to left hand operand
+ * @param[in]  astep step of left hand operand (0 or 1)
+ * @param[in]  *b    pointer to right hand operand
+ * @param[in]  bstep step of right hand operand (0 or 1)
+ * @param[in]  n     number of elements
+ */
+void
+PadNumKernel_CalcFloat(
+    PadNumOp op,
+    double *dst,
+    const double *a,
+    int32_t astep,
+    const double *b,
+    int32_t bstep,
+    int32_t n
+);
+
+/**
+ * get sum of integers
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return sum (0 if empty)
+ */
+int64_t
+PadNumKernel_SumInt(const int64_t *s, int32_t n);
+
+/**
+ * get sum of floats
+ * order of additions depends on level
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return sum (0 if empty)
+ */
+double
+PadNumKernel_SumFloat(const double *s, int32_t n);
+
+/**
+ * get minimum of integers
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements (greater than 0)
+ *
+ * @return minimum
+ */
+int64_t
+PadNumKernel_MinInt(const int64_t *s, int32_t n);
+
+/**
+ * get maximum of integers
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements (greater than 0)
+ *
+ * @return maximum
+ */
+int64_t
+PadNumKernel_MaxInt(const int64_t *s, int32_t n);
+
+/**
+ * get minimum of floats
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements (greater than 0)
+ *
+ * @return minimum
+ */
+double
+PadNumKernel_MinFloat(const double *s, int32_t n);
+
+/**
+ * get maximum of floats
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements (greater than 0)
+ *
+ * @return maximum
+ */
+double
+PadNumKernel_MaxFloat(const double *s, int32_t n);
+
+/**
+ * get dot product of integers
+ *
+ * @param[in] *a pointer to buffer
+ * @param[in] *b pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return sum of a[i] * b[i]
+ */
+int64_t
+PadNumKernel_DotInt(const int64_t *a, const int64_t *b, int32_t n);
+
+/**
+ * get dot product of floats
+ * order of additions depends on level
+ *
+ * @param[in] *a pointer to buffer
+ * @param[in] *b pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return sum of a[i] * b[i]
+ */
+double
+PadNumKernel_DotFloat(const double *a, const double *b, int32_t n);
+
+/**
+ * find zero in integers
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return found to true
+ * @return not found to false
+ */
+bool
+PadNumKernel_HasZeroInt(const int64_t *s, int32_t n);
+
+/**
+ * find zero in floats
+ *
+ * @param[in] *s pointer to buffer
+ * @param[in] n  number of elements
+ *
+ * @return found to true
+ * @return not found to false
+ */
+bool
+PadNumKernel_HasZeroFloat(const double *s, int32_t n);
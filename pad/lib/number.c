@@ -0,0 +1,404 @@
+#include <pad/lib/number.h>
+
+static const char
+digits2[200] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+int32_t
+PadNum_IntToStr(char *dst, int64_t value) {
+    char tmp[PAD_NUM__INT_STR_SIZE];
+    char *end = tmp + sizeof tmp;
+    char *p = end;
+
+    uint64_t u = value < 0 ? 0 - (uint64_t) value : (uint64_t) value;
+    while (u >= 100) {
+        const char *d = digits2 + (u % 100) * 2;
+        u /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if (u < 10) {
+        *--p = '0' + u;
+    } else {
+        *--p = digits2[u * 2 + 1];
+        *--p = digits2[u * 2];
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+
+    int32_t len = end - p;
+    memcpy(dst, p, len);
+    dst[len] = '\0';
+    return len;
+}
+
+/*********
+* grisu2 *
+*********/
+
+// Grisu2 by Florian Loitsch, "Printing Floating-Point Numbers Quickly and
+// Accurately with Integers" (PLDI 2010)
+
+typedef struct {
+    uint64_t f;  // significand
+    int e;  // binary exponent
+} diy_fp_t;
+
+enum {
+    DP_SIGNIFICAND_SIZE = 52,
+    DP_EXPONENT_BIAS = 0x3ff + DP_SIGNIFICAND_SIZE,
+    DP_MIN_EXPONENT = -DP_EXPONENT_BIAS,
+};
+
+#define DP_HIDDEN_BIT ((uint64_t) 1 << DP_SIGNIFICAND_SIZE)
+#define DP_SIGNIFICAND_MASK (DP_HIDDEN_BIT - 1)
+
+// normalized powers of 10^(-348 + 8 * i)
+static const diy_fp_t
+cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220},  // 1e-348
+    {0xbaaee17fa23ebf76ULL, -1193},  // 1e-340
+    {0x8b16fb203055ac76ULL, -1166},  // 1e-332
+    {0xcf42894a5dce35eaULL, -1140},  // 1e-324
+    {0x9a6bb0aa55653b2dULL, -1113},  // 1e-316
+    {0xe61acf033d1a45dfULL, -1087},  // 1e-308
+    {0xab70fe17c79ac6caULL, -1060},  // 1e-300
+    {0xff77b1fcbebcdc4fULL, -1034},  // 1e-292
+    {0xbe5691ef416bd60cULL, -1007},  // 1e-284
+    {0x8dd01fad907ffc3cULL, -980},  // 1e-276
+    {0xd3515c2831559a83ULL, -954},  // 1e-268
+    {0x9d71ac8fada6c9b5ULL, -927},  // 1e-260
+    {0xea9c227723ee8bcbULL, -901},  // 1e-252
+    {0xaecc49914078536dULL, -874},  // 1e-244
+    {0x823c12795db6ce57ULL, -847},  // 1e-236
+    {0xc21094364dfb5637ULL, -821},  // 1e-228
+    {0x9096ea6f3848984fULL, -794},  // 1e-220
+    {0xd77485cb25823ac7ULL, -768},  // 1e-212
+    {0xa086cfcd97bf97f4ULL, -741},  // 1e-204
+    {0xef340a98172aace5ULL, -715},  // 1e-196
+    {0xb23867fb2a35b28eULL, -688},  // 1e-188
+    {0x84c8d4dfd2c63f3bULL, -661},  // 1e-180
+    {0xc5dd44271ad3cdbaULL, -635},  // 1e-172
+    {0x936b9fcebb25c996ULL, -608},  // 1e-164
+    {0xdbac6c247d62a584ULL, -582},  // 1e-156
+    {0xa3ab66580d5fdaf6ULL, -555},  // 1e-148
+    {0xf3e2f893dec3f126ULL, -529},  // 1e-140
+    {0xb5b5ada8aaff80b8ULL, -502},  // 1e-132
+    {0x87625f056c7c4a8bULL, -475},  // 1e-124
+    {0xc9bcff6034c13053ULL, -449},  // 1e-116
+    {0x964e858c91ba2655ULL, -422},  // 1e-108
+    {0xdff9772470297ebdULL, -396},  // 1e-100
+    {0xa6dfbd9fb8e5b88fULL, -369},  // 1e-92
+    {0xf8a95fcf88747d94ULL, -343},  // 1e-84
+    {0xb94470938fa89bcfULL, -316},  // 1e-76
+    {0x8a08f0f8bf0f156bULL, -289},  // 1e-68
+    {0xcdb02555653131b6ULL, -263},  // 1e-60
+    {0x993fe2c6d07b7facULL, -236},  // 1e-52
+    {0xe45c10c42a2b3b06ULL, -210},  // 1e-44
+    {0xaa242499697392d3ULL, -183},  // 1e-36
+    {0xfd87b5f28300ca0eULL, -157},  // 1e-28
+    {0xbce5086492111aebULL, -130},  // 1e-20
+    {0x8cbccc096f5088ccULL, -103},  // 1e-12
+    {0xd1b71758e219652cULL, -77},  // 1e-4
+    {0x9c40000000000000ULL, -50},  // 1e4
+    {0xe8d4a51000000000ULL, -24},  // 1e12
+    {0xad78ebc5ac620000ULL, 3},  // 1e20
+    {0x813f3978f8940984ULL, 30},  // 1e28
+    {0xc097ce7bc90715b3ULL, 56},  // 1e36
+    {0x8f7e32ce7bea5c70ULL, 83},  // 1e44
+    {0xd5d238a4abe98068ULL, 109},  // 1e52
+    {0x9f4f2726179a2245ULL, 136},  // 1e60
+    {0xed63a231d4c4fb27ULL, 162},  // 1e68
+    {0xb0de65388cc8ada8ULL, 189},  // 1e76
+    {0x83c7088e1aab65dbULL, 216},  // 1e84
+    {0xc45d1df942711d9aULL, 242},  // 1e92
+    {0x924d692ca61be758ULL, 269},  // 1e100
+    {0xda01ee641a708deaULL, 295},  // 1e108
+    {0xa26da3999aef774aULL, 322},  // 1e116
+    {0xf209787bb47d6b85ULL, 348},  // 1e124
+    {0xb454e4a179dd1877ULL, 375},  // 1e132
+    {0x865b86925b9bc5c2ULL, 402},  // 1e140
+    {0xc83553c5c8965d3dULL, 428},  // 1e148
+    {0x952ab45cfa97a0b3ULL, 455},  // 1e156
+    {0xde469fbd99a05fe3ULL, 481},  // 1e164
+    {0xa59bc234db398c25ULL, 508},  // 1e172
+    {0xf6c69a72a3989f5cULL, 534},  // 1e180
+    {0xb7dcbf5354e9beceULL, 561},  // 1e188
+    {0x88fcf317f22241e2ULL, 588},  // 1e196
+    {0xcc20ce9bd35c78a5ULL, 614},  // 1e204
+    {0x98165af37b2153dfULL, 641},  // 1e212
+    {0xe2a0b5dc971f303aULL, 667},  // 1e220
+    {0xa8d9d1535ce3b396ULL, 694},  // 1e228
+    {0xfb9b7cd9a4a7443cULL, 720},  // 1e236
+    {0xbb764c4ca7a44410ULL, 747},  // 1e244
+    {0x8bab8eefb6409c1aULL, 774},  // 1e252
+    {0xd01fef10a657842cULL, 800},  // 1e260
+    {0x9b10a4e5e9913129ULL, 827},  // 1e268
+    {0xe7109bfba19c0c9dULL, 853},  // 1e276
+    {0xac2820d9623bf429ULL, 880},  // 1e284
+    {0x80444b5e7aa7cf85ULL, 907},  // 1e292
+    {0xbf21e44003acdd2dULL, 933},  // 1e300
+    {0x8e679c2f5e44ff8fULL, 960},  // 1e308
+    {0xd433179d9c8cb841ULL, 986},  // 1e316
+    {0x9e19db92b4e31ba9ULL, 1013},  // 1e324
+    {0xeb96bf6ebadf77d9ULL, 1039},  // 1e332
+    {0xaf87023b9bf0ee6bULL, 1066},  // 1e340
+};
+
+static const uint64_t
+pow10_table[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+static diy_fp_t
+fp_from_double(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof bits);
+
+    int biased_e = (bits >> DP_SIGNIFICAND_SIZE) & 0x7ff;
+    uint64_t significand = bits & DP_SIGNIFICAND_MASK;
+    if (biased_e) {
+        return (diy_fp_t) {significand + DP_HIDDEN_BIT, biased_e - DP_EXPONENT_BIAS};
+    }
+    return (diy_fp_t) {significand, DP_MIN_EXPONENT + 1};
+}
+
+static diy_fp_t
+fp_normalize(diy_fp_t x) {
+    while (!(x.f & ((uint64_t) 1 << 63))) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+static diy_fp_t
+fp_mul(diy_fp_t x, diy_fp_t y) {
+    const uint64_t m32 = 0xffffffffULL;
+    uint64_t a = x.f >> 32, b = x.f & m32;
+    uint64_t c = y.f >> 32, d = y.f & m32;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32);
+    tmp += 1ULL << 31;  // round
+    return (diy_fp_t) {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64};
+}
+
+/**
+ * get boundaries of value. m- and m+ have same exponent
+ */
+static void
+fp_boundaries(diy_fp_t v, diy_fp_t *minus, diy_fp_t *plus) {
+    diy_fp_t pl = {(v.f << 1) + 1, v.e - 1};
+    pl = fp_normalize(pl);
+
+    diy_fp_t mi;
+    if (v.f == DP_HIDDEN_BIT) {
+        mi = (diy_fp_t) {(v.f << 2) - 1, v.e - 2};
+    } else {
+        mi = (diy_fp_t) {(v.f << 1) - 1, v.e - 1};
+    }
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+
+    *minus = mi;
+    *plus = pl;
+}
+
+/**
+ * get cached power c such that exponent of c * 2^e is in [-60, -32]
+ */
+static diy_fp_t
+cached_power(int e, int *K) {
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = (int) dk;
+    if (dk - k > 0.0) {
+        k++;
+    }
+
+    int index = (k >> 3) + 1;
+    *K = -(-348 + index * 8);
+    return cached_powers[index];
+}
+
+static int
+count_digits32(uint32_t n) {
+    int count = 1;
+    for (; n >= 10; n /= 10) {
+        count++;
+    }
+    return count;
+}
+
+static void
+grisu_round(char *buf, int len, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w) {
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+        buf[len - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+static void
+digit_gen(diy_fp_t W, diy_fp_t Mp, uint64_t delta, char *buf, int *len, int *K) {
+    const diy_fp_t one = {(uint64_t) 1 << -Mp.e, Mp.e};
+    const uint64_t wp_w = Mp.f - W.f;
+    uint32_t p1 = (uint32_t) (Mp.f >> -one.e);
+    uint64_t p2 = Mp.f & (one.f - 1);
+    int kappa = count_digits32(p1);
+    *len = 0;
+
+    // integer part
+    while (kappa > 0) {
+        uint32_t pow = pow10_table[kappa - 1];
+        uint32_t d = p1 / pow;
+        p1 %= pow;
+        if (d || *len) {
+            buf[(*len)++] = '0' + d;
+        }
+        kappa--;
+        uint64_t tmp = ((uint64_t) p1 << -one.e) + p2;
+        if (tmp <= delta) {
+            *K += kappa;
+            grisu_round(buf, *len, delta, tmp, pow10_table[kappa] << -one.e, wp_w);
+            return;
+        }
+    }
+
+    // fraction part
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char) (p2 >> -one.e);
+        if (d || *len) {
+            buf[(*len)++] = '0' + d;
+        }
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta) {
+            *K += kappa;
+            int index = -kappa;
+            grisu_round(buf, *len, delta, p2, one.f, wp_w * (index < 20 ? pow10_table[index] : 0));
+            return;
+        }
+    }
+}
+
+/**
+ * generate shortest digits of positive value. value = digits * 10^K
+ */
+static void
+grisu2(double value, char *buf, int *len, int *K) {
+    diy_fp_t v = fp_from_double(value);
+    diy_fp_t w_m, w_p;
+    fp_boundaries(v, &w_m, &w_p);
+
+    diy_fp_t c_mk = cached_power(w_p.e, K);
+    diy_fp_t W = fp_mul(fp_normalize(v), c_mk);
+    diy_fp_t Wp = fp_mul(w_p, c_mk);
+    diy_fp_t Wm = fp_mul(w_m, c_mk);
+    Wm.f++;
+    Wp.f--;
+    digit_gen(W, Wp, Wp.f - Wm.f, buf, len, K);
+}
+
+/**
+ * write exponent like "e+21" or "e-7"
+ */
+static char *
+write_exponent(char *p, int exp) {
+    *p++ = 'e';
+    if (exp < 0) {
+        *p++ = '-';
+        exp = -exp;
+    } else {
+        *p++ = '+';
+    }
+    if (exp >= 100) {
+        *p++ = '0' + exp / 100;
+        exp %= 100;
+        *p++ = digits2[exp * 2];
+        *p++ = digits2[exp * 2 + 1];
+    } else if (exp >= 10) {
+        *p++ = digits2[exp * 2];
+        *p++ = digits2[exp * 2 + 1];
+    } else {
+        *p++ = '0' + exp;
+    }
+    return p;
+}
+
+int32_t
+PadNum_FloatToStr(char *dst, double value) {
+    char *p = dst;
+
+    if (isnan(value)) {
+        memcpy(dst, "nan", 4);
+        return 3;
+    }
+    if (signbit(value)) {
+        *p++ = '-';
+        value = -value;
+    }
+    if (isinf(value)) {
+        memcpy(p, "inf", 4);
+        return p + 3 - dst;
+    }
+    if (value == 0.0) {
+        memcpy(p, "0.0", 4);
+        return p + 3 - dst;
+    }
+
+    char digits[20];
+    int len;
+    int K;
+    grisu2(value, digits, &len, &K);
+    int pt = len + K;  // position of decimal point in digits
+
+    if (pt > 0 && pt <= 21) {
+        if (len <= pt) {
+            // integral value. 12300.0
+            memcpy(p, digits, len);
+            p += len;
+            memset(p, '0', pt - len);
+            p += pt - len;
+            *p++ = '.';
+            *p++ = '0';
+        } else {
+            // 123.45
+            memcpy(p, digits, pt);
+            p += pt;
+            *p++ = '.';
+            memcpy(p, digits + pt, len - pt);
+            p += len - pt;
+        }
+    } else if (pt <= 0 && pt > -6) {
+        // 0.00123
+        *p++ = '0';
+        *p++ = '.';
+        memset(p, '0', -pt);
+        p += -pt;
+        memcpy(p, digits, len);
+        p += len;
+    } else {
+        // 1.23e+45
+        *p++ = digits[0];
+        if (len > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, len - 1);
+            p += len - 1;
+        }
+        p = write_exponent(p, pt - 1);
+    }
+
+    *p = '\0';
+    return p - dst;
+}
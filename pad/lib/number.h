@@ -0,0 +1,44 @@
+/**
+ * Number formatting
+ *
+ * integers are formatted by two digits at a time
+ * floats are formatted to shortest strings that round trip (Grisu2)
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+enum {
+    PAD_NUM__INT_STR_SIZE = 24,  // size of buffer for PadNum_IntToStr
+    PAD_NUM__FLOAT_STR_SIZE = 32,  // size of buffer for PadNum_FloatToStr
+};
+
+/**
+ * format integer to decimal strings
+ *
+ * @param[out] *dst  pointer to buffer (PAD_NUM__INT_STR_SIZE bytes or more)
+ * @param[in]  value integer value
+ *
+ * @return number of length of strings (without null terminator)
+ */
+int32_t
+PadNum_IntToStr(char *dst, int64_t value);
+
+/**
+ * format float to shortest decimal strings that round trip by strtod
+ * integral values have ".0" (e.g. "1.0") and very large or small values
+ * are formatted with exponent (e.g. "1e+21", "1.5e-7")
+ *
+ * @param[out] *dst  pointer to buffer (PAD_NUM__FLOAT_STR_SIZE bytes or more)
+ * @param[in]  value float value
+ *
+ * @return number of length of strings (without null terminator)
+ */
+int32_t
+PadNum_FloatToStr(char *dst, double value);
@@ -0,0 +1,1956 @@
+#include <pad/lib/regex.h>
+
+enum {
+    MAX_INSTS = 20000,  // max number of instructions of program
+    MAX_NEST = 256,  // max depth of nested groups
+    MAX_CODE = 0x10FFFF,  // max code point
+    DFA_BUDGET = 1 << 22,  // bytes of cached states of one DFA
+    MIN_DSTATES = 16,  // min number of cached states of one DFA
+    MAX_DSTATES = 4096,  // max number of cached states of one DFA
+};
+
+/**
+ * operation of instruction
+ */
+typedef enum {
+    OP_CHAR,  // consume character of x
+    OP_ANY,  // consume any character except newline
+    OP_CLASS,  // consume character in class of index x
+    OP_SPLIT,  // fork threads to x (preferred) and y
+    OP_JMP,  // jump to x
+    OP_SAVE,  // save position to capture slot x
+    OP_ASSERT,  // zero width assertion of kind x
+    OP_MATCH,  // accept
+} op_t;
+
+/**
+ * kind of assertion
+ */
+typedef enum {
+    AS_BEGIN,  // ^ beginning of text
+    AS_END,  // $ end of text
+    AS_WORD,  // \b word boundary
+    AS_NOT_WORD,  // \B not word boundary
+} assert_t;
+
+typedef struct {
+    op_t op;
+    int32_t x;
+    int32_t y;
+} inst_t;
+
+typedef struct {
+    uint32_t lo;
+    uint32_t hi;  // included
+} range_t;
+
+/**
+ * character class. ranges are sorted and not overlapped after normalize
+ */
+typedef struct {
+    range_t *ranges;
+    int32_t len;
+    int32_t capa;
+} class_t;
+
+/**
+ * kind of node of syntax tree
+ */
+typedef enum {
+    N_EMPTY,
+    N_CHAR,
+    N_ANY,
+    N_CLASS,
+    N_ASSERT,
+    N_CAT,
+    N_ALT,
+    N_REPEAT,
+    N_GROUP,
+} ntype_t;
+
+typedef struct {
+    ntype_t type;
+    int32_t x;  // character, index of class, kind of assertion or index of group (-1 is not capturing)
+    int32_t child;  // first child of CAT, ALT, REPEAT and GROUP
+    int32_t next;  // next sibling
+    int32_t min;  // min count of REPEAT
+    int32_t max;  // max count of REPEAT (-1 is infinite)
+    bool greedy;
+} node_t;
+
+/**
+ * set of pcs with order of insertion and O(1) clear
+ */
+typedef struct {
+    int32_t *dense;
+    int32_t *sparse;
+    int32_t len;
+} sset_t;
+
+/**
+ * flags of state of DFA
+ */
+enum {
+    DF_START = 1 << 0,  // at beginning of text
+    DF_WORD = 1 << 1,  // previous character is word character
+    DF_UNANCHORED = 1 << 2,  // match can start at next position
+};
+
+/**
+ * state of DFA. the state is ordered list of pcs of threads before
+ * following epsilon transitions, because assertions depend on next character
+ */
+typedef struct {
+    int32_t *pcs;
+    int32_t npcs;
+    int32_t flags;
+    uint32_t hash;
+    int32_t *next;  // transitions of equivalence classes and end of text. -1 is not computed
+} dstate_t;
+
+/**
+ * lazy DFA over program
+ * transition is encoded as ((index of next state + 1) << 1) | matched
+ * and index -1 is dead state
+ */
+typedef struct {
+    inst_t *insts;
+    int32_t ninsts;
+    bool longest;  // if true then leftmost-longest else leftmost-first
+    dstate_t *states;
+    int32_t nstates;
+    int32_t max_states;
+    int32_t *table;  // hash table of indices of states
+    int32_t table_size;
+    int32_t nresets;
+    sset_t set;
+    int32_t *stack;
+    int32_t *buf;  // pcs of consuming threads
+    int32_t nbuf;
+    int32_t *next_pcs;
+} dfa_t;
+
+/**
+ * frame of stack of Pike VM. if slot >= 0 then the frame restores capture
+ */
+typedef struct {
+    int32_t pc;
+    int32_t slot;
+    int32_t val;
+} frame_t;
+
+struct PadRegex {
+    PadUniType *pattern;
+    int32_t pattern_len;
+    int32_t flags;
+    int32_t ngroups;
+    int32_t nslots;
+
+    inst_t *insts;  // forward program with captures
+    int32_t ninsts;
+    inst_t *rinsts;  // reverse program without captures
+    int32_t nrinsts;
+    class_t *classes;
+    int32_t nclasses;
+
+    // equivalence classes of characters. class k is [bounds[k-1], bounds[k])
+    uint32_t *bounds;
+    int32_t nbounds;
+    int32_t neq;  // number of equivalence classes. index neq is end of text
+    int32_t eq_ascii[128];
+    uint32_t *eq_rep;  // representative of class
+    bool *eq_word;
+
+    dfa_t fwd;
+    dfa_t rev;
+
+    // Pike VM
+    sset_t pike_sets[2];
+    int32_t *pike_caps[2];
+    int32_t *pike_tmp;
+    frame_t *pike_stack;
+};
+
+/**
+ * context of assertions at position
+ */
+typedef struct {
+    bool at_begin;
+    bool at_end;
+    bool prev_word;
+    bool next_word;
+} actx_t;
+
+/**********
+* helpers *
+**********/
+
+static inline bool
+is_word(uint32_t c) {
+    return (c >= '0' && c <= '9') ||
+           (c >= 'A' && c <= 'Z') ||
+           (c >= 'a' && c <= 'z') ||
+           c == '_';
+}
+
+static inline bool
+check_assert(int32_t kind, const actx_t *ctx) {
+    switch (kind) {
+    case AS_BEGIN: return ctx->at_begin;
+    case AS_END: return ctx->at_end;
+    case AS_WORD: return ctx->prev_word != ctx->next_word;
+    case AS_NOT_WORD: return ctx->prev_word == ctx->next_word;
+    }
+    return false;
+}
+
+static bool
+sset_init(sset_t *self, int32_t n) {
+    self->dense = PadMem_Calloc(n + 1, sizeof(int32_t));
+    self->sparse = PadMem_Calloc(n + 1, sizeof(int32_t));
+    self->len = 0;
+    return self->dense && self->sparse;
+}
+
+static void
+sset_fini(sset_t *self) {
+    free(self->dense);
+    free(self->sparse);
+}
+
+static inline bool
+sset_has(const sset_t *self, int32_t v) {
+    int32_t i = self->sparse[v];
+    return i < self->len && self->dense[i] == v;
+}
+
+static inline int32_t
+sset_add(sset_t *self, int32_t v) {
+    self->sparse[v] = self->len;
+    self->dense[self->len] = v;
+    return self->len++;
+}
+
+/********
+* class *
+********/
+
+static bool
+class_add(class_t *self, uint32_t lo, uint32_t hi) {
+    if (self->len >= self->capa) {
+        int32_t capa = self->capa ? self->capa * 2 : 4;
+        range_t *ranges = PadMem_Realloc(self->ranges, sizeof(range_t) * capa);
+        if (!ranges) {
+            return false;
+        }
+        self->ranges = ranges;
+        self->capa = capa;
+    }
+    self->ranges[self->len++] = (range_t) { lo, hi };
+    return true;
+}
+
+static int
+compare_ranges(const void *a, const void *b) {
+    const range_t *x = a;
+    const range_t *y = b;
+    return x->lo < y->lo ? -1 : x->lo > y->lo ? 1 : 0;
+}
+
+static void
+class_normalize(class_t *self) {
+    if (self->len <= 1) {
+        return;
+    }
+
+    qsort(self->ranges, self->len, sizeof(range_t), compare_ranges);
+    int32_t n = 0;
+    for (int32_t i = 1; i < self->len; i++) {
+        range_t *last = &self->ranges[n];
+        const range_t *r = &self->ranges[i];
+        if (r->lo <= last->hi + 1) {
+            if (r->hi > last->hi) {
+                last->hi = r->hi;
+            }
+        } else {
+            self->ranges[++n] = *r;
+        }
+    }
+    self->len = n + 1;
+}
+
+/**
+ * complement of normalized class
+ */
+static bool
+class_negate(class_t *self) {
+    class_t neg = {0};
+    uint32_t lo = 0;
+    for (int32_t i = 0; i < self->len; i++) {
+        const range_t *r = &self->ranges[i];
+        if (r->lo > lo && !class_add(&neg, lo, r->lo - 1)) {
+            free(neg.ranges);
+            return false;
+        }
+        lo = r->hi + 1;
+    }
+    if (lo <= MAX_CODE && !class_add(&neg, lo, MAX_CODE)) {
+        free(neg.ranges);
+        return false;
+    }
+
+    free(self->ranges);
+    *self = neg;
+    return true;
+}
+
+/**
+ * add other cases of ASCII letters in class
+ */
+static bool
+class_fold(class_t *self) {
+    int32_t len = self->len;
+    for (int32_t i = 0; i < len; i++) {
+        uint32_t lo = self->ranges[i].lo;
+        uint32_t hi = self->ranges[i].hi;
+        if (lo <= 'Z' && hi >= 'A') {
+            uint32_t a = lo < 'A' ? 'A' : lo;
+            uint32_t b = hi > 'Z' ? 'Z' : hi;
+            if (!class_add(self, a + 32, b + 32)) {
+                return false;
+            }
+        }
+        if (lo <= 'z' && hi >= 'a') {
+            uint32_t a = lo < 'a' ? 'a' : lo;
+            uint32_t b = hi > 'z' ? 'z' : hi;
+            if (!class_add(self, a - 32, b - 32)) {
+                return false;
+            }
+        }
+    }
+    class_normalize(self);
+    return true;
+}
+
+static bool
+class_has(const class_t *self, uint32_t c) {
+    int32_t lo = 0;
+    int32_t hi = self->len;
+    while (lo < hi) {
+        int32_t mid = (lo + hi) / 2;
+        const range_t *r = &self->ranges[mid];
+        if (c < r->lo) {
+            hi = mid;
+        } else if (c > r->hi) {
+            lo = mid + 1;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * add ranges of \d, \w, \s or negated versions of them
+ */
+static bool
+class_add_perl(class_t *self, uint32_t c) {
+    class_t cls = {0};
+    bool ok = true;
+    switch (c) {
+    case 'd': case 'D':
+        ok = class_add(&cls, '0', '9');
+        break;
+    case 'w': case 'W':
+        ok = class_add(&cls, '0', '9') &&
+             class_add(&cls, 'A', 'Z') &&
+             class_add(&cls, '_', '_') &&
+             class_add(&cls, 'a', 'z');
+        break;
+    case 's': case 'S':
+        ok = class_add(&cls, '\t', '\r') &&
+             class_add(&cls, ' ', ' ');
+        break;
+    }
+    if (ok && c >= 'A' && c <= 'Z') {
+        class_normalize(&cls);
+        ok = class_negate(&cls);
+    }
+    for (int32_t i = 0; ok && i < cls.len; i++) {
+        ok = class_add(self, cls.ranges[i].lo, cls.ranges[i].hi);
+    }
+    free(cls.ranges);
+    return ok;
+}
+
+/*********
+* parser *
+*********/
+
+typedef struct {
+    PadRegex *re;
+    const PadUniType *src;
+    int32_t len;
+    int32_t pos;
+    int32_t depth;
+    node_t *nodes;
+    int32_t nnodes;
+    int32_t capa;
+    char *err;
+    int32_t errsz;
+    bool failed;
+} parser_t;
+
+typedef enum {
+    ESC_ERROR,
+    ESC_CHAR,  // character
+    ESC_PERL,  // \d \w \s \D \W \S
+    ESC_ASSERT,  // \b \B
+} esc_t;
+
+static void
+set_err(parser_t *ps, const char *msg) {
+    if (ps->failed) {
+        return;
+    }
+    ps->failed = true;
+    if (ps->err && ps->errsz > 0) {
+        snprintf(ps->err, ps->errsz, "%s at position %d", msg, ps->pos);
+    }
+}
+
+static int32_t
+new_node(parser_t *ps, ntype_t type) {
+    if (ps->nnodes >= ps->capa) {
+        int32_t capa = ps->capa ? ps->capa * 2 : 16;
+        node_t *nodes = PadMem_Realloc(ps->nodes, sizeof(node_t) * capa);
+        if (!nodes) {
+            set_err(ps, "failed to allocate memory");
+            return -1;
+        }
+        ps->nodes = nodes;
+        ps->capa = capa;
+    }
+
+    ps->nodes[ps->nnodes] = (node_t) {
+        .type = type,
+        .child = -1,
+        .next = -1,
+        .greedy = true,
+    };
+    return ps->nnodes++;
+}
+
+static int32_t
+new_class(parser_t *ps) {
+    PadRegex *re = ps->re;
+    class_t *classes = PadMem_Realloc(re->classes, sizeof(class_t) * (re->nclasses + 1));
+    if (!classes) {
+        set_err(ps, "failed to allocate memory");
+        return -1;
+    }
+    re->classes = classes;
+    re->classes[re->nclasses] = (class_t) {0};
+    return re->nclasses++;
+}
+
+/**
+ * finish class of index. the class is normalized and folded
+ */
+static int32_t
+class_node(parser_t *ps, int32_t index, bool negate) {
+    class_t *cls = &ps->re->classes[index];
+    class_normalize(cls);
+    if (ps->re->flags & PAD_REGEX__IGNORE_CASE) {
+        if (!class_fold(cls)) {
+            set_err(ps, "failed to allocate memory");
+            return -1;
+        }
+    }
+    if (negate && !class_negate(cls)) {
+        set_err(ps, "failed to allocate memory");
+        return -1;
+    }
+
+    int32_t n = new_node(ps, N_CLASS);
+    if (n >= 0) {
+        ps->nodes[n].x = index;
+    }
+    return n;
+}
+
+static int32_t
+char_node(parser_t *ps, uint32_t c) {
+    bool letter = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+    if (letter && (ps->re->flags & PAD_REGEX__IGNORE_CASE)) {
+        int32_t index = new_class(ps);
+        if (index < 0) {
+            return -1;
+        }
+        if (!class_add(&ps->re->classes[index], c, c)) {
+            set_err(ps, "failed to allocate memory");
+            return -1;
+        }
+        return class_node(ps, index, false);
+    }
+
+    int32_t n = new_node(ps, N_CHAR);
+    if (n >= 0) {
+        ps->nodes[n].x = c;
+    }
+    return n;
+}
+
+static int
+hex_value(uint32_t c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * parse escape sequence. pos is at next of backslash
+ */
+static esc_t
+parse_escape(parser_t *ps, uint32_t *ch) {
+    if (ps->pos >= ps->len) {
+        set_err(ps, "bad escape (end of pattern)");
+        return ESC_ERROR;
+    }
+
+    uint32_t c = ps->src[ps->pos++];
+    *ch = c;
+    switch (c) {
+    case 'n': *ch = '\n'; return ESC_CHAR;
+    case 't': *ch = '\t'; return ESC_CHAR;
+    case 'r': *ch = '\r'; return ESC_CHAR;
+    case 'f': *ch = '\f'; return ESC_CHAR;
+    case 'v': *ch = '\v'; return ESC_CHAR;
+    case '0': *ch = 0; return ESC_CHAR;
+    case 'd': case 'D': case 'w': case 'W': case 's': case 'S':
+        return ESC_PERL;
+    case 'b': case 'B':
+        return ESC_ASSERT;
+    case 'x': case 'u': {
+        int32_t ndigits = c == 'x' ? 2 : 4;
+        uint32_t val = 0;
+        for (int32_t i = 0; i < ndigits; i++) {
+            int h = ps->pos < ps->len ? hex_value(ps->src[ps->pos]) : -1;
+            if (h < 0) {
+                set_err(ps, c == 'x' ? "bad escape \\x" : "bad escape \\u");
+                return ESC_ERROR;
+            }
+            val = val * 16 + h;
+            ps->pos++;
+        }
+        *ch = val;
+        return ESC_CHAR;
+    } break;
+    }
+
+    if (c < 128 && is_word(c)) {
+        ps->pos--;
+        set_err(ps, "bad escape");
+        return ESC_ERROR;
+    }
+    return ESC_CHAR;
+}
+
+/**
+ * parse [...] or [^...]. pos is at next of '['
+ */
+static int32_t
+parse_class(parser_t *ps) {
+    int32_t begin = ps->pos - 1;
+    int32_t index = new_class(ps);
+    if (index < 0) {
+        return -1;
+    }
+
+    bool negate = false;
+    if (ps->pos < ps->len && ps->src[ps->pos] == '^') {
+        negate = true;
+        ps->pos++;
+    }
+
+    bool first = true;
+    for (;;) {
+        if (ps->pos >= ps->len) {
+            ps->pos = begin;
+            set_err(ps, "unterminated character set");
+            return -1;
+        }
+
+        uint32_t c = ps->src[ps->pos++];
+        if (c == ']' && !first) {
+            break;
+        }
+        first = false;
+
+        uint32_t lo = c;
+        if (c == '\\') {
+            esc_t esc = parse_escape(ps, &lo);
+            if (esc == ESC_ERROR) {
+                return -1;
+            } else if (esc == ESC_PERL) {
+                if (!class_add_perl(&ps->re->classes[index], lo)) {
+                    set_err(ps, "failed to allocate memory");
+                    return -1;
+                }
+                continue;
+            } else if (esc == ESC_ASSERT) {
+                if (lo == 'B') {
+                    ps->pos--;
+                    set_err(ps, "bad escape");
+                    return -1;
+                }
+                lo = '\b';
+            }
+        }
+
+        uint32_t hi = lo;
+        if (ps->pos + 1 < ps->len &&
+            ps->src[ps->pos] == '-' &&
+            ps->src[ps->pos + 1] != ']') {
+            ps->pos++;
+            hi = ps->src[ps->pos++];
+            if (hi == '\\') {
+                esc_t esc = parse_escape(ps, &hi);
+                if (esc == ESC_ERROR) {
+                    return -1;
+                } else if (esc != ESC_CHAR && !(esc == ESC_ASSERT && hi == 'b')) {
+                    set_err(ps, "bad character range");
+                    return -1;
+                } else if (esc == ESC_ASSERT) {
+                    hi = '\b';
+                }
+            }
+            if (hi < lo) {
+                set_err(ps, "bad character range");
+                return -1;
+            }
+        }
+
+        if (!class_add(&ps->re->classes[index], lo, hi)) {
+            set_err(ps, "failed to allocate memory");
+            return -1;
+        }
+    }
+
+    return class_node(ps, index, negate);
+}
+
+static int32_t
+parse_alt(parser_t *ps);
+
+/**
+ * parse (...) or (?:...). pos is at next of '('
+ */
+static int32_t
+parse_group(parser_t *ps) {
+    if (++ps->depth > MAX_NEST) {
+        set_err(ps, "too deep nesting");
+        return -1;
+    }
+
+    int32_t index = -1;
+    if (ps->pos < ps->len && ps->src[ps->pos] == '?') {
+        if (ps->pos + 1 >= ps->len || ps->src[ps->pos + 1] != ':') {
+            set_err(ps, "unknown extension");
+            return -1;
+        }
+        ps->pos += 2;
+    } else {
+        index = ++ps->re->ngroups;
+    }
+
+    int32_t body = parse_alt(ps);
+    if (body < 0) {
+        return -1;
+    }
+    if (ps->pos >= ps->len || ps->src[ps->pos] != ')') {
+        set_err(ps, "missing ), unterminated subpattern");
+        return -1;
+    }
+    ps->pos++;
+    ps->depth--;
+
+    int32_t n = new_node(ps, N_GROUP);
+    if (n >= 0) {
+        ps->nodes[n].x = index;
+        ps->nodes[n].child = body;
+    }
+    return n;
+}
+
+static bool
+parse_number(parser_t *ps, int32_t *val) {
+    int32_t begin = ps->pos;
+    int32_t n = 0;
+    for (; ps->pos < ps->len; ps->pos++) {
+        uint32_t c = ps->src[ps->pos];
+        if (c < '0' || c > '9') {
+            break;
+        }
+        if (n <= PAD_REGEX__MAX_REPEAT) {
+            n = n * 10 + (c - '0');
+        }
+    }
+    *val = n;
+    return ps->pos > begin;
+}
+
+/**
+ * parse {n}, {n,}, {,m} or {n,m}. pos is at '{'
+ *
+ * @return 1 if quantifier, 0 if not quantifier (pos is not moved), -1 if error
+ */
+static int
+parse_braces(parser_t *ps, int32_t *min, int32_t *max) {
+    int32_t begin = ps->pos;
+    ps->pos++;
+
+    bool has_min = parse_number(ps, min);
+    bool has_max = false;
+    bool comma = false;
+    if (ps->pos < ps->len && ps->src[ps->pos] == ',') {
+        comma = true;
+        ps->pos++;
+        has_max = parse_number(ps, max);
+    }
+    if (ps->pos >= ps->len || ps->src[ps->pos] != '}' || (!has_min && !has_max)) {
+        ps->pos = begin;
+        return 0;
+    }
+    ps->pos++;
+
+    if (!has_min) {
+        *min = 0;
+    }
+    if (!comma) {
+        *max = *min;
+    } else if (!has_max) {
+        *max = -1;
+    }
+
+    if (*min > PAD_REGEX__MAX_REPEAT || *max > PAD_REGEX__MAX_REPEAT) {
+        ps->pos = begin;
+        set_err(ps, "the repetition number is too large");
+        return -1;
+    }
+    if (*max >= 0 && *max < *min) {
+        ps->pos = begin;
+        set_err(ps, "min repeat greater than max repeat");
+        return -1;
+    }
+    return 1;
+}
+
+static int32_t
+parse_atom(parser_t *ps) {
+    uint32_t c = ps->src[ps->pos++];
+    switch (c) {
+    case '(':
+        return parse_group(ps);
+    case '[':
+        return parse_class(ps);
+    case '.':
+        return new_node(ps, N_ANY);
+    case '^':
+    case '$': {
+        int32_t n = new_node(ps, N_ASSERT);
+        if (n >= 0) {
+            ps->nodes[n].x = c == '^' ? AS_BEGIN : AS_END;
+        }
+        return n;
+    } break;
+    case '*':
+    case '+':
+    case '?':
+        ps->pos--;
+        set_err(ps, "nothing to repeat");
+        return -1;
+    case '{': {
+        ps->pos--;
+        int32_t min, max;
+        int ret = parse_braces(ps, &min, &max);
+        if (ret != 0) {
+            set_err(ps, "nothing to repeat");
+            return -1;
+        }
+        ps->pos++;
+        return char_node(ps, c);
+    } break;
+    case '\\': {
+        uint32_t ch;
+        switch (parse_escape(ps, &ch)) {
+        case ESC_ERROR:
+            return -1;
+        case ESC_CHAR:
+            return char_node(ps, ch);
+        case ESC_PERL: {
+            int32_t index = new_class(ps);
+            if (index < 0) {
+                return -1;
+            }
+            if (!class_add_perl(&ps->re->classes[index], ch)) {
+                set_err(ps, "failed to allocate memory");
+                return -1;
+            }
+            return class_node(ps, index, false);
+        } break;
+        case ESC_ASSERT: {
+            int32_t n = new_node(ps, N_ASSERT);
+            if (n >= 0) {
+                ps->nodes[n].x = ch == 'b' ? AS_WORD : AS_NOT_WORD;
+            }
+            return n;
+        } break;
+        }
+    } break;
+    }
+
+    return char_node(ps, c);
+}
+
+static int32_t
+parse_repeat(parser_t *ps) {
+    int32_t atom = parse_atom(ps);
+    if (atom < 0) {
+        return -1;
+    }
+
+    bool repeated = false;
+    while (ps->pos < ps->len) {
+        int32_t begin = ps->pos;
+        int32_t min, max;
+        uint32_t c = ps->src[ps->pos];
+        if (c == '*') {
+            min = 0, max = -1;
+            ps->pos++;
+        } else if (c == '+') {
+            min = 1, max = -1;
+            ps->pos++;
+        } else if (c == '?') {
+            min = 0, max = 1;
+            ps->pos++;
+        } else if (c == '{') {
+            int ret = parse_braces(ps, &min, &max);
+            if (ret < 0) {
+                return -1;
+            } else if (ret == 0) {
+                break;
+            }
+        } else {
+            break;
+        }
+
+        if (repeated) {
+            ps->pos = begin;
+            set_err(ps, "multiple repeat");
+            return -1;
+        }
+        repeated = true;
+
+        bool greedy = true;
+        if (ps->pos < ps->len && ps->src[ps->pos] == '?') {
+            greedy = false;
+            ps->pos++;
+        }
+
+        int32_t n = new_node(ps, N_REPEAT);
+        if (n < 0) {
+            return -1;
+        }
+        ps->nodes[n].child = atom;
+        ps->nodes[n].min = min;
+        ps->nodes[n].max = max;
+        ps->nodes[n].greedy = greedy;
+        atom = n;
+    }
+
+    return atom;
+}
+
+/**
+ * parse sequence of atoms. children of CAT are linked by next
+ */
+static int32_t
+parse_cat(parser_t *ps) {
+    int32_t first = -1;
+    int32_t last = -1;
+    int32_t count = 0;
+
+    while (ps->pos < ps->len) {
+        uint32_t c = ps->src[ps->pos];
+        if (c == '|' || c == ')') {
+            break;
+        }
+        int32_t n = parse_repeat(ps);
+        if (n < 0) {
+            return -1;
+        }
+        if (last >= 0) {
+            ps->nodes[last].next = n;
+        } else {
+            first = n;
+        }
+        last = n;
+        count++;
+    }
+
+    if (count == 0) {
+        return new_node(ps, N_EMPTY);
+    } else if (count == 1) {
+        return first;
+    }
+
+    int32_t n = new_node(ps, N_CAT);
+    if (n >= 0) {
+        ps->nodes[n].child = first;
+    }
+    return n;
+}
+
+static int32_t
+parse_alt(parser_t *ps) {
+    int32_t first = parse_cat(ps);
+    if (first < 0) {
+        return -1;
+    }
+    if (ps->pos >= ps->len || ps->src[ps->pos] != '|') {
+        return first;
+    }
+
+    int32_t last = first;
+    while (ps->pos < ps->len && ps->src[ps->pos] == '|') {
+        ps->pos++;
+        int32_t n = parse_cat(ps);
+        if (n < 0) {
+            return -1;
+        }
+        ps->nodes[last].next = n;
+        last = n;
+    }
+
+    int32_t n = new_node(ps, N_ALT);
+    if (n >= 0) {
+        ps->nodes[n].child = first;
+    }
+    return n;
+}
+
+/*******
+* emit *
+*******/
+
+/**
+ * program under generation
+ */
+typedef struct {
+    parser_t *ps;
+    inst_t *insts;
+    int32_t len;
+    int32_t capa;
+    bool reverse;  // if true then generate program for reversed text without captures
+} prog_t;
+
+static int32_t
+emit(prog_t *prog, op_t op, int32_t x, int32_t y) {
+    if (prog->len >= MAX_INSTS) {
+        set_err(prog->ps, "pattern is too large");
+        return -1;
+    }
+    if (prog->len >= prog->capa) {
+        int32_t capa = prog->capa ? prog->capa * 2 : 32;
+        inst_t *insts = PadMem_Realloc(prog->insts, sizeof(inst_t) * capa);
+        if (!insts) {
+            set_err(prog->ps, "failed to allocate memory");
+            return -1;
+        }
+        prog->insts = insts;
+        prog->capa = capa;
+    }
+
+    prog->insts[prog->len] = (inst_t) { op, x, y };
+    return prog->len++;
+}
+
+static bool
+gen(prog_t *prog, int32_t index);
+
+static bool
+gen_cat(prog_t *prog, int32_t child) {
+    if (!prog->reverse) {
+        for (int32_t c = child; c >= 0; c = prog->ps->nodes[c].next) {
+            if (!gen(prog, c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int32_t n = 0;
+    for (int32_t c = child; c >= 0; c = prog->ps->nodes[c].next) {
+        n++;
+    }
+    int32_t *children = PadMem_Calloc(n, sizeof(int32_t));
+    if (!children) {
+        set_err(prog->ps, "failed to allocate memory");
+        return false;
+    }
+    n = 0;
+    for (int32_t c = child; c >= 0; c = prog->ps->nodes[c].next) {
+        children[n++] = c;
+    }
+
+    bool ok = true;
+    for (int32_t i = n - 1; ok && i >= 0; i--) {
+        ok = gen(prog, children[i]);
+    }
+    free(children);
+    return ok;
+}
+
+/**
+ * alternatives are
+ *
+ *     SPLIT L1, L2
+ *     L1: alt1; JMP end
+ *     L2: SPLIT L3, L4 ...
+ *
+ * pending JMPs are linked by x and patched to end
+ */
+static bool
+gen_alt(prog_t *prog, int32_t child) {
+    int32_t jmps = -1;
+    for (int32_t c = child; c >= 0; c = prog->ps->nodes[c].next) {
+        if (prog->ps->nodes[c].next < 0) {
+            if (!gen(prog, c)) {
+                return false;
+            }
+            break;
+        }
+
+        int32_t split = emit(prog, OP_SPLIT, prog->len + 1, -1);
+        if (split < 0 || !gen(prog, c)) {
+            return false;
+        }
+        int32_t jmp = emit(prog, OP_JMP, jmps, 0);
+        if (jmp < 0) {
+            return false;
+        }
+        jmps = jmp;
+        prog->insts[split].y = prog->len;
+    }
+
+    while (jmps >= 0) {
+        int32_t next = prog->insts[jmps].x;
+        prog->insts[jmps].x = prog->len;
+        jmps = next;
+    }
+    return true;
+}
+
+static bool
+gen_repeat(prog_t *prog, const node_t *node) {
+    int32_t child = node->child;
+    bool greedy = node->greedy;
+
+    if (node->max < 0) {
+        if (node->min == 0) {
+            // L: SPLIT body, end; body; JMP L
+            int32_t split = emit(prog, OP_SPLIT, -1, -1);
+            if (split < 0 || !gen(prog, child) || emit(prog, OP_JMP, split, 0) < 0) {
+                return false;
+            }
+            prog->insts[split].x = greedy ? split + 1 : prog->len;
+            prog->insts[split].y = greedy ? prog->len : split + 1;
+            return true;
+        }
+
+        // body * (min - 1); L: body; SPLIT L, end
+        for (int32_t i = 0; i < node->min - 1; i++) {
+            if (!gen(prog, child)) {
+                return false;
+            }
+        }
+        int32_t loop = prog->len;
+        if (!gen(prog, child)) {
+            return false;
+        }
+        int32_t end = prog->len + 1;
+        return emit(prog, OP_SPLIT, greedy ? loop : end, greedy ? end : loop) >= 0;
+    }
+
+    for (int32_t i = 0; i < node->min; i++) {
+        if (!gen(prog, child)) {
+            return false;
+        }
+    }
+
+    // (body (body ...)?)? . skips of SPLITs are linked by y and patched to end
+    int32_t splits = -1;
+    for (int32_t i = node->min; i < node->max; i++) {
+        int32_t split = emit(prog, OP_SPLIT, -1, splits);
+        if (split < 0 || !gen(prog, child)) {
+            return false;
+        }
+        splits = split;
+    }
+    while (splits >= 0) {
+        int32_t next = prog->insts[splits].y;
+        prog->insts[splits].x = greedy ? splits + 1 : prog->len;
+        prog->insts[splits].y = greedy ? prog->len : splits + 1;
+        splits = next;
+    }
+    return true;
+}
+
+static bool
+gen(prog_t *prog, int32_t index) {
+    const node_t node = prog->ps->nodes[index];
+    switch (node.type) {
+    case N_EMPTY:
+        return true;
+    case N_CHAR:
+        return emit(prog, OP_CHAR, node.x, 0) >= 0;
+    case N_ANY:
+        return emit(prog, OP_ANY, 0, 0) >= 0;
+    case N_CLASS:
+        return emit(prog, OP_CLASS, node.x, 0) >= 0;
+    case N_ASSERT: {
+        int32_t kind = node.x;
+        if (prog->reverse && kind == AS_BEGIN) {
+            kind = AS_END;
+        } else if (prog->reverse && kind == AS_END) {
+            kind = AS_BEGIN;
+        }
+        return emit(prog, OP_ASSERT, kind, 0) >= 0;
+    } break;
+    case N_CAT:
+        return gen_cat(prog, node.child);
+    case N_ALT:
+        return gen_alt(prog, node.child);
+    case N_REPEAT:
+        return gen_repeat(prog, &node);
+    case N_GROUP:
+        if (node.x < 0 || prog->reverse) {
+            return gen(prog, node.child);
+        }
+        return emit(prog, OP_SAVE, node.x * 2, 0) >= 0 &&
+               gen(prog, node.child) &&
+               emit(prog, OP_SAVE, node.x * 2 + 1, 0) >= 0;
+    }
+    return false;
+}
+
+/**
+ * generate program of root. forward program is
+ *
+ *     SAVE 0; root; SAVE 1; MATCH
+ */
+static inst_t *
+gen_prog(parser_t *ps, int32_t root, bool reverse, int32_t *ninsts) {
+    prog_t prog = {
+        .ps = ps,
+        .reverse = reverse,
+    };
+
+    bool ok = (reverse || emit(&prog, OP_SAVE, 0, 0) >= 0) &&
+              gen(&prog, root) &&
+              (reverse || emit(&prog, OP_SAVE, 1, 0) >= 0) &&
+              emit(&prog, OP_MATCH, 0, 0) >= 0;
+    if (!ok) {
+        free(prog.insts);
+        return NULL;
+    }
+
+    *ninsts = prog.len;
+    return prog.insts;
+}
+
+/**********************
+* equivalence classes *
+**********************/
+
+static int
+compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *) a;
+    uint32_t y = *(const uint32_t *) b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static inline int32_t
+eq_of(const PadRegex *self, uint32_t c) {
+    if (c < 128) {
+        return self->eq_ascii[c];
+    }
+
+    // number of bounds less than or equal to c
+    int32_t lo = 0;
+    int32_t hi = self->nbounds;
+    while (lo < hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (self->bounds[mid] <= c) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * split code points to classes which are not distinguished by program.
+ * every character of one class matches the same instructions and has
+ * the same word property
+ */
+static bool
+build_eq_classes(PadRegex *self) {
+    int32_t capa = 16 + 2;
+    for (int32_t i = 0; i < self->ninsts; i++) {
+        const inst_t *inst = &self->insts[i];
+        if (inst->op == OP_CHAR || inst->op == OP_ANY) {
+            capa += 2;
+        } else if (inst->op == OP_CLASS) {
+            capa += self->classes[inst->x].len * 2;
+        }
+    }
+
+    uint32_t *points = PadMem_Calloc(capa, sizeof(uint32_t));
+    if (!points) {
+        return false;
+    }
+
+    int32_t n = 0;
+    static const uint32_t words[] = {'0', '9' + 1, 'A', 'Z' + 1, '_', '_' + 1, 'a', 'z' + 1, '\n', '\n' + 1};
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        points[n++] = words[i];
+    }
+    for (int32_t i = 0; i < self->ninsts; i++) {
+        const inst_t *inst = &self->insts[i];
+        if (inst->op == OP_CHAR) {
+            points[n++] = inst->x;
+            points[n++] = (uint32_t) inst->x + 1;
+        } else if (inst->op == OP_CLASS) {
+            const class_t *cls = &self->classes[inst->x];
+            for (int32_t j = 0; j < cls->len; j++) {
+                points[n++] = cls->ranges[j].lo;
+                points[n++] = cls->ranges[j].hi + 1;
+            }
+        }
+    }
+
+    qsort(points, n, sizeof(uint32_t), compare_u32);
+    int32_t m = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (points[i] == 0 || points[i] > MAX_CODE) {
+            continue;
+        }
+        if (m == 0 || points[m - 1] != points[i]) {
+            points[m++] = points[i];
+        }
+    }
+
+    self->bounds = points;
+    self->nbounds = m;
+    self->neq = m + 1;
+    self->eq_rep = PadMem_Calloc(self->neq, sizeof(uint32_t));
+    self->eq_word = PadMem_Calloc(self->neq, sizeof(bool));
+    if (!self->eq_rep || !self->eq_word) {
+        return false;
+    }
+
+    for (int32_t k = 0; k < self->neq; k++) {
+        self->eq_rep[k] = k == 0 ? 0 : self->bounds[k - 1];
+        self->eq_word[k] = is_word(self->eq_rep[k]);
+    }
+
+    int32_t k = 0;
+    for (uint32_t c = 0; c < 128; c++) {
+        while (k < self->nbounds && self->bounds[k] <= c) {
+            k++;
+        }
+        self->eq_ascii[c] = k;
+    }
+
+    return true;
+}
+
+/******
+* DFA *
+******/
+
+static bool
+dfa_init(dfa_t *self, const PadRegex *re, inst_t *insts, int32_t ninsts, bool longest) {
+    *self = (dfa_t) {
+        .insts = insts,
+        .ninsts = ninsts,
+        .longest = longest,
+    };
+
+    int32_t per_state = (re->neq + 1) * sizeof(int32_t) + sizeof(dstate_t) + 8 * sizeof(int32_t);
+    int32_t max_states = DFA_BUDGET / per_state;
+    if (max_states < MIN_DSTATES) {
+        max_states = MIN_DSTATES;
+    } else if (max_states > MAX_DSTATES) {
+        max_states = MAX_DSTATES;
+    }
+    self->max_states = max_states;
+
+    self->table_size = 1;
+    while (self->table_size < max_states * 2) {
+        self->table_size *= 2;
+    }
+
+    self->states = PadMem_Calloc(max_states, sizeof(dstate_t));
+    self->table = PadMem_Calloc(self->table_size, sizeof(int32_t));
+    self->stack = PadMem_Calloc(ninsts * 2 + 2, sizeof(int32_t));
+    self->buf = PadMem_Calloc(ninsts + 1, sizeof(int32_t));
+    self->next_pcs = PadMem_Calloc(ninsts + 1, sizeof(int32_t));
+    if (!self->states || !self->table || !self->stack || !self->buf || !self->next_pcs ||
+        !sset_init(&self->set, ninsts)) {
+        return false;
+    }
+    memset(self->table, 0xff, sizeof(int32_t) * self->table_size);
+
+    return true;
+}
+
+static void
+dfa_clear(dfa_t *self) {
+    for (int32_t i = 0; i < self->nstates; i++) {
+        free(self->states[i].pcs);
+        free(self->states[i].next);
+    }
+    self->nstates = 0;
+    if (self->table) {
+        memset(self->table, 0xff, sizeof(int32_t) * self->table_size);
+    }
+}
+
+static void
+dfa_fini(dfa_t *self) {
+    dfa_clear(self);
+    free(self->states);
+    free(self->table);
+    free(self->stack);
+    free(self->buf);
+    free(self->next_pcs);
+    sset_fini(&self->set);
+}
+
+static uint32_t
+hash_state(const int32_t *pcs, int32_t n, int32_t flags) {
+    uint32_t h = 2166136261u ^ (uint32_t) flags;
+    for (int32_t i = 0; i < n; i++) {
+        h ^= (uint32_t) pcs[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * find or add state
+ *
+ * @return index of state
+ * @return -1 if cache is full
+ * @return -2 if failed to allocate memory
+ */
+static int32_t
+dfa_state(dfa_t *self, const PadRegex *re, const int32_t *pcs, int32_t n, int32_t flags) {
+    uint32_t hash = hash_state(pcs, n, flags);
+    uint32_t mask = self->table_size - 1;
+    uint32_t i = hash & mask;
+    for (; self->table[i] >= 0; i = (i + 1) & mask) {
+        const dstate_t *st = &self->states[self->table[i]];
+        if (st->hash == hash && st->flags == flags && st->npcs == n &&
+            !memcmp(st->pcs, pcs, sizeof(int32_t) * n)) {
+            return self->table[i];
+        }
+    }
+
+    if (self->nstates >= self->max_states) {
+        return -1;
+    }
+
+    dstate_t *st = &self->states[self->nstates];
+    st->pcs = PadMem_Calloc(n + 1, sizeof(int32_t));
+    st->next = PadMem_Calloc(re->neq + 1, sizeof(int32_t));
+    if (!st->pcs || !st->next) {
+        free(st->pcs);
+        free(st->next);
+        return -2;
+    }
+    memcpy(st->pcs, pcs, sizeof(int32_t) * n);
+    memset(st->next, 0xff, sizeof(int32_t) * (re->neq + 1));
+    st->npcs = n;
+    st->flags = flags;
+    st->hash = hash;
+
+    self->table[i] = self->nstates;
+    return self->nstates++;
+}
+
+/**
+ * find or add state. the cache is cleared if it is full
+ *
+ * @return index of state
+ * @return -2 if failed to allocate memory
+ */
+static int32_t
+dfa_state_or_reset(dfa_t *self, const PadRegex *re, const int32_t *pcs, int32_t n, int32_t flags, bool *reset) {
+    int32_t sid = dfa_state(self, re, pcs, n, flags);
+    if (sid == -1) {
+        dfa_clear(self);
+        self->nresets++;
+        *reset = true;
+        sid = dfa_state(self, re, pcs, n, flags);
+    }
+    return sid;
+}
+
+/**
+ * follow epsilon transitions from pc and collect consuming threads to buf
+ *
+ * @return true if reached to MATCH
+ */
+static bool
+dfa_closure(dfa_t *self, int32_t pc0, const actx_t *ctx) {
+    int32_t *stack = self->stack;
+    int32_t n = 0;
+    bool matched = false;
+
+    stack[n++] = pc0;
+    while (n > 0) {
+        int32_t pc = stack[--n];
+        if (sset_has(&self->set, pc)) {
+            continue;
+        }
+        sset_add(&self->set, pc);
+
+        const inst_t *inst = &self->insts[pc];
+        switch (inst->op) {
+        case OP_JMP:
+            stack[n++] = inst->x;
+            break;
+        case OP_SPLIT:
+            stack[n++] = inst->y;
+            stack[n++] = inst->x;
+            break;
+        case OP_SAVE:
+            stack[n++] = pc + 1;
+            break;
+        case OP_ASSERT:
+            if (check_assert(inst->x, ctx)) {
+                stack[n++] = pc + 1;
+            }
+            break;
+        case OP_MATCH:
+            if (!self->longest) {
+                // threads of lower priority are cut
+                return true;
+            }
+            matched = true;
+            break;
+        case OP_CHAR:
+        case OP_ANY:
+        case OP_CLASS:
+            self->buf[self->nbuf++] = pc;
+            break;
+        }
+    }
+
+    return matched;
+}
+
+static inline bool
+dfa_accepts(const PadRegex *re, const inst_t *inst, int32_t eq) {
+    switch (inst->op) {
+    case OP_CHAR: return eq_of(re, inst->x) == eq;
+    case OP_ANY: return re->eq_rep[eq] != '\n';
+    case OP_CLASS: return class_has(&re->classes[inst->x], re->eq_rep[eq]);
+    default: break;
+    }
+    return false;
+}
+
+/**
+ * compute transition of state by equivalence class (neq is end of text)
+ *
+ * @return index of next state
+ * @return -1 if dead state
+ * @return -2 if failed to allocate memory
+ */
+static int32_t
+dfa_step(dfa_t *self, const PadRegex *re, int32_t sid, int32_t eq, bool *matched) {
+    const dstate_t *st = &self->states[sid];
+    bool at_end = eq == re->neq;
+    actx_t ctx = {
+        .at_begin = st->flags & DF_START,
+        .at_end = at_end,
+        .prev_word = st->flags & DF_WORD,
+        .next_word = !at_end && re->eq_word[eq],
+    };
+
+    self->set.len = 0;
+    self->nbuf = 0;
+    bool m = false;
+    for (int32_t i = 0; i < st->npcs; i++) {
+        if (dfa_closure(self, st->pcs[i], &ctx)) {
+            m = true;
+            if (!self->longest) {
+                break;
+            }
+        }
+    }
+    bool unanchored = st->flags & DF_UNANCHORED;
+    if ((!m || self->longest) && unanchored && dfa_closure(self, 0, &ctx)) {
+        m = true;
+    }
+    *matched = m;
+
+    int32_t nnext = 0;
+    if (!at_end) {
+        for (int32_t i = 0; i < self->nbuf; i++) {
+            int32_t pc = self->buf[i];
+            if (dfa_accepts(re, &self->insts[pc], eq)) {
+                self->next_pcs[nnext++] = pc + 1;
+            }
+        }
+    }
+
+    int32_t flags = 0;
+    if (!at_end && re->eq_word[eq]) {
+        flags |= DF_WORD;
+    }
+    if (unanchored && !m) {
+        flags |= DF_UNANCHORED;
+    }
+
+    int32_t nsid = -1;
+    bool reset = false;
+    if (!at_end && (nnext > 0 || (flags & DF_UNANCHORED))) {
+        nsid = dfa_state_or_reset(self, re, self->next_pcs, nnext, flags, &reset);
+        if (nsid == -2) {
+            return -2;
+        }
+    }
+
+    if (!reset) {
+        self->states[sid].next[eq] = ((nsid + 1) << 1) | m;
+    }
+    return nsid;
+}
+
+/**
+ * run DFA from start to end of text
+ *
+ * @return index of end of last match
+ * @return -1 if not matched
+ * @return -2 if failed to allocate memory
+ */
+static int32_t
+dfa_search_forward(PadRegex *re, const PadUniType *s, int32_t len, int32_t start, bool anchored) {
+    dfa_t *dfa = &re->fwd;
+    int32_t flags = anchored ? 0 : DF_UNANCHORED;
+    if (start == 0) {
+        flags |= DF_START;
+    } else if (is_word(s[start - 1])) {
+        flags |= DF_WORD;
+    }
+
+    int32_t pc = 0;
+    bool reset = false;
+    int32_t sid = dfa_state_or_reset(dfa, re, &pc, anchored ? 1 : 0, flags, &reset);
+    if (sid < 0) {
+        return -2;
+    }
+
+    int32_t last = -1;
+    for (int32_t i = start; ; i++) {
+        int32_t eq = i < len ? eq_of(re, s[i]) : re->neq;
+        int32_t v = dfa->states[sid].next[eq];
+        int32_t nsid;
+        if (v >= 0) {
+            nsid = (v >> 1) - 1;
+            if (v & 1) {
+                last = i;
+            }
+        } else {
+            bool m;
+            nsid = dfa_step(dfa, re, sid, eq, &m);
+            if (nsid == -2) {
+                return -2;
+            }
+            if (m) {
+                last = i;
+            }
+        }
+        if (nsid < 0 || i >= len) {
+            break;
+        }
+        sid = nsid;
+    }
+
+    return last;
+}
+
+/**
+ * run reverse DFA from end to lower bound and find leftmost start
+ *
+ * @return index of start of longest match
+ * @return -1 if not matched
+ * @return -2 if failed to allocate memory
+ */
+static int32_t
+dfa_search_reverse(PadRegex *re, const PadUniType *s, int32_t len, int32_t end, int32_t lower) {
+    dfa_t *dfa = &re->rev;
+    int32_t flags = 0;
+    if (end == len) {
+        flags |= DF_START;
+    } else if (is_word(s[end])) {
+        flags |= DF_WORD;
+    }
+
+    int32_t pc = 0;
+    bool reset = false;
+    int32_t sid = dfa_state_or_reset(dfa, re, &pc, 1, flags, &reset);
+    if (sid < 0) {
+        return -2;
+    }
+
+    int32_t last = -1;
+    for (int32_t i = end; ; i--) {
+        int32_t eq = i > 0 ? eq_of(re, s[i - 1]) : re->neq;
+        int32_t v = dfa->states[sid].next[eq];
+        int32_t nsid;
+        if (v >= 0) {
+            nsid = (v >> 1) - 1;
+            if (v & 1) {
+                last = i;
+            }
+        } else {
+            bool m;
+            nsid = dfa_step(dfa, re, sid, eq, &m);
+            if (nsid == -2) {
+                return -2;
+            }
+            if (m) {
+                last = i;
+            }
+        }
+        if (nsid < 0 || i <= lower) {
+            break;
+        }
+        sid = nsid;
+    }
+
+    return last;
+}
+
+/**********
+* Pike VM *
+**********/
+
+static inline bool
+pike_accepts(const PadRegex *re, const inst_t *inst, uint32_t c) {
+    switch (inst->op) {
+    case OP_CHAR: return (uint32_t) inst->x == c;
+    case OP_ANY: return c != '\n';
+    case OP_CLASS: return class_has(&re->classes[inst->x], c);
+    default: break;
+    }
+    return false;
+}
+
+static inline actx_t
+make_actx(const PadUniType *s, int32_t len, int32_t i) {
+    return (actx_t) {
+        .at_begin = i == 0,
+        .at_end = i == len,
+        .prev_word = i > 0 && is_word(s[i - 1]),
+        .next_word = i < len && is_word(s[i]),
+    };
+}
+
+/**
+ * add thread of pc to list with captures of tmp
+ * captures are copied to list for consuming threads and MATCH only
+ */
+static void
+pike_add(PadRegex *re, sset_t *set, int32_t *caps, int32_t pc0, int32_t pos, const actx_t *ctx) {
+    frame_t *stack = re->pike_stack;
+    int32_t *tmp = re->pike_tmp;
+    int32_t n = 0;
+
+    stack[n++] = (frame_t) { pc0, -1, 0 };
+    while (n > 0) {
+        frame_t f = stack[--n];
+        if (f.slot >= 0) {
+            tmp[f.slot] = f.val;
+            continue;
+        }
+        if (sset_has(set, f.pc)) {
+            continue;
+        }
+        int32_t j = sset_add(set, f.pc);
+
+        const inst_t *inst = &re->insts[f.pc];
+        switch (inst->op) {
+        case OP_JMP:
+            stack[n++] = (frame_t) { inst->x, -1, 0 };
+            break;
+        case OP_SPLIT:
+            stack[n++] = (frame_t) { inst->y, -1, 0 };
+            stack[n++] = (frame_t) { inst->x, -1, 0 };
+            break;
+        case OP_SAVE:
+            stack[n++] = (frame_t) { 0, inst->x, tmp[inst->x] };
+            tmp[inst->x] = pos;
+            stack[n++] = (frame_t) { f.pc + 1, -1, 0 };
+            break;
+        case OP_ASSERT:
+            if (check_assert(inst->x, ctx)) {
+                stack[n++] = (frame_t) { f.pc + 1, -1, 0 };
+            }
+            break;
+        case OP_CHAR:
+        case OP_ANY:
+        case OP_CLASS:
+        case OP_MATCH:
+            memcpy(caps + j * re->nslots, tmp, sizeof(int32_t) * re->nslots);
+            break;
+        }
+    }
+}
+
+/**
+ * run Pike VM anchored at start and stop at stop
+ */
+static bool
+pike_match(PadRegex *re, const PadUniType *s, int32_t len, int32_t start, int32_t stop, int32_t *caps) {
+    sset_t *clist = &re->pike_sets[0];
+    sset_t *nlist = &re->pike_sets[1];
+    int32_t *ccaps = re->pike_caps[0];
+    int32_t *ncaps = re->pike_caps[1];
+    int32_t nslots = re->nslots;
+    bool matched = false;
+
+    clist->len = 0;
+    for (int32_t i = 0; i < nslots; i++) {
+        re->pike_tmp[i] = -1;
+    }
+    actx_t ctx = make_actx(s, len, start);
+    pike_add(re, clist, ccaps, 0, start, &ctx);
+
+    for (int32_t i = start; clist->len > 0; i++) {
+        nlist->len = 0;
+        actx_t next_ctx = make_actx(s, len, i + 1);
+        for (int32_t j = 0; j < clist->len; j++) {
+            const inst_t *inst = &re->insts[clist->dense[j]];
+            int32_t *tcaps = ccaps + j * nslots;
+            if (inst->op == OP_MATCH) {
+                matched = true;
+                memcpy(caps, tcaps, sizeof(int32_t) * nslots);
+                break;  // threads of lower priority are cut
+            }
+            if (i < stop && i < len && pike_accepts(re, inst, s[i])) {
+                memcpy(re->pike_tmp, tcaps, sizeof(int32_t) * nslots);
+                pike_add(re, nlist, ncaps, clist->dense[j] + 1, i + 1, &next_ctx);
+            }
+        }
+        if (i >= stop) {
+            break;
+        }
+
+        sset_t *tset = clist;
+        clist = nlist;
+        nlist = tset;
+        int32_t *tcaps = ccaps;
+        ccaps = ncaps;
+        ncaps = tcaps;
+    }
+
+    return matched;
+}
+
+/*********
+* public *
+*********/
+
+void
+PadRegex_Del(PadRegex *self) {
+    if (!self) {
+        return;
+    }
+
+    free(self->pattern);
+    free(self->insts);
+    free(self->rinsts);
+    for (int32_t i = 0; i < self->nclasses; i++) {
+        free(self->classes[i].ranges);
+    }
+    free(self->classes);
+    free(self->bounds);
+    free(self->eq_rep);
+    free(self->eq_word);
+    dfa_fini(&self->fwd);
+    dfa_fini(&self->rev);
+    sset_fini(&self->pike_sets[0]);
+    sset_fini(&self->pike_sets[1]);
+    free(self->pike_caps[0]);
+    free(self->pike_caps[1]);
+    free(self->pike_tmp);
+    free(self->pike_stack);
+    free(self);
+}
+
+static bool
+init_machines(PadRegex *self) {
+    if (!build_eq_classes(self) ||
+        !dfa_init(&self->fwd, self, self->insts, self->ninsts, false) ||
+        !dfa_init(&self->rev, self, self->rinsts, self->nrinsts, true)) {
+        return false;
+    }
+
+    int32_t n = self->ninsts;
+    self->nslots = (self->ngroups + 1) * 2;
+    self->pike_caps[0] = PadMem_Calloc(n * self->nslots, sizeof(int32_t));
+    self->pike_caps[1] = PadMem_Calloc(n * self->nslots, sizeof(int32_t));
+    self->pike_tmp = PadMem_Calloc(self->nslots, sizeof(int32_t));
+    self->pike_stack = PadMem_Calloc(n * 2 + 2, sizeof(frame_t));
+    return self->pike_caps[0] && self->pike_caps[1] && self->pike_tmp && self->pike_stack &&
+           sset_init(&self->pike_sets[0], n) &&
+           sset_init(&self->pike_sets[1], n);
+}
+
+PadRegex *
+PadRegex_New(const PadUniType *pattern, int32_t len, int32_t flags, char *err, int32_t errsz) {
+    if (err && errsz > 0) {
+        err[0] = '\0';
+    }
+    if (!pattern || len < 0) {
+        return NULL;
+    }
+
+    PadRegex *self = PadMem_Calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    self->flags = flags;
+    self->pattern_len = len;
+    self->pattern = PadMem_Calloc(len + 1, sizeof(PadUniType));
+    if (!self->pattern) {
+        free(self);
+        return NULL;
+    }
+    memcpy(self->pattern, pattern, sizeof(PadUniType) * len);
+
+    parser_t ps = {
+        .re = self,
+        .src = pattern,
+        .len = len,
+        .err = err,
+        .errsz = errsz,
+    };
+
+    int32_t root = parse_alt(&ps);
+    if (root >= 0 && ps.pos < len) {
+        set_err(&ps, "unbalanced parenthesis");
+    }
+    if (!ps.failed) {
+        self->insts = gen_prog(&ps, root, false, &self->ninsts);
+    }
+    if (!ps.failed) {
+        self->rinsts = gen_prog(&ps, root, true, &self->nrinsts);
+    }
+    free(ps.nodes);
+    if (ps.failed) {
+        PadRegex_Del(self);
+        return NULL;
+    }
+
+    if (!init_machines(self)) {
+        if (err && errsz > 0) {
+            snprintf(err, errsz, "failed to allocate memory");
+        }
+        PadRegex_Del(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+PadRegex *
+PadRegex_DeepCopy(const PadRegex *other) {
+    if (!other) {
+        return NULL;
+    }
+    return PadRegex_New(other->pattern, other->pattern_len, other->flags, NULL, 0);
+}
+
+int32_t
+PadRegex_GetNGroups(const PadRegex *self) {
+    return self->ngroups;
+}
+
+const PadUniType *
+PadRegex_GetcPattern(const PadRegex *self) {
+    return self->pattern;
+}
+
+int32_t
+PadRegex_GetPatternLen(const PadRegex *self) {
+    return self->pattern_len;
+}
+
+int32_t
+PadRegex_GetFlags(const PadRegex *self) {
+    return self->flags;
+}
+
+bool
+PadRegex_Search(PadRegex *self, const PadUniType *s, int32_t len, int32_t start, bool anchored, int32_t *caps) {
+    if (!self || !s || !caps || start < 0 || start > len) {
+        return false;
+    }
+
+    int32_t end = dfa_search_forward(self, s, len, start, anchored);
+    if (end < 0) {
+        return false;
+    }
+
+    int32_t begin = start;
+    if (!anchored) {
+        begin = dfa_search_reverse(self, s, len, end, start);
+        if (begin < 0) {
+            return false;
+        }
+    }
+
+    if (self->ngroups == 0) {
+        caps[0] = begin;
+        caps[1] = end;
+        return true;
+    }
+
+    return pike_match(self, s, len, begin, end, caps);
+}
+
+int32_t
+PadRegex_GetNCachedStates(const PadRegex *self) {
+    return self->fwd.nstates;
+}
+
+int32_t
+PadRegex_GetNCacheResets(const PadRegex *self) {
+    return self->fwd.nresets + self->rev.nresets;
+}
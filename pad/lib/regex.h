@@ -0,0 +1,165 @@
+/**
+ * Regular expression
+ *
+ * pattern is compiled to program of Thompson NFA and text is matched
+ * without backtracking, so time of matching is linear to length of text
+ *
+ *   1. forward DFA finds end of leftmost-first match
+ *   2. reverse DFA finds start of the match from the end
+ *   3. Pike VM finds captures in range of the match only
+ *
+ * states of DFA are built lazily from sets of NFA threads and cached in
+ * the regex object with transitions for equivalence classes of characters.
+ * if the cache becomes full then it is cleared and rebuilt while matching
+ *
+ * syntax:
+ *
+ *     .  [abc]  [^a-z]  \d \w \s \D \W \S  \t \n \r \f \v \0 \xHH \uHHHH
+ *     ^ (beginning of text)  $ (end of text)  \b  \B
+ *     *  +  ?  {n}  {n,}  {n,m}  and lazy versions  *?  +?  ??  {n,m}?
+ *     (...)  (?:...)  |
+ *
+ * \d, \w, \s and word boundary are ASCII only. ignore case folds ASCII
+ * letters only. backreferences and lookaround are not supported
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <pad/lib/memory.h>
+#include <pad/lib/unicode.h>
+
+/**
+ * flags of compile
+ */
+enum {
+    PAD_REGEX__IGNORE_CASE = 1 << 0,  // ASCII letters match both cases
+};
+
+/**
+ * max count of repetition of {n,m}
+ */
+#define PAD_REGEX__MAX_REPEAT 1000
+
+struct PadRegex;
+typedef struct PadRegex PadRegex;
+
+/**
+ * destruct regex
+ *
+ * @param[in] *self
+ */
+void
+PadRegex_Del(PadRegex *self);
+
+/**
+ * compile pattern to regex
+ *
+ * @param[in]  *pattern pointer to code points of pattern
+ * @param[in]  len      length of pattern
+ * @param[in]  flags    flags of PAD_REGEX__*
+ * @param[out] *err     pointer to buffer of error message (can be NULL)
+ * @param[in]  errsz    size of buffer of error message
+ *
+ * @return success to pointer to PadRegex (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadRegex *
+PadRegex_New(const PadUniType *pattern, int32_t len, int32_t flags, char *err, int32_t errsz);
+
+/**
+ * deep copy
+ * cache of DFA is not copied
+ *
+ * @param[in] *other
+ *
+ * @return success to pointer to PadRegex (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadRegex *
+PadRegex_DeepCopy(const PadRegex *other);
+
+/**
+ * get number of capturing groups (not includes whole match)
+ *
+ * @param[in] *self
+ *
+ * @return number of groups
+ */
+int32_t
+PadRegex_GetNGroups(const PadRegex *self);
+
+/**
+ * get pattern of compile
+ *
+ * @param[in] *self
+ *
+ * @return pointer to code points of pattern (NUL terminated)
+ */
+const PadUniType *
+PadRegex_GetcPattern(const PadRegex *self);
+
+/**
+ * get length of pattern
+ *
+ * @param[in] *self
+ *
+ * @return length of pattern
+ */
+int32_t
+PadRegex_GetPatternLen(const PadRegex *self);
+
+/**
+ * get flags of compile
+ *
+ * @param[in] *self
+ *
+ * @return flags
+ */
+int32_t
+PadRegex_GetFlags(const PadRegex *self);
+
+/**
+ * search leftmost-first match in text from start
+ * caps receives pairs of start and end of whole match and groups.
+ * the size of caps must be 2 * (number of groups + 1). positions of
+ * groups which did not participate in the match are -1
+ *
+ * @param[in]  *self
+ * @param[in]  *s        pointer to code points of text
+ * @param[in]  len       length of text
+ * @param[in]  start     index of start of search
+ * @param[in]  anchored  if true then match must start at start
+ * @param[out] *caps     pointer to array of positions
+ *
+ * @return found to true
+ * @return not found to false
+ */
+bool
+PadRegex_Search(PadRegex *self, const PadUniType *s, int32_t len, int32_t start, bool anchored, int32_t *caps);
+
+/**
+ * get number of cached states of forward DFA
+ *
+ * @param[in] *self
+ *
+ * @return number of states
+ */
+int32_t
+PadRegex_GetNCachedStates(const PadRegex *self);
+
+/**
+ * get number of times the caches of DFA were cleared because it became full
+ *
+ * @param[in] *self
+ *
+ * @return number of times
+ */
+int32_t
+PadRegex_GetNCacheResets(const PadRegex *self);
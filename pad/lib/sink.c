@@ -0,0 +1,326 @@
+#include <pad/lib/sink.h>
+
+struct PadSink {
+    PadSinkType type;
+    FILE *ref_fp;  // type == PAD_SINK_TYPE__FILE
+    int fd;  // type == PAD_SINK_TYPE__FD
+    PadSinkWriteFunc func;  // type == PAD_SINK_TYPE__CALLBACK
+    void *func_arg;  // type == PAD_SINK_TYPE__CALLBACK
+    PadStr *str;  // type == PAD_SINK_TYPE__STR
+
+    // buffer of output. not used by memory sink
+    char buf[PAD_SINK__BUF_SIZE];
+    int32_t buf_len;
+
+    // pending output in order. spans point to buf or static data
+    struct {
+        const char *data;
+        int32_t len;
+    } spans[PAD_SINK__NSPANS];
+    int32_t nspans;
+};
+
+static PadSink *
+sink_new(PadSinkType type) {
+    PadSink *self = PadMem_Calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    self->type = type;
+    self->fd = -1;
+
+    return self;
+}
+
+/**
+ * write data to destination without buffer
+ */
+static bool
+write_dst(PadSink *self, const char *data, int32_t len) {
+    switch (self->type) {
+    case PAD_SINK_TYPE__FILE:
+        return fwrite(data, 1, len, self->ref_fp) == (size_t) len;
+    case PAD_SINK_TYPE__FD:
+        while (len > 0) {
+            ssize_t n = write(self->fd, data, len);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            data += n;
+            len -= n;
+        }
+        return true;
+    case PAD_SINK_TYPE__CALLBACK:
+        return self->func(self->func_arg, data, len);
+    case PAD_SINK_TYPE__STR:
+        return PadStr_AppNStr(self->str, data, len) != NULL;
+    }
+
+    return false;
+}
+
+/**
+ * write pending spans to file descriptor at once by writev
+ */
+static bool
+writev_spans(PadSink *self) {
+#if defined(PAD_SINK__WINDOWS)
+    for (int32_t i = 0; i < self->nspans; i++) {
+        if (!write_dst(self, self->spans[i].data, self->spans[i].len)) {
+            return false;
+        }
+    }
+    return true;
+#else
+    struct iovec iov[PAD_SINK__NSPANS];
+    for (int32_t i = 0; i < self->nspans; i++) {
+        iov[i].iov_base = (void *) self->spans[i].data;
+        iov[i].iov_len = self->spans[i].len;
+    }
+
+    struct iovec *cur = iov;
+    int32_t n = self->nspans;
+    while (n > 0) {
+        ssize_t nwrite = writev(self->fd, cur, n);
+        if (nwrite < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+
+        // skip written vectors and advance partial one
+        while (n > 0 && (size_t) nwrite >= cur->iov_len) {
+            nwrite -= cur->iov_len;
+            cur++;
+            n--;
+        }
+        if (n > 0) {
+            cur->iov_base = (char *) cur->iov_base + nwrite;
+            cur->iov_len -= nwrite;
+        }
+    }
+    return true;
+#endif
+}
+
+/**
+ * push span of pending output
+ * caller must ensure free space of spans
+ */
+static void
+push_span(PadSink *self, const char *data, int32_t len) {
+    if (self->nspans) {
+        // extend last span if data follows it (continuous write to buf)
+        int32_t last = self->nspans - 1;
+        if (self->spans[last].data + self->spans[last].len == data) {
+            self->spans[last].len += len;
+            return;
+        }
+    }
+
+    self->spans[self->nspans].data = data;
+    self->spans[self->nspans].len = len;
+    self->nspans++;
+}
+
+void
+PadSink_Del(PadSink *self) {
+    if (!self) {
+        return;
+    }
+
+    PadSink_Flush(self);
+    PadStr_Del(self->str);
+    free(self);
+}
+
+PadSink *
+PadSink_NewFile(FILE *ref_fp) {
+    if (!ref_fp) {
+        return NULL;
+    }
+
+    PadSink *self = sink_new(PAD_SINK_TYPE__FILE);
+    if (!self) {
+        return NULL;
+    }
+
+    self->ref_fp = ref_fp;
+
+    return self;
+}
+
+PadSink *
+PadSink_NewFd(int fd) {
+    if (fd < 0) {
+        return NULL;
+    }
+
+    PadSink *self = sink_new(PAD_SINK_TYPE__FD);
+    if (!self) {
+        return NULL;
+    }
+
+    self->fd = fd;
+
+    return self;
+}
+
+PadSink *
+PadSink_NewCallback(PadSinkWriteFunc func, void *arg) {
+    if (!func) {
+        return NULL;
+    }
+
+    PadSink *self = sink_new(PAD_SINK_TYPE__CALLBACK);
+    if (!self) {
+        return NULL;
+    }
+
+    self->func = func;
+    self->func_arg = arg;
+
+    return self;
+}
+
+PadSink *
+PadSink_NewStr(void) {
+    PadSink *self = sink_new(PAD_SINK_TYPE__STR);
+    if (!self) {
+        return NULL;
+    }
+
+    self->str = PadStr_New();
+    if (!self->str) {
+        PadSink_Del(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+PadSinkType
+PadSink_GetType(const PadSink *self) {
+    return self->type;
+}
+
+PadSink *
+PadSink_Write(PadSink *self, const char *data, int32_t len) {
+    if (!self || !data || len < 0) {
+        return NULL;
+    }
+
+    if (self->type == PAD_SINK_TYPE__STR) {
+        if (!write_dst(self, data, len)) {
+            return NULL;
+        }
+        return self;
+    }
+
+    // large data is written directly after pending output
+    if (len >= PAD_SINK__BUF_SIZE) {
+        if (!PadSink_Flush(self)) {
+            return NULL;
+        }
+        if (!write_dst(self, data, len)) {
+            return NULL;
+        }
+        return self;
+    }
+
+    if (self->buf_len + len > PAD_SINK__BUF_SIZE ||
+        self->nspans >= PAD_SINK__NSPANS) {
+        if (!PadSink_Flush(self)) {
+            return NULL;
+        }
+    }
+
+    memcpy(self->buf + self->buf_len, data, len);
+    push_span(self, self->buf + self->buf_len, len);
+    self->buf_len += len;
+
+    return self;
+}
+
+PadSink *
+PadSink_WriteStatic(PadSink *self, const char *data, int32_t len) {
+    if (!self || !data || len < 0) {
+        return NULL;
+    }
+
+    // short data is cheaper to copy than to reference
+    if (self->type == PAD_SINK_TYPE__STR || len < PAD_SINK__STATIC_MIN) {
+        return PadSink_Write(self, data, len);
+    }
+
+    if (self->nspans >= PAD_SINK__NSPANS) {
+        if (!PadSink_Flush(self)) {
+            return NULL;
+        }
+    }
+
+    push_span(self, data, len);
+
+    return self;
+}
+
+PadSink *
+PadSink_WriteCStr(PadSink *self, const char *str) {
+    if (!str) {
+        return NULL;
+    }
+
+    return PadSink_Write(self, str, strlen(str));
+}
+
+PadSink *
+PadSink_Flush(PadSink *self) {
+    if (!self) {
+        return NULL;
+    }
+    if (!self->nspans) {
+        return self;
+    }
+
+    bool ok = true;
+    if (self->type == PAD_SINK_TYPE__FD) {
+        ok = writev_spans(self);
+    } else {
+        for (int32_t i = 0; ok && i < self->nspans; i++) {
+            ok = write_dst(self, self->spans[i].data, self->spans[i].len);
+        }
+    }
+    self->nspans = 0;
+    self->buf_len = 0;
+    if (!ok) {
+        return NULL;
+    }
+    if (self->type == PAD_SINK_TYPE__FILE) {
+        fflush(self->ref_fp);
+    }
+
+    return self;
+}
+
+const char *
+PadSink_GetcStr(const PadSink *self) {
+    if (!self || self->type != PAD_SINK_TYPE__STR) {
+        return NULL;
+    }
+
+    return PadStr_Getc(self->str);
+}
+
+void
+PadSink_ClearStr(PadSink *self) {
+    if (!self || self->type != PAD_SINK_TYPE__STR) {
+        return;
+    }
+
+    PadStr_Clear(self->str);
+}
@@ -0,0 +1,195 @@
+/**
+ * Output sink
+ *
+ * destination of rendered output (FILE, file descriptor, callback or memory)
+ * writes are stored to fixed-size buffer and flushed when it's full
+ * static data (text blocks of program etc) are referenced without copy and
+ * gathered with buffered data on flush
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+# define PAD_SINK__WINDOWS 1 /* cap: sink.h */
+#else
+# undef PAD_SINK__WINDOWS
+#endif
+
+#if !defined(PAD_SINK__WINDOWS)
+# include <sys/uio.h>
+#endif
+
+#include <pad/lib/memory.h>
+#include <pad/lib/string.h>
+
+enum {
+    PAD_SINK__BUF_SIZE = 8192,  // size of buffer before flush
+    PAD_SINK__NSPANS = 64,  // number of spans before flush
+    PAD_SINK__STATIC_MIN = 128,  // static data shorter than this are copied
+};
+
+typedef enum {
+    PAD_SINK_TYPE__FILE,  // write to FILE by fwrite
+    PAD_SINK_TYPE__FD,  // write to file descriptor by write
+    PAD_SINK_TYPE__CALLBACK,  // call function
+    PAD_SINK_TYPE__STR,  // store to memory
+} PadSinkType;
+
+struct PadSink;
+typedef struct PadSink PadSink;
+
+/**
+ * write function for callback sink
+ *
+ * @param[in] *arg  argument of PadSink_NewCallback
+ * @param[in] *data pointer to data (not null terminated)
+ * @param[in] len   length of data
+ *
+ * @return success to true
+ * @return failed to false
+ */
+typedef bool (*PadSinkWriteFunc)(void *arg, const char *data, int32_t len);
+
+/**
+ * destruct sink
+ * flush buffer before destruct. FILE and file descriptor are not closed
+ *
+ * @param[in] *self
+ */
+void
+PadSink_Del(PadSink *self);
+
+/**
+ * construct sink for FILE
+ *
+ * @param[in] *ref_fp reference to FILE (DO NOT CLOSE)
+ *
+ * @return success to pointer to PadSink (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_NewFile(FILE *ref_fp);
+
+/**
+ * construct sink for file descriptor
+ *
+ * @param[in] fd file descriptor (DO NOT CLOSE)
+ *
+ * @return success to pointer to PadSink (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_NewFd(int fd);
+
+/**
+ * construct sink for callback
+ *
+ * @param[in] func pointer to write function
+ * @param[in] *arg argument for function
+ *
+ * @return success to pointer to PadSink (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_NewCallback(PadSinkWriteFunc func, void *arg);
+
+/**
+ * construct sink for memory
+ * written data are read by PadSink_GetcStr
+ *
+ * @return success to pointer to PadSink (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_NewStr(void);
+
+/**
+ * get type of sink
+ *
+ * @param[in] *self
+ *
+ * @return number of type
+ */
+PadSinkType
+PadSink_GetType(const PadSink *self);
+
+/**
+ * write data to sink
+ *
+ * @param[in] *self
+ * @param[in] *data pointer to data
+ * @param[in] len   length of data
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_Write(PadSink *self, const char *data, int32_t len);
+
+/**
+ * write static data to sink
+ * data is referenced without copy until next flush. the caller must keep
+ * data alive and unchanged until PadSink_Flush
+ *
+ * @param[in] *self
+ * @param[in] *data pointer to data
+ * @param[in] len   length of data
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_WriteStatic(PadSink *self, const char *data, int32_t len);
+
+/**
+ * write null terminated strings to sink
+ *
+ * @param[in] *self
+ * @param[in] *str  pointer to strings
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_WriteCStr(PadSink *self, const char *str);
+
+/**
+ * flush buffer to destination
+ *
+ * @param[in] *self
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadSink *
+PadSink_Flush(PadSink *self);
+
+/**
+ * get written strings of memory sink
+ *
+ * @param[in] *self
+ *
+ * @return success to pointer to strings (read-only)
+ * @return failed to NULL (not memory sink)
+ */
+const char *
+PadSink_GetcStr(const PadSink *self);
+
+/**
+ * clear written strings of memory sink
+ *
+ * @param[in] *self
+ */
+void
+PadSink_ClearStr(PadSink *self);
@@ -312,6 +312,25 @@ PadStr_App(PadStr *self, const PadStrType *src) {
     return self;
 }
 
+PadStr *
+PadStr_AppNStr(PadStr *self, const PadStrType *src, int32_t len) {
+    if (!self || !src || len < 0) {
+        return NULL;
+    }
+
+    if (self->length + len >= self->capacity-1) {
+        if (!PadStr_Resize(self, (self->length + len) * 2)) {
+            return NULL;
+        }
+    }
+
+    memcpy(self->buffer + self->length, src, len * sizeof(PadStrType));
+    self->length += len;
+    self->buffer[self->length] = NIL;
+
+    return self;
+}
+
 PadStr *
 PadStr_AppStream(PadStr *self, FILE *fin) {
     if (!self || !fin) {
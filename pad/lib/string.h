@@ -217,6 +217,20 @@ PadStr_PopFront(PadStr *self);
 PadStr *
 PadStr_App(PadStr *self, const PadStrType *src);
 
+/**
+ * append strings of length at back of buffer in string
+ * src is not need null terminator
+ *
+ * @param[in] self
+ * @param[in] src pointer to memory of strings
+ * @param[in] len length of strings
+ *
+ * @return success to pointer to self
+ * @return failed to NULL
+ */
+PadStr *
+PadStr_AppNStr(PadStr *self, const PadStrType *src, int32_t len);
+
 /**
  * append stream at back of buffer in string
  *
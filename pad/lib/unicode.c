@@ -1,4 +1,5 @@
 #include <pad/lib/unicode.h>
+#include <pad/lib/unicode_kernel.h>
 
 #define NIL PAD_UNI__CH('\0')
 
@@ -224,16 +225,78 @@ struct PadUni {
     PadUniType *buffer;
     int32_t length;
     int32_t capacity;
+
+    // cache of multi byte strings for PadUni_GetcMB
+    // mb_valid be false at mutation of buffer (see unshare_buffer)
     char *mb;
+    int32_t mb_capa;
+    bool mb_valid;
+
+    // reference counts of buffer shared by PadUni_ShallowCopy
+    // if NULL then the buffer is not shared
+    int32_t *buffer_refs;
 };
 
+/**
+ * release buffer of self. the shared buffer is freed by last owner
+ */
+static void
+release_buffer(PadUni *self) {
+    if (self->buffer_refs) {
+        *self->buffer_refs -= 1;
+        if (*self->buffer_refs > 0) {
+            self->buffer = NULL;
+            self->buffer_refs = NULL;
+            return;
+        }
+        free(self->buffer_refs);
+        self->buffer_refs = NULL;
+    }
+
+    free(self->buffer);
+    self->buffer = NULL;
+}
+
+/**
+ * copy on write. the buffer of self be own buffer before mutation
+ *
+ * @return success to self
+ * @return failed to NULL
+ */
+static PadUni *
+unshare_buffer(PadUni *self) {
+    self->mb_valid = false;  // all mutators pass this point
+
+    if (!self->buffer_refs) {
+        return self;  // not shared
+    }
+    if (*self->buffer_refs == 1) {
+        free(self->buffer_refs);  // other owners were already gone
+        self->buffer_refs = NULL;
+        return self;
+    }
+
+    int32_t byte = sizeof(PadUniType);
+    PadUniType *buf = PadMem_Calloc(self->capacity + 1, byte);
+    if (!buf) {
+        return NULL;
+    }
+    memcpy(buf, self->buffer, (self->length + 1) * byte);
+
+    *self->buffer_refs -= 1;
+    self->buffer_refs = NULL;
+    self->buffer = buf;
+
+    return self;
+}
+
 void
 PadUni_Del(PadUni *self) {
     if (!self) {
         return;
     }
 
-    free(self->buffer);
+    release_buffer(self);
     free(self->mb);
     free(self);
 }
@@ -243,6 +306,9 @@ PadUni_EscDel(PadUni *self) {
     if (!self) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     PadUniType *esc = self->buffer;
     free(self->mb);
@@ -284,6 +350,9 @@ PadUni_Resize(PadUni *self, int32_t newcapa) {
     if (!self || newcapa < 0) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     int32_t byte = sizeof(PadUniType);
     int32_t size = newcapa * byte + byte;
@@ -326,6 +395,9 @@ PadUni_Get(PadUni *self) {
     if (!self) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     return self->buffer;
 }
@@ -353,6 +425,9 @@ PadUni_Clear(PadUni *self) {
     if (!self) {
         return;
     }
+    if (!unshare_buffer(self)) {
+        return;
+    }
 
     self->length = 0;
     self->buffer[self->length] = NIL;
@@ -363,6 +438,9 @@ PadUni_Set(PadUni *self, const PadUniType *src) {
     if (!self || !src) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     int srclen = PadU_Len(src);
     if (srclen >= self->length) {
@@ -388,6 +466,9 @@ PadUni_PushBack(PadUni *self, PadUniType ch) {
     if (ch == PAD_UNI__CH('\0')) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     if (self->length >= self->capacity) {
         if (!PadUni_Resize(self, self->capacity * 2)) {
@@ -406,6 +487,9 @@ PadUni_PopBack(PadUni *self) {
     if (!self) {
         return NIL;
     }
+    if (!unshare_buffer(self)) {
+        return NIL;
+    }
 
     if (self->length > 0) {
         PadUniType ret = self->buffer[--self->length];
@@ -421,6 +505,9 @@ PadUni_PushFront(PadUni *self, PadUniType ch) {
     if (!self || ch == NIL) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     if (self->length >= self->capacity - 1) {
         if (!PadUni_Resize(self, self->length * 2)) {
@@ -442,6 +529,9 @@ PadUni_PopFront(PadUni *self) {
     if (!self || self->length == 0) {
         return NIL;
     }
+    if (!unshare_buffer(self)) {
+        return NIL;
+    }
 
     PadUniType ret = self->buffer[0];
 
@@ -460,6 +550,9 @@ PadUni_App(PadUni *self, const PadUniType *src) {
     if (!self || !src) {
         return NULL;
     }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
 
     int32_t srclen = PadU_Len(src);
     int32_t totallen = self->length + srclen;
@@ -479,6 +572,30 @@ PadUni_App(PadUni *self, const PadUniType *src) {
     return self;
 }
 
+PadUni *
+PadUni_AppN(PadUni *self, const PadUniType *src, int32_t n) {
+    if (!self || !src || n < 0) {
+        return NULL;
+    }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
+
+    int32_t totallen = self->length + n;
+    if (totallen >= self->capacity - 1) {
+        int32_t newcapa = totallen * 2;
+        if (!PadUni_Resize(self, newcapa)) {
+            return NULL;
+        }
+    }
+
+    memcpy(self->buffer + self->length, src, sizeof(PadUniType) * n);
+    self->length += n;
+    self->buffer[self->length] = NIL;
+
+    return self;
+}
+
 PadUni *
 PadUni_AppStream(PadUni *self, FILE *fin) {
     if (!self || !fin) {
@@ -526,8 +643,33 @@ PadUni_DeepCopy(const PadUni *other) {
 }
 
 PadUni *
-PadUni_ShallowCopy(const PadUni *other) {
-    return PadUni_DeepCopy(other);
+PadUni_ShallowCopy(const PadUni *_other) {
+    if (!_other) {
+        return NULL;
+    }
+
+    // the buffer is shared and copied at first mutation (copy on write)
+    PadUni *other = (PadUni *) _other;
+    if (!other->buffer_refs) {
+        other->buffer_refs = PadMem_Calloc(1, sizeof(int32_t));
+        if (!other->buffer_refs) {
+            return NULL;
+        }
+        *other->buffer_refs = 1;
+    }
+
+    PadUni *self = calloc(1, sizeof(*self));
+    if (!self) {
+        return NULL;
+    }
+
+    self->buffer = other->buffer;
+    self->length = other->length;
+    self->capacity = other->capacity;
+    self->buffer_refs = other->buffer_refs;
+    *self->buffer_refs += 1;
+
+    return self;
 }
 
 PadUni *
@@ -577,34 +719,91 @@ PadUni_AppFmt(PadUni *self, char *buf, int32_t nbuf, const char *fmt, ...) {
     return self;
 }
 
-char *
-PadUni_ToMB(const PadUni *self) {
-    if (!self) {
-        return NULL;
+/**
+ * convert buffer of self to multi byte strings
+ * ASCII characters are copied without conversion by locale
+ *
+ * @param[in]     *self
+ * @param[in]     *dst       destination buffer (can be NULL)
+ * @param[in,out] *dst_capa  capacity of destination buffer
+ *
+ * @return success to pointer to destination buffer (may be reallocated)
+ * @return failed to NULL (dst is freed)
+ */
+static char *
+encode_mb(const PadUni *self, char *dst, int32_t *dst_capa) {
+    // ASCII takes one byte per character. grow if found other characters
+    int32_t capa = *dst_capa;
+    if (capa < self->length + 1) {
+        capa = self->length + 1;
+        char *tmp = realloc(dst, capa);
+        if (!tmp) {
+            free(dst);
+            return NULL;
+        }
+        dst = tmp;
     }
 
     mbstate_t mbstate = {0};
-    PadStr *buf = PadStr_New();
+    int32_t n = 0;
 
     for (int32_t i = 0; i < self->length; ++i) {
+        // copy run of ASCII characters at once. the rest of characters
+        // take at least one byte for each
+        if (n + self->length - i >= capa) {
+            capa = capa * 2 + self->length - i;
+            char *tmp = realloc(dst, capa);
+            if (!tmp) {
+                free(dst);
+                return NULL;
+            }
+            dst = tmp;
+        }
+        int32_t run = PadUniKernel_NarrowAscii(dst + n, self->buffer + i, self->length - i);
+        n += run;
+        i += run;
+        if (i >= self->length) {
+            break;
+        }
+
+        PadUniType ch = self->buffer[i];
         char mb[MB_LEN_MAX + 1];
 #if defined(PAD_UNI__CHAR32)
-        size_t result = c32rtomb(mb, self->buffer[i], &mbstate);
+        size_t result = c32rtomb(mb, ch, &mbstate);
 #elif defined(PAD_UNI__CH16)
-        size_t result = c16rtomb(mb, self->buffer[i], &mbstate);
+        size_t result = c16rtomb(mb, ch, &mbstate);
 #endif
         if (result == -1) {
+            free(dst);
             return NULL;
         }
 
-        mb[result] = '\0';
-
-        for (const char *p = mb; *p; ++p) {
-            PadStr_PushBack(buf, *p);
+        if (n + (int32_t) result >= capa) {
+            capa = capa * 2 + result;
+            char *tmp = realloc(dst, capa);
+            if (!tmp) {
+                free(dst);
+                return NULL;
+            }
+            dst = tmp;
         }
+        memcpy(dst + n, mb, result);
+        n += result;
+    }
+
+    dst[n] = '\0';
+    *dst_capa = capa;
+    return dst;
+}
+
+char *
+PadUni_ToMB(const PadUni *self) {
+    if (!self) {
+        return NULL;
     }
 
-    return PadStr_EscDel(buf);
+    int32_t capa = 0;
+    return encode_mb(self, NULL, &capa);
 }
 
 PadUni *
@@ -620,7 +819,23 @@ PadUni_SetMB(PadUni *self, const char *mb) {
 
     PadUni_Clear(self);
 
+    // number of characters is less than or equal to number of bytes
+    if (len > self->capacity) {
+        if (!PadUni_Resize(self, len)) {
+            return NULL;
+        }
+    }
+
     for (; mbi < len;) {
+        unsigned char byte = mb[mbi];
+        if (byte < 0x80) {
+            // ASCII is same in multi byte strings
+            self->buffer[self->length++] = byte;
+            self->buffer[self->length] = NIL;
+            mbi += 1;
+            continue;
+        }
+
         char32_t c32;
         mbstate = (mbstate_t) {0};
         errno = 0;
@@ -654,29 +869,40 @@ PadUni_SetMB(PadUni *self, const char *mb) {
             return NULL;
         }
     }
+    self->buffer[self->length] = NIL;
 
     return self;
 }
 
+/**
+ * if ch is in rems then return true
+ */
+static bool
+is_in_rems(const PadUniType *rems, PadUniType ch) {
+    for (const PadUniType *p = rems; *p; ++p) {
+        if (*p == ch) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static PadUni *
 _PadUni_RStrip(PadUni *self, const PadUniType *rems) {
     if (!self || !rems) {
         return NULL;
     }
 
-    for (int32_t i = self->length - 1; i > 0; --i) {
-        bool found = false;
-        for (const PadUniType *p = rems; *p; ++p) {
-            if (*p == self->buffer[i]) {
-                self->buffer[i] = NIL;
-                found = true;
-            }
-        }
-        if (!found) {
-            break;
-        }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
+
+    int32_t len = self->length;
+    for (; len > 0 && is_in_rems(rems, self->buffer[len - 1]); --len) {
     }
 
+    self->length = len;
+    self->buffer[len] = NIL;
     return self;
 }
 
@@ -701,17 +927,17 @@ _PadUni_LStrip(PadUni *self, const PadUniType *rems) {
         return NULL;
     }
 
-    for (; self->length; ) {
-        bool found = false;
-        for (const PadUniType *p = rems; *p; ++p) {
-            if (*p == self->buffer[0]) {
-                PadUni_PopFront(self);
-                found = true;
-            }
-        }
-        if (!found) {
-            break;
-        }
+    if (!unshare_buffer(self)) {
+        return NULL;
+    }
+
+    // find end of removals and move rest at once
+    int32_t n = 0;
+    for (; n < self->length && is_in_rems(rems, self->buffer[n]); ++n) {
+    }
+    if (n) {
+        self->length -= n;
+        memmove(self->buffer, self->buffer + n, (self->length + 1) * sizeof(PadUniType));
     }
 
     return self;
@@ -755,15 +981,20 @@ PadUni_Strip(const PadUni *other, const PadUniType *rems) {
 
 const char *
 PadUni_GetcMB(PadUni *self) {
-    char *mb = PadUni_ToMB(self);
-    if (!mb) {
+    if (!self) {
         return NULL;
     }
+    if (self->mb_valid) {
+        return self->mb;
+    }
 
-    if (self->mb) {
-        free(self->mb);
+    // reuse buffer of cache
+    self->mb = encode_mb(self, self->mb, &self->mb_capa);
+    if (!self->mb) {
+        self->mb_capa = 0;
+        return NULL;
     }
-    self->mb = mb;
+    self->mb_valid = true;
 
     return self->mb;
 }
@@ -798,12 +1029,11 @@ PadUni_Lower(const PadUni *other) {
     }
 
     PadUni *self = PadUni_DeepCopy(other);
-    for (int32_t i = 0; i < self->length; ++i) {
-        PadUniType ch = self->buffer[i];
-        if (PadU_IsUpper(ch)) {
-            self->buffer[i] = PadU_ToLower(ch);
-        }
+    if (!self || !unshare_buffer(self)) {
+        PadUni_Del(self);
+        return NULL;
     }
+    PadUniKernel_Lower(self->buffer, self->length);
 
     return self;
 }
@@ -815,12 +1045,11 @@ PadUni_Upper(const PadUni *other) {
     }
 
     PadUni *self = PadUni_DeepCopy(other);
-    for (int32_t i = 0; i < self->length; ++i) {
-        PadUniType ch = self->buffer[i];
-        if (PadU_IsLower(ch)) {
-            self->buffer[i] = PadU_ToUpper(ch);
-        }
+    if (!self || !unshare_buffer(self)) {
+        PadUni_Del(self);
+        return NULL;
     }
+    PadUniKernel_Upper(self->buffer, self->length);
 
     return self;
 }
@@ -1003,9 +1232,59 @@ PadUni_Mul(const PadUni *other, int32_t n) {
     return buf;
 }
 
+/**
+ * construct unicode by range of buffer
+ */
+static PadUni *
+new_from_range(const PadUniType *src, int32_t len) {
+    PadUni *self = PadUni_New();
+    if (!self) {
+        return NULL;
+    }
+    if (len > self->capacity && !PadUni_Resize(self, len)) {
+        PadUni_Del(self);
+        return NULL;
+    }
+
+    memcpy(self->buffer, src, len * sizeof(PadUniType));
+    self->length = len;
+    self->buffer[len] = NIL;
+
+    return self;
+}
+
+/**
+ * find sub in buffer from pos
+ * candidates are found by first character of sub and compared rest
+ * it is O(n * m) in worst case on repetitive text like find "aab" in "aaaa..."
+ *
+ * @return found to index of sub
+ * @return not found to -1
+ */
+static int32_t
+find_sub(const PadUniType *buf, int32_t len, const PadUniType *sub, int32_t sublen, int32_t pos) {
+    if (!sublen) {
+        return pos <= len ? pos : -1;
+    }
+
+    while (pos + sublen <= len) {
+        int32_t i = PadUniKernel_FindCh(buf + pos, len - pos - sublen + 1, sub[0]);
+        if (i < 0) {
+            return -1;
+        }
+        pos += i;
+        if (!memcmp(buf + pos + 1, sub + 1, (sublen - 1) * sizeof(PadUniType))) {
+            return pos;
+        }
+        pos++;
+    }
+
+    return -1;
+}
+
 PadUni **
 PadUni_Split(const PadUni *other, const PadUniType *sep) {
-    if (!other) {
+    if (!other || !sep) {
         return NULL;
     }
 
@@ -1016,69 +1295,179 @@ PadUni_Split(const PadUni *other, const PadUniType *sep) {
         return NULL;
     }
 
-    PadUni *u = PadUni_New();
+    const PadUniType *buf = other->buffer;
+    int32_t len = other->length;
+    int32_t seplen = PadU_Len(sep);
+    int32_t begin = 0;  // begin of current token
+
+    for (;;) {
+        int32_t end = len;
+        int32_t next = len;
+        int32_t found = seplen ? find_sub(buf, len, sep, seplen, begin) : -1;
+        if (found >= 0) {
+            end = found;
+            next = found + seplen;
+        }
 
-#define store(u) \
-    if (PadUni_Len(u)) { \
-        if (capa >= cursize) { \
-            capa *= 2; \
-            int32_t nbyte = sizeof(PadUni *); \
-            PadUni **tmp = PadMem_Realloc(arr, capa * nbyte + nbyte); \
-            if (!tmp) { \
-                return NULL; \
-            } \
-            arr = tmp; \
-        } \
-        arr[cursize++] = PadMem_Move(u); \
-        arr[cursize] = NULL; \
-        u = PadUni_New(); \
-    } \
+        // store token if not empty
+        if (end > begin) {
+            if (cursize >= capa) {
+                capa *= 2;
+                int32_t nbyte = sizeof(PadUni *);
+                PadUni **tmp = PadMem_Realloc(arr, capa * nbyte + nbyte);
+                if (!tmp) {
+                    goto fail;
+                }
+                arr = tmp;
+            }
+            arr[cursize] = new_from_range(buf + begin, end - begin);
+            if (!arr[cursize]) {
+                goto fail;
+            }
+            arr[++cursize] = NULL;
+        }
 
-    int32_t seplen = PadU_Len(sep);
+        if (end == len) {
+            break;
+        }
+        begin = next;
+    }
+
+    return arr;
+fail:
+    for (PadUni **p = arr; *p; ++p) {
+        PadUni_Del(*p);
+    }
+    free(arr);
+    return NULL;
+}
 
-    for (const PadUniType *p = other->buffer; *p; ) {
-        if (!PadU_StrNCmp(p, sep, seplen)) {
-            store(u);
-            p += seplen;
-        } else {
-            PadUni_PushBack(u, *p++);
+int32_t
+PadUni_Find(const PadUni *self, const PadUniType *sub, int32_t start) {
+    if (!self || !sub || start < 0) {
+        return -1;
+    }
+
+    return find_sub(self->buffer, self->length, sub, PadU_Len(sub), start);
+}
+
+int32_t
+PadUni_Count(const PadUni *self, const PadUniType *sub) {
+    if (!self || !sub) {
+        return -1;
+    }
+
+    int32_t sublen = PadU_Len(sub);
+    if (!sublen) {
+        return self->length + 1;  // empty strings match all positions
+    }
+
+    int32_t n = 0;
+    for (int32_t pos = 0; ; pos += sublen, n++) {
+        pos = find_sub(self->buffer, self->length, sub, sublen, pos);
+        if (pos < 0) {
+            break;
         }
     }
 
-    store(u);
+    return n;
+}
+
+PadUni *
+PadUni_Replace(const PadUni *other, const PadUniType *old, const PadUniType *new, int32_t count) {
+    if (!other || !old || !new) {
+        return NULL;
+    }
+
+    if (!count) {
+        return PadUni_DeepCopy(other);
+    }
 
-    PadUni_Del(u);
-    return arr;
+    // empty old matches all positions like PadUni_Count
+    // then next match is searched from next character
+    int32_t oldlen = PadU_Len(old);
+    int32_t step = oldlen ? oldlen : 1;
+
+    // count matches for size of result
+    const PadUniType *buf = other->buffer;
+    int32_t len = other->length;
+    int32_t n = 0;
+    int32_t first = find_sub(buf, len, old, oldlen, 0);
+    for (int32_t pos = first; pos >= 0 && (count < 0 || n < count); n++) {
+        pos = find_sub(buf, len, old, oldlen, pos + step);
+    }
+    if (!n) {
+        return PadUni_DeepCopy(other);
+    }
+
+    int32_t newlen = PadU_Len(new);
+    int32_t dstlen = len + n * (newlen - oldlen);
+    PadUni *self = PadUni_New();
+    if (!self) {
+        return NULL;
+    }
+    if (dstlen > self->capacity && !PadUni_Resize(self, dstlen)) {
+        PadUni_Del(self);
+        return NULL;
+    }
+
+    int32_t byte = sizeof(PadUniType);
+    PadUniType *dst = self->buffer;
+    int32_t prev = 0;
+    for (int32_t i = 0, pos = first; i < n; i++) {
+        memcpy(dst, buf + prev, (pos - prev) * byte);
+        dst += pos - prev;
+        memcpy(dst, new, newlen * byte);
+        dst += newlen;
+        prev = pos + oldlen;
+        pos = find_sub(buf, len, old, oldlen, pos + step);
+    }
+    memcpy(dst, buf + prev, (len - prev) * byte);
+
+    self->length = dstlen;
+    self->buffer[dstlen] = NIL;
+
+    return self;
 }
 
 bool
-PadUni_IsDigit(const PadUni *self) {
-    if (!self) {
+PadUni_StartsWith(const PadUni *self, const PadUniType *prefix) {
+    if (!self || !prefix) {
         return false;
     }
 
-    for (const PadUniType *p = self->buffer; *p; ++p) {
-        if (!PadU_IsDigit(*p)) {
-            return false;
-        }
+    int32_t n = PadU_Len(prefix);
+    return n <= self->length &&
+           !memcmp(self->buffer, prefix, n * sizeof(PadUniType));
+}
+
+bool
+PadUni_EndsWith(const PadUni *self, const PadUniType *suffix) {
+    if (!self || !suffix) {
+        return false;
     }
 
-    return true;
+    int32_t n = PadU_Len(suffix);
+    return n <= self->length &&
+           !memcmp(self->buffer + self->length - n, suffix, n * sizeof(PadUniType));
 }
 
 bool
-PadUni_IsAlpha(const PadUni *self) {
+PadUni_IsDigit(const PadUni *self) {
     if (!self) {
         return false;
     }
 
-    for (const PadUniType *p = self->buffer; *p; ++p) {
-        if (!PadU_IsAlpha(*p)) {
-            return false;
-        }
+    return PadUniKernel_SpanDigit(self->buffer, self->length) == self->length;
+}
+
+bool
+PadUni_IsAlpha(const PadUni *self) {
+    if (!self) {
+        return false;
     }
 
-    return true;
+    return PadUniKernel_SpanAlpha(self->buffer, self->length) == self->length;
 }
 
 bool
@@ -1087,13 +1476,7 @@ PadUni_IsSpace(const PadUni *self) {
         return false;
     }
 
-    for (const PadUniType *p = self->buffer; *p; ++p) {
-        if (!PadU_IsSpace(*p)) {
-            return false;
-        }
-    }
-
-    return true;
+    return PadUniKernel_SpanSpace(self->buffer, self->length) == self->length;
 }
 
 int
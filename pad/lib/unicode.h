@@ -459,6 +459,19 @@ PadUni_PopFront(PadUni *self);
 PadUni *
 PadUni_App(PadUni *self, const PadUniType *src);
 
+/**
+ * append n characters at tail of buffer
+ * src can have NUL characters and it does not need NUL terminator
+ *
+ * @param[in] *self
+ * @param[in] *src  unicode characters (read-only)
+ * @param[in] n     number of characters
+ *
+ * @return success to self else NULL
+ */
+PadUni *
+PadUni_AppN(PadUni *self, const PadUniType *src, int32_t n);
+
 /**
  * append unicode string of stream at tail of buffer
  *
@@ -480,6 +493,14 @@ PadUni_AppStream(PadUni *self, FILE *fin);
 PadUni *
 PadUni_DeepCopy(const PadUni *other);
 
+/**
+ * shallow copy object
+ * the buffer is shared with other and copied at first mutation (copy on write)
+ *
+ * @param[in] *other other object
+ *
+ * @return success to new object else NULL
+ */
 PadUni *
 PadUni_ShallowCopy(const PadUni *other);
 
@@ -564,6 +585,7 @@ PadUni_Strip(const PadUni *other, const PadUniType *rems);
 
 /**
  * get multi byte strings after converted from unicode strings
+ * the converted strings are cached until next mutation of self
  *
  * @param[in] *self
  *
@@ -662,6 +684,68 @@ PadUni_Mul(const PadUni *other, int32_t n);
 PadUni **
 PadUni_Split(const PadUni *other, const PadUniType *sep);
 
+/**
+ * find sub strings
+ *
+ * @param[in] *self
+ * @param[in] *sub  pointer to strings for find
+ * @param[in] start index of start of find
+ *
+ * @return found to index of sub
+ * @return not found or failed to -1
+ */
+int32_t
+PadUni_Find(const PadUni *self, const PadUniType *sub, int32_t start);
+
+/**
+ * count sub strings without overlap
+ *
+ * @param[in] *self
+ * @param[in] *sub  pointer to strings for count
+ *
+ * @return success to number of sub (if sub is empty then length + 1)
+ * @return failed to -1
+ */
+int32_t
+PadUni_Count(const PadUni *self, const PadUniType *sub);
+
+/**
+ * replace sub strings to new strings
+ * result is allocated at once by number of matches
+ *
+ * @param[in] *other other object (read-only)
+ * @param[in] *old   pointer to strings for replace (if empty then insert new at all positions)
+ * @param[in] *new   pointer to new strings
+ * @param[in] count  maximum number of replace. if negative then replace all
+ *
+ * @return success to pointer to PadUni (dynamic allocate memory)
+ * @return failed to NULL
+ */
+PadUni *
+PadUni_Replace(const PadUni *other, const PadUniType *old, const PadUniType *new, int32_t count);
+
+/**
+ * if self starts with prefix then return true
+ *
+ * @param[in] *self
+ * @param[in] *prefix
+ *
+ * @return true or false
+ */
+bool
+PadUni_StartsWith(const PadUni *self, const PadUniType *prefix);
+
+/**
+ * if self ends with suffix then return true
+ *
+ * @param[in] *self
+ * @param[in] *suffix
+ *
+ * @return true or false
+ */
+bool
+PadUni_EndsWith(const PadUni *self, const PadUniType *suffix);
+
 bool
 PadUni_IsDigit(const PadUni *self);
 
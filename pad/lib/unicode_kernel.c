@@ -0,0 +1,553 @@
+#include <pad/lib/unicode_kernel.h>
+
+#if defined(PAD_UNI__CHAR32) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+# define PAD_UNI_KERNEL__X86 1
+# include <immintrin.h>
+#else
+# undef PAD_UNI_KERNEL__X86
+#endif
+
+/**
+ * table of kernels for each level
+ * range kernels handle characters of [lo, hi] after OR with mask
+ */
+typedef struct {
+    int32_t (*find_ch)(const PadUniType *s, int32_t len, PadUniType ch);
+    void (*case_map)(PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, int32_t delta);
+    int32_t (*span_range)(const PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, PadUniType mask);
+    int32_t (*span_space)(const PadUniType *s, int32_t len);
+    int32_t (*span_html)(const char *s, int32_t len);
+    int32_t (*span_json)(const char *s, int32_t len);
+    int32_t (*narrow_ascii)(char *dst, const PadUniType *s, int32_t len);
+} kernels_t;
+
+/*********
+* scalar *
+*********/
+
+static int32_t
+scalar_find_ch(const PadUniType *s, int32_t len, PadUniType ch) {
+    for (int32_t i = 0; i < len; i++) {
+        if (s[i] == ch) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void
+scalar_case_map(PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, int32_t delta) {
+    for (int32_t i = 0; i < len; i++) {
+        if (s[i] >= lo && s[i] <= hi) {
+            s[i] += delta;
+        }
+    }
+}
+
+static int32_t
+scalar_span_range(const PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, PadUniType mask) {
+    int32_t i = 0;
+    for (; i < len; i++) {
+        PadUniType ch = s[i] | mask;
+        if (ch < lo || ch > hi) {
+            break;
+        }
+    }
+    return i;
+}
+
+static int32_t
+scalar_span_space(const PadUniType *s, int32_t len) {
+    int32_t i = 0;
+    for (; i < len && PadU_IsSpace(s[i]); i++) {
+    }
+    return i;
+}
+
+static int32_t
+scalar_span_html(const char *s, int32_t len) {
+    int32_t i = 0;
+    for (; i < len; i++) {
+        switch (s[i]) {
+        case '<': case '>': case '&': case '"': case '\'':
+            return i;
+            break;
+        }
+    }
+    return i;
+}
+
+static int32_t
+scalar_span_json(const char *s, int32_t len) {
+    int32_t i = 0;
+    for (; i < len; i++) {
+        unsigned char c = s[i];
+        if (c == '"' || c == '\\' || c < 0x20) {
+            break;
+        }
+    }
+    return i;
+}
+
+static int32_t
+scalar_narrow_ascii(char *dst, const PadUniType *s, int32_t len) {
+    int32_t i = 0;
+    for (; i < len && s[i] < 0x80; i++) {
+        dst[i] = s[i];
+    }
+    return i;
+}
+
+static const kernels_t
+scalar_kernels = {
+    scalar_find_ch,
+    scalar_case_map,
+    scalar_span_range,
+    scalar_span_space,
+    scalar_span_html,
+    scalar_span_json,
+    scalar_narrow_ascii,
+};
+
+#if defined(PAD_UNI_KERNEL__X86)
+
+/*******
+* sse2 *
+*******/
+
+// code points are compared as signed 32 bit integers. characters over
+// 0x7fffffff are negative and never be in ranges of ASCII
+
+__attribute__((target("sse2")))
+static int32_t
+sse2_find_ch(const PadUniType *s, int32_t len, PadUniType ch) {
+    __m128i needle = _mm_set1_epi32(ch);
+    int32_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+        int bits = _mm_movemask_epi8(_mm_cmpeq_epi32(v, needle));
+        if (bits) {
+            return i + __builtin_ctz(bits) / 4;
+        }
+    }
+    int32_t j = scalar_find_ch(s + i, len - i, ch);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("sse2")))
+static void
+sse2_case_map(PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, int32_t delta) {
+    __m128i vlo = _mm_set1_epi32(lo - 1);
+    __m128i vhi = _mm_set1_epi32(hi + 1);
+    __m128i vdelta = _mm_set1_epi32(delta);
+    int32_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+        __m128i in = _mm_and_si128(_mm_cmpgt_epi32(v, vlo), _mm_cmplt_epi32(v, vhi));
+        v = _mm_add_epi32(v, _mm_and_si128(in, vdelta));
+        _mm_storeu_si128((__m128i *) (s + i), v);
+    }
+    scalar_case_map(s + i, len - i, lo, hi, delta);
+}
+
+__attribute__((target("sse2")))
+static int32_t
+sse2_span_range(const PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, PadUniType mask) {
+    __m128i vlo = _mm_set1_epi32(lo - 1);
+    __m128i vhi = _mm_set1_epi32(hi + 1);
+    __m128i vmask = _mm_set1_epi32(mask);
+    int32_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128i v = _mm_or_si128(_mm_loadu_si128((const __m128i *) (s + i)), vmask);
+        __m128i in = _mm_and_si128(_mm_cmpgt_epi32(v, vlo), _mm_cmplt_epi32(v, vhi));
+        int bits = _mm_movemask_epi8(in);
+        if (bits != 0xffff) {
+            return i + __builtin_ctz(~bits) / 4;
+        }
+    }
+    return i + scalar_span_range(s + i, len - i, lo, hi, mask);
+}
+
+__attribute__((target("sse2")))
+static int32_t
+sse2_span_space(const PadUniType *s, int32_t len) {
+    __m128i nl = _mm_set1_epi32('\n');
+    __m128i tab = _mm_set1_epi32('\t');
+    __m128i sp = _mm_set1_epi32(' ');
+    int32_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+        __m128i in = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(v, nl), _mm_cmpeq_epi32(v, tab)),
+            _mm_cmpeq_epi32(v, sp)
+        );
+        int bits = _mm_movemask_epi8(in);
+        if (bits != 0xffff) {
+            return i + __builtin_ctz(~bits) / 4;
+        }
+    }
+    return i + scalar_span_space(s + i, len - i);
+}
+
+__attribute__((target("sse2")))
+static int32_t
+sse2_span_html(const char *s, int32_t len) {
+    __m128i lt = _mm_set1_epi8('<');
+    __m128i gt = _mm_set1_epi8('>');
+    __m128i amp = _mm_set1_epi8('&');
+    __m128i dq = _mm_set1_epi8('"');
+    __m128i sq = _mm_set1_epi8('\'');
+    int32_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+        __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, gt)),
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, dq)),
+                _mm_cmpeq_epi8(v, sq)
+            )
+        );
+        int bits = _mm_movemask_epi8(hit);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+    return i + scalar_span_html(s + i, len - i);
+}
+
+// control characters are found by unsigned min with 0x1f (equal if <= 0x1f)
+__attribute__((target("sse2")))
+static int32_t
+sse2_span_json(const char *s, int32_t len) {
+    __m128i dq = _mm_set1_epi8('"');
+    __m128i bs = _mm_set1_epi8('\\');
+    __m128i ctl = _mm_set1_epi8(0x1f);
+    int32_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+        __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, dq), _mm_cmpeq_epi8(v, bs)),
+            _mm_cmpeq_epi8(_mm_min_epu8(v, ctl), v)
+        );
+        int bits = _mm_movemask_epi8(hit);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+    return i + scalar_span_json(s + i, len - i);
+}
+
+// 16 characters are checked by OR of them and packed to 16 bytes at once
+__attribute__((target("sse2")))
+static int32_t
+sse2_narrow_ascii(char *dst, const PadUniType *s, int32_t len) {
+    __m128i high = _mm_set1_epi32(~0x7f);
+    int32_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (s + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (s + i + 4));
+        __m128i c = _mm_loadu_si128((const __m128i *) (s + i + 8));
+        __m128i d = _mm_loadu_si128((const __m128i *) (s + i + 12));
+        __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        __m128i over = _mm_and_si128(all, high);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(over, _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i *) (dst + i), packed);
+    }
+    return i + scalar_narrow_ascii(dst + i, s + i, len - i);
+}
+
+static const kernels_t
+sse2_kernels = {
+    sse2_find_ch,
+    sse2_case_map,
+    sse2_span_range,
+    sse2_span_space,
+    sse2_span_html,
+    sse2_span_json,
+    sse2_narrow_ascii,
+};
+
+/*******
+* avx2 *
+*******/
+
+__attribute__((target("avx2")))
+static int32_t
+avx2_find_ch(const PadUniType *s, int32_t len, PadUniType ch) {
+    __m256i needle = _mm256_set1_epi32(ch);
+    int32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        uint32_t bits = _mm256_movemask_epi8(_mm256_cmpeq_epi32(v, needle));
+        if (bits) {
+            return i + __builtin_ctz(bits) / 4;
+        }
+    }
+    int32_t j = sse2_find_ch(s + i, len - i, ch);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("avx2")))
+static void
+avx2_case_map(PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, int32_t delta) {
+    __m256i vlo = _mm256_set1_epi32(lo - 1);
+    __m256i vhi = _mm256_set1_epi32(hi + 1);
+    __m256i vdelta = _mm256_set1_epi32(delta);
+    int32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        __m256i in = _mm256_and_si256(_mm256_cmpgt_epi32(v, vlo), _mm256_cmpgt_epi32(vhi, v));
+        v = _mm256_add_epi32(v, _mm256_and_si256(in, vdelta));
+        _mm256_storeu_si256((__m256i *) (s + i), v);
+    }
+    sse2_case_map(s + i, len - i, lo, hi, delta);
+}
+
+__attribute__((target("avx2")))
+static int32_t
+avx2_span_range(const PadUniType *s, int32_t len, PadUniType lo, PadUniType hi, PadUniType mask) {
+    __m256i vlo = _mm256_set1_epi32(lo - 1);
+    __m256i vhi = _mm256_set1_epi32(hi + 1);
+    __m256i vmask = _mm256_set1_epi32(mask);
+    int32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256i v = _mm256_or_si256(_mm256_loadu_si256((const __m256i *) (s + i)), vmask);
+        __m256i in = _mm256_and_si256(_mm256_cmpgt_epi32(v, vlo), _mm256_cmpgt_epi32(vhi, v));
+        uint32_t bits = _mm256_movemask_epi8(in);
+        if (bits != 0xffffffff) {
+            return i + __builtin_ctz(~bits) / 4;
+        }
+    }
+    return i + sse2_span_range(s + i, len - i, lo, hi, mask);
+}
+
+__attribute__((target("avx2")))
+static int32_t
+avx2_span_space(const PadUniType *s, int32_t len) {
+    __m256i nl = _mm256_set1_epi32('\n');
+    __m256i tab = _mm256_set1_epi32('\t');
+    __m256i sp = _mm256_set1_epi32(' ');
+    int32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        __m256i in = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi32(v, nl), _mm256_cmpeq_epi32(v, tab)),
+            _mm256_cmpeq_epi32(v, sp)
+        );
+        uint32_t bits = _mm256_movemask_epi8(in);
+        if (bits != 0xffffffff) {
+            return i + __builtin_ctz(~bits) / 4;
+        }
+    }
+    return i + sse2_span_space(s + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static int32_t
+avx2_span_html(const char *s, int32_t len) {
+    __m256i lt = _mm256_set1_epi8('<');
+    __m256i gt = _mm256_set1_epi8('>');
+    __m256i amp = _mm256_set1_epi8('&');
+    __m256i dq = _mm256_set1_epi8('"');
+    __m256i sq = _mm256_set1_epi8('\'');
+    int32_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, lt), _mm256_cmpeq_epi8(v, gt)),
+            _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, amp), _mm256_cmpeq_epi8(v, dq)),
+                _mm256_cmpeq_epi8(v, sq)
+            )
+        );
+        uint32_t bits = _mm256_movemask_epi8(hit);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+    return i + sse2_span_html(s + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static int32_t
+avx2_span_json(const char *s, int32_t len) {
+    __m256i dq = _mm256_set1_epi8('"');
+    __m256i bs = _mm256_set1_epi8('\\');
+    __m256i ctl = _mm256_set1_epi8(0x1f);
+    int32_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+        __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, dq), _mm256_cmpeq_epi8(v, bs)),
+            _mm256_cmpeq_epi8(_mm256_min_epu8(v, ctl), v)
+        );
+        uint32_t bits = _mm256_movemask_epi8(hit);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+    return i + sse2_span_json(s + i, len - i);
+}
+
+static const kernels_t
+avx2_kernels = {
+    avx2_find_ch,
+    avx2_case_map,
+    avx2_span_range,
+    avx2_span_space,
+    avx2_span_html,
+    avx2_span_json,
+    sse2_narrow_ascii,  // packs of AVX2 work in lanes. not faster than SSE2
+};
+
+#endif  // PAD_UNI_KERNEL__X86
+
+/***********
+* dispatch *
+***********/
+
+static const kernels_t *kernels;  // selected kernels. NULL until first use
+static PadUniKernelLevel kernels_level;
+
+PadUniKernelLevel
+PadUniKernel_GetMaxLevel(void) {
+#if defined(PAD_UNI_KERNEL__X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return PAD_UNI_KERNEL__AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return PAD_UNI_KERNEL__SSE2;
+    }
+#endif
+    return PAD_UNI_KERNEL__SCALAR;
+}
+
+PadUniKernelLevel
+PadUniKernel_SetLevel(PadUniKernelLevel level) {
+    PadUniKernelLevel max = PadUniKernel_GetMaxLevel();
+    if (level > max) {
+        level = max;
+    }
+
+    switch (level) {
+    default:
+        kernels = &scalar_kernels;
+        level = PAD_UNI_KERNEL__SCALAR;
+        break;
+#if defined(PAD_UNI_KERNEL__X86)
+    case PAD_UNI_KERNEL__SSE2:
+        kernels = &sse2_kernels;
+        break;
+    case PAD_UNI_KERNEL__AVX2:
+        kernels = &avx2_kernels;
+        break;
+#endif
+    }
+
+    kernels_level = level;
+    return level;
+}
+
+PadUniKernelLevel
+PadUniKernel_GetLevel(void) {
+    if (!kernels) {
+        PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+    }
+    return kernels_level;
+}
+
+const char *
+PadUniKernel_GetLevelName(PadUniKernelLevel level) {
+    switch (level) {
+    case PAD_UNI_KERNEL__SCALAR: return "scalar"; break;
+    case PAD_UNI_KERNEL__SSE2: return "sse2"; break;
+    case PAD_UNI_KERNEL__AVX2: return "avx2"; break;
+    }
+    return "unknown";
+}
+
+static inline const kernels_t *
+get_kernels(void) {
+    if (!kernels) {
+        PadUniKernel_GetLevel();
+    }
+    return kernels;
+}
+
+int32_t
+PadUniKernel_FindCh(const PadUniType *s, int32_t len, PadUniType ch) {
+    if (!s || len <= 0) {
+        return -1;
+    }
+    return get_kernels()->find_ch(s, len, ch);
+}
+
+void
+PadUniKernel_Lower(PadUniType *s, int32_t len) {
+    if (!s || len <= 0) {
+        return;
+    }
+    get_kernels()->case_map(s, len, PAD_UNI__CH('A'), PAD_UNI__CH('Z'), 32);
+}
+
+void
+PadUniKernel_Upper(PadUniType *s, int32_t len) {
+    if (!s || len <= 0) {
+        return;
+    }
+    get_kernels()->case_map(s, len, PAD_UNI__CH('a'), PAD_UNI__CH('z'), -32);
+}
+
+int32_t
+PadUniKernel_SpanDigit(const PadUniType *s, int32_t len) {
+    if (!s || len <= 0) {
+        return 0;
+    }
+    return get_kernels()->span_range(s, len, PAD_UNI__CH('0'), PAD_UNI__CH('9'), 0);
+}
+
+int32_t
+PadUniKernel_SpanAlpha(const PadUniType *s, int32_t len) {
+    if (!s || len <= 0) {
+        return 0;
+    }
+    // OR with 0x20 maps 'A'-'Z' to 'a'-'z' and no other character into it
+    return get_kernels()->span_range(s, len, PAD_UNI__CH('a'), PAD_UNI__CH('z'), 0x20);
+}
+
+int32_t
+PadUniKernel_SpanSpace(const PadUniType *s, int32_t len) {
+    if (!s || len <= 0) {
+        return 0;
+    }
+    return get_kernels()->span_space(s, len);
+}
+
+int32_t
+PadUniKernel_SpanHtmlSafe(const char *s, int32_t len) {
+    if (!s || len <= 0) {
+        return 0;
+    }
+    return get_kernels()->span_html(s, len);
+}
+
+int32_t
+PadUniKernel_SpanJsonSafe(const char *s, int32_t len) {
+    if (!s || len <= 0) {
+        return 0;
+    }
+    return get_kernels()->span_json(s, len);
+}
+
+int32_t
+PadUniKernel_NarrowAscii(char *dst, const PadUniType *s, int32_t len) {
+    if (!dst || !s || len <= 0) {
+        return 0;
+    }
+    return get_kernels()->narrow_ascii(dst, s, len);
+}
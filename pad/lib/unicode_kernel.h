@@ -0,0 +1,163 @@
+/**
+ * Kernels of unicode strings
+ *
+ * search, ASCII case mapping and classification over buffer of PadUniType
+ * and scan of HTML and JSON special characters over multi byte strings
+ * the kernels use SSE2 or AVX2 if CPU supports it (selected at runtime)
+ * otherwise scalar loops are used
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <pad/lib/unicode.h>
+
+typedef enum {
+    PAD_UNI_KERNEL__SCALAR,
+    PAD_UNI_KERNEL__SSE2,
+    PAD_UNI_KERNEL__AVX2,
+} PadUniKernelLevel;
+
+/**
+ * get level of kernels in use
+ * the level is detected by CPU at first call
+ *
+ * @return number of level
+ */
+PadUniKernelLevel
+PadUniKernel_GetLevel(void);
+
+/**
+ * get best level of kernels on this CPU
+ *
+ * @return number of level
+ */
+PadUniKernelLevel
+PadUniKernel_GetMaxLevel(void);
+
+/**
+ * set level of kernels. for tests and benchmarks
+ * if CPU does not support level then best supported level is used
+ *
+ * @param[in] level number of level
+ *
+ * @return number of level in use
+ */
+PadUniKernelLevel
+PadUniKernel_SetLevel(PadUniKernelLevel level);
+
+/**
+ * get name of level
+ *
+ * @param[in] level number of level
+ *
+ * @return pointer to strings ("scalar", "sse2" or "avx2")
+ */
+const char *
+PadUniKernel_GetLevelName(PadUniKernelLevel level);
+
+/**
+ * find character in buffer
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ * @param[in] ch  character for find
+ *
+ * @return found to index of character
+ * @return not found to -1
+ */
+int32_t
+PadUniKernel_FindCh(const PadUniType *s, int32_t len, PadUniType ch);
+
+/**
+ * convert ASCII upper case characters to lower case in place
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ */
+void
+PadUniKernel_Lower(PadUniType *s, int32_t len);
+
+/**
+ * convert ASCII lower case characters to upper case in place
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ */
+void
+PadUniKernel_Upper(PadUniType *s, int32_t len);
+
+/**
+ * get length of leading digits ('0' to '9')
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ *
+ * @return number of length
+ */
+int32_t
+PadUniKernel_SpanDigit(const PadUniType *s, int32_t len);
+
+/**
+ * get length of leading ASCII alphabets
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ *
+ * @return number of length
+ */
+int32_t
+PadUniKernel_SpanAlpha(const PadUniType *s, int32_t len);
+
+/**
+ * get length of leading spaces (see PadChar32_IsSpace)
+ *
+ * @param[in] *s  pointer to buffer
+ * @param[in] len length of buffer
+ *
+ * @return number of length
+ */
+int32_t
+PadUniKernel_SpanSpace(const PadUniType *s, int32_t len);
+
+/**
+ * get length of leading bytes that need no escape in HTML
+ * (other than '<', '>', '&', '"' and '\'')
+ *
+ * @param[in] *s  pointer to multi byte strings
+ * @param[in] len length of strings
+ *
+ * @return number of length
+ */
+int32_t
+PadUniKernel_SpanHtmlSafe(const char *s, int32_t len);
+
+/**
+ * get length of leading bytes that need no escape in JSON strings
+ * (other than '"', '\\' and control characters under 0x20)
+ *
+ * @param[in] *s  pointer to multi byte strings
+ * @param[in] len length of strings
+ *
+ * @return number of length
+ */
+int32_t
+PadUniKernel_SpanJsonSafe(const char *s, int32_t len);
+
+/**
+ * copy leading ASCII characters to bytes
+ * copy stops at first character that is not ASCII
+ *
+ * @param[out] *dst pointer to destination (needs len bytes)
+ * @param[in]  *s   pointer to buffer
+ * @param[in]  len  length of buffer
+ *
+ * @return number of copied characters
+ */
+int32_t
+PadUniKernel_NarrowAscii(char *dst, const PadUniType *s, int32_t len);
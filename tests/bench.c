@@ -0,0 +1,655 @@
+/**
+ * Pad
+ *
+ * micro benchmarks of kernels and modules
+ * they print throughput to stderr and are not run by tests
+ *
+ *     $ make bench
+ *     $ build/pad_bench [name]
+ *
+ * run at root of repository because some benches import modules of lib
+ *
+ * License: MIT
+ *  Author: narupo
+ *   Since: 2026
+ */
+#include <tests/tests.h>
+
+/*********
+* macros *
+*********/
+
+// same as tests/tests.c
+#define check_ok(code, hope) \
+    PadTkr_Parse(tkr, code); \
+    { \
+        PadAST_Clear(ast); \
+        PadCC_Compile(ast, PadTkr_GetToks(tkr)); \
+        PadCtx_Clear(ctx); \
+        PadTrv_Trav(ast, ctx); \
+        assert(!PadAST_HasErrs(ast)); \
+        assert(!strcmp(PadCtx_GetcStdoutBuf(ctx), hope)); \
+    }
+
+#define trv_ready \
+    PadConfig *config = PadConfig_New(); \
+    PadTkrOpt *opt = PadTkrOpt_New(); \
+    PadTkr *tkr = PadTkr_New(PadMem_Move(opt)); \
+    PadAST *ast = PadAST_New(config); \
+    PadGC *gc = PadGC_New(); \
+    PadCtx *ctx = PadCtx_New(gc, PAD_CTX_TYPE__DEFAULT); \
+
+#define trv_cleanup \
+    PadCtx_Del(ctx); \
+    PadGC_Del(gc); \
+    PadAST_Del(ast); \
+    PadTkr_Del(tkr); \
+    PadConfig_Del(config); \
+
+/********
+* bench *
+********/
+
+struct bench {
+    const char *name;
+    void (*bench)(void);
+};
+
+/*********************
+* lib/unicode_kernel *
+*********************/
+
+/**
+ * kernels on multi-megabyte input for each level
+ */
+static void
+bench_unicode_kernel(void) {
+    enum { N = 4 * 1024 * 1024, NLOOP = 4 };
+    PadUniType *buf = PadMem_Calloc(N + 1, sizeof(PadUniType));
+    PadUniType *alpha = PadMem_Calloc(N + 1, sizeof(PadUniType));
+    assert(buf && alpha);
+    for (int32_t i = 0; i < N; i++) {
+        buf[i] = (i % 80 == 79) ? U'\n' : U'A' + i % 26;
+        alpha[i] = U'a' + i % 26;
+    }
+
+    for (PadUniKernelLevel level = PAD_UNI_KERNEL__SCALAR;
+         level <= PadUniKernel_GetMaxLevel(); level++) {
+        PadUniKernel_SetLevel(level);
+
+        clock_t start = clock();
+        int32_t nlines = 0;
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            nlines = 0;
+            for (int32_t pos = 0, i; pos < N; pos += i + 1, nlines++) {
+                i = PadUniKernel_FindCh(buf + pos, N - pos, U'\n');
+                if (i < 0) {
+                    break;
+                }
+            }
+        }
+        clock_t find_end = clock();
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            PadUniKernel_Lower(buf, N);
+            PadUniKernel_Upper(buf, N);
+        }
+        clock_t case_end = clock();
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            assert(PadUniKernel_SpanAlpha(alpha, N) == N);
+        }
+        clock_t span_end = clock();
+        assert(nlines == N / 80);
+
+        double mb = (double) N * sizeof(PadUniType) * NLOOP / (1024 * 1024);
+        fprintf(stderr,
+            "%-6s find %7.1f MB/s, lower+upper %7.1f MB/s, isalpha %7.1f MB/s\n",
+            PadUniKernel_GetLevelName(level),
+            mb / ((double) (find_end - start) / CLOCKS_PER_SEC + 1e-9),
+            mb * 2 / ((double) (case_end - find_end) / CLOCKS_PER_SEC + 1e-9),
+            mb / ((double) (span_end - case_end) / CLOCKS_PER_SEC + 1e-9)
+        );
+    }
+
+    PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+    free(buf);
+    free(alpha);
+}
+
+/*****************
+* lib/num_kernel *
+*****************/
+
+/**
+ * kernels on 1M elements for each level
+ */
+static void
+bench_num_kernel(void) {
+    enum { N = 1024 * 1024, NLOOP = 8 };
+    double *a = PadMem_Calloc(N, sizeof(double));
+    double *b = PadMem_Calloc(N, sizeof(double));
+    double *dst = PadMem_Calloc(N, sizeof(double));
+    int64_t *is = PadMem_Calloc(N, sizeof(int64_t));
+    assert(a && b && dst && is);
+    for (int32_t i = 0; i < N; i++) {
+        a[i] = i % 100;
+        b[i] = 1 + i % 7;
+        is[i] = i % 1000;
+    }
+
+    for (PadNumKernelLevel level = PAD_NUM_KERNEL__SCALAR;
+         level <= PadNumKernel_GetMaxLevel(); level++) {
+        PadNumKernel_SetLevel(level);
+
+        clock_t start = clock();
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            PadNumKernel_CalcFloat(PAD_NUM_OP__MUL, dst, a, 1, b, 1, N);
+            PadNumKernel_CalcFloat(PAD_NUM_OP__ADD, dst, dst, 1, a, 1, N);
+        }
+        clock_t calc_end = clock();
+        double sum = 0;
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            sum = PadNumKernel_SumFloat(dst, N);
+        }
+        clock_t sum_end = clock();
+        int64_t max = 0;
+        for (int32_t loop = 0; loop < NLOOP; loop++) {
+            max = PadNumKernel_MaxInt(is, N);
+        }
+        clock_t max_end = clock();
+        assert(sum > 0);
+        assert(max == 999);
+
+        double mb = (double) N * sizeof(double) * NLOOP / (1024 * 1024);
+        fprintf(stderr,
+            "%-6s mul+add %7.1f MB/s, sum %7.1f MB/s, max %7.1f MB/s\n",
+            PadNumKernel_GetLevelName(level),
+            mb * 2 / ((double) (calc_end - start) / CLOCKS_PER_SEC + 1e-9),
+            mb / ((double) (sum_end - calc_end) / CLOCKS_PER_SEC + 1e-9),
+            mb / ((double) (max_end - sum_end) / CLOCKS_PER_SEC + 1e-9)
+        );
+    }
+
+    PadNumKernel_SetLevel(PadNumKernel_GetMaxLevel());
+    free(a);
+    free(b);
+    free(dst);
+    free(is);
+}
+
+/************
+* lib/regex *
+************/
+
+static PadRegex *
+regex_new(const char *pattern, int32_t flags, char *err, int32_t errsz) {
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, pattern);
+    PadRegex *re = PadRegex_New(PadUni_Getc(u), PadUni_Len(u), flags, err, errsz);
+    PadUni_Del(u);
+    return re;
+}
+
+/**
+ * pathological pattern and find all on 2M characters text
+ */
+static void
+bench_regex(void) {
+    char err[256];
+
+    // (a?){n}a{n} takes exponential time on backtracking engines
+    for (int32_t n = 10; n <= 40; n += 10) {
+        char pattern[128];
+        snprintf(pattern, sizeof pattern, "(a?){%d}a{%d}", n, n);
+        PadRegex *re = regex_new(pattern, 0, err, sizeof err);
+        assert(re);
+        PadUniType text[64] = {0};
+        for (int32_t i = 0; i < n; i++) {
+            text[i] = 'a';
+        }
+        int32_t caps[4];
+        clock_t start = clock();
+        assert(PadRegex_Search(re, text, n, 0, true, caps));
+        assert(caps[0] == 0 && caps[1] == n);
+        fprintf(stderr, "(a?){%d}a{%d} %.3f ms\n", n, n,
+            (double) (clock() - start) * 1000 / CLOCKS_PER_SEC);
+        PadRegex_Del(re);
+    }
+
+    // find all of mail addresses in text
+    enum { LEN = 1 << 21 };
+    static const char *words[] = {"lorem ", "ipsum ", "dolor ", "sit ", "amet, ", "user@example.com "};
+    PadUniType *text = PadMem_Calloc(LEN + 32, sizeof(PadUniType));
+    int32_t len = 0;
+    int32_t nexpect = 0;
+    for (int32_t i = 0; len < LEN; i++) {
+        const char *w = words[(i * 7) % 6];
+        nexpect += w == words[5];
+        for (const char *p = w; *p; p++) {
+            text[len++] = *p;
+        }
+    }
+
+    PadRegex *re = regex_new("(\\w+)@(\\w+)\\.com", 0, err, sizeof err);
+    assert(re);
+    int32_t caps[6];
+    int32_t n = 0;
+    clock_t start = clock();
+    for (int32_t pos = 0; PadRegex_Search(re, text, len, pos, false, caps); pos = caps[1]) {
+        n++;
+    }
+    double sec = (double) (clock() - start) / CLOCKS_PER_SEC + 1e-9;
+    assert(n == nexpect);
+    fprintf(stderr, "findall %d matches in %d chars %.1f Mchars/s (%d states, %d resets)\n",
+        n, len, len / sec / 1e6, PadRegex_GetNCachedStates(re), PadRegex_GetNCacheResets(re));
+
+    PadRegex_Del(re);
+    free(text);
+}
+
+/************
+* lang/json *
+************/
+
+/**
+ * append array of records to JSON text
+ */
+static void
+app_json_records(PadStr *dst, int32_t nrecs) {
+    char buf[512];
+    PadStr_App(dst, "[");
+    for (int32_t i = 0; i < nrecs; i++) {
+        PadStr_AppFmt(dst, buf, sizeof buf,
+            "%s{\"id\": %d, \"name\": \"user \\\"%d\\\" あ\", \"score\": %d.%03d, "
+            "\"tags\": [\"a\", \"b\\\\\", \"c\"], \"active\": %s, \"extra\": null, "
+            "\"pos\": {\"x\": %d, \"y\": %d}}",
+            i ? ",\n" : "", i, i, i % 100, i * 7 % 1000,
+            i % 2 ? "true" : "false", i, -i
+        );
+    }
+    PadStr_App(dst, "]");
+}
+
+/**
+ * Pad-level JSON parser in the style of lib/stream.pad for comparison
+ */
+static const char json_pad_parser[] =
+    "{@\n"
+    "from \"lib/stream.pad\" import Stream\n"
+    "def skip(s):\n"
+    "    for c = s.cur(0); c == \" \" or c == \"\\n\"; c = s.cur(0):\n"
+    "        s.next()\n"
+    "    end\n"
+    "end\n"
+    "def parse(s):\n"
+    "    skip(s)\n"
+    "    c = s.get()\n"
+    "    if c == \"{\":\n"
+    "        d = {}\n"
+    "        skip(s)\n"
+    "        if s.cur(0) == \"}\":\n"
+    "            s.next()\n"
+    "            return d\n"
+    "        end\n"
+    "        for:\n"
+    "            k = parse(s)\n"
+    "            skip(s)\n"
+    "            s.next()\n"
+    "            d[k] = parse(s)\n"
+    "            skip(s)\n"
+    "            if s.get() == \"}\":\n"
+    "                return d\n"
+    "            end\n"
+    "            skip(s)\n"
+    "        end\n"
+    "    elif c == \"[\":\n"
+    "        a = []\n"
+    "        skip(s)\n"
+    "        if s.cur(0) == \"]\":\n"
+    "            s.next()\n"
+    "            return a\n"
+    "        end\n"
+    "        for:\n"
+    "            a.push(parse(s))\n"
+    "            skip(s)\n"
+    "            if s.get() == \"]\":\n"
+    "                return a\n"
+    "            end\n"
+    "        end\n"
+    "    elif c == \"\\\"\":\n"
+    "        t = \"\"\n"
+    "        for c = s.get(); c != \"\\\"\"; c = s.get():\n"
+    "            if c == \"\\\\\":\n"
+    "                c = s.get()\n"
+    "            end\n"
+    "            t += c\n"
+    "        end\n"
+    "        return t\n"
+    "    elif c == \"t\":\n"
+    "        s.index += 3\n"
+    "        return true\n"
+    "    elif c == \"f\":\n"
+    "        s.index += 4\n"
+    "        return false\n"
+    "    elif c == \"n\":\n"
+    "        s.index += 3\n"
+    "        return nil\n"
+    "    end\n"
+    "    t = c\n"
+    "    is_float = false\n"
+    "    for c = s.cur(0); c != nil; c = s.cur(0):\n"
+    "        o = ord(c)\n"
+    "        if c == \".\" or c == \"e\":\n"
+    "            is_float = true\n"
+    "        elif not (o >= 48 and o <= 57 or c == \"-\" or c == \"+\"):\n"
+    "            break\n"
+    "        end\n"
+    "        t += c\n"
+    "        s.next()\n"
+    "    end\n"
+    "    if is_float:\n"
+    "        v = Float(t)\n"
+    "    else:\n"
+    "        v = Int(t)\n"
+    "    end\n"
+    "    return v\n"
+    "end\n"
+    "f = open(\"/tmp/pad.test.json\", \"r\")\n"
+    "text = f.read()\n"
+    "f.close()\n"
+    "data = parse(Stream.new(text))\n"
+    "@}{: json.encode(data) == json.encode(json.decode(text)) :}";
+
+/**
+ * Pad-level parser and json.decode on same small document
+ * Pad-level parser is too slow for multi-megabyte document
+ */
+static void
+bench_json_pad_level(void) {
+    enum { NRECS = 24 };
+    PadStr *src = PadStr_New();
+    app_json_records(src, NRECS);
+    FILE *fout = fopen("/tmp/pad.test.json", "w");
+    assert(fout);
+    fputs(PadStr_Getc(src), fout);
+    fclose(fout);
+    double mb = (double) PadStr_Len(src) / (1024 * 1024);
+
+    trv_ready;
+    clock_t start = clock();
+    check_ok(json_pad_parser, "true");
+    clock_t pad_end = clock();
+    check_ok("{@ f = open(\"/tmp/pad.test.json\", \"r\")\n"
+             "data = json.decode(f.read())\n"
+             "f.close() @}{: len(data) :}", "24");
+    clock_t native_end = clock();
+    trv_cleanup;
+
+    fprintf(stderr, "pad-level %.3f MB decode %7.3f MB/s, json.decode %7.3f MB/s\n",
+        mb,
+        mb / ((double) (pad_end - start) / CLOCKS_PER_SEC + 1e-9),
+        mb / ((double) (native_end - pad_end) / CLOCKS_PER_SEC + 1e-9)
+    );
+
+    remove("/tmp/pad.test.json");
+    PadStr_Del(src);
+}
+
+/**
+ * decode and encode on multi-megabyte document for each level of kernels
+ * and comparison with Pad-level parser on small document
+ */
+static void
+bench_json(void) {
+    enum { NRECS = 24000 };
+    PadGC *gc = PadGC_New();
+    PadStr *src = PadStr_New();
+    PadStr *dst = PadStr_New();
+    char err[256];
+    app_json_records(src, NRECS);
+    double mb = (double) PadStr_Len(src) / (1024 * 1024);
+
+    for (PadUniKernelLevel level = PAD_UNI_KERNEL__SCALAR;
+         level <= PadUniKernel_GetMaxLevel(); level++) {
+        PadUniKernel_SetLevel(level);
+
+        clock_t start = clock();
+        PadObj *obj = PadJson_Decode(gc, PadStr_Getc(src), PadStr_Len(src), err, sizeof err);
+        clock_t decode_end = clock();
+        PadStr_Clear(dst);
+        assert(PadJson_EncodeToStr(dst, obj, 0, err, sizeof err));
+        clock_t encode_end = clock();
+        assert(obj && PadObjAry_Len(obj->objarr) == NRECS);
+        PadObj_Del(obj);
+
+        fprintf(stderr, "%-6s %.1f MB decode %7.1f MB/s, encode %7.1f MB/s\n",
+            PadUniKernel_GetLevelName(level), mb,
+            mb / ((double) (decode_end - start) / CLOCKS_PER_SEC + 1e-9),
+            (double) PadStr_Len(dst) / (1024 * 1024) /
+                ((double) (encode_end - decode_end) / CLOCKS_PER_SEC + 1e-9)
+        );
+    }
+    PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+
+    PadStr_Del(src);
+    PadStr_Del(dst);
+    PadGC_Del(gc);
+
+    bench_json_pad_level();
+}
+
+/***********
+* lang/ini *
+***********/
+
+/**
+ * get value of name in section of decoded dict
+ */
+static const char *
+ini_get(PadObj *obj, const char *section, const char *name) {
+    PadObjDictItem *sec = PadObjDict_Get(obj->objdict, section);
+    if (!sec || sec->value->type != PAD_OBJ_TYPE__DICT) {
+        return NULL;
+    }
+    PadObjDictItem *item = PadObjDict_Get(sec->value->objdict, name);
+    if (!item || item->value->type != PAD_OBJ_TYPE__UNICODE) {
+        return NULL;
+    }
+    return PadUni_GetcMB(item->value->unicode);
+}
+
+static void
+app_ini_sections(PadStr *dst, int32_t nsecs, int32_t nnames) {
+    char buf[256];
+    for (int32_t i = 0; i < nsecs; i++) {
+        PadStr_AppFmt(dst, buf, sizeof buf, "[section-%d]\n", i);
+        for (int32_t j = 0; j < nnames; j++) {
+            PadStr_AppFmt(dst, buf, sizeof buf, "name_%d = value-%d.%d\n", j, i, j);
+        }
+        PadStr_App(dst, "\n");
+    }
+}
+
+/**
+ * Pad-level INI parser of previous lib/ini.pad for comparison
+ */
+static const char ini_pad_parser[] =
+    "{@\n"
+    "from \"lib/text-file.pad\" import TextFile\n"
+    "struct P:\n"
+    "    data = {}\n"
+    "    cur = nil\n"
+    "    mode = \"first\"\n"
+    "    met isNameChar(self, c):\n"
+    "        return c.isalpha() or c.isdigit() or c == \"_\" or c == \"-\"\n"
+    "    end\n"
+    "    met parseLine(self, line):\n"
+    "        section = \"\"\n"
+    "        name = \"\"\n"
+    "        value = \"\"\n"
+    "        for i = 0; i < len(line); i += 1:\n"
+    "            c = line[i]\n"
+    "            if self.mode == \"first\":\n"
+    "                if c == \"[\":\n"
+    "                    self.mode = \"read section\"\n"
+    "                end\n"
+    "            elif self.mode == \"read section\":\n"
+    "                if c == \"]\":\n"
+    "                    self.mode = \"read name\"\n"
+    "                    self.cur = section\n"
+    "                else:\n"
+    "                    section += c\n"
+    "                end\n"
+    "            elif self.mode == \"read name\":\n"
+    "                if self.isNameChar(c):\n"
+    "                    self.mode = \"read name 2\"\n"
+    "                    name = c\n"
+    "                elif c == \"[\":\n"
+    "                    self.mode = \"read section\"\n"
+    "                end\n"
+    "            elif self.mode == \"read name 2\":\n"
+    "                if self.isNameChar(c):\n"
+    "                    name += c\n"
+    "                elif c.isspace():\n"
+    "                    self.mode = \"read name 3\"\n"
+    "                elif c == \"=\":\n"
+    "                    self.mode = \"read value\"\n"
+    "                end\n"
+    "            elif self.mode == \"read name 3\":\n"
+    "                if c == \"=\":\n"
+    "                    self.mode = \"read value\"\n"
+    "                end\n"
+    "            elif self.mode == \"read value\":\n"
+    "                if not c.isspace():\n"
+    "                    self.mode = \"read value 2\"\n"
+    "                    value += c\n"
+    "                end\n"
+    "            elif self.mode == \"read value 2\":\n"
+    "                if not c.isspace():\n"
+    "                    value += c\n"
+    "                else:\n"
+    "                    self.mode = \"read name\"\n"
+    "                    if not self.data.has(self.cur):\n"
+    "                        self.data[self.cur] = {}\n"
+    "                    end\n"
+    "                    self.data[self.cur][name] = value\n"
+    "                end\n"
+    "            end\n"
+    "        end\n"
+    "    end\n"
+    "end\n"
+    "fin = TextFile()\n"
+    "fin.open(\"/tmp/pad.test.ini\", \"r\")\n"
+    "lines = fin.readLines()\n"
+    "fin.close()\n"
+    "p = P()\n"
+    "for i = 0; i < len(lines); i += 1:\n"
+    "    p.parseLine(lines[i])\n"
+    "end\n"
+    "@}{: len(p.data[\"section-0\"]) :}";
+
+/**
+ * Pad-level parser and ini.load on same small document
+ * Pad-level parser is too slow for large document
+ */
+static void
+bench_ini_pad_level(void) {
+    enum { NSECS = 5, NNAMES = 20 };
+    PadStr *src = PadStr_New();
+    app_ini_sections(src, NSECS, NNAMES);
+    FILE *fout = fopen("/tmp/pad.test.ini", "w");
+    assert(fout);
+    fputs(PadStr_Getc(src), fout);
+    fclose(fout);
+    double kb = (double) PadStr_Len(src) / 1024;
+
+    trv_ready;
+    clock_t start = clock();
+    check_ok(ini_pad_parser, "20");
+    clock_t pad_end = clock();
+    check_ok("{@ d = ini.load(\"/tmp/pad.test.ini\") @}{: len(d[\"section-0\"]) :}", "20");
+    clock_t native_end = clock();
+    trv_cleanup;
+
+    fprintf(stderr, "pad-level %.1f KB parse %8.1f KB/s, ini.load %8.1f KB/s\n",
+        kb,
+        kb / ((double) (pad_end - start) / CLOCKS_PER_SEC + 1e-9),
+        kb / ((double) (native_end - pad_end) / CLOCKS_PER_SEC + 1e-9)
+    );
+
+    remove("/tmp/pad.test.ini");
+    PadStr_Del(src);
+}
+
+/**
+ * decode and encode on 20k lines document and comparison with Pad-level
+ * parser on small document
+ */
+static void
+bench_ini(void) {
+    enum { NSECS = 1000, NNAMES = 19 };
+    PadGC *gc = PadGC_New();
+    PadStr *src = PadStr_New();
+    PadStr *dst = PadStr_New();
+    char err[256];
+    app_ini_sections(src, NSECS, NNAMES);
+    double mb = (double) PadStr_Len(src) / (1024 * 1024);
+
+    clock_t start = clock();
+    PadObj *obj = PadIni_Decode(gc, PadStr_Getc(src), PadStr_Len(src), 0, err, sizeof err);
+    clock_t decode_end = clock();
+    assert(PadIni_EncodeToStr(dst, obj, err, sizeof err));
+    clock_t encode_end = clock();
+    assert(obj && PadObjDict_Len(obj->objdict) == NSECS);
+    assert(!strcmp(ini_get(obj, "section-999", "name_18"), "value-999.18"));
+    PadObj_Del(obj);
+
+    fprintf(stderr, "%d lines %.1f MB decode %7.1f MB/s, encode %7.1f MB/s\n",
+        NSECS * (NNAMES + 2), mb,
+        mb / ((double) (decode_end - start) / CLOCKS_PER_SEC + 1e-9),
+        (double) PadStr_Len(dst) / (1024 * 1024) /
+            ((double) (encode_end - decode_end) / CLOCKS_PER_SEC + 1e-9)
+    );
+
+    PadStr_Del(src);
+    PadStr_Del(dst);
+    PadGC_Del(gc);
+
+    bench_ini_pad_level();
+}
+
+/*******
+* main *
+*******/
+
+static const struct bench
+benches[] = {
+    {"unicode_kernel", bench_unicode_kernel},
+    {"num_kernel", bench_num_kernel},
+    {"regex", bench_regex},
+    {"json", bench_json},
+    {"ini", bench_ini},
+    {0},
+};
+
+int
+main(int argc, char *argv[]) {
+    setlocale(LC_CTYPE, "");
+
+    const char *name = argc >= 2 ? argv[1] : NULL;
+    int32_t nbench = 0;
+    for (const struct bench *b = benches; b->name; ++b) {
+        if (name && strcmp(name, b->name)) {
+            continue;
+        }
+        fprintf(stderr, "* bench '%s'\n", b->name);
+        b->bench();
+        ++nbench;
+    }
+
+    if (!nbench) {
+        fprintf(stderr, "not found bench \"%s\"\n", name ? name : "");
+        return 1;
+    }
+
+    return 0;
+}
@@ -1807,6 +1807,34 @@ test_PadUni_DeepCopy(void) {
     PadUni_Del(u);
 }
 
+static void
+test_PadUni_ShallowCopy(void) {
+    PadUni *u = PadUni_New();
+    assert(u != NULL);
+    assert(PadUni_SetMB(u, "1234") != NULL);
+    assert(PadUni_ShallowCopy(NULL) == NULL);
+
+    // buffer is shared until mutation
+    PadUni *o = PadUni_ShallowCopy(u);
+    PadUni *o2 = PadUni_ShallowCopy(o);
+    assert(o != NULL && o2 != NULL);
+    assert(PadUni_Getc(o) == PadUni_Getc(u));
+    assert(PadUni_Getc(o2) == PadUni_Getc(u));
+
+    assert(PadUni_App(o, PAD_UNI__STR("5")) != NULL);
+    assert(PadUni_Getc(o) != PadUni_Getc(u));
+    assert(PadU_StrCmp(PadUni_Getc(o), PAD_UNI__STR("12345")) == 0);
+    assert(PadU_StrCmp(PadUni_Getc(u), PAD_UNI__STR("1234")) == 0);
+
+    PadUni_Del(u);
+    assert(PadU_StrCmp(PadUni_Getc(o2), PAD_UNI__STR("1234")) == 0);
+    PadUni_Clear(o2);
+    assert(PadUni_Len(o2) == 0);
+
+    PadUni_Del(o2);
+    PadUni_Del(o);
+}
+
 static void
 test_PadUni_Len(void) {
     PadUni *u = PadUni_New();
@@ -2024,8 +2052,15 @@ test_PadUni_RStrip(void) {
     PadUni *o = PadUni_RStrip(u, PAD_UNI__STR("34"));
     assert(o);
     assert(PadU_StrCmp(PadUni_Getc(o), PAD_UNI__STR("12")) == 0);
+    assert(PadUni_Len(o) == 2);
+    PadUni_Del(o);
 
+    o = PadUni_RStrip(u, PAD_UNI__STR("1234"));
+    assert(o);
+    assert(PadUni_Len(o) == 0);
+    assert(!strcmp(PadUni_GetcMB(o), ""));
     PadUni_Del(o);
+
     PadUni_Del(u);
 }
 
@@ -2040,8 +2075,12 @@ test_PadUni_LStrip(void) {
     PadUni *o = PadUni_LStrip(u, PAD_UNI__STR("12"));
     assert(o);
     assert(PadU_StrCmp(PadUni_Getc(o), PAD_UNI__STR("34")) == 0);
-
+    assert(PadUni_Len(o) == 2);
     PadUni_Del(o);
+
+    // source is not changed
+    assert(PadU_StrCmp(PadUni_Getc(u), PAD_UNI__STR("1234")) == 0);
+
     PadUni_Del(u);
 }
 
@@ -2071,6 +2110,12 @@ test_PadUni_Lower(void) {
     assert(cp);
     assert(!PadU_StrCmp(PadUni_Getc(cp), PAD_UNI__STR("abc")));
     PadUni_Del(cp);
+
+    PadUni_SetMB(u, "@AZ[`az{あイ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    cp = PadUni_Lower(u);
+    assert(!strcmp(PadUni_GetcMB(cp), "@az[`az{あイ0123456789abcdefghijklmnopqrstuvwxyz"));
+    assert(!strcmp(PadUni_GetcMB(u), "@AZ[`az{あイ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+    PadUni_Del(cp);
     PadUni_Del(u);
 }
 
@@ -2395,6 +2440,28 @@ test_PadUni_GetcMB(void) {
 
     const char *s = PadUni_GetcMB(u);
     assert(strcmp(s, "abc") == 0);
+    assert(PadUni_GetcMB(u) == s);  // cached
+
+    // cache is updated after mutation
+    PadUni_PushBack(u, PAD_UNI__CH('d'));
+    assert(strcmp(PadUni_GetcMB(u), "abcd") == 0);
+    PadUni *c = PadUni_ShallowCopy(u);
+    PadUni_PushBack(c, PAD_UNI__CH('e'));
+    assert(strcmp(PadUni_GetcMB(u), "abcd") == 0);
+    assert(strcmp(PadUni_GetcMB(c), "abcde") == 0);
+    PadUni_Del(c);
+
+    // mixed ASCII and multi byte characters
+    PadUni_SetMB(u, "aあb\nいう");
+    assert(PadUni_Len(u) == 6);
+    assert(strcmp(PadUni_GetcMB(u), "aあb\nいう") == 0);
+    const char *long_mb =
+        "あいうえおかきくけこ0123456789abcdefghijklmnopqrstuvwxyz"
+        "さしすせそ0123456789abcdefghijklmnopqrstuvwxyz\U0001F600";
+    PadUni_SetMB(u, long_mb);
+    assert(strcmp(PadUni_GetcMB(u), long_mb) == 0);
+    PadUni_Clear(u);
+    assert(strcmp(PadUni_GetcMB(u), "") == 0);
 
     PadUni_Del(u);
 }
@@ -2454,6 +2521,91 @@ test_PadUni_Split(void) {
         PadUni_Del(*p);
     }
     free(arr);
+
+    // prefix of separator at end is not separator
+    PadUni_SetMB(u, "abcabxab");
+    arr = PadUni_Split(u, PAD_UNI__STR("abc"));
+    assert(!PadU_StrCmp(PadUni_Getc(arr[0]), PAD_UNI__STR("abxab")));
+    assert(arr[1] == NULL);
+    PadUni_Del(arr[0]);
+    free(arr);
+
+    // many tokens over vector width
+    PadUni_SetMB(u, "a,bb,,ccc,dddd,eeeee,ffffff,ggggggg,hhhhhhhh,iiiiiiiii,");
+    arr = PadUni_Split(u, PAD_UNI__STR(","));
+    int32_t n = 0;
+    for (PadUni **p = arr; *p; ++p, ++n) {
+        assert(PadUni_Len(*p) == n + 1);
+        PadUni_Del(*p);
+    }
+    assert(n == 9);
+    free(arr);
+
+    // empty separator does not split
+    PadUni_SetMB(u, "abc");
+    arr = PadUni_Split(u, PAD_UNI__STR(""));
+    assert(!PadU_StrCmp(PadUni_Getc(arr[0]), PAD_UNI__STR("abc")));
+    assert(arr[1] == NULL);
+    PadUni_Del(arr[0]);
+    free(arr);
+
+    PadUni_Del(u);
+}
+
+static void
+test_PadUni_Find(void) {
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, "abcabcabd");
+    assert(PadUni_Find(NULL, PAD_UNI__STR("a"), 0) == -1);
+    assert(PadUni_Find(u, PAD_UNI__STR("abd"), 0) == 6);
+    assert(PadUni_Find(u, PAD_UNI__STR("abc"), 1) == 3);
+    assert(PadUni_Find(u, PAD_UNI__STR("abdx"), 0) == -1);
+    assert(PadUni_Find(u, PAD_UNI__STR(""), 9) == 9);
+    assert(PadUni_Find(u, PAD_UNI__STR(""), 10) == -1);
+    assert(PadUni_Count(u, PAD_UNI__STR("ab")) == 3);
+    assert(PadUni_Count(u, PAD_UNI__STR("abc")) == 2);
+    assert(PadUni_StartsWith(u, PAD_UNI__STR("abca")));
+    assert(!PadUni_StartsWith(u, PAD_UNI__STR("b")));
+    assert(PadUni_EndsWith(u, PAD_UNI__STR("abd")));
+    assert(!PadUni_EndsWith(u, PAD_UNI__STR("abc")));
+    PadUni_Del(u);
+}
+
+static void
+test_PadUni_Replace(void) {
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, "abcabcabd");
+    assert(PadUni_Replace(NULL, PAD_UNI__STR("a"), PAD_UNI__STR("b"), -1) == NULL);
+
+    PadUni *r = PadUni_Replace(u, PAD_UNI__STR("abc"), PAD_UNI__STR("x"), -1);
+    assert(!strcmp(PadUni_GetcMB(r), "xxabd"));
+    assert(PadUni_Len(r) == 5);
+    PadUni_Del(r);
+
+    r = PadUni_Replace(u, PAD_UNI__STR("ab"), PAD_UNI__STR("あいう"), 2);
+    assert(!strcmp(PadUni_GetcMB(r), "あいうcあいうcabd"));
+    PadUni_Del(r);
+
+    r = PadUni_Replace(u, PAD_UNI__STR("d"), PAD_UNI__STR(""), -1);
+    assert(!strcmp(PadUni_GetcMB(r), "abcabcab"));
+    PadUni_Del(r);
+
+    r = PadUni_Replace(u, PAD_UNI__STR("z"), PAD_UNI__STR("y"), -1);
+    assert(!strcmp(PadUni_GetcMB(r), "abcabcabd"));
+    PadUni_Del(r);
+
+    // empty old is inserted at all positions of PadUni_Count
+    PadUni_SetMB(u, "aaa");
+    r = PadUni_Replace(u, PAD_UNI__STR(""), PAD_UNI__STR("x"), -1);
+    assert(!strcmp(PadUni_GetcMB(r), "xaxaxax"));
+    assert(PadUni_Len(r) == 3 + PadUni_Count(u, PAD_UNI__STR("")));
+    PadUni_Del(r);
+
+    r = PadUni_Replace(u, PAD_UNI__STR(""), PAD_UNI__STR("x"), 2);
+    assert(!strcmp(PadUni_GetcMB(r), "xaxaa"));
+    PadUni_Del(r);
+
+    PadUni_Del(u);
 }
 
 static void
@@ -2597,6 +2749,7 @@ unicode_tests[] = {
     {"PadUni_New", test_PadUni_New},
     {"PadUni_DeepCopy", test_PadUni_DeepCopy},
     {"PadUni_DeepCopy", test_PadUni_DeepCopy},
+    {"PadUni_ShallowCopy", test_PadUni_ShallowCopy},
     {"PadUni_Len", test_PadUni_Len},
     {"PadUni_Capa", test_PadUni_Capa},
     {"PadUni_Getc", test_PadUni_Getc},
@@ -2628,6 +2781,8 @@ unicode_tests[] = {
     {"PadUni_GetcMB", test_PadUni_GetcMB},
     {"PadUni_Mul", test_PadUni_Mul},
     {"PadUni_Split", test_PadUni_Split},
+    {"PadUni_Find", test_PadUni_Find},
+    {"PadUni_Replace", test_PadUni_Replace},
     {"PadUni_IsDigit", test_PadUni_IsDigit},
     {"PadUni_IsAlpha", test_PadUni_IsAlpha},
     {"PadChar32_Len", test_PadChar32_Len},
@@ -3872,6 +4027,1038 @@ unicode_path_tests[] = {
     {0},
 };
 
+/*************
+* lib/number *
+*************/
+
+static void
+test_PadNum_IntToStr(void) {
+    char buf[PAD_NUM__INT_STR_SIZE];
+
+    assert(PadNum_IntToStr(buf, 0) == 1);
+    assert(!strcmp(buf, "0"));
+    assert(PadNum_IntToStr(buf, 7) == 1);
+    assert(!strcmp(buf, "7"));
+    assert(PadNum_IntToStr(buf, -10) == 3);
+    assert(!strcmp(buf, "-10"));
+    assert(PadNum_IntToStr(buf, 123456789) == 9);
+    assert(!strcmp(buf, "123456789"));
+    assert(PadNum_IntToStr(buf, INT64_MAX) == 19);
+    assert(!strcmp(buf, "9223372036854775807"));
+    assert(PadNum_IntToStr(buf, INT64_MIN) == 20);
+    assert(!strcmp(buf, "-9223372036854775808"));
+}
+
+static void
+test_PadNum_FloatToStr(void) {
+    char buf[PAD_NUM__FLOAT_STR_SIZE];
+
+    struct {
+        double value;
+        const char *expect;
+    } cases[] = {
+        {0.0, "0.0"},
+        {-0.0, "-0.0"},
+        {1.0, "1.0"},
+        {-2.5, "-2.5"},
+        {0.1, "0.1"},
+        {0.1 + 0.2, "0.30000000000000004"},
+        {1.0 / 3.0, "0.3333333333333333"},
+        {100.0, "100.0"},
+        {1e20, "100000000000000000000.0"},
+        {1e21, "1e+21"},
+        {1.5e300, "1.5e+300"},
+        {0.00001, "0.00001"},
+        {1e-7, "1e-7"},
+        {5e-324, "5e-324"},
+        {1.7976931348623157e308, "1.7976931348623157e+308"},
+        {INFINITY, "inf"},
+        {-INFINITY, "-inf"},
+        {NAN, "nan"},
+    };
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        int32_t len = PadNum_FloatToStr(buf, cases[i].value);
+        assert(!strcmp(buf, cases[i].expect));
+        assert(len == (int32_t) strlen(buf));
+    }
+
+    // formatted strings round trip by strtod
+    uint64_t seed = 88172645463325252ULL;
+    for (int32_t i = 0; i < 100000; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        double value;
+        memcpy(&value, &seed, sizeof value);
+        if (isnan(value) || isinf(value)) {
+            continue;
+        }
+        PadNum_FloatToStr(buf, value);
+        double back = strtod(buf, NULL);
+        assert(!memcmp(&back, &value, sizeof value));
+    }
+}
+
+static const struct testcase
+number_tests[] = {
+    {"PadNum_IntToStr", test_PadNum_IntToStr},
+    {"PadNum_FloatToStr", test_PadNum_FloatToStr},
+    {0},
+};
+
+/*********************
+* lib/unicode_kernel *
+*********************/
+
+/**
+ * fill buffer by pseudo random ASCII and non-ASCII characters
+ */
+static void
+fill_kernel_input(PadUniType *s, int32_t len, uint32_t seed) {
+    static const PadUniType chars[] = U"aZ09 \t\n@[`{/:あイ\U0001F600";
+    int32_t nchars = sizeof(chars) / sizeof(chars[0]) - 1;
+    for (int32_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        s[i] = chars[(seed >> 16) % nchars];
+    }
+}
+
+static void
+test_PadUniKernel_Level(void) {
+    PadUniKernelLevel max = PadUniKernel_GetMaxLevel();
+    assert(PadUniKernel_GetLevel() == max);
+    assert(PadUniKernel_SetLevel(PAD_UNI_KERNEL__SCALAR) == PAD_UNI_KERNEL__SCALAR);
+    assert(PadUniKernel_GetLevel() == PAD_UNI_KERNEL__SCALAR);
+    assert(PadUniKernel_SetLevel(PAD_UNI_KERNEL__AVX2) == max);
+    assert(!strcmp(PadUniKernel_GetLevelName(PAD_UNI_KERNEL__SSE2), "sse2"));
+}
+
+static void
+test_PadUniKernel_Kernels(void) {
+    enum { N = 67 };
+    PadUniType src[N];
+    PadUniType expect[N];
+    PadUniType got[N];
+
+    for (PadUniKernelLevel level = PAD_UNI_KERNEL__SCALAR;
+         level <= PadUniKernel_GetMaxLevel(); level++) {
+        PadUniKernel_SetLevel(level);
+
+        // compare results with PadChar32 functions at all lengths and offsets
+        for (uint32_t seed = 0; seed < 8; seed++) {
+            fill_kernel_input(src, N, seed);
+            for (int32_t len = 0; len <= N; len++) {
+                int32_t find = -1;
+                int32_t digit = len, alpha = len, space = len;
+                for (int32_t i = len - 1; i >= 0; i--) {
+                    find = src[i] == U'@' ? i : find;
+                    digit = !PadChar32_IsDigit(src[i]) ? i : digit;
+                    alpha = !PadChar32_IsAlpha(src[i]) ? i : alpha;
+                    space = !PadChar32_IsSpace(src[i]) ? i : space;
+                }
+                assert(PadUniKernel_FindCh(src, len, U'@') == find);
+                assert(PadUniKernel_SpanDigit(src, len) == digit);
+                assert(PadUniKernel_SpanAlpha(src, len) == alpha);
+                assert(PadUniKernel_SpanSpace(src, len) == space);
+
+                for (int32_t i = 0; i < len; i++) {
+                    expect[i] = PadChar32_ToLower(src[i]);
+                    got[i] = src[i];
+                }
+                PadUniKernel_Lower(got, len);
+                assert(!memcmp(got, expect, len * sizeof(PadUniType)));
+
+                for (int32_t i = 0; i < len; i++) {
+                    expect[i] = PadChar32_ToUpper(src[i]);
+                    got[i] = src[i];
+                }
+                PadUniKernel_Upper(got, len);
+                assert(!memcmp(got, expect, len * sizeof(PadUniType)));
+            }
+        }
+
+        // runs of classes
+        for (int32_t i = 0; i < N; i++) {
+            src[i] = U'0' + i % 10;
+        }
+        assert(PadUniKernel_SpanDigit(src, N) == N);
+        src[N - 1] = U'x';
+        assert(PadUniKernel_SpanDigit(src, N) == N - 1);
+        assert(PadUniKernel_FindCh(src, N, U'x') == N - 1);
+        assert(PadUniKernel_FindCh(src, N, U'y') == -1);
+
+        // ASCII is narrowed until first other character
+        char bytes[N];
+        for (int32_t pos = 0; pos < N; pos++) {
+            for (int32_t i = 0; i < N; i++) {
+                src[i] = U'a' + i % 26;
+            }
+            src[pos] = U'あ';
+            assert(PadUniKernel_NarrowAscii(bytes, src, N) == pos);
+            for (int32_t i = 0; i < pos; i++) {
+                assert(bytes[i] == 'a' + i % 26);
+            }
+        }
+        src[N - 1] = U'a';
+        assert(PadUniKernel_NarrowAscii(bytes, src, N) == N);
+    }
+
+    PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+}
+
+static const struct testcase
+unicode_kernel_tests[] = {
+    {"PadUniKernel_Level", test_PadUniKernel_Level},
+    {"PadUniKernel_Kernels", test_PadUniKernel_Kernels},
+    {0},
+};
+
+/*****************
+* lib/num_kernel *
+*****************/
+
+/**
+ * fill buffers by pseudo random integers in [-50, 50] and same floats
+ * integers are exact in double so sums of any order are same
+ */
+static void
+fill_num_kernel_input(int64_t *is, double *fs, int32_t len, uint32_t seed) {
+    for (int32_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        is[i] = (int64_t) ((seed >> 16) % 101) - 50;
+        fs[i] = (double) is[i];
+    }
+}
+
+static int64_t
+calc_num_int_ref(PadNumOp op, int64_t a, int64_t b) {
+    switch (op) {
+    default: break;
+    case PAD_NUM_OP__ADD: return a + b;
+    case PAD_NUM_OP__SUB: return a - b;
+    case PAD_NUM_OP__MUL: return a * b;
+    case PAD_NUM_OP__DIV: return a / b;
+    }
+    return 0;
+}
+
+static double
+calc_num_float_ref(PadNumOp op, double a, double b) {
+    switch (op) {
+    default: break;
+    case PAD_NUM_OP__ADD: return a + b;
+    case PAD_NUM_OP__SUB: return a - b;
+    case PAD_NUM_OP__MUL: return a * b;
+    case PAD_NUM_OP__DIV: return a / b;
+    }
+    return 0;
+}
+
+static void
+test_PadNumKernel_Level(void) {
+    PadNumKernelLevel max = PadNumKernel_GetMaxLevel();
+    assert(PadNumKernel_GetLevel() == max);
+    assert(PadNumKernel_SetLevel(PAD_NUM_KERNEL__SCALAR) == PAD_NUM_KERNEL__SCALAR);
+    assert(PadNumKernel_GetLevel() == PAD_NUM_KERNEL__SCALAR);
+    assert(PadNumKernel_SetLevel(PAD_NUM_KERNEL__AVX2) == max);
+    assert(!strcmp(PadNumKernel_GetLevelName(PAD_NUM_KERNEL__AVX2), "avx2"));
+}
+
+static void
+test_PadNumKernel_Kernels(void) {
+    enum { N = 37 };
+    int64_t ia[N], ib[N], idst[N];
+    double fa[N], fb[N], fdst[N];
+
+    for (PadNumKernelLevel level = PAD_NUM_KERNEL__SCALAR;
+         level <= PadNumKernel_GetMaxLevel(); level++) {
+        PadNumKernel_SetLevel(level);
+
+        // compare results with scalar expressions at all lengths and steps
+        for (uint32_t seed = 0; seed < 4; seed++) {
+            fill_num_kernel_input(ia, fa, N, seed);
+            fill_num_kernel_input(ib, fb, N, seed + 100);
+            for (int32_t i = 0; i < N; i++) {
+                if (ib[i] == 0) {
+                    ib[i] = fb[i] = 7;  // divisor
+                }
+            }
+
+            for (int32_t len = 0; len <= N; len++) {
+                for (PadNumOp op = PAD_NUM_OP__ADD; op < PAD_NUM_OP__NOPS; op++) {
+                    for (int32_t astep = 0; astep <= 1; astep++) {
+                        for (int32_t bstep = 0; bstep <= 1; bstep++) {
+                            PadNumKernel_CalcInt(op, idst, ia, astep, ib, bstep, len);
+                            PadNumKernel_CalcFloat(op, fdst, fa, astep, fb, bstep, len);
+                            for (int32_t i = 0; i < len; i++) {
+                                int64_t a = ia[i * astep], b = ib[i * bstep];
+                                assert(idst[i] == calc_num_int_ref(op, a, b));
+                                assert(fdst[i] == calc_num_float_ref(op, fa[i * astep], fb[i * bstep]));
+                            }
+                        }
+                    }
+                }
+
+                int64_t sum = 0, dot = 0;
+                int64_t min = len ? ia[0] : 0, max = min;
+                bool has_zero = false;
+                for (int32_t i = 0; i < len; i++) {
+                    sum += ia[i];
+                    dot += ia[i] * ib[i];
+                    min = ia[i] < min ? ia[i] : min;
+                    max = ia[i] > max ? ia[i] : max;
+                    has_zero = has_zero || ia[i] == 0;
+                }
+                assert(PadNumKernel_SumInt(ia, len) == sum);
+                assert(PadNumKernel_SumFloat(fa, len) == (double) sum);
+                assert(PadNumKernel_DotInt(ia, ib, len) == dot);
+                assert(PadNumKernel_DotFloat(fa, fb, len) == (double) dot);
+                assert(PadNumKernel_HasZeroInt(ia, len) == has_zero);
+                assert(PadNumKernel_HasZeroFloat(fa, len) == has_zero);
+                if (len) {
+                    assert(PadNumKernel_MinInt(ia, len) == min);
+                    assert(PadNumKernel_MaxInt(ia, len) == max);
+                    assert(PadNumKernel_MinFloat(fa, len) == (double) min);
+                    assert(PadNumKernel_MaxFloat(fa, len) == (double) max);
+                }
+            }
+        }
+
+        // extremes of integers in every position
+        for (int32_t pos = 0; pos < N; pos++) {
+            for (int32_t i = 0; i < N; i++) {
+                ia[i] = i;
+            }
+            ia[pos] = INT64_MIN;
+            assert(PadNumKernel_MinInt(ia, N) == INT64_MIN);
+            ia[pos] = INT64_MAX;
+            assert(PadNumKernel_MaxInt(ia, N) == INT64_MAX);
+        }
+
+        // overflow wraps and INT64_MIN / -1 does not trap
+        ia[0] = INT64_MAX;
+        ib[0] = 1;
+        PadNumKernel_CalcInt(PAD_NUM_OP__ADD, idst, ia, 1, ib, 1, 1);
+        assert(idst[0] == INT64_MIN);
+        ia[0] = INT64_MIN;
+        ib[0] = -1;
+        PadNumKernel_CalcInt(PAD_NUM_OP__DIV, idst, ia, 1, ib, 1, 1);
+        assert(idst[0] == INT64_MIN);
+    }
+
+    PadNumKernel_SetLevel(PadNumKernel_GetMaxLevel());
+}
+
+static const struct testcase
+num_kernel_tests[] = {
+    {"PadNumKernel_Level", test_PadNumKernel_Level},
+    {"PadNumKernel_Kernels", test_PadNumKernel_Kernels},
+    {0},
+};
+
+/****************
+* lib/num_array *
+****************/
+
+#define num_int(v) ((PadNumVal) { .kind = PAD_NUM_ARY_KIND__INT, .ivalue = (v) })
+#define num_float(v) ((PadNumVal) { .kind = PAD_NUM_ARY_KIND__FLOAT, .fvalue = (v) })
+
+/**
+ * construct 2-D integer array of rows x cols and elements are 1, 2, 3...
+ */
+static PadNumAry *
+new_num_ary_seq(int32_t rows, int32_t cols) {
+    PadNumAry *ary = PadNumAry_New2D(PAD_NUM_ARY_KIND__INT, rows, cols);
+    assert(ary);
+    for (int32_t y = 0; y < rows; y++) {
+        for (int32_t x = 0; x < cols; x++) {
+            assert(PadNumAry_Set2D(ary, y, x, num_int(y * cols + x + 1)));
+        }
+    }
+    return ary;
+}
+
+static void
+test_PadNumAry_New(void) {
+    PadNumAry *ary = PadNumAry_New(PAD_NUM_ARY_KIND__INT, 3);
+    assert(ary);
+    assert(PadNumAry_GetKind(ary) == PAD_NUM_ARY_KIND__INT);
+    assert(PadNumAry_GetNDim(ary) == 1);
+    assert(PadNumAry_Len(ary) == 3);
+    assert(PadNumAry_Cols(ary) == 0);
+    assert(PadNumAry_Size(ary) == 3);
+    assert(PadNumAry_Get(ary, 2).ivalue == 0);
+    PadNumAry_Del(ary);
+
+    ary = PadNumAry_New2D(PAD_NUM_ARY_KIND__FLOAT, 2, 3);
+    assert(ary);
+    assert(PadNumAry_GetNDim(ary) == 2);
+    assert(PadNumAry_Len(ary) == 2);
+    assert(PadNumAry_Cols(ary) == 3);
+    assert(PadNumAry_Size(ary) == 6);
+    assert(PadNumAry_Get2D(ary, 1, 2).fvalue == 0.0);
+    PadNumAry_Del(ary);
+
+    ary = PadNumAry_New(PAD_NUM_ARY_KIND__INT, 0);
+    assert(ary);
+    assert(PadNumAry_Len(ary) == 0);
+    PadNumVal val;
+    assert(!PadNumAry_Min(ary, &val));
+    assert(!PadNumAry_Max(ary, &val));
+    assert(PadNumAry_Sum(ary).ivalue == 0);
+    PadNumAry_Del(ary);
+}
+
+static void
+test_PadNumAry_Set(void) {
+    PadNumAry *ary = PadNumAry_New(PAD_NUM_ARY_KIND__INT, 2);
+    assert(PadNumAry_Set(ary, 0, num_int(5)));
+    assert(PadNumAry_Set(ary, 1, num_float(2.7)));
+    assert(!PadNumAry_Set(ary, 2, num_int(1)));
+    assert(!PadNumAry_Set(ary, -1, num_int(1)));
+    assert(PadNumAry_Get(ary, 0).ivalue == 5);
+    assert(PadNumAry_Get(ary, 1).ivalue == 2);
+
+    PadNumAry *flt = PadNumAry_ToKind(ary, PAD_NUM_ARY_KIND__FLOAT);
+    assert(PadNumAry_GetKind(flt) == PAD_NUM_ARY_KIND__FLOAT);
+    assert(PadNumAry_Get(flt, 0).fvalue == 5.0);
+    PadNumAry_Del(flt);
+    PadNumAry_Del(ary);
+}
+
+static void
+test_PadNumAry_Views(void) {
+    PadNumAry *m = new_num_ary_seq(2, 3);
+
+    // row is view of same buffer
+    PadNumAry *row = PadNumAry_Row(m, 1);
+    assert(row);
+    assert(PadNumAry_GetNDim(row) == 1);
+    assert(PadNumAry_Len(row) == 3);
+    assert(PadNumAry_Get(row, 0).ivalue == 4);
+    assert(PadNumAry_Set(row, 0, num_int(40)));
+    assert(PadNumAry_Get2D(m, 1, 0).ivalue == 40);
+    assert(!PadNumAry_Row(m, 2));
+
+    // transpose is view of same buffer
+    PadNumAry *t = PadNumAry_Transpose(m);
+    assert(t);
+    assert(PadNumAry_Len(t) == 3);
+    assert(PadNumAry_Cols(t) == 2);
+    assert(PadNumAry_Get2D(t, 2, 1).ivalue == 6);
+    assert(PadNumAry_Set2D(t, 0, 1, num_int(4)));
+    assert(PadNumAry_Get2D(m, 1, 0).ivalue == 4);
+
+    // buffer lives until last view is deleted
+    PadNumAry_Del(m);
+    assert(PadNumAry_Get(row, 2).ivalue == 6);
+    PadNumAry *copy = PadNumAry_DeepCopy(t);
+    PadNumAry_Set2D(copy, 0, 0, num_int(100));
+    assert(PadNumAry_Get2D(t, 0, 0).ivalue == 1);
+    assert(PadNumAry_Get2D(copy, 2, 1).ivalue == 6);
+    PadNumAry_Del(copy);
+    PadNumAry_Del(t);
+    PadNumAry_Del(row);
+}
+
+static void
+test_PadNumAry_Rotate(void) {
+    // 1 2 3
+    // 4 5 6
+    PadNumAry *m = new_num_ary_seq(2, 3);
+
+    // 4 1
+    // 5 2
+    // 6 3
+    PadNumAry *r = PadNumAry_Rotate(m, 1);
+    assert(PadNumAry_Len(r) == 3);
+    assert(PadNumAry_Cols(r) == 2);
+    assert(PadNumAry_Get2D(r, 0, 0).ivalue == 4);
+    assert(PadNumAry_Get2D(r, 0, 1).ivalue == 1);
+    assert(PadNumAry_Get2D(r, 2, 0).ivalue == 6);
+    PadNumAry_Del(r);
+
+    r = PadNumAry_Rotate(m, 2);
+    assert(PadNumAry_Get2D(r, 0, 0).ivalue == 6);
+    assert(PadNumAry_Get2D(r, 1, 2).ivalue == 1);
+    PadNumAry_Del(r);
+
+    r = PadNumAry_Rotate(m, -1);
+    PadNumAry *r3 = PadNumAry_Rotate(m, 3);
+    assert(PadNumAry_Get2D(r, 0, 0).ivalue == 3);
+    assert(PadNumAry_Get2D(r, 2, 1).ivalue == 4);
+    for (int32_t y = 0; y < 3; y++) {
+        for (int32_t x = 0; x < 2; x++) {
+            assert(PadNumAry_Get2D(r, y, x).ivalue == PadNumAry_Get2D(r3, y, x).ivalue);
+        }
+    }
+    PadNumAry_Del(r);
+    PadNumAry_Del(r3);
+
+    PadNumAry *row = PadNumAry_Row(m, 0);
+    assert(!PadNumAry_Rotate(row, 1));
+    PadNumAry_Del(row);
+    PadNumAry_Del(m);
+}
+
+static void
+test_PadNumAry_Calc(void) {
+    PadNumAry *a = new_num_ary_seq(1, 4);
+    PadNumAry *b = PadNumAry_ToKind(a, PAD_NUM_ARY_KIND__FLOAT);
+
+    PadNumAry *c = PadNumAry_Calc(a, PAD_NUM_OP__MUL, a);
+    assert(PadNumAry_GetKind(c) == PAD_NUM_ARY_KIND__INT);
+    assert(PadNumAry_Get2D(c, 0, 3).ivalue == 16);
+    PadNumAry_Del(c);
+
+    c = PadNumAry_Calc(a, PAD_NUM_OP__DIV, b);
+    assert(PadNumAry_GetKind(c) == PAD_NUM_ARY_KIND__FLOAT);
+    assert(PadNumAry_Get2D(c, 0, 2).fvalue == 1.0);
+    PadNumAry_Del(c);
+
+    c = PadNumAry_CalcScalar(a, PAD_NUM_OP__SUB, num_int(10), true);
+    assert(PadNumAry_Get2D(c, 0, 0).ivalue == 9);
+    PadNumAry_Del(c);
+
+    c = PadNumAry_CalcScalar(a, PAD_NUM_OP__DIV, num_float(2.0), false);
+    assert(PadNumAry_GetKind(c) == PAD_NUM_ARY_KIND__FLOAT);
+    assert(PadNumAry_Get2D(c, 0, 0).fvalue == 0.5);
+    PadNumAry_Del(c);
+
+    // integer division by zero fails
+    assert(!PadNumAry_CalcScalar(a, PAD_NUM_OP__DIV, num_int(0), false));
+    PadNumAry *zero = PadNumAry_New2D(PAD_NUM_ARY_KIND__INT, 1, 4);
+    assert(!PadNumAry_Calc(a, PAD_NUM_OP__DIV, zero));
+    PadNumAry_Del(zero);
+
+    // shapes must be same
+    PadNumAry *t = PadNumAry_Transpose(a);
+    assert(!PadNumAry_Calc(a, PAD_NUM_OP__ADD, t));
+
+    // views are calculated by strides
+    c = PadNumAry_Calc(t, PAD_NUM_OP__ADD, t);
+    assert(PadNumAry_Len(c) == 4);
+    assert(PadNumAry_Get2D(c, 3, 0).ivalue == 8);
+    PadNumAry_Del(c);
+    PadNumAry_Del(t);
+
+    PadNumAry_Del(a);
+    PadNumAry_Del(b);
+}
+
+static void
+test_PadNumAry_Reduce(void) {
+    PadNumAry *m = new_num_ary_seq(3, 3);
+    PadNumAry_Set2D(m, 1, 1, num_int(-7));
+
+    PadNumVal val;
+    assert(PadNumAry_Sum(m).ivalue == 45 - 5 - 7);
+    assert(PadNumAry_Min(m, &val) && val.ivalue == -7);
+    assert(PadNumAry_Max(m, &val) && val.ivalue == 9);
+
+    // reductions of view
+    PadNumAry *t = PadNumAry_Transpose(m);
+    PadNumAry *col = PadNumAry_Row(t, 2);
+    assert(PadNumAry_Sum(col).ivalue == 3 + 6 + 9);
+    assert(PadNumAry_Dot(col, col, &val) && val.ivalue == 9 + 36 + 81);
+    PadNumAry_Del(col);
+    PadNumAry_Del(t);
+
+    PadNumAry *f = PadNumAry_ToKind(m, PAD_NUM_ARY_KIND__FLOAT);
+    assert(PadNumAry_Sum(f).fvalue == 33.0);
+    assert(PadNumAry_Min(f, &val) && val.fvalue == -7.0);
+    PadNumAry_Del(f);
+    PadNumAry_Del(m);
+}
+
+static void
+test_PadNumAry_MatMul(void) {
+    // 1 2 3    1 2
+    // 4 5 6    3 4
+    //          5 6
+    PadNumAry *a = new_num_ary_seq(2, 3);
+    PadNumAry *b = new_num_ary_seq(3, 2);
+
+    PadNumAry *c = PadNumAry_MatMul(a, b);
+    assert(c);
+    assert(PadNumAry_Len(c) == 2);
+    assert(PadNumAry_Cols(c) == 2);
+    assert(PadNumAry_Get2D(c, 0, 0).ivalue == 22);
+    assert(PadNumAry_Get2D(c, 0, 1).ivalue == 28);
+    assert(PadNumAry_Get2D(c, 1, 0).ivalue == 49);
+    assert(PadNumAry_Get2D(c, 1, 1).ivalue == 64);
+    PadNumAry_Del(c);
+
+    // matrix and vector
+    PadNumAry *v = PadNumAry_Row(b, 0);
+    assert(!PadNumAry_MatMul(a, v));
+    PadNumAry *t = PadNumAry_Transpose(b);
+    PadNumAry *col = PadNumAry_Row(t, 0);
+    c = PadNumAry_MatMul(a, col);
+    assert(PadNumAry_GetNDim(c) == 1);
+    assert(PadNumAry_Get(c, 0).ivalue == 22);
+    assert(PadNumAry_Get(c, 1).ivalue == 49);
+    PadNumAry_Del(c);
+
+    assert(!PadNumAry_MatMul(a, a));
+    PadNumAry_Del(col);
+    PadNumAry_Del(t);
+    PadNumAry_Del(v);
+    PadNumAry_Del(a);
+    PadNumAry_Del(b);
+}
+
+static const struct testcase
+num_array_tests[] = {
+    {"PadNumAry_New", test_PadNumAry_New},
+    {"PadNumAry_Set", test_PadNumAry_Set},
+    {"PadNumAry_Views", test_PadNumAry_Views},
+    {"PadNumAry_Rotate", test_PadNumAry_Rotate},
+    {"PadNumAry_Calc", test_PadNumAry_Calc},
+    {"PadNumAry_Reduce", test_PadNumAry_Reduce},
+    {"PadNumAry_MatMul", test_PadNumAry_MatMul},
+    {0},
+};
+
+/***********
+* lib/sink *
+***********/
+
+static void
+test_PadSink_NewStr(void) {
+    assert(PadSink_Write(NULL, "a", 1) == NULL);
+    assert(PadSink_NewFile(NULL) == NULL);
+    assert(PadSink_NewFd(-1) == NULL);
+    assert(PadSink_NewCallback(NULL, NULL) == NULL);
+
+    PadSink *sink = PadSink_NewStr();
+    assert(sink);
+    assert(PadSink_GetType(sink) == PAD_SINK_TYPE__STR);
+
+    assert(PadSink_WriteCStr(sink, "abc"));
+    assert(PadSink_Write(sink, "defg", 3));
+    assert(!strcmp(PadSink_GetcStr(sink), "abcdef"));
+    PadSink_ClearStr(sink);
+    assert(!strcmp(PadSink_GetcStr(sink), ""));
+
+    PadSink_Del(sink);
+}
+
+struct sink_counter {
+    int32_t ncalls;
+    int32_t nbytes;
+};
+
+static bool
+sink_counter_write(void *arg, const char *data, int32_t len) {
+    struct sink_counter *counter = arg;
+    counter->ncalls += 1;
+    counter->nbytes += len;
+    return true;
+}
+
+static void
+test_PadSink_NewCallback(void) {
+    struct sink_counter counter = {0};
+    PadSink *sink = PadSink_NewCallback(sink_counter_write, &counter);
+    assert(sink);
+    assert(PadSink_GetcStr(sink) == NULL);
+
+    // small writes are stored in buffer until it's full
+    for (int32_t i = 0; i < PAD_SINK__BUF_SIZE; i++) {
+        assert(PadSink_Write(sink, "x", 1));
+    }
+    assert(counter.ncalls == 0);
+    assert(PadSink_Write(sink, "y", 1));
+    assert(counter.ncalls == 1);
+    assert(counter.nbytes == PAD_SINK__BUF_SIZE);
+
+    // large data is written directly after flush
+    char big[PAD_SINK__BUF_SIZE * 2];
+    memset(big, 'z', sizeof big);
+    assert(PadSink_Write(sink, big, sizeof big));
+    assert(counter.ncalls == 3);
+    assert(counter.nbytes == PAD_SINK__BUF_SIZE * 3 + 1);
+
+    PadSink_Del(sink);
+}
+
+static void
+test_PadSink_NewFile(void) {
+    FILE *fp = tmpfile();
+    assert(fp);
+
+    PadSink *sink = PadSink_NewFile(fp);
+    assert(sink);
+    assert(PadSink_WriteCStr(sink, "abc"));
+    assert(PadSink_WriteCStr(sink, "def"));
+    PadSink_Del(sink);  // flush
+
+    rewind(fp);
+    char buf[32] = {0};
+    assert(fread(buf, 1, sizeof(buf) - 1, fp) == 6);
+    assert(!strcmp(buf, "abcdef"));
+
+    fclose(fp);
+}
+
+static void
+test_PadSink_WriteStatic(void) {
+    FILE *fp = tmpfile();
+    assert(fp);
+
+    char text[PAD_SINK__STATIC_MIN + 1];
+    memset(text, 't', PAD_SINK__STATIC_MIN);
+    text[PAD_SINK__STATIC_MIN] = '\0';
+
+    // static data and buffered data are written in order
+    PadSink *sink = PadSink_NewFd(fileno(fp));
+    assert(sink);
+    assert(PadSink_WriteStatic(NULL, text, 1) == NULL);
+    assert(PadSink_WriteCStr(sink, "a"));
+    assert(PadSink_WriteStatic(sink, text, PAD_SINK__STATIC_MIN));
+    assert(PadSink_WriteStatic(sink, "b", 1));
+    assert(PadSink_WriteCStr(sink, "c"));
+    for (int32_t i = 0; i < PAD_SINK__NSPANS * 2; i++) {
+        assert(PadSink_WriteStatic(sink, text, PAD_SINK__STATIC_MIN));
+        assert(PadSink_WriteCStr(sink, "d"));
+    }
+    PadSink_Del(sink);  // flush
+
+    int32_t len = 3 + PAD_SINK__STATIC_MIN + (PAD_SINK__STATIC_MIN + 1) * PAD_SINK__NSPANS * 2;
+    char *buf = PadMem_Calloc(len + 1, sizeof(char));
+    assert(buf);
+    rewind(fp);
+    assert(fread(buf, 1, len + 1, fp) == (size_t) len);
+    assert(buf[0] == 'a');
+    assert(!strncmp(buf + 1, text, PAD_SINK__STATIC_MIN));
+    assert(!strncmp(buf + 1 + PAD_SINK__STATIC_MIN, "bc", 2));
+    for (int32_t i = 0; i < PAD_SINK__NSPANS * 2; i++) {
+        const char *p = buf + 3 + PAD_SINK__STATIC_MIN + (PAD_SINK__STATIC_MIN + 1) * i;
+        assert(!strncmp(p, text, PAD_SINK__STATIC_MIN));
+        assert(p[PAD_SINK__STATIC_MIN] == 'd');
+    }
+    free(buf);
+    fclose(fp);
+
+    // static data of memory sink is copied
+    sink = PadSink_NewStr();
+    assert(sink);
+    assert(PadSink_WriteStatic(sink, text, PAD_SINK__STATIC_MIN));
+    assert(!strcmp(PadSink_GetcStr(sink), text));
+    PadSink_Del(sink);
+}
+
+static const struct testcase
+sink_tests[] = {
+    {"PadSink_NewStr", test_PadSink_NewStr},
+    {"PadSink_NewCallback", test_PadSink_NewCallback},
+    {"PadSink_NewFile", test_PadSink_NewFile},
+    {"PadSink_WriteStatic", test_PadSink_WriteStatic},
+    {0},
+};
+
+/***********
+* lib/html *
+***********/
+
+static void
+test_PadHtml_EscapeApp(void) {
+    PadStr *s = PadStr_New();
+    assert(s);
+
+    assert(PadHtml_EscapeApp(s, "", 0));
+    assert(!strcmp(PadStr_Getc(s), ""));
+    assert(PadHtml_EscapeApp(s, "abc", 3));
+    assert(!strcmp(PadStr_Getc(s), "abc"));
+    PadStr_Clear(s);
+    assert(PadHtml_EscapeApp(s, "<a href=\"x\">'&'</a>", 19));
+    assert(!strcmp(PadStr_Getc(s), "&lt;a href=&quot;x&quot;&gt;&#39;&amp;&#39;&lt;/a&gt;"));
+    PadStr_Clear(s);
+    assert(PadHtml_EscapeApp(s, "あ<い>", strlen("あ<い>")));
+    assert(!strcmp(PadStr_Getc(s), "あ&lt;い&gt;"));
+
+    // special character at all positions of long strings for each level
+    enum { N = 80 };
+    char src[N + 1];
+    char expect[N + 5];
+    for (PadUniKernelLevel level = PAD_UNI_KERNEL__SCALAR;
+         level <= PadUniKernel_GetMaxLevel(); level++) {
+        PadUniKernel_SetLevel(level);
+        for (int32_t pos = 0; pos < N; pos++) {
+            memset(src, 'x', N);
+            src[N] = '\0';
+            src[pos] = '&';
+            memset(expect, 'x', pos);
+            strcpy(expect + pos, "&amp;");
+            memset(expect + pos + 5, 'x', N - pos - 1);
+            expect[N + 4] = '\0';
+            PadStr_Clear(s);
+            assert(PadHtml_EscapeApp(s, src, N));
+            assert(!strcmp(PadStr_Getc(s), expect));
+            assert(PadUniKernel_SpanHtmlSafe(src, N) == pos);
+            assert(PadHtml_NeedEscape(src, N));
+            assert(!PadHtml_NeedEscape(src, pos));
+        }
+    }
+    PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+
+    PadStr_Del(s);
+}
+
+static const struct testcase
+html_tests[] = {
+    {"PadHtml_EscapeApp", test_PadHtml_EscapeApp},
+    {0},
+};
+
+/************
+* lib/regex *
+************/
+
+static PadRegex *
+regex_new(const char *pattern, int32_t flags, char *err, int32_t errsz) {
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, pattern);
+    PadRegex *re = PadRegex_New(PadUni_Getc(u), PadUni_Len(u), flags, err, errsz);
+    PadUni_Del(u);
+    return re;
+}
+
+/**
+ * search pattern in ASCII text and write match as "whole|group1|..."
+ * groups which did not participate are "-". if not matched then "nil"
+ */
+static const char *
+regex_search(char *dst, const char *pattern, int32_t flags, const char *text, bool anchored) {
+    char err[256];
+    PadRegex *re = regex_new(pattern, flags, err, sizeof err);
+    assert(re);
+
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, text);
+    int32_t caps[20];
+    assert(PadRegex_GetNGroups(re) < 10);
+    if (!PadRegex_Search(re, PadUni_Getc(u), PadUni_Len(u), 0, anchored, caps)) {
+        strcpy(dst, "nil");
+    } else {
+        char *p = dst;
+        for (int32_t g = 0; g <= PadRegex_GetNGroups(re); g++) {
+            if (g > 0) {
+                *p++ = '|';
+            }
+            if (caps[g * 2] < 0) {
+                *p++ = '-';
+                continue;
+            }
+            memcpy(p, text + caps[g * 2], caps[g * 2 + 1] - caps[g * 2]);
+            p += caps[g * 2 + 1] - caps[g * 2];
+        }
+        *p = '\0';
+    }
+
+    PadUni_Del(u);
+    PadRegex_Del(re);
+    return dst;
+}
+
+static void
+test_PadRegex_New(void) {
+    char err[256];
+    PadRegex *re = regex_new("(a)(?:b)(c(d))", 0, err, sizeof err);
+    assert(re);
+    assert(PadRegex_GetNGroups(re) == 3);
+    assert(PadRegex_GetPatternLen(re) == 14);
+    assert(PadRegex_GetcPattern(re)[0] == '(');
+    PadRegex *copy = PadRegex_DeepCopy(re);
+    assert(copy && PadRegex_GetNGroups(copy) == 3);
+    PadRegex_Del(copy);
+    PadRegex_Del(re);
+
+    static const struct {
+        const char *pattern;
+        const char *err;
+    } fails[] = {
+        {"(a", "missing ), unterminated subpattern at position 2"},
+        {"a)", "unbalanced parenthesis at position 1"},
+        {"*a", "nothing to repeat at position 0"},
+        {"a**", "multiple repeat at position 2"},
+        {"[a-", "unterminated character set at position 0"},
+        {"[z-a]", "bad character range at position 4"},
+        {"a{3,1}", "min repeat greater than max repeat at position 1"},
+        {"a{1001}", "the repetition number is too large at position 1"},
+        {"\\q", "bad escape at position 1"},
+        {"a\\", "bad escape (end of pattern) at position 2"},
+        {"(?=a)", "unknown extension at position 1"},
+        {"(a{1000}){1000}", "pattern is too large at position 15"},
+    };
+    for (size_t i = 0; i < sizeof fails / sizeof fails[0]; i++) {
+        assert(!regex_new(fails[i].pattern, 0, err, sizeof err));
+        assert(!strcmp(err, fails[i].err));
+    }
+}
+
+static void
+test_PadRegex_Search(void) {
+    static const struct {
+        const char *pattern;
+        const char *text;
+        bool anchored;
+        const char *expect;
+    } cases[] = {
+        {"abc", "xxabcxx", false, "abc"},
+        {"abc", "xxabcxx", true, "nil"},
+        {"a.c", "a\nc abc", false, "abc"},
+        {"[a-c]+", "xxbcaz", false, "bca"},
+        {"[^a-c]+", "abxyz", false, "xyz"},
+        {"[]a]+", "x]a]", false, "]a]"},
+        {"[\\d-]+", "tel 03-1234", false, "03-1234"},
+        {"\\d+\\s\\w+\\W", "a 12 ab_1!", false, "12 ab_1!"},
+        {"\\D\\S", "1 a2", false, " a"},
+        {"(\\w+)=(\\d+)", "x: key=123;", false, "key=123|key|123"},
+        {"(a)|(b)", "b", false, "b|-|b"},
+        {"a|ab", "ab", false, "a"},
+        {"ab|a", "ab", false, "ab"},
+        {"a*", "aaa", false, "aaa"},
+        {"a*?", "aaa", false, ""},
+        {"a+?", "aaa", false, "a"},
+        {"a??b", "ab", false, "ab"},
+        {"<.*>", "<a><b>", false, "<a><b>"},
+        {"<.*?>", "<a><b>", false, "<a>"},
+        {"a{2}", "aaaa", false, "aa"},
+        {"a{2,}", "aaaa", false, "aaaa"},
+        {"a{,2}", "aaaa", false, "aa"},
+        {"a{1,3}?", "aaaa", false, "a"},
+        {"a{", "a{", false, "a{"},
+        {"x{a}", "x{a}", false, "x{a}"},
+        {"(a|b)*c", "abac", false, "abac|a"},
+        {"(a*)*", "b", false, "|-"},
+        {"(a*)+", "b", false, "|"},
+        {"(a|)+b", "aab", false, "aab|a"},
+        {"^abc$", "abc", false, "abc"},
+        {"^b", "ab", false, "nil"},
+        {"a$", "aa", false, "a"},
+        {"\\bfoo\\b", "afoo foo", false, "foo"},
+        {"\\Boo\\B", "oo foox", false, "oo"},
+        {"\\b", "", false, "nil"},
+        {"$", "", false, ""},
+        {"x*", "", true, ""},
+        {"\\x41\\u0042\\t", "AB\t", false, "AB\t"},
+        {"\\.\\*\\[", "a.*[", false, ".*["},
+        {"(?:ab)+", "ababa", false, "abab"},
+        {"(a)(b)?(c)", "ac", false, "ac|a|-|c"},
+        {"((a)|b)+", "ab", false, "ab|b|a"},
+        {"(a+)(a+)", "aaaa", false, "aaaa|aaa|a"},
+        {"(a+?)(a+)", "aaaa", false, "aaaa|a|aaa"},
+        {"z|(x)y", "xxyz", false, "xy|x"},
+        {"foo|foobar|xfoobar", "xfoobar", false, "xfoobar"},
+    };
+    char buf[256];
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        const char *got = regex_search(buf, cases[i].pattern, 0, cases[i].text, cases[i].anchored);
+        if (strcmp(got, cases[i].expect)) {
+            fprintf(stderr, "%s %s: %s\n", cases[i].pattern, cases[i].text, got);
+        }
+        assert(!strcmp(got, cases[i].expect));
+    }
+
+    assert(!strcmp(regex_search(buf, "hello", PAD_REGEX__IGNORE_CASE, "say HeLLo", false), "HeLLo"));
+    assert(!strcmp(regex_search(buf, "[a-c]+", PAD_REGEX__IGNORE_CASE, "xAbC", false), "AbC"));
+    assert(!strcmp(regex_search(buf, "[^a]+", PAD_REGEX__IGNORE_CASE, "AAb", false), "b"));
+
+    // positions are indices of characters
+    char err[256];
+    PadRegex *re = regex_new("(日本)+(語)", 0, err, sizeof err);
+    PadUni *u = PadUni_New();
+    PadUni_SetMB(u, "こんにちは日本日本語です");
+    int32_t caps[6];
+    assert(PadRegex_Search(re, PadUni_Getc(u), PadUni_Len(u), 0, false, caps));
+    assert(caps[0] == 5 && caps[1] == 10);
+    assert(caps[2] == 7 && caps[3] == 9);
+    assert(caps[4] == 9 && caps[5] == 10);
+    assert(PadRegex_Search(re, PadUni_Getc(u), PadUni_Len(u), 6, false, caps) && caps[0] == 7);
+    assert(!PadRegex_Search(re, PadUni_Getc(u), PadUni_Len(u), 8, false, caps));
+    assert(!PadRegex_Search(re, PadUni_Getc(u), PadUni_Len(u), 100, false, caps));
+    PadUni_Del(u);
+    PadRegex_Del(re);
+}
+
+static void
+test_PadRegex_Cache(void) {
+    // the DFA of a[ab]{15} has 2^16 states and overflows the cache
+    enum { N = 50000, K = 16 };
+    char err[256];
+    PadRegex *re = regex_new("a[ab]{15}", 0, err, sizeof err);
+    assert(re);
+
+    PadUniType *text = PadMem_Calloc(N + 1, sizeof(PadUniType));
+    uint32_t seed = 12345;
+    for (int32_t i = 0; i < N; i++) {
+        seed = seed * 1103515245 + 12345;
+        text[i] = (seed >> 16) & 1 ? 'a' : 'b';
+    }
+    text[N - 1] = 'c';
+
+    int32_t caps[2];
+    int32_t nmatches = 0;
+    for (int32_t pos = 0; pos <= N; ) {
+        int32_t expect = -1;
+        for (int32_t i = pos; i + K <= N - 1; i++) {
+            if (text[i] == 'a') {
+                expect = i;
+                break;
+            }
+        }
+        bool found = PadRegex_Search(re, text, N, pos, false, caps);
+        assert(found == (expect >= 0));
+        if (!found) {
+            break;
+        }
+        assert(caps[0] == expect && caps[1] == expect + K);
+        pos = caps[1];
+        nmatches++;
+    }
+    assert(nmatches > 100);
+    assert(PadRegex_GetNCacheResets(re) > 0);
+    assert(PadRegex_GetNCachedStates(re) > 0);
+
+    free(text);
+    PadRegex_Del(re);
+}
+
+/**
+ * (a?){n}a{n} takes exponential time on backtracking engines
+ */
+static void
+test_PadRegex_Pathological(void) {
+    enum { N = 40 };
+    char pattern[128];
+    snprintf(pattern, sizeof pattern, "(a?){%d}a{%d}", N, N);
+    char err[256];
+    PadRegex *re = regex_new(pattern, 0, err, sizeof err);
+    assert(re);
+
+    PadUniType text[N + 1] = {0};
+    for (int32_t i = 0; i < N; i++) {
+        text[i] = 'a';
+    }
+    int32_t caps[4];
+    assert(PadRegex_Search(re, text, N, 0, true, caps));
+    assert(caps[0] == 0 && caps[1] == N);
+    assert(!PadRegex_Search(re, text, N - 1, 0, true, caps));
+
+    PadRegex_Del(re);
+}
+
+static const struct testcase
+regex_tests[] = {
+    {"PadRegex_New", test_PadRegex_New},
+    {"PadRegex_Search", test_PadRegex_Search},
+    {"PadRegex_Cache", test_PadRegex_Cache},
+    {"PadRegex_Pathological", test_PadRegex_Pathological},
+    {0},
+};
+
 
 /*****************
 * lang/tokenizer *
@@ -16286,6 +17473,66 @@ test_trv_builtin_unicode_isspace(void) {
     trv_cleanup;
 }
 
+static void
+test_trv_builtin_unicode_find(void) {
+    trv_ready;
+
+    check_ok("{: \"a-b-c-b\".find(\"b\") :}", "2");
+    check_ok("{: \"a-b-c-b\".find(\"b\", 3) :}", "6");
+    check_ok("{: \"a-b-c-b\".find(\"c-b\") :}", "4");
+    check_ok("{: \"a-b-c-b\".find(\"z\") :}", "-1");
+    check_ok("{: \"a-b-c-b\".find(\"b\", 100) :}", "-1");
+    check_ok("{: \"あいう\".find(\"う\") :}", "2");
+    check_fail("{: \"abc\".find(1) :}", "invalid argument type of find");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_unicode_count(void) {
+    trv_ready;
+
+    check_ok("{: \"a-b-c-b\".count(\"-\") :}", "3");
+    check_ok("{: \"aaaa\".count(\"aa\") :}", "2");
+    check_ok("{: \"abc\".count(\"z\") :}", "0");
+    check_ok("{: \"abc\".count(\"\") :}", "4");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_unicode_replace(void) {
+    trv_ready;
+
+    check_ok("{: \"a-b-c\".replace(\"-\", \"+\") :}", "a+b+c");
+    check_ok("{: \"a-b-c\".replace(\"-\", \"\") :}", "abc");
+    check_ok("{: \"a-b-c\".replace(\"-\", \"--\", 1) :}", "a--b-c");
+    check_ok("{: \"a-b-c\".replace(\"b\", \"あいう\") :}", "a-あいう-c");
+    check_ok("{: \"abc\".replace(\"z\", \"y\") :}", "abc");
+    check_ok("{: \"abc\".replace(\"\", \"y\") :}", "yaybycy");
+    check_ok("{: \"abc\".replace(\"\", \"y\", 2) :}", "yaybc");
+    check_ok("{: \"\".replace(\"\", \"y\") :}", "y");
+    check_ok("{@ s = \"abc\" \n t = s.replace(\"b\", \"x\") @}{: s :},{: t :}", "abc,axc");
+    check_fail("{: \"abc\".replace(\"a\") :}", "invalid arguments length of replace");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_unicode_startswith(void) {
+    trv_ready;
+
+    check_ok("{: \"abc\".startswith(\"ab\") :}", "true");
+    check_ok("{: \"abc\".startswith(\"bc\") :}", "false");
+    check_ok("{: \"abc\".startswith(\"\") :}", "true");
+    check_ok("{: \"abc\".startswith(\"abcd\") :}", "false");
+    check_ok("{: \"abc\".endswith(\"bc\") :}", "true");
+    check_ok("{: \"abc\".endswith(\"ab\") :}", "false");
+    check_ok("{: \"abc\".endswith(\"zabc\") :}", "false");
+
+    trv_cleanup;
+}
+
 static void
 test_trv_builtin_functions(void) {
     PadConfig *config = PadConfig_New();
@@ -22709,6 +23956,33 @@ test_trv_for_stmt_12(void) {
     trv_cleanup;
 }
 
+static void
+test_trv_for_in_stmt_0(void) {
+    trv_ready;
+
+    check_ok("{@ for x in [1, \"a\", 2.5]: puts(x) end @}", "1\na\n2.5\n");
+    check_ok("{@ for i, x in [\"a\", \"b\"]: puts(i, x) end @}", "0 a\n1 b\n");
+    check_ok("{@ for x in []: puts(x) end @}", "");
+    check_ok("{@ d = {\"a\": 1, \"b\": 2} \n for k in d: puts(k) end @}", "a\nb\n");
+    check_ok("{@ for k, v in {\"a\": 1, \"b\": 2}: puts(k, v) end @}", "a 1\nb 2\n");
+    check_ok("{@ for c in \"abc\": puts(c) end @}", "a\nb\nc\n");
+    check_ok("{@ for i, c in \"ab\": puts(i, c) end @}", "0 a\n1 b\n");
+    check_ok("{@ for x in [1, 2, 3]: if x == 2: break end puts(x) end @}", "1\n");
+    check_ok("{@ for x in [1, 2, 3]: if x == 2: continue end puts(x) end @}", "1\n3\n");
+    check_ok("{@ def f(): for x in [1, 2]: return x end end @}{: f() :}", "1");
+    check_ok("{@ a = [1, 2] \n for x in a: a = nil end @}{: x :}", "2");
+    check_ok("{@ for x in [[1, 2], [3]]: for y in x: puts(y) end end @}", "1\n2\n3\n");
+    check_ok("{@ for i in [1]: @}{: i :}{@ end @}", "1");
+    check_ok("{@ a = [1, 2] \n for x in a: a[0] = 3 end @}{: a[0] :}", "3");
+
+    check_fail("{@ a = [1] \n for x in a: a.push(2) end @}", "array changed size during iteration");
+    check_fail("{@ d = {\"a\": 1} \n for k in d: d[\"b\"] = 2 end @}", "dict changed size during iteration");
+    check_fail("{@ for x in 1: end @}", "can't iterate object (1)");
+    check_fail("{@ for x in y: end @}", "\"y\" is not defined");
+
+    trv_cleanup;
+}
+
 static void
 test_trv_break_stmt_0(void) {
     trv_ready;
@@ -26970,7 +28244,7 @@ test_trv_asscalc_0(void) {
 
     check_fail("{@ 0 += 1 @}", "invalid left hand operand (1)");
     check_fail("{@ true += 1 @}", "invalid left hand operand (3)");
-    check_fail("{@ a = 0 \n a += \"b\" @}", "invalid right hand operand (5)");
+    check_fail("{@ a = 0 \n a += \"b\" @}", "can't add int with string");
 
     PadCtx_Del(ctx);
     PadGC_Del(gc);
@@ -27043,7 +28317,7 @@ test_trv_asscalc_1(void) {
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
         assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid left hand operand type (1)"));
+        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid left hand operand (1)"));
     }
 
     PadTkr_Parse(tkr, "{@ true -= 1 @}");
@@ -27053,7 +28327,7 @@ test_trv_asscalc_1(void) {
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
         assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid left hand operand type (3)"));
+        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid left hand operand (3)"));
     }
 
     PadTkr_Parse(tkr, "{@ a = 0 \n a -= \"c\" @}");
@@ -27063,7 +28337,7 @@ test_trv_asscalc_1(void) {
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
         assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid right hand operand type (5)"));
+        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "can't sub int with string"));
     }
 
     PadCtx_Del(ctx);
@@ -27177,7 +28451,7 @@ test_trv_asscalc_2(void) {
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
         assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "can't mul by negative value"));
+        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "can't mul string by negative value"));
     }
 
     PadTkr_Parse(tkr, "{@ 1 *= 2 @}");
@@ -27200,14 +28474,14 @@ test_trv_asscalc_2(void) {
         assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid left hand operand (3)"));
     }
 
-    PadTkr_Parse(tkr, "{@ a = 2 \n a *= \"b\" @}");
+    PadTkr_Parse(tkr, "{@ a = 2 \n a *= \"b\" @}{: a :}");
     {
         PadAST_Clear(ast);
         PadCC_Compile(ast, PadTkr_GetToks(tkr));
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
-        assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid right hand operand (5)"));
+        assert(!PadAST_HasErrs(ast));
+        assert(!strcmp(PadCtx_GetcStdoutBuf(ctx), "bb"));
     }
 
     PadCtx_Del(ctx);
@@ -27331,7 +28605,7 @@ test_trv_asscalc_3(void) {
         PadCtx_Clear(ctx);
         PadTrv_Trav(ast, ctx);
         assert(PadAST_HasErrs(ast));
-        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "invalid right hand operand (5)"));
+        assert(!strcmp(PadAST_GetcFirstErrMsg(ast), "can't div int with string"));
     }
 
     PadCtx_Del(ctx);
@@ -27717,7 +28991,7 @@ test_trv_asscalc_fail_0(void) {
     check_fail("{@ a /= @}", "syntax error. not found rhs operand in asscalc");
     check_fail("{@ a %= @}", "syntax error. not found rhs operand in asscalc");
     check_fail("{@ 1 += 1 @}", "invalid left hand operand (1)");
-    check_fail("{@ 1 -= 1 @}", "invalid left hand operand type (1)");
+    check_fail("{@ 1 -= 1 @}", "invalid left hand operand (1)");
     check_fail("{@ 1 *= 1 @}", "invalid left hand operand (1)");
     check_fail("{@ 1 /= 1 @}", "invalid left hand operand (1)");
     check_fail("{@ 1 %= 1 @}", "invalid left hand operand (1)");
@@ -28010,9 +29284,9 @@ test_trv_expr_float(void) {
     check_ok("{: 1.1 + 1.2 :}", "2.3");
     check_ok("{: 1 + 1.2 :}", "2.2");
     check_ok("{: 1.1 + true :}", "2.1");
-    check_ok("{: 1.2 - 1.1 :}", "0.1");
-    check_ok("{: 2 - 1.1 :}", "0.9");
-    check_ok("{: 1.2 - true :}", "0.2");
+    check_ok("{: 1.2 - 1.1 :}", "0.09999999999999987");
+    check_ok("{: 2 - 1.1 :}", "0.8999999999999999");
+    check_ok("{: 1.2 - true :}", "0.19999999999999996");
     check_ok("{: 1.2 * 1.3 :}", "1.56");
     check_ok("{: 2 * 1.3 :}", "2.6");
     check_ok("{: 1.2 * true :}", "1.2");
@@ -28021,14 +29295,14 @@ test_trv_expr_float(void) {
     check_ok("{: 4.0 / true :}", "4.0");
     check_ok("{@ a = 1.1 b = a @}{: b :}", "1.1");
 
-    check_fail("{: 1.0 + \"a\" :}", "can't add with float");
-    check_fail("{: 1.0 - \"a\" :}", "can't sub with float");
-    check_fail("{: 1.0 * \"a\" :}", "can't mul with float");
-    check_fail("{: 1.0 / \"a\" :}", "invalid right hand operand");
-    check_fail("{: \"a\" + 1.0 :}", "can't add 2 with string");
-    check_fail("{: \"a\" - 1.0 :}", "can't sub");
-    check_fail("{: \"a\" * 1.0 :}", "can't mul with string");
-    check_fail("{: \"a\" / 1.0 :}", "can't division");
+    check_fail("{: 1.0 + \"a\" :}", "can't add float with string");
+    check_fail("{: 1.0 - \"a\" :}", "can't sub float with string");
+    check_fail("{: 1.0 * \"a\" :}", "can't mul float with string");
+    check_fail("{: 1.0 / \"a\" :}", "can't div float with string");
+    check_fail("{: \"a\" + 1.0 :}", "can't add string with float");
+    check_fail("{: \"a\" - 1.0 :}", "can't sub string with float");
+    check_fail("{: \"a\" * 1.0 :}", "can't mul string with float");
+    check_fail("{: \"a\" / 1.0 :}", "can't div string with float");
 
     check_ok("{@ a = 0.0 a += 0.1 @}{: a :}", "0.1");
     check_ok("{@ a = 0.0 a += 1 @}{: a :}", "1.0");
@@ -28043,10 +29317,10 @@ test_trv_expr_float(void) {
     check_ok("{@ a = 4.0 a /= 2 @}{: a :}", "2.0");
     check_ok("{@ a = 4.0 a /= true @}{: a :}", "4.0");
 
-    check_fail("{@ a = 1.0 a += nil @}", "invalid right hand operand (0)");
-    check_fail("{@ a = 1.0 a += \"a\" @}", "invalid right hand operand (5)");
-    check_fail("{@ a = 1.0 a += [] @}", "invalid right hand operand (6)");
-    check_fail("{@ a = 1.0 a += {} @}", "invalid right hand operand (7)");
+    check_fail("{@ a = 1.0 a += nil @}", "can't add float with nil");
+    check_fail("{@ a = 1.0 a += \"a\" @}", "can't add float with string");
+    check_fail("{@ a = 1.0 a += [] @}", "can't add float with array");
+    check_fail("{@ a = 1.0 a += {} @}", "can't add float with dict");
 
     check_ok("{@ a = 1 a += 1.0 @}{: a :}", "2.0");
     check_ok("{@ a = 1 a -= 1.0 @}{: a :}", "0.0");
@@ -28077,46 +29351,46 @@ test_trv_expr_float(void) {
     check_ok("{: 1.0 >= 0.0 :}", "true");
     check_ok("{: true >= 0.0 :}", "true");
 
-    check_fail("{: 1.0 < nil :}", "can't compare lt with float");
-    check_fail("{: 1.0 < \"a\" :}", "can't compare lt with float");
-    check_fail("{: 1.0 < [] :}", "can't compare lt with float");
-    check_fail("{: 1.0 < {} :}", "can't compare lt with float");
-    check_fail("{@ def f(): end @}{: 1.0 < f :}", "can't compare lt with float");
-    check_fail("{: 1.0 <= nil :}", "can't compare lte with float");
-    check_fail("{: 1.0 <= \"a\" :}", "can't compare lte with float");
-    check_fail("{: 1.0 <= [] :}", "can't compare lte with float");
-    check_fail("{: 1.0 <= {} :}", "can't compare lte with float");
-    check_fail("{@ def f(): end @}{: 1.0 <= f :}", "can't compare lte with float");
-    check_fail("{: 1.0 > \"a\" :}", "can't compare gt with float");
-    check_fail("{: 1.0 > nil :}", "can't compare gt with float");
-    check_fail("{: 1.0 > [] :}", "can't compare gt with float");
-    check_fail("{: 1.0 > {} :}", "can't compare gt with float");
-    check_fail("{@ def f(): end @}{: 1.0 > f :}", "can't compare gt with float");
-    check_fail("{: 1.0 >= nil :}", "can't compare gte with float");
-    check_fail("{: 1.0 >= \"a\" :}", "can't compare gte with float");
-    check_fail("{: 1.0 >= [] :}", "can't compare gte with float");
-    check_fail("{: 1.0 >= {} :}", "can't compare gte with float");
-    check_fail("{@ def f(): end @}{: 1.0 >= f :}", "can't compare gte with float");
-    check_fail("{: nil < 1.0 :}", "can't compare with lt (0)");
-    check_fail("{: \"a\" < 1.0 :}", "can't compare with lt (5)");
-    check_fail("{: [] < 1.0 :}", "can't compare with lt (6)");
-    check_fail("{: {} < 1.0 :}", "can't compare with lt (7)");
-    check_fail("{@ def f(): end @}{: f < 1.0 :}", "can't compare with lt (10)");
-    check_fail("{: nil <= 1.0 :}", "can't compare with lte");
-    check_fail("{: \"a\" <= 1.0 :}", "can't compare with lte");
-    check_fail("{: [] <= 1.0 :}", "can't compare with lte");
-    check_fail("{: {} <= 1.0 :}", "can't compare with lte");
-    check_fail("{@ def f(): end @}{: f <= 1.0 :}", "can't compare with lte");
-    check_fail("{: nil > 1.0 :}", "can't compare with gt");
-    check_fail("{: \"a\" > 1.0 :}", "can't compare with gt");
-    check_fail("{: [] > 1.0 :}", "can't compare with gt");
-    check_fail("{: {} > 1.0 :}", "can't compare with gt");
-    check_fail("{@ def f(): end @}{: f > 1.0 :}", "can't compare with gt");
-    check_fail("{: nil >= 1.0 :}", "can't compare with gte");
-    check_fail("{: \"a\" >= 1.0 :}", "can't compare with gte");
-    check_fail("{: [] >= 1.0 :}", "can't compare with gte");
-    check_fail("{: {} >= 1.0 :}", "can't compare with gte");
-    check_fail("{@ def f(): end @}{: f >= 1.0 :}", "can't compare with gte");
+    check_fail("{: 1.0 < nil :}", "can't lt float with nil");
+    check_fail("{: 1.0 < \"a\" :}", "can't lt float with string");
+    check_fail("{: 1.0 < [] :}", "can't lt float with array");
+    check_fail("{: 1.0 < {} :}", "can't lt float with dict");
+    check_fail("{@ def f(): end @}{: 1.0 < f :}", "can't lt float with func");
+    check_fail("{: 1.0 <= nil :}", "can't lte float with nil");
+    check_fail("{: 1.0 <= \"a\" :}", "can't lte float with string");
+    check_fail("{: 1.0 <= [] :}", "can't lte float with array");
+    check_fail("{: 1.0 <= {} :}", "can't lte float with dict");
+    check_fail("{@ def f(): end @}{: 1.0 <= f :}", "can't lte float with func");
+    check_fail("{: 1.0 > \"a\" :}", "can't gt float with string");
+    check_fail("{: 1.0 > nil :}", "can't gt float with nil");
+    check_fail("{: 1.0 > [] :}", "can't gt float with array");
+    check_fail("{: 1.0 > {} :}", "can't gt float with dict");
+    check_fail("{@ def f(): end @}{: 1.0 > f :}", "can't gt float with func");
+    check_fail("{: 1.0 >= nil :}", "can't gte float with nil");
+    check_fail("{: 1.0 >= \"a\" :}", "can't gte float with string");
+    check_fail("{: 1.0 >= [] :}", "can't gte float with array");
+    check_fail("{: 1.0 >= {} :}", "can't gte float with dict");
+    check_fail("{@ def f(): end @}{: 1.0 >= f :}", "can't gte float with func");
+    check_fail("{: nil < 1.0 :}", "can't lt nil with float");
+    check_fail("{: \"a\" < 1.0 :}", "can't lt string with float");
+    check_fail("{: [] < 1.0 :}", "can't lt array with float");
+    check_fail("{: {} < 1.0 :}", "can't lt dict with float");
+    check_fail("{@ def f(): end @}{: f < 1.0 :}", "can't lt func with float");
+    check_fail("{: nil <= 1.0 :}", "can't lte nil with float");
+    check_fail("{: \"a\" <= 1.0 :}", "can't lte string with float");
+    check_fail("{: [] <= 1.0 :}", "can't lte array with float");
+    check_fail("{: {} <= 1.0 :}", "can't lte dict with float");
+    check_fail("{@ def f(): end @}{: f <= 1.0 :}", "can't lte func with float");
+    check_fail("{: nil > 1.0 :}", "can't gt nil with float");
+    check_fail("{: \"a\" > 1.0 :}", "can't gt string with float");
+    check_fail("{: [] > 1.0 :}", "can't gt array with float");
+    check_fail("{: {} > 1.0 :}", "can't gt dict with float");
+    check_fail("{@ def f(): end @}{: f > 1.0 :}", "can't gt func with float");
+    check_fail("{: nil >= 1.0 :}", "can't gte nil with float");
+    check_fail("{: \"a\" >= 1.0 :}", "can't gte string with float");
+    check_fail("{: [] >= 1.0 :}", "can't gte array with float");
+    check_fail("{: {} >= 1.0 :}", "can't gte dict with float");
+    check_fail("{@ def f(): end @}{: f >= 1.0 :}", "can't gte func with float");
 
     check_ok("{: 1.0 == nil :}", "false");
     check_ok("{: 1.0 == \"a\" :}", "false");
@@ -28154,69 +29428,69 @@ test_trv_expr_float(void) {
     check_ok("{@ a = [1.0] @}{: a[0] + 1.0 :}", "2.0");
     check_ok("{@ a = [1.0] @}{: a[0] + 1 :}", "2.0");
     check_ok("{@ a = [1.0] @}{: a[0] + true :}", "2.0");
-    check_fail("{@ a = [1.0] @}{: a[0] + nil :}", "can't add with float");
-    check_fail("{@ a = [1.0] @}{: a[0] + [] :}", "can't add with float");
-    check_fail("{@ a = [1.0] @}{: a[0] + {} :}", "can't add with float");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] + f :}", "can't add with float");
+    check_fail("{@ a = [1.0] @}{: a[0] + nil :}", "can't add float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] + [] :}", "can't add float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] + {} :}", "can't add float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] + f :}", "can't add float with func");
 
     check_ok("{@ a = [1.0] @}{: 1.0 + a[0] :}", "2.0");
     check_ok("{@ a = [1.0] @}{: 1 + a[0] :}", "2.0");
     check_ok("{@ a = [1.0] @}{: true + a[0] :}", "2.0");
-    check_fail("{@ a = [1.0] @}{: nil + a[0] :}", "can't add");
-    check_fail("{@ a = [1.0] @}{: [] + a[0] :}", "invalid right hand operand (2)");
-    check_fail("{@ a = [1.0] @}{: {} + a[0] :}", "can't add");
-    check_fail("{@ a = [1.0] def f(): end @}{: f + a[0] :}", "can't add");
+    check_fail("{@ a = [1.0] @}{: nil + a[0] :}", "can't add nil with float");
+    check_fail("{@ a = [1.0] @}{: [] + a[0] :}", "can't add array with float");
+    check_fail("{@ a = [1.0] @}{: {} + a[0] :}", "can't add dict with float");
+    check_fail("{@ a = [1.0] def f(): end @}{: f + a[0] :}", "can't add func with float");
 
     // - sub operator
     check_ok("{@ a = [1.0] @}{: a[0] - 1.0 :}", "0.0");
     check_ok("{@ a = [1.0] @}{: a[0] - 1 :}", "0.0");
     check_ok("{@ a = [1.0] @}{: a[0] - true :}", "0.0");
-    check_fail("{@ a = [1.0] @}{: a[0] - nil :}", "can't sub with float");
-    check_fail("{@ a = [1.0] @}{: a[0] - [] :}", "can't sub with float");
-    check_fail("{@ a = [1.0] @}{: a[0] - {} :}", "can't sub with float");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] - f :}", "can't sub with float");
+    check_fail("{@ a = [1.0] @}{: a[0] - nil :}", "can't sub float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] - [] :}", "can't sub float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] - {} :}", "can't sub float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] - f :}", "can't sub float with func");
 
     check_ok("{@ a = [1.0] @}{: 1.0 - a[0] :}", "0.0");
     check_ok("{@ a = [1.0] @}{: 1 - a[0] :}", "0.0");
     check_ok("{@ a = [1.0] @}{: true - a[0] :}", "0.0");
-    check_fail("{@ a = [1.0] @}{: nil - a[0] :}", "can't sub");
-    check_fail("{@ a = [1.0] @}{: [] - a[0] :}", "can't sub");
-    check_fail("{@ a = [1.0] @}{: {} - a[0] :}", "can't sub");
-    check_fail("{@ a = [1.0] def f(): end @}{: f - a[0] :}", "can't sub");
+    check_fail("{@ a = [1.0] @}{: nil - a[0] :}", "can't sub nil with float");
+    check_fail("{@ a = [1.0] @}{: [] - a[0] :}", "can't sub array with float");
+    check_fail("{@ a = [1.0] @}{: {} - a[0] :}", "can't sub dict with float");
+    check_fail("{@ a = [1.0] def f(): end @}{: f - a[0] :}", "can't sub func with float");
 
     // - mul operator
     check_ok("{@ a = [2.0] @}{: a[0] * 2.0 :}", "4.0");
     check_ok("{@ a = [2.0] @}{: a[0] * 2 :}", "4.0");
     check_ok("{@ a = [2.0] @}{: a[0] * true :}", "2.0");
-    check_fail("{@ a = [1.0] @}{: a[0] * nil :}", "can't mul with float");
-    check_fail("{@ a = [1.0] @}{: a[0] * [] :}", "can't mul with float");
-    check_fail("{@ a = [1.0] @}{: a[0] * {} :}", "can't mul with float");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] * f :}", "can't mul with float");
+    check_fail("{@ a = [1.0] @}{: a[0] * nil :}", "can't mul float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] * [] :}", "can't mul float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] * {} :}", "can't mul float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] * f :}", "can't mul float with func");
 
     check_ok("{@ a = [2.0] @}{: 2.0 * a[0] :}", "4.0");
     check_ok("{@ a = [2.0] @}{: 2 * a[0] :}", "4.0");
     check_ok("{@ a = [2.0] @}{: true * a[0] :}", "2.0");
-    check_fail("{@ a = [1.0] @}{: nil * a[0] :}", "can't mul");
-    check_fail("{@ a = [1.0] @}{: [] * a[0] :}", "can't mul");
-    check_fail("{@ a = [1.0] @}{: {} * a[0] :}", "can't mul");
-    check_fail("{@ a = [1.0] def f(): end @}{: f * a[0] :}", "can't mul");
+    check_fail("{@ a = [1.0] @}{: nil * a[0] :}", "can't mul nil with float");
+    check_fail("{@ a = [1.0] @}{: [] * a[0] :}", "can't mul array with float");
+    check_fail("{@ a = [1.0] @}{: {} * a[0] :}", "can't mul dict with float");
+    check_fail("{@ a = [1.0] def f(): end @}{: f * a[0] :}", "can't mul func with float");
 
     // - div operator
     check_ok("{@ a = [4.0] @}{: a[0] / 2.0 :}", "2.0");
     check_ok("{@ a = [4.0] @}{: a[0] / 2 :}", "2.0");
     check_ok("{@ a = [4.0] @}{: a[0] / true :}", "4.0");
-    check_fail("{@ a = [1.0] @}{: a[0] / nil :}", "invalid right hand operand");
-    check_fail("{@ a = [1.0] @}{: a[0] / [] :}", "invalid right hand operand");
-    check_fail("{@ a = [1.0] @}{: a[0] / {} :}", "invalid right hand operand");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] / f :}", "invalid right hand operand");
+    check_fail("{@ a = [1.0] @}{: a[0] / nil :}", "can't div float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] / [] :}", "can't div float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] / {} :}", "can't div float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] / f :}", "can't div float with func");
 
     check_ok("{@ a = [2.0] @}{: 4.0 / a[0] :}", "2.0");
     check_ok("{@ a = [2.0] @}{: 4 / a[0] :}", "2.0");
     check_ok("{@ a = [2.0] @}{: true / a[0] :}", "0.5");
-    check_fail("{@ a = [1.0] @}{: nil / a[0] :}", "can't division");
-    check_fail("{@ a = [1.0] @}{: [] / a[0] :}", "can't division");
-    check_fail("{@ a = [1.0] @}{: {} / a[0] :}", "can't division");
-    check_fail("{@ a = [1.0] def f(): end @}{: f / a[0] :}", "can't division");
+    check_fail("{@ a = [1.0] @}{: nil / a[0] :}", "can't div nil with float");
+    check_fail("{@ a = [1.0] @}{: [] / a[0] :}", "can't div array with float");
+    check_fail("{@ a = [1.0] @}{: {} / a[0] :}", "can't div dict with float");
+    check_fail("{@ a = [1.0] def f(): end @}{: f / a[0] :}", "can't div func with float");
 
     // - assign operator
     check_ok("{@ a = [1.0] a[0] = 2.0 @}{: a[0] :}", "2.0");
@@ -28238,65 +29512,65 @@ test_trv_expr_float(void) {
     check_ok("{@ a = [1.0] a[0] += 1.0 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [1.0] a[0] += 1 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [1.0] a[0] += true @}{: a[0] :}", "2.0");
-    check_fail("{@ a = [1.0] @}{: a[0] += nil :}", "invalid right hand operand (0)");
-    check_fail("{@ a = [1.0] @}{: a[0] += [] :}", "invalid right hand operand (6)");
-    check_fail("{@ a = [1.0] @}{: a[0] += {} :}", "invalid right hand operand (7)");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] += f :}", "invalid right hand operand (10)");
+    check_fail("{@ a = [1.0] @}{: a[0] += nil :}", "can't add float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] += [] :}", "can't add float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] += {} :}", "can't add float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] += f :}", "can't add float with func");
 
     check_ok("{@ a = [1] a[0] += 1.0 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [true] a[0] += 1.0 @}{: a[0] :}", "2.0");
-    check_fail("{@ a = [nil] a[0] += 1.0 @}{: a[0] :}", "invalid left hand operand (0)");
-    check_fail("{@ a = [[]] a[0] += 1.0 @}{: a[0] :}", "invalid right hand operand (2)");
-    check_fail("{@ a = [{}] a[0] += 1.0 @}{: a[0] :}", "invalid left hand operand (7)");
-    check_fail("{@ def f(): end a = [f] a[0] += 1.0 @}{: a[0] :}", "invalid left hand operand (10)");
+    check_fail("{@ a = [nil] a[0] += 1.0 @}{: a[0] :}", "can't add nil with float");
+    check_fail("{@ a = [[]] a[0] += 1.0 @}{: a[0] :}", "can't add array with float");
+    check_fail("{@ a = [{}] a[0] += 1.0 @}{: a[0] :}", "can't add dict with float");
+    check_fail("{@ def f(): end a = [f] a[0] += 1.0 @}{: a[0] :}", "can't add func with float");
 
     // - sub assign operator
     check_ok("{@ a = [1.0] a[0] -= 1.0 @}{: a[0] :}", "0.0");
     check_ok("{@ a = [1.0] a[0] -= 1 @}{: a[0] :}", "0.0");
     check_ok("{@ a = [1.0] a[0] -= true @}{: a[0] :}", "0.0");
-    check_fail("{@ a = [1.0] @}{: a[0] -= nil :}", "invalid right hand operand (0)");
-    check_fail("{@ a = [1.0] @}{: a[0] -= [] :}", "invalid right hand operand (6)");
-    check_fail("{@ a = [1.0] @}{: a[0] -= {} :}", "invalid right hand operand (7)");
-    check_fail("{@ a = [1.0] def f(): end @}{: a[0] -= f :}", "invalid right hand operand (10)");
+    check_fail("{@ a = [1.0] @}{: a[0] -= nil :}", "can't sub float with nil");
+    check_fail("{@ a = [1.0] @}{: a[0] -= [] :}", "can't sub float with array");
+    check_fail("{@ a = [1.0] @}{: a[0] -= {} :}", "can't sub float with dict");
+    check_fail("{@ a = [1.0] def f(): end @}{: a[0] -= f :}", "can't sub float with func");
 
     check_ok("{@ a = [1] a[0] -= 1.0 @}{: a[0] :}", "0.0");
     check_ok("{@ a = [true] a[0] -= 1.0 @}{: a[0] :}", "0.0");
-    check_fail("{@ a = [nil] a[0] -= 1.0 @}{: a[0] :}", "invalid left hand operand (0)");
-    check_fail("{@ a = [[]] a[0] -= 1.0 @}{: a[0] :}", "invalid left hand operand (6)");
-    check_fail("{@ a = [{}] a[0] -= 1.0 @}{: a[0] :}", "invalid left hand operand (7)");
-    check_fail("{@ def f(): end a = [f] a[0] -= 1.0 @}{: a[0] :}", "invalid left hand operand (10)");
+    check_fail("{@ a = [nil] a[0] -= 1.0 @}{: a[0] :}", "can't sub nil with float");
+    check_fail("{@ a = [[]] a[0] -= 1.0 @}{: a[0] :}", "can't sub array with float");
+    check_fail("{@ a = [{}] a[0] -= 1.0 @}{: a[0] :}", "can't sub dict with float");
+    check_fail("{@ def f(): end a = [f] a[0] -= 1.0 @}{: a[0] :}", "can't sub func with float");
 
     // - mul assign operator
     check_ok("{@ a = [2.0] a[0] *= 2.0 @}{: a[0] :}", "4.0");
     check_ok("{@ a = [2.0] a[0] *= 2 @}{: a[0] :}", "4.0");
     check_ok("{@ a = [2.0] a[0] *= true @}{: a[0] :}", "2.0");
-    check_fail("{@ a = [2.0] @}{: a[0] *= nil :}", "invalid right hand operand (0)");
-    check_fail("{@ a = [2.0] @}{: a[0] *= [] :}", "invalid right hand operand (6)");
-    check_fail("{@ a = [2.0] @}{: a[0] *= {} :}", "invalid right hand operand (7)");
-    check_fail("{@ a = [2.0] def f(): end @}{: a[0] *= f :}", "invalid right hand operand (10)");
+    check_fail("{@ a = [2.0] @}{: a[0] *= nil :}", "can't mul float with nil");
+    check_fail("{@ a = [2.0] @}{: a[0] *= [] :}", "can't mul float with array");
+    check_fail("{@ a = [2.0] @}{: a[0] *= {} :}", "can't mul float with dict");
+    check_fail("{@ a = [2.0] def f(): end @}{: a[0] *= f :}", "can't mul float with func");
 
     check_ok("{@ a = [2] a[0] *= 2.0 @}{: a[0] :}", "4.0");
     check_ok("{@ a = [true] a[0] *= 2.0 @}{: a[0] :}", "2.0");
-    check_fail("{@ a = [nil] a[0] *= 1.0 @}", "invalid left hand operand (0)");
-    check_fail("{@ a = [[]] a[0] *= 1.0 @}", "invalid left hand operand (6)");
-    check_fail("{@ a = [{}] a[0] *= 1.0 @}", "invalid left hand operand (7)");
-    check_fail("{@ def f(): end a = [f] a[0] *= 1.0 @}", "invalid left hand operand (10)");
+    check_fail("{@ a = [nil] a[0] *= 1.0 @}", "can't mul nil with float");
+    check_fail("{@ a = [[]] a[0] *= 1.0 @}", "can't mul array with float");
+    check_fail("{@ a = [{}] a[0] *= 1.0 @}", "can't mul dict with float");
+    check_fail("{@ def f(): end a = [f] a[0] *= 1.0 @}", "can't mul func with float");
 
     // - div assign operator
     check_ok("{@ a = [4.0] a[0] /= 2.0 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [4.0] a[0] /= 2 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [4.0] a[0] /= true @}{: a[0] :}", "4.0");
-    check_fail("{@ a = [4.0] @}{: a[0] /= nil :}", "invalid right hand operand (0)");
-    check_fail("{@ a = [4.0] @}{: a[0] /= [] :}", "invalid right hand operand (6)");
-    check_fail("{@ a = [4.0] @}{: a[0] /= {} :}", "invalid right hand operand (7)");
-    check_fail("{@ a = [4.0] def f(): end @}{: a[0] /= f :}", "invalid right hand operand (10)");
+    check_fail("{@ a = [4.0] @}{: a[0] /= nil :}", "can't div float with nil");
+    check_fail("{@ a = [4.0] @}{: a[0] /= [] :}", "can't div float with array");
+    check_fail("{@ a = [4.0] @}{: a[0] /= {} :}", "can't div float with dict");
+    check_fail("{@ a = [4.0] def f(): end @}{: a[0] /= f :}", "can't div float with func");
 
     check_ok("{@ a = [4] a[0] /= 2.0 @}{: a[0] :}", "2.0");
     check_ok("{@ a = [true] a[0] /= 2.0 @}{: a[0] :}", "0.5");
-    check_fail("{@ a = [nil] a[0] /= 1.0 @}", "invalid left hand operand (0)");
-    check_fail("{@ a = [[]] a[0] /= 1.0 @}", "invalid left hand operand (6)");
-    check_fail("{@ a = [{}] a[0] /= 1.0 @}", "invalid left hand operand (7)");
-    check_fail("{@ def f(): end a = [f] a[0] /= 1.0 @}", "invalid left hand operand (10)");
+    check_fail("{@ a = [nil] a[0] /= 1.0 @}", "can't div nil with float");
+    check_fail("{@ a = [[]] a[0] /= 1.0 @}", "can't div array with float");
+    check_fail("{@ a = [{}] a[0] /= 1.0 @}", "can't div dict with float");
+    check_fail("{@ def f(): end a = [f] a[0] /= 1.0 @}", "can't div func with float");
 
     // - comparison operator
     // -- eq operator
@@ -28337,69 +29611,69 @@ test_trv_expr_float(void) {
     check_ok("{@ a = [1.0] @}{: a[0] > 0.5 :}", "true");
     check_ok("{@ a = [1] @}{: a[0] > 0.5 :}", "true");
     check_ok("{@ a = [true] @}{: a[0] > 0.5 :}", "true");
-    check_fail("{@ a = [nil] @}{: a[0] > 0.5 :}", "can't compare with gt");
-    check_fail("{@ a = [[]] @}{: a[0] > 0.5 :}", "can't compare with gt");
-    check_fail("{@ a = [{}] @}{: a[0] > 0.5 :}", "can't compare with gt");
-    check_fail("{@ def f(): end a = [f] @}{: a[0] > 0.5 :}", "can't compare with gt");
+    check_fail("{@ a = [nil] @}{: a[0] > 0.5 :}", "can't gt nil with float");
+    check_fail("{@ a = [[]] @}{: a[0] > 0.5 :}", "can't gt array with float");
+    check_fail("{@ a = [{}] @}{: a[0] > 0.5 :}", "can't gt dict with float");
+    check_fail("{@ def f(): end a = [f] @}{: a[0] > 0.5 :}", "can't gt func with float");
 
     check_ok("{@ a = [1.0] @}{: 0.5 > a[0] :}", "false");
     check_ok("{@ a = [1] @}{: 0.5 > a[0] :}", "false");
     check_ok("{@ a = [true] @}{: 0.5 > a[0] :}", "false");
-    check_fail("{@ a = [nil] @}{: 0.5 > a[0] :}", "can't compare gt with float");
-    check_fail("{@ a = [[]] @}{: 0.5 > a[0] :}", "can't compare gt with float");
-    check_fail("{@ a = [{}] @}{: 0.5 > a[0] :}", "can't compare gt with float");
-    check_fail("{@ def f(): end a = [f] @}{: 0.5 > a[0] :}", "can't compare gt with float");
+    check_fail("{@ a = [nil] @}{: 0.5 > a[0] :}", "can't gt float with nil");
+    check_fail("{@ a = [[]] @}{: 0.5 > a[0] :}", "can't gt float with array");
+    check_fail("{@ a = [{}] @}{: 0.5 > a[0] :}", "can't gt float with dict");
+    check_fail("{@ def f(): end a = [f] @}{: 0.5 > a[0] :}", "can't gt float with func");
 
     // -- gte operator
     check_ok("{@ a = [1.0] @}{: a[0] >= 0.5 :}", "true");
     check_ok("{@ a = [1] @}{: a[0] >= 0.5 :}", "true");
     check_ok("{@ a = [true] @}{: a[0] >= 0.5 :}", "true");
-    check_fail("{@ a = [nil] @}{: a[0] >= 0.5 :}", "can't compare with gte");
-    check_fail("{@ a = [[]] @}{: a[0] >= 0.5 :}", "can't compare with gte");
-    check_fail("{@ a = [{}] @}{: a[0] >= 0.5 :}", "can't compare with gte");
-    check_fail("{@ def f(): end a = [f] @}{: a[0] >= 0.5 :}", "can't compare with gte");
+    check_fail("{@ a = [nil] @}{: a[0] >= 0.5 :}", "can't gte nil with float");
+    check_fail("{@ a = [[]] @}{: a[0] >= 0.5 :}", "can't gte array with float");
+    check_fail("{@ a = [{}] @}{: a[0] >= 0.5 :}", "can't gte dict with float");
+    check_fail("{@ def f(): end a = [f] @}{: a[0] >= 0.5 :}", "can't gte func with float");
 
     check_ok("{@ a = [1.0] @}{: 0.5 >= a[0] :}", "false");
     check_ok("{@ a = [1] @}{: 0.5 >= a[0] :}", "false");
     check_ok("{@ a = [true] @}{: 0.5 >= a[0] :}", "false");
-    check_fail("{@ a = [nil] @}{: 0.5 >= a[0] :}", "can't compare gte with float");
-    check_fail("{@ a = [[]] @}{: 0.5 >= a[0] :}", "can't compare gte with float");
-    check_fail("{@ a = [{}] @}{: 0.5 >= a[0] :}", "can't compare gte with float");
-    check_fail("{@ def f(): end a = [f] @}{: 0.5 >= a[0] :}", "can't compare gte with float");
+    check_fail("{@ a = [nil] @}{: 0.5 >= a[0] :}", "can't gte float with nil");
+    check_fail("{@ a = [[]] @}{: 0.5 >= a[0] :}", "can't gte float with array");
+    check_fail("{@ a = [{}] @}{: 0.5 >= a[0] :}", "can't gte float with dict");
+    check_fail("{@ def f(): end a = [f] @}{: 0.5 >= a[0] :}", "can't gte float with func");
 
     // -- lt operator
     check_ok("{@ a = [1.0] @}{: a[0] < 1.5 :}", "true");
     check_ok("{@ a = [1] @}{: a[0] < 1.5 :}", "true");
     check_ok("{@ a = [true] @}{: a[0] < 1.5 :}", "true");
-    check_fail("{@ a = [nil] @}{: a[0] < 1.5 :}", "can't compare with lt (0)");
-    check_fail("{@ a = [[]] @}{: a[0] < 1.5 :}", "can't compare with lt (6)");
-    check_fail("{@ a = [{}] @}{: a[0] < 1.5 :}", "can't compare with lt (7)");
-    check_fail("{@ def f(): end a = [f] @}{: a[0] < 1.5 :}", "can't compare with lt (10)");
+    check_fail("{@ a = [nil] @}{: a[0] < 1.5 :}", "can't lt nil with float");
+    check_fail("{@ a = [[]] @}{: a[0] < 1.5 :}", "can't lt array with float");
+    check_fail("{@ a = [{}] @}{: a[0] < 1.5 :}", "can't lt dict with float");
+    check_fail("{@ def f(): end a = [f] @}{: a[0] < 1.5 :}", "can't lt func with float");
 
     check_ok("{@ a = [1.0] @}{: 1.5 < a[0] :}", "false");
     check_ok("{@ a = [1] @}{: 1.5 < a[0] :}", "false");
     check_ok("{@ a = [true] @}{: 1.5 < a[0] :}", "false");
-    check_fail("{@ a = [nil] @}{: 1.5 < a[0] :}", "can't compare lt with float");
-    check_fail("{@ a = [[]] @}{: 1.5 < a[0] :}", "can't compare lt with float");
-    check_fail("{@ a = [{}] @}{: 1.5 < a[0] :}", "can't compare lt with float");
-    check_fail("{@ def f(): end a = [f] @}{: 1.5 < a[0] :}", "can't compare lt with float");
+    check_fail("{@ a = [nil] @}{: 1.5 < a[0] :}", "can't lt float with nil");
+    check_fail("{@ a = [[]] @}{: 1.5 < a[0] :}", "can't lt float with array");
+    check_fail("{@ a = [{}] @}{: 1.5 < a[0] :}", "can't lt float with dict");
+    check_fail("{@ def f(): end a = [f] @}{: 1.5 < a[0] :}", "can't lt float with func");
 
     // -- lte operator
     check_ok("{@ a = [1.0] @}{: a[0] <= 1.5 :}", "true");
     check_ok("{@ a = [1] @}{: a[0] <= 1.5 :}", "true");
     check_ok("{@ a = [true] @}{: a[0] <= 1.5 :}", "true");
-    check_fail("{@ a = [nil] @}{: a[0] <= 1.5 :}", "can't compare with lte");
-    check_fail("{@ a = [[]] @}{: a[0] <= 1.5 :}", "can't compare with lte");
-    check_fail("{@ a = [{}] @}{: a[0] <= 1.5 :}", "can't compare with lte");
-    check_fail("{@ def f(): end a = [f] @}{: a[0] <= 1.5 :}", "can't compare with lte");
+    check_fail("{@ a = [nil] @}{: a[0] <= 1.5 :}", "can't lte nil with float");
+    check_fail("{@ a = [[]] @}{: a[0] <= 1.5 :}", "can't lte array with float");
+    check_fail("{@ a = [{}] @}{: a[0] <= 1.5 :}", "can't lte dict with float");
+    check_fail("{@ def f(): end a = [f] @}{: a[0] <= 1.5 :}", "can't lte func with float");
 
     check_ok("{@ a = [1.0] @}{: 1.5 <= a[0] :}", "false");
     check_ok("{@ a = [1] @}{: 1.5 <= a[0] :}", "false");
     check_ok("{@ a = [true] @}{: 1.5 <= a[0] :}", "false");
-    check_fail("{@ a = [nil] @}{: 1.5 <= a[0] :}", "can't compare lte with float");
-    check_fail("{@ a = [[]] @}{: 1.5 <= a[0] :}", "can't compare lte with float");
-    check_fail("{@ a = [{}] @}{: 1.5 <= a[0] :}", "can't compare lte with float");
-    check_fail("{@ def f(): end a = [f] @}{: 1.5 <= a[0] :}", "can't compare lte with float");
+    check_fail("{@ a = [nil] @}{: 1.5 <= a[0] :}", "can't lte float with nil");
+    check_fail("{@ a = [[]] @}{: 1.5 <= a[0] :}", "can't lte float with array");
+    check_fail("{@ a = [{}] @}{: 1.5 <= a[0] :}", "can't lte float with dict");
+    check_fail("{@ def f(): end a = [f] @}{: 1.5 <= a[0] :}", "can't lte float with func");
 
     trv_cleanup;
 }
@@ -28420,22 +29694,22 @@ test_trv_expr_fail_0(void) {
     check_fail("{@ 1 + + @}", "syntax error. not found rhs operand in expr");
     check_fail("{@ + 1 + @}", "not found blocks");
     check_fail("{@ 1 + + @}", "syntax error. not found rhs operand in expr");
-    check_fail("{@ 1 + [] @}", "can't add with int");
-    check_fail("{@ [] + 1 @}", "invalid right hand operand (1)");
-    check_fail("{@ 1 + {} @}", "can't add with int");
-    check_fail("{@ {} + 1 @}", "can't add");
-    check_fail("{@ 1 + \"a\" @}", "can't add with int");
-    check_fail("{@ \"a\" + 1 @}", "can't add 1 with string");
+    check_fail("{@ 1 + [] @}", "can't add int with array");
+    check_fail("{@ [] + 1 @}", "can't add array with int");
+    check_fail("{@ 1 + {} @}", "can't add int with dict");
+    check_fail("{@ {} + 1 @}", "can't add dict with int");
+    check_fail("{@ 1 + \"a\" @}", "can't add int with string");
+    check_fail("{@ \"a\" + 1 @}", "can't add string with int");
 
     check_fail("{@ 1 - - @}", "syntax error. not found rhs operand in expr");
     check_fail("{@ - 1 - @}", "syntax error. not found rhs operand in expr");
     check_fail("{@ 1 - - @}", "syntax error. not found rhs operand in expr");
-    check_fail("{@ 1 - [] @}", "can't sub with int");
-    check_fail("{@ [] - 1 @}", "can't sub");
-    check_fail("{@ 1 - {} @}", "can't sub with int");
-    check_fail("{@ {} - 1 @}", "can't sub");
-    check_fail("{@ 1 - \"a\" @}", "can't sub with int");
-    check_fail("{@ \"a\" - 1 @}", "can't sub");
+    check_fail("{@ 1 - [] @}", "can't sub int with array");
+    check_fail("{@ [] - 1 @}", "can't sub array with int");
+    check_fail("{@ 1 - {} @}", "can't sub int with dict");
+    check_fail("{@ {} - 1 @}", "can't sub dict with int");
+    check_fail("{@ 1 - \"a\" @}", "can't sub int with string");
+    check_fail("{@ \"a\" - 1 @}", "can't sub string with int");
 
     trv_cleanup;
 }
@@ -28464,16 +29738,16 @@ test_trv_term_1(void) {
 
     check_fail("{: 4 / 0 :}", "zero division error");
     check_fail("{: 4 / false :}", "zero division error");
-    check_fail("{: 4 / \"aa\" :}", "invalid right hand operand");
-    check_fail("{: 4 / [] :}", "invalid right hand operand");
-    check_fail("{: 4 / {} :}", "invalid right hand operand");
+    check_fail("{: 4 / \"aa\" :}", "can't div int with string");
+    check_fail("{: 4 / [] :}", "can't div int with array");
+    check_fail("{: 4 / {} :}", "can't div int with dict");
 
     check_ok("{: true / 1 :}", "1");
     check_ok("{: false / 1 :}", "0");
 
-    check_fail("{: \"aa\" / 1 :}", "can't division");
-    check_fail("{: [] / 1 :}", "can't division");
-    check_fail("{: {} / 1 :}", "can't division");
+    check_fail("{: \"aa\" / 1 :}", "can't div string with int");
+    check_fail("{: [] / 1 :}", "can't div array with int");
+    check_fail("{: {} / 1 :}", "can't div dict with int");
 
     trv_cleanup;
 }
@@ -28488,16 +29762,16 @@ test_trv_term_2(void) {
 
     check_fail("{: 1 % 0 :}", "zero division error");
     check_fail("{: 1 % false :}", "zero division error");
-    check_fail("{: \"a\" % 1 :}", "invalid left hand operand (5)");
-    check_fail("{: [] % 1 :}", "invalid left hand operand (6)");
-    check_fail("{: {} % 1 :}", "invalid left hand operand (7)");
+    check_fail("{: \"a\" % 1 :}", "can't mod string with int");
+    check_fail("{: [] % 1 :}", "can't mod array with int");
+    check_fail("{: {} % 1 :}", "can't mod dict with int");
 
-    check_fail("{: 1 % \"a\" :}", "invalid right hand operand (5)");
-    check_fail("{: 1 % [] :}", "invalid right hand operand (6)");
-    check_fail("{: 1 % {} :}", "invalid right hand operand (7)");
+    check_fail("{: 1 % \"a\" :}", "can't mod int with string");
+    check_fail("{: 1 % [] :}", "can't mod int with array");
+    check_fail("{: 1 % {} :}", "can't mod int with dict");
 
-    check_fail("{: 4 % nil :}", "invalid right hand operand (0)");
-    check_fail("{: nil % 2 :}", "invalid left hand operand (0)");
+    check_fail("{: 4 % nil :}", "can't mod int with nil");
+    check_fail("{: nil % 2 :}", "can't mod nil with int");
 
     trv_cleanup;
 }
@@ -28528,22 +29802,22 @@ test_trv_term_fail_0(void) {
     check_ok("{: false * 1 :}", "0");
     check_ok("{: 1 * \"a\" :}", "a");
     check_ok("{: \"a\" * 1 :}", "a");
-    check_fail("{: 1 * [] :}", "can't mul with int");
-    check_fail("{: [] * 1 :}", "can't mul");
-    check_fail("{: 1 * {} :}", "can't mul with int");
-    check_fail("{: {} * 1 :}", "can't mul");
+    check_fail("{: 1 * [] :}", "can't mul int with array");
+    check_fail("{: [] * 1 :}", "can't mul array with int");
+    check_fail("{: 1 * {} :}", "can't mul int with dict");
+    check_fail("{: {} * 1 :}", "can't mul dict with int");
 
     check_fail("{: / :}", "not found blocks");
     check_fail("{: 1 / :}", "syntax error. not found rhs operand in term");
     check_fail("{: / 1 :}", "not found blocks");
     check_ok("{: 1 / true :}", "1");
     check_ok("{: false / 1 :}", "0");
-    check_fail("{: 1 / \"a\" :}", "invalid right hand operand");
-    check_fail("{: \"a\" / 1 :}", "can't division");
-    check_fail("{: 1 / [] :}", "invalid right hand operand");
-    check_fail("{: [] / 1 :}", "can't division");
-    check_fail("{: 1 / {} :}", "invalid right hand operand");
-    check_fail("{: {} / 1 :}", "can't division");
+    check_fail("{: 1 / \"a\" :}", "can't div int with string");
+    check_fail("{: \"a\" / 1 :}", "can't div string with int");
+    check_fail("{: 1 / [] :}", "can't div int with array");
+    check_fail("{: [] / 1 :}", "can't div array with int");
+    check_fail("{: 1 / {} :}", "can't div int with dict");
+    check_fail("{: {} / 1 :}", "can't div dict with int");
 
     trv_cleanup;
 }
@@ -29504,6 +30778,89 @@ test_trv_builtin_array_0(void) {
     PadConfig_Del(config);
 }
 
+static void
+test_trv_builtin_array_sort(void) {
+    trv_ready;
+
+    check_ok("{@ a = [3, 1, 2] \n a.sort() @}{: a.join(\",\") :}", "1,2,3");
+    check_ok("{: [].sort().join(\",\") :}", "");
+    check_ok("{: [\"b\", \"c\", \"a\"].sort().join(\",\") :}", "a,b,c");
+    check_ok("{: [2, 0.5, -1, true, 1.5].sort().join(\",\") :}", "-1,0.5,true,1.5,2");
+    check_ok("{@ def neg(x): return -x end @}{: [1, 3, 2].sort(neg).join(\",\") :}", "3,2,1");
+    check_ok("{: [\"ccc\", \"a\", \"bb\"].sort(len).join(\",\") :}", "a,bb,ccc");
+
+    // stable by key and the array is sorted in place
+    check_ok("{@\n"
+    "def first(s): return s[0] end\n"
+    "a = [\"b2\", \"a1\", \"b1\", \"a2\", \"a3\"]\n"
+    "a.sort(first)\n"
+    "@}{: a.join(\",\") :}", "a1,a2,a3,b2,b1");
+
+    // quick sort, heap sort and insertion sort paths
+    check_ok("{@\n"
+    "a = []\n"
+    "x = 7\n"
+    "for i = 0; i < 500; i += 1:\n"
+    "   x = (x * 75 + 74) % 65537\n"
+    "   a.push(x % 100)\n"
+    "end\n"
+    "a.sort()\n"
+    "ok = true\n"
+    "for i = 1; i < len(a); i += 1:\n"
+    "   if a[i - 1] > a[i]: ok = false end\n"
+    "end\n"
+    "@}{: ok :},{: len(a) :}", "true,500");
+
+    check_fail("{: [1, \"a\"].sort() :}", "can't invoke array.sort. can't compare elements");
+    check_fail("{: [[1]].sort() :}", "can't invoke array.sort. can't compare elements");
+    check_fail("{: [1].sort(1) :}", "can't invoke array.sort. key is not function");
+
+    // key function changes the array
+    check_fail("{@\n"
+    "a = [3, 1, 2]\n"
+    "def k(x):\n"
+    "   a.pop()\n"
+    "   return x\n"
+    "end\n"
+    "a.sort(k)\n"
+    "@}", "can't invoke array.sort. array changed during sort");
+    check_ok("{@\n"
+    "a = [3, 1, 2]\n"
+    "def k(x):\n"
+    "   a[0] = 9\n"
+    "   return x\n"
+    "end\n"
+    "a.sort(k)\n"
+    "@}{: a.join(\",\") :}", "1,2,3");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_array_1(void) {
+    trv_ready;
+
+    check_ok("{: [1, 2, 3, 4].slice(1, 3).join(\",\") :}", "2,3");
+    check_ok("{: [1, 2, 3, 4].slice(-2).join(\",\") :}", "3,4");
+    check_ok("{: [1, 2, 3, 4].slice(3, 1).join(\",\") :}", "");
+    check_ok("{: [1, 2, 3, 4].slice(0, 100).join(\",\") :}", "1,2,3,4");
+    check_ok("{@ a = [1, 2] \n b = a.slice(0) \n b.push(3) @}{: len(a) :},{: len(b) :}", "2,3");
+    check_ok("{: [\"a\", 1, nil].join() :}", "a1nil");
+    check_ok("{: [].join(\", \") :}", "");
+    check_ok("{@ a = [1] \n a.extend([2, 3]) \n a.extend(a) @}{: a.join(\",\") :}", "1,2,3,1,2,3");
+    check_ok("{@ a = [1, 2, 3] \n a.reverse() @}{: a.join(\",\") :}", "3,2,1");
+    check_ok("{: [1, \"a\", 2.0].index(2) :},{: [1, \"a\"].index(\"a\") :},{: [1].index(3) :}", "2,1,-1");
+    check_ok("{: [1, nil].contains(nil) :},{: [1].contains(\"1\") :}", "true,false");
+    check_ok("{@ s = \"x\" \n a = [\"w\", \"x\"] @}{: a.contains(s) :}", "true");
+
+    check_fail("{: [1].slice(\"a\") :}", "can't invoke array.slice. index is not integer");
+    check_fail("{: [1].join(1) :}", "can't invoke array.join. separator is not string");
+    check_fail("{: [1].extend(1) :}", "can't invoke array.extend. argument is not array");
+    check_fail("{: [1].index() :}", "can't invoke array.index. need one argument");
+
+    trv_cleanup;
+}
+
 static void
 test_trv_builtin_dict_0(void) {
     PadConfig *config = PadConfig_New();
@@ -29553,6 +30910,136 @@ test_trv_builtin_dict_0(void) {
     PadConfig_Del(config);
 }
 
+static void
+test_trv_builtin_dict_view(void) {
+    trv_ready;
+
+    check_ok("{@ d = {\"a\": 1, \"b\": 2} \n k = d.keys() @}{: len(k) :},{: k[0] :},{: k[1] :}", "2,a,b");
+    check_ok("{@ d = {\"a\": 1, \"b\": 2} \n v = d.values() @}{: len(v) :},{: v[1] :}", "2,2");
+    check_ok("{@ d = {\"a\": 1} \n p = d.items()[0] @}{: p[0] :},{: p[1] :}", "a,1");
+    check_ok("{@ d = {\"a\": 1} \n k = d.keys() \n d[\"b\"] = 2 @}{: len(k) :},{: k[1] :}", "2,b");
+    check_ok("{@ for k in {\"a\": 1, \"b\": 2}.keys(): puts(k) end @}", "a\nb\n");
+    check_ok("{@ for i, v in {\"a\": 1, \"b\": 2}.values(): puts(i, v) end @}", "0 1\n1 2\n");
+    check_ok("{@ for k, v in {\"a\": 1, \"b\": 2}.items(): puts(k, v) end @}", "a 1\nb 2\n");
+    check_ok("{@ for p in {\"a\": 1}.items(): puts(p[0], p[1]) end @}", "a 1\n");
+    check_ok("{@ k = {\"a\": 1}.keys() @}{: k.contains(\"a\") :},{: k.contains(\"b\") :},{: k.contains(1) :}", "true,false,false");
+    check_ok("{@ v = {\"a\": 1}.values() @}{: v.contains(1.0) :},{: v.contains(\"a\") :}", "true,false");
+    check_ok("{@ i = {\"a\": 1}.items() @}{: i.contains([\"a\", 1]) :},{: i.contains([\"a\", 2]) :}", "true,false");
+    check_ok("{@ d = {\"a\": 1} \n a = d.keys().to_array() \n a.push(\"x\") @}{: len(a) :},{: len(d) :}", "2,1");
+    check_ok("{@ if {}.keys(): puts(1) else: puts(0) end @}", "0\n");
+    check_ok("{@ def f(d):\n return d.values()\n end \n v = f({\"a\": 3}) @}{: v[0] :}", "3");
+    check_ok("{: {\"a\": 1}.keys() :}", "(dict-view)");
+
+    check_fail("{: {\"a\": 1}.keys()[1] :}", "index out of range");
+    check_fail("{: {\"a\": 1}.keys(1) :}", "can't invoke dict.keys(). too many arguments");
+    check_fail("{@ d = {\"a\": 1} \n for k in d.keys(): d[k + \"x\"] = 1 end @}", "dict changed size during iteration");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_json(void) {
+    trv_ready;
+
+    check_ok("{@ d = json.decode(\"{\\\"a\\\": [1, 2.5, null], \\\"b\\\": true}\") @}{: d[\"a\"][0] + d[\"a\"][1] :},{: d[\"a\"][2] :},{: d.b :}", "3.5,nil,true");
+    check_ok("{@ d = json.decode(\"[\\\"\\\\u3042\\\", -3]\") @}{: d[0] :}{: d[1] :}", "あ-3");
+    check_ok("{: json.encode({\"a\": [1, 2.5, nil, true], \"s\": \"x\\\"y\"}) :}", "{\"a\":[1,2.5,null,true],\"s\":\"x\\\"y\"}");
+    check_ok("{: json.encode([1, [2]], 1) :}", "[\n 1,\n [\n  2\n ]\n]");
+    check_ok("{@ d = {\"a\": 1, \"b\": 2} @}{: json.encode([d.keys(), d.values(), d.items()]) :}", "[[\"a\",\"b\"],[1,2],[[\"a\",1],[\"b\",2]]]");
+    check_ok("{: json.encode(Deque([1, 2])) :},{: json.encode(NumArray([[1, 2], [3, 4]])) :}", "[1,2],[[1,2],[3,4]]");
+    check_ok("{@ struct P: x = 1 \n y = \"a\" end @}{: json.encode(P()) :}", "{\"x\":1,\"y\":\"a\"}");
+    check_ok("{@ s = \"[1, {\\\"k\\\": [true]}]\" @}{: json.encode(json.decode(s)) :}", "[1,{\"k\":[true]}]");
+    check_ok("{@\n"
+        "f = open(\"/tmp/pad.test.json\", \"w\")\n"
+        "json.dump({\"a\": [1, \"x\"]}, f, 2)\n"
+        "f.close()\n"
+        "f = open(\"/tmp/pad.test.json\", \"r\")\n"
+        "d = json.load(f)\n"
+        "f.close()\n"
+        "@}{: d.a[1] :}", "x");
+    remove("/tmp/pad.test.json");
+
+    check_fail("{: json.decode(\"[1,]\") :}", "failed to decode json. unexpected character ']' at line 1 column 4");
+    check_fail("{: json.decode(1) :}", "can't invoke json.decode(). argument is not string");
+    check_fail("{: json.decode() :}", "can't invoke json.decode(). need one argument");
+    check_fail("{@ a = [] \n a.push(a) @}{: json.encode(a) :}", "failed to encode json. circular reference");
+    check_fail("{: json.encode(open) :}", "failed to encode json. can't encode (builtin-function)");
+    check_fail("{: json.encode(1, \"2\") :}", "can't invoke json.encode(). invalid indent");
+    check_fail("{: json.load(1) :}", "can't invoke json.load(). argument is not file");
+    check_fail("{: json.dump(1) :}", "can't invoke json.dump(). need two or three arguments");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_re(void) {
+    trv_ready;
+
+    check_ok("{@ m = re.search(\"(\\\\w+)=(\\\\d+)\", \"x: key=123;\") @}{: m.groups[1] :},{: m.groups[2] :},{: m.start :},{: m.stop :}", "key,123,3,10");
+    check_ok("{: json.encode(re.search(\"(a)|(b)\", \"b\")) :}", "{\"groups\":[\"b\",null,\"b\"],\"spans\":[[0,1],[-1,-1],[0,1]],\"start\":0,\"stop\":1}");
+    check_ok("{: re.match(\"b\", \"ab\") :},{: re.match(\"a\", \"ab\").stop :}", "nil,1");
+    check_ok("{: json.encode(re.findall(\"\\\\d+\", \"1 22 333\")) :}", "[\"1\",\"22\",\"333\"]");
+    check_ok("{: json.encode(re.findall(\"(\\\\w)(\\\\d)?\", \"a1 b\")) :}", "[[\"a\",\"1\"],[\"b\",\"\"]]");
+    check_ok("{: json.encode(re.findall(\"a*\", \"baa\")) :}", "[\"\",\"aa\",\"\"]");
+    check_ok("{: json.encode(re.split(\",\\\\s*\", \"a, b,c\")) :}", "[\"a\",\"b\",\"c\"]");
+    check_ok("{: json.encode(re.split(\"(,)\", \"a,b,c\", 1)) :}", "[\"a\",\",\",\"b,c\"]");
+    check_ok("{: re.sub(\"(\\\\w+)@(\\\\w+)\", \"\\\\2 at \\\\1\", \"me@home you@work\") :}", "home at me work at you");
+    check_ok("{: re.sub(\"x*\", \"-\", \"abxd\") :},{: re.sub(\"a\", \"b\", \"aaa\", 2) :}", "-a-b--d-,bba");
+    check_ok("{: re.escape(\"1+1=2?\") :}", "1\\+1=2\\?");
+    check_ok("{@ r = re.compile(\"[a-z]+\", \"i\") @}{: json.encode(r.findall(\"Hello World\")) :},{: r.pattern() :},{: r.ngroups() :},{: r :}", "[\"Hello\",\"World\"],[a-z]+,0,(regex)");
+    check_ok("{@ r = re.compile(\"\\\\d\") \n m = r.search(\"1a2\", 1) @}{: m.start :},{: r.match(\"1a2\", 1) :},{: r.sub(\"#\", \"1a2\") :},{: json.encode(r.split(\"a1b\")) :}", "2,nil,#a#,[\"a\",\"b\"]");
+    check_ok("{@ r = re.compile(\"o\") @}{: re.sub(r, \"0\", \"foo\") :},{: len(re.findall(r, \"foo\")) :}", "f00,2");
+    check_ok("{: re.search(\"日本\", \"こんにちは日本語\").start :}", "5");
+
+    check_fail("{: re.search(\"(a\", \"a\") :}", "failed to compile pattern. missing ), unterminated subpattern at position 2");
+    check_fail("{: re.search(1, \"a\") :}", "can't invoke re.search(). pattern is not string or regex");
+    check_fail("{: re.search(\"a\", 1) :}", "can't invoke re.search(). argument is not string");
+    check_fail("{: re.findall(\"a\") :}", "can't invoke re.findall(). need two arguments");
+    check_fail("{: re.compile(\"a\", \"x\") :}", "can't invoke re.compile(). invalid flags");
+    check_fail("{: re.sub(\"a\", \"\\\\1\", \"a\") :}", "can't invoke re.sub(). invalid group reference 1");
+    check_fail("{: re.compile(\"a\").search(\"a\", \"b\") :}", "can't invoke search. invalid position");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_ini(void) {
+    trv_ready;
+
+    check_ok("{@ d = ini.decode(\"; comment\\n[a]\\nx = 1\\ny=hello world \\n\\n[ b ]\\nz =\\n\") @}{: d.a.x :},{: d.a.y :},{: d.b.z :},{: len(d) :}", "1,hello world,,2");
+    check_ok("{: ini.encode({\"a\": {\"x\": 1, \"y\": \"s\"}, \"b\": {}}) :}", "[a]\nx = 1\ny = s\n\n[b]\n\n");
+    check_ok("{: ini.encode({\"a\": {\"f\": 1.5, \"t\": true, \"n\": nil}}) :}", "[a]\nf = 1.5\nt = true\nn = nil\n\n");
+    check_ok("{@ s = \"[a]\\nk = v\\n\\n\" @}{: ini.encode(ini.decode(s)) == s :}", "true");
+    check_ok("{@\n"
+        "ini.dump({\"s\": {\"k\": \"v\"}}, \"/tmp/pad.test.ini\")\n"
+        "d = ini.load(\"/tmp/pad.test.ini\")\n"
+        "f = open(\"/tmp/pad.test.ini\", \"r\")\n"
+        "e = ini.load(f)\n"
+        "f.close()\n"
+        "@}{: d.s.k :},{: e.s.k :}", "v,v");
+    check_ok("{@\n"
+        "f = open(\"/tmp/pad.test.ini\", \"w\")\n"
+        "ini.dump({\"s\": {\"k\": 2}}, f)\n"
+        "f.close()\n"
+        "@}{: ini.load(\"/tmp/pad.test.ini\").s.k :}", "2");
+    remove("/tmp/pad.test.ini");
+
+    check_fail("{: ini.decode(\"[a]\\nb\") :}", "failed to decode ini. expected '=' at line 2");
+    check_fail("{: ini.decode(\"k = v\") :}", "failed to decode ini. name outside of section at line 1");
+    check_fail("{: ini.decode(1) :}", "can't invoke ini.decode(). argument is not string");
+    check_ok("{@ d = ini.decode(\"k = v\\n[a]\\nb\\nc = d\\n\", false) @}{: len(d) :},{: d.a.c :}", "1,d");
+    check_fail("{: ini.decode(\"[a]\\nb\", 1) :}", "can't invoke ini.decode(). strict is not bool");
+    check_fail("{: ini.decode() :}", "can't invoke ini.decode(). need one or two arguments");
+    check_fail("{: ini.encode({\"a\": 1}) :}", "failed to encode ini. section \"a\" is not dict");
+    check_fail("{: ini.encode({\"a\": {\"k\": [1]}}) :}", "failed to encode ini. can't encode (array)");
+    check_fail("{: ini.encode({\"a\": {\"k\": \"x\\ny\"}}) :}", "failed to encode ini. value of \"k\" in section \"a\" has newline");
+    check_fail("{: ini.load(1) :}", "can't invoke ini.load(). argument is not path or file");
+    check_fail("{: ini.load(\"/tmp/pad.test.ini.nothing\") :}", "can't invoke ini.load(). failed to open \"/tmp/pad.test.ini.nothing\"");
+    check_fail("{: ini.dump({}) :}", "can't invoke ini.dump(). need two arguments");
+
+    trv_cleanup;
+}
+
 static void
 test_trv_module_0(void) {
     trv_ready;
@@ -30698,6 +32185,417 @@ test_trv_builtin_open_0(void) {
     trv_cleanup;
 }
 
+static void
+test_trv_ring_long_chain(void) {
+    trv_ready;
+
+    // longer than fixed owners buffer
+    check_ok("{@ a = [[[[[[[[[[1]]]]]]]]]] @}{: a[0][0][0][0][0][0][0][0][0][0] :}", "1");
+    check_ok("{@ a = [[[[[[[[[[1]]]]]]]]]] \n a[0][0][0][0][0][0][0][0][0][0] = 2 @}"
+        "{: a[0][0][0][0][0][0][0][0][0][0] :}", "2");
+    check_ok("{: \"abc\".upper().lower().upper().lower().upper().lower().upper().lower().upper() :}", "ABC");
+    check_ok("{@ def f(x):\n return [x] end \n @}{: f(1)[0] :},{: f(\"ab\")[0].upper() :}", "1,AB");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_operator_kernel(void) {
+    trv_ready;
+
+    assert(PadOp_GetKernel(PAD_OP__ADD, PAD_OBJ_TYPE__INT, PAD_OBJ_TYPE__INT));
+    assert(PadOp_GetKernel(PAD_OP__EQ, PAD_OBJ_TYPE__UNICODE, PAD_OBJ_TYPE__NIL));
+    assert(!PadOp_GetKernel(PAD_OP__ADD, PAD_OBJ_TYPE__INT, PAD_OBJ_TYPE__UNICODE));
+    assert(!PadOp_GetKernel(PAD_OP__NOPS, PAD_OBJ_TYPE__INT, PAD_OBJ_TYPE__INT));
+    assert(!PadOp_Register(PAD_OP__ADD, PAD_OBJ_TYPE__IDENT, PAD_OBJ_TYPE__INT, NULL));
+
+    // operands of identifier and ring are resolved before kernel
+    check_ok("{@ a = 1 \n b = 2.5 @}{: a + b :},{: a * 3 :},{: b > a :}", "3.5,3,true");
+    check_ok("{@ a = [1, 2] @}{: a[0] + a[1] :},{: a + [3] :},{: a[1] % 2 :}", "3,(array),0");
+    check_ok("{@ s = \"ab\" @}{: s * 2 :},{: 2 * s :},{: s + \"c\" :},{: s == nil :}", "abab,abab,abc,false");
+    check_ok("{: 7 / 2 :},{: 7.0 / 2 :},{: true + 1 :},{: nil == nil :}", "3,3.5,2,true");
+    check_fail("{: 1 / 0 :}", "zero division error");
+    check_fail("{: 1 % \"a\" :}", "can't mod int with string");
+    check_fail("{: \"a\" % 1 :}", "can't mod string with int");
+
+    // no kernel for pair of types is one error after resolving operands
+    check_fail("{@ a = 1 \n b = \"x\" @}{: a + b :}", "can't add int with string");
+    check_fail("{@ a = [nil] @}{: a[0] < 1 :}", "can't lt nil with int");
+    check_fail("{@ a = {\"k\": 1} \n a[\"k\"] -= [] @}", "can't sub int with array");
+    check_fail("{: x + 1 :}", "\"x\" is not defined");
+
+    // augmented assignment uses same kernels
+    check_ok("{@ a = [1] \n a[0] += 2.5 \n s = \"ab\" \n s *= true @}{: a[0] :},{: s :}", "3.5,ab");
+    check_ok("{@ a = [1] \n a += [2] @}{: len(a) :}", "2");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_func_frame_reuse(void) {
+    trv_ready;
+
+    // frame of function is reused after return. locals must not remain
+    check_ok("{@ def fib(n):\n if n < 2: return n end \n return fib(n - 1) + fib(n - 2) end @}"
+        "{: fib(12) :},{: fib(5) :}", "144,5");
+    check_fail("{@ def f(x):\n if x: y = 1 end \n return y end @}{: f(true) :}{: f(false) :}",
+        "\"y\" is not defined");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_func_args_by_value(void) {
+    trv_ready;
+
+    // arguments of value types are not changed by callee
+    check_ok("{@ def f(s, i, self):\n s += \"d\" \n i += 1 \n self.push(s) \n return s end \n"
+        " s = \"abc\" \n i = 1 \n a = [] \n r = f(s, i, a) @}"
+        "{: s :},{: i :},{: r :},{: a[0] :},{: id(s) != id(r) :}", "abc,1,abcd,abcd,true");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_deepcopy_cow(void) {
+    trv_ready;
+
+    // copies share elements until mutation
+    check_ok("{@ a = [1, \"s\"] \n b = deepcopy(a) \n b.push(2) \n b[0] = 3 \n b[1] += \"t\" @}"
+        "{: len(a) :},{: a[0] :},{: a[1] :},{: len(b) :},{: b[0] :},{: b[1] :}", "2,1,s,3,3,st");
+    check_ok("{@ a = [1, 2] \n b = deepcopy(a) \n a.pop() @}{: len(a) :},{: len(b) :},{: b[1] :}", "1,2,2");
+    check_ok("{@ a = {\"k\": 1} \n b = deepcopy(a) \n b[\"k\"] = 2 @}{: a[\"k\"] :},{: b[\"k\"] :}", "1,2");
+    check_ok("{@ a = [[1]] \n b = deepcopy(a) \n b[0].push(2) @}{: len(a[0]) :},{: len(b[0]) :}", "1,2");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_func_tail_call(void) {
+    trv_ready;
+
+    // tail calls do not consume native stack
+    check_ok("{@ def f(n, acc):\n if n == 0: return acc end \n return f(n - 1, acc + 1) end @}"
+        "{: f(20000, 0) :}", "20000");
+    check_ok("{@ def even(n): if n == 0: return true end return odd(n - 1) end \n"
+        " def odd(n): if n == 0: return false end return even(n - 1) end @}"
+        "{: even(10001) :},{: odd(10001) :}", "false,true");
+    check_ok("{@ struct S: def m(self, n): if n == 0: return \"done\" end return self.m(self, n - 1) end end \n"
+        " s = S() @}{: s.m(s, 5000) :}", "done");
+    check_ok("{@ struct S:\n met m(self, n): if n == 0: return \"done\" end return self.m(n - 1) end end \n"
+        " s = S() @}{: s.m(5000) :}", "done");
+    check_ok("{@ def f(n, acc): if n == 0: return acc end return f(n - 1, acc + 1) end \n"
+        " def g(n): for i = 0; i < 3; i += 1: if i == 1: return f(n, 0) end end end @}"
+        "{: g(3000) :}", "3000");
+    check_ok("{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(100) :}", "100");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_func_recursion_limit(void) {
+    trv_ready;
+
+    // deep recursion raises error instead of overflow of stack
+    config->recursion_limit = 50;
+    check_fail("{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(100) :}",
+        "maximum recursion depth exceeded (50)");
+    check_ok("{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(40) :}", "40");
+    check_ok("{@ def f(n): if n == 0: return 0 end return f(n - 1) end @}{: f(100) :}", "0");
+
+    // g(n) calls n + 1 functions. the limit is reached exactly
+    check_ok("{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(49) :}", "49");
+    check_fail("{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(50) :}",
+        "maximum recursion depth exceeded (50)");
+
+    // default limit is reached before the guard of native stack
+    config->recursion_limit = 0;
+    char code[256], hope[64];
+    snprintf(code, sizeof code, "{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(%d) :}",
+        PAD_CONFIG__RECURSION_LIMIT - 1);
+    snprintf(hope, sizeof hope, "%d", PAD_CONFIG__RECURSION_LIMIT - 1);
+    check_ok(code, hope);
+    snprintf(code, sizeof code, "{@ def g(n): if n == 0: return 0 end return 1 + g(n - 1) end @}{: g(%d) :}",
+        PAD_CONFIG__RECURSION_LIMIT);
+    snprintf(hope, sizeof hope, "maximum recursion depth exceeded (%d)", PAD_CONFIG__RECURSION_LIMIT);
+    check_fail(code, hope);
+
+    trv_cleanup;
+}
+
+static void
+test_trv_string_add_ass_inplace(void) {
+    trv_ready;
+
+    // appending to uniquely referenced string does not affect other references
+    check_ok("{@ s = \"\" \n for i = 0; i < 100; i += 1: s += \"ab\" end @}{: len(s) :}", "200");
+    check_ok("{@ a = \"ab\" \n b = a \n a += \"c\" @}{: a :},{: b :}", "abc,ab");
+    check_ok("{@ a = [\"ab\"] \n s = a[0] \n s += \"c\" @}{: a[0] :},{: s :}", "ab,abc");
+    check_ok("{@ def f(x): x += \"z\" return x end \n a = \"a\" \n r = f(a) @}{: a :},{: r :}", "a,az");
+    check_ok("{@ s = \"ab\" \n s += s @}{: s :}", "abab");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_output_sink(void) {
+    trv_ready;
+
+    // outputs of ref block, text block and puts are written to sink
+    PadSink *sink = PadSink_NewStr();
+    PadCtx_SetStdoutSink(ctx, sink);
+    PadTkr_Parse(tkr, "a{: 1 :}{@ puts(\"b\") @}c{@ for i = 0; i < 3; i += 1: @}{: i :}{@ end @}");
+    PadAST_Clear(ast);
+    PadCC_Compile(ast, PadTkr_GetToks(tkr));
+    PadCtx_Clear(ctx);
+    PadTrv_Trav(ast, ctx);
+    assert(!PadAST_HasErrs(ast));
+    PadCtx_FlushSinks(ctx);
+    assert(!strcmp(PadSink_GetcStr(sink), "a1b\nc012"));
+    assert(!strcmp(PadCtx_GetcStdoutBuf(ctx), ""));
+    PadSink_Del(sink);
+
+    // long text blocks are referenced by sink until flush
+    FILE *fp = tmpfile();
+    assert(fp);
+    sink = PadSink_NewFd(fileno(fp));
+    PadCtx_SetStdoutSink(ctx, sink);
+    char src[PAD_SINK__STATIC_MIN + 100] = "{@ for i = 0; i < 100; i += 1: @}";
+    int32_t srclen = strlen(src);
+    memset(src + srclen, 't', PAD_SINK__STATIC_MIN);
+    strcpy(src + srclen + PAD_SINK__STATIC_MIN, "{: i % 10 :}{@ end @}");
+    PadTkr_Parse(tkr, src);
+    PadAST_Clear(ast);
+    PadCC_Compile(ast, PadTkr_GetToks(tkr));
+    PadCtx_Clear(ctx);
+    PadTrv_Trav(ast, ctx);
+    assert(!PadAST_HasErrs(ast));
+    PadCtx_FlushSinks(ctx);
+    PadSink_Del(sink);
+    rewind(fp);
+    char out[(PAD_SINK__STATIC_MIN + 1) * 100 + 1];
+    assert(fread(out, 1, sizeof out, fp) == sizeof(out) - 1);
+    for (int32_t i = 0; i < 100; i++) {
+        const char *p = out + (PAD_SINK__STATIC_MIN + 1) * i;
+        assert(p[0] == 't' && p[PAD_SINK__STATIC_MIN - 1] == 't');
+        assert(p[PAD_SINK__STATIC_MIN] == '0' + i % 10);
+    }
+    fclose(fp);
+
+    // unset sink
+    PadCtx_SetStdoutSink(ctx, NULL);
+    check_ok("{: 1 :}", "1");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_range(void) {
+    trv_ready;
+
+    check_ok("{: len(range(5)) :},{: len(range(2, 10, 3)) :},{: len(range(5, 0, -2)) :},{: len(range(3, 3)) :}", "5,3,3,0");
+    check_ok("{@ r = range(2, 10, 3) @}{: r[0] :},{: r[2] :}", "2,8");
+    check_ok("{@ for i in range(3): @}{: i :}{@ end @}", "012");
+    check_ok("{@ for i in range(5, 0, -2): @}{: i :}{@ end @}", "531");
+    check_ok("{@ for i, n in range(10, 12): @}{: i :}:{: n :} {@ end @}", "0:10 1:11 ");
+    check_ok("{@ for i in range(0): puts(i) end @}", "");
+    check_ok("{@ a = [] \n for i in range(3): a.push(i) end @}{: a.join(\",\") :}", "0,1,2");
+    check_ok("{@ x = nil \n for i in range(3): x = i end @}{: x :},{: i :}", "2,2");
+    check_ok("{@ for i in range(3): if i == 1: break end end @}{: i :}", "1");
+    check_ok("{: range(2) :}", "(range)");
+
+    check_fail("{: range() :}", "range function need one to three arguments");
+    check_fail("{: range(\"a\") :}", "range argument is not integer");
+    check_fail("{: range(0, 3, 0) :}", "range step is zero");
+    check_fail("{: range(3)[3] :}", "index out of range");
+
+    // length over integer is error and values are calculated without overflow
+    check_fail("{: range(-9223372036854775807 - 1, 9223372036854775807) :}", "range is too long");
+    check_fail("{: range(9223372036854775807, -9223372036854775807 - 1, -2) :}", "range is too long");
+    check_ok("{@ r = range(-9223372036854775807 - 1, 9223372036854775807, 3) @}"
+             "{: len(r) :},{: r[len(r) - 1] :}", "6148914691236517205,9223372036854775804");
+    check_ok("{@ for i in range(9223372036854775806, 9223372036854775807): @}{: i :}{@ end @}",
+             "9223372036854775806");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_deque(void) {
+    trv_ready;
+
+    check_ok("{@ q = Deque() @}{: len(q) :}", "0");
+    check_ok("{@ q = Deque([1, 2]) \n q.push(3).push_front(0) @}{: len(q) :},{: q[0] :},{: q[3] :}", "4,0,3");
+    check_ok("{@ q = Deque([1, 2, 3]) @}{: q.front() :},{: q.back() :}", "1,3");
+    check_ok("{@ q = Deque([1, 2, 3]) @}{: q.pop() :},{: q.pop_front() :},{: len(q) :}", "3,1,1");
+    check_ok("{@ q = Deque() @}{: q.pop() :},{: q.pop_front() :},{: q.front() :}", "nil,nil,nil");
+    check_ok("{@ q = Deque([1, 2]) \n q.clear() @}{: len(q) :}", "0");
+    check_ok("{@ q = Deque() \n for i in range(20): q.push_front(i) end @}{: q[0] :},{: q[19] :}", "19,0");
+    check_ok("{@ for i, v in Deque([\"a\", \"b\"]): @}{: i :}{: v :}{@ end @}", "0a1b");
+    check_ok("{@ q = Deque([1]) \n if q: puts(\"t\") end @}", "t\n");
+    check_ok("{@ a = 1 \n q = Deque() \n q.push(a) \n a += 1 @}{: q[0] :}", "1");
+    check_ok("{@ struct S:\n items = Deque()\n end\n s = S() \n s.items.push(1) @}{: len(s.items) :}", "1");
+    check_ok("{: Deque() :}", "(deque)");
+
+    check_fail("{: Deque(1) :}", "invalid argument type. expected array but given other");
+    check_fail("{: Deque()[0] :}", "index out of range");
+    check_fail("{@ q = Deque([1, 2]) \n for v in q: q.push(v) end @}", "deque changed size during iteration");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_numarray(void) {
+    trv_ready;
+
+    check_ok("{@ a = NumArray([1, 2, 3]) @}{: len(a) :},{: a[0] :},{: a[2] :}", "3,1,3");
+    check_ok("{@ a = NumArray([1, 2.5]) @}{: a[0] :},{: a[1] :}", "1.0,2.5");
+    check_ok("{@ a = NumArray([1, 2], \"float\") @}{: a[1] :}", "2.0");
+    check_ok("{@ a = NumArray([1.9, 2], \"int\") @}{: a[0] :}", "1");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) @}{: len(m) :},{: m[1][0] :}", "2,3");
+    check_ok("{@ a = NumArray([1, 2]) \n a[1] = 5 \n i = 0 \n v = 7 \n a[i] = v @}{: a[0] :},{: a[1] :}", "7,5");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n m[1][1] = 9 @}{: m[1][1] :}", "9");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n r = m[0] \n r[0] = 9 @}{: m[0][0] :}", "9");
+    check_ok("{@ for i, v in NumArray([4, 5]): @}{: i :}{: v :}{@ end @}", "0415");
+    check_ok("{@ for r in NumArray([[1, 2], [3, 4]]): @}{: r.sum() :},{@ end @}", "3,7,");
+
+    // operators with numeric arrays and scalars at both sides
+    check_ok("{@ a = NumArray([1, 2, 3]) \n b = a + a * 2 @}{: b[2] :}", "9");
+    check_ok("{@ a = NumArray([1, 2, 3]) \n b = 10 - a @}{: b[0] :},{: b[2] :}", "9,7");
+    check_ok("{@ a = NumArray([2, 4]) \n b = a / 2.0 @}{: b[1] :}", "2.0");
+    check_ok("{@ a = NumArray([2, 4]) \n n = 2 \n b = n * a - a / n @}{: b[1] :}", "6");
+    check_ok("{@ a = [NumArray([1, 2])] \n b = a[0] + a[0] @}{: b[1] :}", "4");
+    check_ok("{@ a = NumArray([1.5]) \n b = a - NumArray([1]) @}{: b[0] :}", "0.5");
+
+    // methods
+    check_ok("{@ a = NumArray([3, -1, 2]) @}{: a.sum() :},{: a.min() :},{: a.max() :}", "4,-1,3");
+    check_ok("{@ a = NumArray([]) @}{: a.min() :},{: a.max() :},{: a.sum() :}", "nil,nil,0");
+    check_ok("{@ a = NumArray([1, 2, 3]) @}{: a.dot(a) :}", "14");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n c = m.dot(m) @}{: c[1][0] :},{: c[1][1] :}", "15,22");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n c = m.dot(NumArray([1, 1])) @}{: c[0] :},{: c[1] :}", "3,7");
+    check_ok("{@ m = NumArray([[1, 2, 3]]) \n t = m.transpose() @}{: len(t) :},{: t[2][0] :}", "3,3");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n r = m.rotate() @}{: r[0][0] :},{: r[0][1] :}", "3,1");
+    check_ok("{@ m = NumArray([[1, 2], [3, 4]]) \n r = m.rotate(-1) @}{: r[0][0] :},{: r[0][1] :}", "2,4");
+    check_ok("{@ m = NumArray([[1, 2, 3], [4, 5, 6]]) @}{: m.shape() :}", "(array)");
+    check_ok("{@ s = NumArray([[1, 2, 3], [4, 5, 6]]).shape() @}{: s[0] :},{: s[1] :}", "2,3");
+    check_ok("{@ a = NumArray([[1, 2], [3, 4]]).to_array() @}{: a[1][0] :},{: len(a) :}", "3,2");
+    check_ok("{@ def f(a):\n return a * 2\n end \n b = f(NumArray([1])) @}{: b[0] :}", "2");
+    check_ok("{: NumArray([1]) :}", "(numarray)");
+
+    check_fail("{: NumArray() :}", "NumArray need one or two arguments");
+    check_fail("{: NumArray(1) :}", "invalid argument type. expected array but given other");
+    check_fail("{: NumArray([1, \"a\"]) :}", "invalid element of numeric array");
+    check_fail("{: NumArray([[1], [1, 2]]) :}", "rows of numeric array are not same length");
+    check_fail("{: NumArray([1], \"x\") :}", "invalid kind of numeric array \"x\"");
+    check_fail("{: NumArray([1])[1] :}", "index out of range");
+    check_fail("{@ a = NumArray([1]) \n a[1] = 1 @}", "index out of range");
+    check_fail("{@ a = NumArray([1]) \n a[0] = \"s\" @}", "can't assign (5) to numeric array");
+    check_fail("{@ m = NumArray([[1]]) \n m[0] = 1 @}", "can't assign to row of numeric array");
+    check_fail("{@ a = NumArray([1]) + NumArray([1, 2]) @}", "can't calculate numeric arrays of different shapes");
+    check_fail("{@ a = NumArray([1]) / 0 @}", "zero division error");
+    check_fail("{@ a = NumArray([1]) + \"s\" @}", "can't add numarray with string");
+    check_fail("{@ a = NumArray([1]).rotate() @}", "can't rotate 1-D numeric array");
+    check_fail("{@ a = NumArray([[1, 2]]).dot(NumArray([1])) @}", "can't invoke numarray.dot. shapes are not aligned");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_builtin_dump(void) {
+    trv_ready;
+
+#undef check_dump
+#define check_dump(code, hope) \
+    check_ok(code, ""); \
+    assert(!strcmp(PadCtx_GetcStderrBuf(ctx), hope));
+
+    check_dump("{@ dump(nil) @}", "nil\n");
+    check_dump("{@ dump(1) \n dump(-2.5) \n dump(true) @}", "1\n-2.5\ntrue\n");
+    check_dump("{@ dump(\"a\\\"b\\\\c\\n\") @}", "\"a\\\"b\\\\c\\n\"\n");
+    check_dump("{@ a = [1, \"x\", [2.5, nil], {\"k\": true}] \n dump(a) @}",
+        "[1, \"x\", [2.5, nil], {\"k\": true}]\n");
+    check_dump("{@ dump([]) \n dump({}) @}", "[]\n{}\n");
+    check_dump("{@ dump(range(1, -5, -2)) @}", "range(1, -5, -2)\n");
+    check_dump("{@ dump(Deque([1, \"a\"])) @}", "Deque([1, \"a\"])\n");
+    check_dump("{@ dump(NumArray([[1, 2], [3, 4]])) \n dump(NumArray([0.5])) @}",
+        "NumArray([[1, 2], [3, 4]])\nNumArray([0.5], \"float\")\n");
+    check_dump("{@ d = {\"a\": 1} \n dump(d.keys()) \n dump(d.values()) \n dump(d.items()) @}",
+        "dict_keys([\"a\"])\ndict_values([1])\ndict_items([[\"a\", 1]])\n");
+    check_dump("{@ struct P:\n x = 1\n y = \"a\"\n end\n p = P()\n dump([p]) @}",
+        "[P{x: 1, y: \"a\"}]\n");
+
+    // recursive containers
+    check_dump("{@ a = [1, 2] \n d = {\"a\": a} \n a[1] = d \n dump(a) @}", "[1, {\"a\": [...]}]\n");
+    check_dump("{@ d = {\"k\": 1} \n d[\"s\"] = d \n dump(d) @}", "{\"k\": 1, \"s\": {...}}\n");
+
+    // serialize to sink
+    PadSink *sink = PadSink_NewStr();
+    PadCtx_SetStderrSink(ctx, sink);
+    check_ok("{@ dump([1, {\"a\": \"b\"}]) @}", "");
+    PadCtx_FlushSinks(ctx);
+    assert(!strcmp(PadSink_GetcStr(sink), "[1, {\"a\": \"b\"}]\n"));
+    PadCtx_SetStderrSink(ctx, NULL);
+    PadSink_Del(sink);
+
+    // reuse buffer
+    PadStr *str = PadStr_New();
+    PadObj *obj = PadObj_NewInt(gc, 12);
+    assert(PadSer_ObjToStr(str, obj));
+    assert(PadSer_ObjToStr(str, obj));
+    assert(!strcmp(PadStr_Getc(str), "1212"));
+    PadObj_Del(obj);
+    PadStr_Del(str);
+
+    check_fail("{@ dump() @}", "need one argument");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_escape_html(void) {
+    trv_ready;
+
+    check_ok("{: escape_html(\"<b>\\\"a&b\\\" 'c'</b>\") :}", "&lt;b&gt;&quot;a&amp;b&quot; &#39;c&#39;&lt;/b&gt;");
+    check_ok("{: escape_html(\"abc\") :}", "abc");
+    check_ok("{: escape_html(\"\") :}", "");
+    check_fail("{: escape_html(1) :}", "invalid argument type");
+    check_fail("{: escape_html() :}", "need one argument");
+
+    // auto escape mode escapes outputs of ref block only
+    PadCtx_SetAutoEscape(ctx, true);
+    check_ok("<p>{: \"<&>\" :}</p>", "<p>&lt;&amp;&gt;</p>");
+    check_ok("{@ s = \"'\" @}{: s :},{: 1 :},{: [1] :}", "&#39;,1,(array)");
+    check_ok("{@ b = builder(\"<\") @}{: b :}", "&lt;");
+    check_ok("{@ puts(\"<\") @}", "<\n");
+    PadSink *sink = PadSink_NewStr();
+    PadCtx_SetStdoutSink(ctx, sink);
+    check_ok("<{: \"<a>\" :}>", "");
+    PadCtx_FlushSinks(ctx);
+    assert(!strcmp(PadSink_GetcStr(sink), "<&lt;a&gt;>"));
+    PadCtx_SetStdoutSink(ctx, NULL);
+    PadSink_Del(sink);
+    PadCtx_SetAutoEscape(ctx, false);
+    check_ok("{: \"<&>\" :}", "<&>");
+
+    trv_cleanup;
+}
+
+static void
+test_trv_string_builder(void) {
+    trv_ready;
+
+    check_ok("{@ b = builder(\"x\") \n b.append(\"a\", \"b\") @}{: b.build() :},{: len(b) :}", "xab,3");
+    check_ok("{@ b = builder() \n b.join([\"1\", \"2\", \"3\"], \", \") @}{: b :}", "1, 2, 3");
+    check_ok("{@ b = builder() \n b.join([\"p\", \"q\"]) @}{: b.build() :}", "pq");
+    check_ok("{@ b = builder(\"a\") \n s = b.build() \n b.append(\"b\") @}{: s :},{: b.build() :},{: b.len() :}", "a,ab,2");
+    check_ok("{@ b = builder(\"a\") \n c = builder(\"b\") \n b.append(c) @}{: b :}", "ab");
+    check_ok("{@ def mk(n): b = builder() \n for i = 0; i < n; i += 1: b.append(\"xy\") end \n return b end \n"
+        " b = mk(100) @}{: len(b.build()) :}", "200");
+    check_fail("{@ b = builder() \n b.append(1) @}", "invalid argument type (1)");
+
+    trv_cleanup;
+}
+
 static const struct testcase
 traverser_2_tests[] = {
     {"if_stmt_0", test_trv_if_stmt_0},
@@ -30742,6 +32640,7 @@ traverser_2_tests[] = {
     {"for_stmt_10", test_trv_for_stmt_10},
     {"for_stmt_11", test_trv_for_stmt_11},
     {"for_stmt_12", test_trv_for_stmt_12},
+    {"for_in_stmt_0", test_trv_for_in_stmt_0},
     {"break_stmt_0", test_trv_break_stmt_0},
     {"break_stmt_1", test_trv_break_stmt_1},
     {"break_stmt_2", test_trv_break_stmt_2},
@@ -30903,9 +32802,34 @@ traverser_2_tests[] = {
     {"builtin_unicode_isdigit", test_trv_builtin_unicode_isdigit},
     {"builtin_unicode_isalpha", test_trv_builtin_unicode_isalpha},
     {"builtin_unicode_isspace", test_trv_builtin_unicode_isspace},
+    {"builtin_unicode_find", test_trv_builtin_unicode_find},
+    {"builtin_unicode_count", test_trv_builtin_unicode_count},
+    {"builtin_unicode_replace", test_trv_builtin_unicode_replace},
+    {"builtin_unicode_startswith", test_trv_builtin_unicode_startswith},
     {"builtin_array_0", test_trv_builtin_array_0},
+    {"builtin_array_sort", test_trv_builtin_array_sort},
+    {"builtin_array_1", test_trv_builtin_array_1},
     {"builtin_dict_0", test_trv_builtin_dict_0},
+    {"builtin_dict_view", test_trv_builtin_dict_view},
+    {"builtin_json", test_trv_builtin_json},
+    {"builtin_re", test_trv_builtin_re},
+    {"builtin_ini", test_trv_builtin_ini},
     {"builtin_open_0", test_trv_builtin_open_0},
+    {"ring_long_chain", test_trv_ring_long_chain},
+    {"operator_kernel", test_trv_operator_kernel},
+    {"func_frame_reuse", test_trv_func_frame_reuse},
+    {"func_args_by_value", test_trv_func_args_by_value},
+    {"deepcopy_cow", test_trv_deepcopy_cow},
+    {"func_tail_call", test_trv_func_tail_call},
+    {"func_recursion_limit", test_trv_func_recursion_limit},
+    {"string_add_ass_inplace", test_trv_string_add_ass_inplace},
+    {"string_builder", test_trv_string_builder},
+    {"output_sink", test_trv_output_sink},
+    {"builtin_range", test_trv_builtin_range},
+    {"builtin_deque", test_trv_builtin_deque},
+    {"builtin_numarray", test_trv_builtin_numarray},
+    {"builtin_dump", test_trv_builtin_dump},
+    {"escape_html", test_trv_escape_html},
     {0},
 };
 
@@ -31359,11 +33283,549 @@ test_lang_PadObjDict_Pop(void) {
     PadGC_Del(gc);
 }
 
+static void
+test_lang_PadObjDict_DeepCopy(void) {
+    PadGC *gc = PadGC_New();
+    PadObjDict *d = PadObjDict_New(gc);
+    PadObjDict_Move(d, "a", PadObj_NewInt(gc, 1));
+    PadObjDict_Move(d, "b", PadObj_NewInt(gc, 2));
+
+    // map is shared until mutation
+    PadObjDict *c = PadObjDict_DeepCopy(d);
+    assert(c);
+    assert(PadObjDict_Getc(c, "a")->value == PadObjDict_Getc(d, "a")->value);
+
+    PadObjDict_Move(c, "a", PadObj_NewInt(gc, 3));
+    assert(PadObjDict_Getc(c, "a")->value->lvalue == 3);
+    assert(PadObjDict_Getc(d, "a")->value->lvalue == 1);
+    assert(PadObjDict_Getc(c, "b")->value == PadObjDict_Getc(d, "b")->value);
+
+    PadObjDict *c2 = PadObjDict_DeepCopy(d);
+    PadObjDict_Del(d);
+    assert(PadObjDict_Len(c2) == 2);
+    assert(PadObjDict_Getc(c2, "b")->value->lvalue == 2);
+    PadObj_Del(PadObjDict_Pop(c2, "b"));
+    assert(PadObjDict_Len(c2) == 1);
+
+    PadObjDict_Del(c2);
+    PadObjDict_Del(c);
+    PadGC_Del(gc);
+}
+
 static const struct testcase
 objdict_tests[] = {
     {"move", test_lang_PadObjDict_Move},
     {"set", test_lang_PadObjDict_Set},
     {"pop", test_lang_PadObjDict_Pop},
+    {"deep_copy", test_lang_PadObjDict_DeepCopy},
+    {0},
+};
+
+/************
+* objdeque *
+************/
+
+static void
+test_lang_PadObjDeq_Push(void) {
+    PadGC *gc = PadGC_New();
+    PadObjDeq *q = PadObjDeq_New();
+    assert(q);
+    assert(PadObjDeq_Len(q) == 0);
+    assert(PadObjDeq_Get(q, 0) == NULL);
+
+    // wrap around and grow
+    for (int32_t i = 0; i < 20; ++i) {
+        PadObj *obj = PadObj_NewInt(gc, i);
+        if (i % 2) {
+            assert(PadObjDeq_PushBack(q, obj));
+        } else {
+            assert(PadObjDeq_PushFront(q, obj));
+        }
+        assert(obj->gc_item.ref_counts == 1);
+    }
+    assert(PadObjDeq_Len(q) == 20);
+
+    // 18 16 .. 2 0 1 3 .. 19
+    for (int32_t i = 0; i < 10; ++i) {
+        assert(PadObjDeq_Get(q, i)->lvalue == 18 - i * 2);
+        assert(PadObjDeq_Get(q, 10 + i)->lvalue == i * 2 + 1);
+    }
+    assert(PadObjDeq_Get(q, 20) == NULL);
+    assert(PadObjDeq_Get(q, -1) == NULL);
+
+    PadObjDeq_Del(q);
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_PadObjDeq_Pop(void) {
+    PadGC *gc = PadGC_New();
+    PadObjDeq *q = PadObjDeq_New();
+
+    assert(PadObjDeq_PopBack(q) == NULL);
+    assert(PadObjDeq_PopFront(q) == NULL);
+
+    for (int32_t i = 0; i < 10; ++i) {
+        PadObjDeq_PushBack(q, PadObj_NewInt(gc, i));
+    }
+
+    PadObj *obj = PadObjDeq_PopFront(q);
+    assert(obj->lvalue == 0);
+    PadObj_DecRef(obj);
+    PadObj_Del(obj);
+
+    obj = PadObjDeq_PopBack(q);
+    assert(obj->lvalue == 9);
+    PadObj_DecRef(obj);
+    PadObj_Del(obj);
+
+    assert(PadObjDeq_Len(q) == 8);
+    assert(PadObjDeq_Get(q, 0)->lvalue == 1);
+    assert(PadObjDeq_Get(q, 7)->lvalue == 8);
+
+    PadObjDeq_Clear(q);
+    assert(PadObjDeq_Len(q) == 0);
+    assert(PadObjDeq_PushFront(q, PadObj_NewInt(gc, 1)));
+    assert(PadObjDeq_Get(q, 0)->lvalue == 1);
+
+    PadObjDeq_Del(q);
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_PadObjDeq_DeepCopy(void) {
+    PadGC *gc = PadGC_New();
+    PadObjDeq *q = PadObjDeq_New();
+
+    for (int32_t i = 0; i < 5; ++i) {
+        PadObjDeq_PushFront(q, PadObj_NewInt(gc, i));
+    }
+
+    PadObjDeq *c = PadObjDeq_DeepCopy(q);
+    assert(c);
+    assert(PadObjDeq_Len(c) == 5);
+    for (int32_t i = 0; i < 5; ++i) {
+        assert(PadObjDeq_Get(c, i) != PadObjDeq_Get(q, i));
+        assert(PadObjDeq_Get(c, i)->lvalue == 4 - i);
+    }
+
+    PadObjDeq_Del(q);
+    assert(PadObjDeq_Get(c, 4)->lvalue == 0);
+
+    PadObjDeq_Del(c);
+    PadGC_Del(gc);
+}
+
+static const struct testcase
+objdeque_tests[] = {
+    {"push", test_lang_PadObjDeq_Push},
+    {"pop", test_lang_PadObjDeq_Pop},
+    {"deep_copy", test_lang_PadObjDeq_DeepCopy},
+    {0},
+};
+
+/************
+* lang/json *
+************/
+
+/**
+ * decode JSON text and encode it again
+ */
+static const char *
+json_round_trip(PadStr *dst, PadGC *gc, const char *src, int32_t indent) {
+    char err[256];
+    PadObj *obj = PadJson_Decode(gc, src, strlen(src), err, sizeof err);
+    if (!obj) {
+        return NULL;
+    }
+    PadStr_Clear(dst);
+    const char *ret = PadJson_EncodeToStr(dst, obj, indent, err, sizeof err) ? PadStr_Getc(dst) : NULL;
+    PadObj_Del(obj);
+    return ret;
+}
+
+static void
+test_lang_json_decode(void) {
+    PadGC *gc = PadGC_New();
+    PadStr *s = PadStr_New();
+    char err[256];
+
+    const char *src = "{\"a\": [1, -2, 2.5e1, true, false, null], \"b\": {}}";
+    PadObj *obj = PadJson_Decode(gc, src, strlen(src), err, sizeof err);
+    assert(obj);
+    assert(obj->type == PAD_OBJ_TYPE__DICT);
+    assert(PadObjDict_Len(obj->objdict) == 2);
+    PadObj *a = PadObjDict_Get(obj->objdict, "a")->value;
+    assert(a->type == PAD_OBJ_TYPE__ARRAY);
+    assert(PadObjAry_Len(a->objarr) == 6);
+    assert(PadObjAry_Get(a->objarr, 0)->lvalue == 1);
+    assert(PadObjAry_Get(a->objarr, 1)->lvalue == -2);
+    assert(PadObjAry_Get(a->objarr, 2)->type == PAD_OBJ_TYPE__FLOAT);
+    assert(PadObjAry_Get(a->objarr, 2)->float_value == 25.0);
+    assert(PadObjAry_Get(a->objarr, 3)->boolean);
+    assert(!PadObjAry_Get(a->objarr, 4)->boolean);
+    assert(PadObjAry_Get(a->objarr, 5)->type == PAD_OBJ_TYPE__NIL);
+    assert(PadObjDict_Get(obj->objdict, "b")->value->type == PAD_OBJ_TYPE__DICT);
+    PadObj_Del(obj);
+
+    // strings
+    assert(!strcmp(json_round_trip(s, gc, "\"x\\\"\\\\\\/\\b\\f\\n\\r\\t\"", 0), "\"x\\\"\\\\/\\b\\f\\n\\r\\t\""));
+    assert(!strcmp(json_round_trip(s, gc, "\"\\u3042\\ud83d\\ude00\\u0001\"", 0), "\"あ😀\\u0001\""));
+    assert(!strcmp(json_round_trip(s, gc, "\"あいう\"", 0), "\"あいう\""));
+    assert(!strcmp(json_round_trip(s, gc, "\xef\xbb\xbf \"bom\" ", 0), "\"bom\""));
+
+    // numbers. integers out of range are floats
+    assert(!strcmp(json_round_trip(s, gc, "[0, -0, 9223372036854775807, -9223372036854775808]", 0),
+        "[0,0,9223372036854775807,-9223372036854775808]"));
+    assert(!strcmp(json_round_trip(s, gc, "[9223372036854775808, 1.5E+3, -0.25e-2]", 0),
+        "[9223372036854776000.0,1500.0,-0.0025]"));
+
+    // duplicated keys are over written
+    assert(!strcmp(json_round_trip(s, gc, "{\"k\": 1, \"k\": 2}", 0), "{\"k\":2}"));
+
+    PadStr_Del(s);
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_json_decode_fail(void) {
+    static const struct {
+        const char *src;
+        const char *err;
+    } cases[] = {
+        {"", "unexpected end of text at line 1 column 1"},
+        {"[1, 2,]", "unexpected character ']' at line 1 column 7"},
+        {"[1] x", "extra data at line 1 column 5"},
+        {"[1 2]", "expected ',' or ']' at line 1 column 4"},
+        {"{\"a\" 1}", "expected ':' at line 1 column 6"},
+        {"{\"a\": 1,}", "expected string of key at line 1 column 9"},
+        {"{\"a\": 1 \"b\": 2}", "expected ',' or '}' at line 1 column 9"},
+        {"\"abc", "unterminated string at line 1 column 5"},
+        {"\"a\nb\"", "control character in string at line 1 column 3"},
+        {"\"\\x\"", "invalid escape '\\x' at line 1 column 3"},
+        {"\"\\u12g4\"", "invalid \\u escape at line 1 column 7"},
+        {"\"\\ud800\"", "invalid surrogate pair at line 1 column 8"},
+        {"\"\\udc00\"", "invalid surrogate pair at line 1 column 8"},
+        {"\"\\u0000\"", "\\u0000 is not supported at line 1 column 8"},
+        {"01", "extra data at line 1 column 2"},
+        {"-", "invalid number at line 1 column 2"},
+        {"1.", "invalid number at line 1 column 3"},
+        {"1e+", "invalid number at line 1 column 4"},
+        {"tru", "unexpected character 't' at line 1 column 1"},
+        {"nil", "unexpected character 'n' at line 1 column 1"},
+        {"[\n1,\n?]", "unexpected character '?' at line 3 column 1"},
+        {0},
+    };
+
+    PadGC *gc = PadGC_New();
+    char err[256];
+    for (int32_t i = 0; cases[i].src; i++) {
+        const char *src = cases[i].src;
+        assert(!PadJson_Decode(gc, src, strlen(src), err, sizeof err));
+        assert(!strcmp(err, cases[i].err));
+    }
+
+    // too deep
+    enum { N = PAD_JSON__MAX_DEPTH + 1 };
+    char deep[N * 2 + 1];
+    memset(deep, '[', N);
+    memset(deep + N, ']', N);
+    deep[N * 2] = '\0';
+    assert(!PadJson_Decode(gc, deep, N * 2, err, sizeof err));
+    assert(!strncmp(err, "too deep nesting", 16));
+    PadObj *obj = PadJson_Decode(gc, deep + 1, N * 2 - 2, err, sizeof err);
+    assert(obj && obj->type == PAD_OBJ_TYPE__ARRAY);
+    PadObj_Del(obj);
+
+    // key over size of key of dict
+    PadStr *s = PadStr_New();
+    PadStr_App(s, "{\"");
+    for (int32_t i = 0; i < PAD_OBJ_DICT__ITEM_KEY_SIZE; i++) {
+        PadStr_PushBack(s, 'k');
+    }
+    PadStr_App(s, "\": 1}");
+    assert(!PadJson_Decode(gc, PadStr_Getc(s), PadStr_Len(s), err, sizeof err));
+    assert(!strncmp(err, "key is too long", 15));
+    PadStr_Del(s);
+
+    assert(!PadJson_Decode(NULL, "1", 1, err, sizeof err));
+    assert(!PadJson_Decode(gc, NULL, 0, err, sizeof err));
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_json_encode(void) {
+    PadGC *gc = PadGC_New();
+    PadStr *s = PadStr_New();
+    char err[256];
+
+    const char *src = "{\"a\": [1, {\"b\": null}, []], \"c\": {}, \"d\": \"x\"}";
+    assert(!strcmp(json_round_trip(s, gc, src, 0), "{\"a\":[1,{\"b\":null},[]],\"c\":{},\"d\":\"x\"}"));
+    assert(!strcmp(json_round_trip(s, gc, src, 2),
+        "{\n"
+        "  \"a\": [\n"
+        "    1,\n"
+        "    {\n"
+        "      \"b\": null\n"
+        "    },\n"
+        "    []\n"
+        "  ],\n"
+        "  \"c\": {},\n"
+        "  \"d\": \"x\"\n"
+        "}"));
+
+    // control characters and non ASCII characters
+    PadObj *obj = PadObj_NewUnicodeCStr(gc, "\x01\x1f\x7fあ\"");
+    PadStr_Clear(s);
+    assert(PadJson_EncodeToStr(s, obj, 0, err, sizeof err));
+    assert(!strcmp(PadStr_Getc(s), "\"\\u0001\\u001f\x7fあ\\\"\""));
+    PadObj_Del(obj);
+
+    // recursive array
+    PadObj *arr = PadObj_NewAry(gc, PadObjAry_New());
+    PadObjAry_PushBack(arr->objarr, arr);
+    PadStr_Clear(s);
+    assert(!PadJson_EncodeToStr(s, arr, 0, err, sizeof err));
+    assert(!strcmp(err, "circular reference"));
+    PadObjAry_PopBack(arr->objarr);
+    PadObj_DecRef(arr);
+    PadObj_Del(arr);
+
+    // float of not finite
+    obj = PadObj_NewFloat(gc, INFINITY);
+    assert(!PadJson_EncodeToStr(s, obj, 0, err, sizeof err));
+    assert(!strcmp(err, "can't encode inf"));
+    PadObj_Del(obj);
+
+    // sink
+    PadSink *sink = PadSink_NewStr();
+    obj = PadJson_Decode(gc, "[1, \"a\"]", 8, err, sizeof err);
+    assert(PadJson_EncodeToSink(sink, obj, 1, err, sizeof err));
+    PadSink_Flush(sink);
+    assert(!strcmp(PadSink_GetcStr(sink), "[\n 1,\n \"a\"\n]"));
+    PadObj_Del(obj);
+    PadSink_Del(sink);
+
+    PadStr_Del(s);
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_json_span(void) {
+    enum { N = 80 };
+    char src[N];
+    static const char specials[] = {'"', '\\', '\n', '\x01', '\x1f'};
+
+    for (PadUniKernelLevel level = PAD_UNI_KERNEL__SCALAR;
+         level <= PadUniKernel_GetMaxLevel(); level++) {
+        PadUniKernel_SetLevel(level);
+        for (int32_t pos = 0; pos < N; pos++) {
+            for (int32_t i = 0; i < (int32_t) sizeof specials; i++) {
+                // bytes of non ASCII and DEL are not special
+                for (int32_t j = 0; j < N; j++) {
+                    src[j] = j % 3 == 0 ? '\xe3' : j % 3 == 1 ? '\x7f' : ' ';
+                }
+                src[pos] = specials[i];
+                assert(PadUniKernel_SpanJsonSafe(src, N) == pos);
+                assert(PadUniKernel_SpanJsonSafe(src, pos) == pos);
+            }
+        }
+    }
+    PadUniKernel_SetLevel(PadUniKernel_GetMaxLevel());
+}
+
+static const struct testcase
+json_tests[] = {
+    {"decode", test_lang_json_decode},
+    {"decode_fail", test_lang_json_decode_fail},
+    {"encode", test_lang_json_encode},
+    {"span", test_lang_json_span},
+    {0},
+};
+
+/***********
+* lang/ini *
+***********/
+
+/**
+ * get value of name in section of decoded dict
+ */
+static const char *
+ini_get(PadObj *obj, const char *section, const char *name) {
+    PadObjDictItem *sec = PadObjDict_Get(obj->objdict, section);
+    if (!sec || sec->value->type != PAD_OBJ_TYPE__DICT) {
+        return NULL;
+    }
+    PadObjDictItem *item = PadObjDict_Get(sec->value->objdict, name);
+    if (!item || item->value->type != PAD_OBJ_TYPE__UNICODE) {
+        return NULL;
+    }
+    return PadUni_GetcMB(item->value->unicode);
+}
+
+static void
+test_lang_ini_decode(void) {
+    PadGC *gc = PadGC_New();
+    char err[256];
+
+    const char *src =
+        "\xef\xbb\xbf; comment\r\n"
+        "[s1]\r\n"
+        "n1 = v1\r\n"
+        " n2=v2 \r\n"
+        "\r\n"
+        "[ s-2 ] # comment\n"
+        "\tn3 =\tv 3\n"
+        "n4 = a=b;c\n"
+        "n5 =\n"
+        "# n6 = v6\n"
+        "[s1]\n"
+        "n1 = over\n"
+        "ｎ７ = あい";
+    PadObj *obj = PadIni_Decode(gc, src, strlen(src), 0, err, sizeof err);
+    assert(obj);
+    assert(obj->type == PAD_OBJ_TYPE__DICT);
+    assert(PadObjDict_Len(obj->objdict) == 2);
+    assert(!strcmp(PadObjDict_GetcIndex(obj->objdict, 0)->key, "s1"));
+    assert(!strcmp(PadObjDict_GetcIndex(obj->objdict, 1)->key, "s-2"));
+    assert(!strcmp(ini_get(obj, "s1", "n1"), "over"));
+    assert(!strcmp(ini_get(obj, "s1", "n2"), "v2"));
+    assert(!strcmp(ini_get(obj, "s1", "ｎ７"), "あい"));
+    assert(!strcmp(ini_get(obj, "s-2", "n3"), "v 3"));
+    assert(!strcmp(ini_get(obj, "s-2", "n4"), "a=b;c"));
+    assert(!strcmp(ini_get(obj, "s-2", "n5"), ""));
+    assert(!ini_get(obj, "s-2", "n6"));
+    PadObj_Del(obj);
+
+    // empty text and sections without names
+    obj = PadIni_Decode(gc, "", 0, 0, err, sizeof err);
+    assert(obj && PadObjDict_Len(obj->objdict) == 0);
+    PadObj_Del(obj);
+    obj = PadIni_Decode(gc, "[a]\n[b]", 7, 0, err, sizeof err);
+    assert(obj && PadObjDict_Len(obj->objdict) == 2);
+    PadObj_Del(obj);
+
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_ini_decode_fail(void) {
+    static const struct {
+        const char *src;
+        const char *err;
+    } cases[] = {
+        {"k = v", "name outside of section at line 1"},
+        {"[a]\nk", "expected '=' at line 2"},
+        {"[a]\n= v", "empty name at line 2"},
+        {"\n\n[a", "expected ']' at line 3"},
+        {"[]", "empty section name at line 1"},
+        {"[ \t]", "empty section name at line 1"},
+        {"[a] b", "extra data after section at line 1"},
+        {0},
+    };
+
+    PadGC *gc = PadGC_New();
+    char err[256];
+    for (int32_t i = 0; cases[i].src; i++) {
+        const char *src = cases[i].src;
+        assert(!PadIni_Decode(gc, src, strlen(src), 0, err, sizeof err));
+        assert(!strcmp(err, cases[i].err));
+    }
+
+    // name over size of key of dict
+    PadStr *s = PadStr_New();
+    PadStr_App(s, "[a]\n");
+    for (int32_t i = 0; i < PAD_OBJ_DICT__ITEM_KEY_SIZE; i++) {
+        PadStr_PushBack(s, 'k');
+    }
+    PadStr_App(s, " = v\n");
+    assert(!PadIni_Decode(gc, PadStr_Getc(s), PadStr_Len(s), 0, err, sizeof err));
+    assert(!strcmp(err, "name is too long at line 2"));
+    PadStr_Del(s);
+
+    assert(!PadIni_Decode(NULL, "", 0, 0, err, sizeof err));
+    assert(!PadIni_Decode(gc, NULL, 0, 0, err, sizeof err));
+
+    // invalid lines of names are skipped by flag but sections are checked
+    const char *src = "k = v\n[a]\nb\n = c\nd = e\n";
+    PadObj *obj = PadIni_Decode(gc, src, strlen(src), PAD_INI__SKIP_INVALID, err, sizeof err);
+    assert(obj && PadObjDict_Len(obj->objdict) == 1);
+    PadObjDictItem *sec = PadObjDict_Get(obj->objdict, "a");
+    assert(sec && PadObjDict_Len(sec->value->objdict) == 1);
+    PadObj_Del(obj);
+    assert(!PadIni_Decode(gc, "[a", 2, PAD_INI__SKIP_INVALID, err, sizeof err));
+    assert(!strcmp(err, "expected ']' at line 1"));
+
+    PadGC_Del(gc);
+}
+
+static void
+test_lang_ini_encode(void) {
+    PadGC *gc = PadGC_New();
+    PadStr *s = PadStr_New();
+    char err[256];
+
+    const char *src = "[s1]\nn1 = v1\nn2 = v 2\n\n[s2]\n\n[s3]\nn3 = \n\n";
+    PadObj *obj = PadIni_Decode(gc, src, strlen(src), 0, err, sizeof err);
+    assert(obj);
+    assert(PadIni_EncodeToStr(s, obj, err, sizeof err));
+    assert(!strcmp(PadStr_Getc(s), src));
+
+    // same output through sink
+    PadSink *sink = PadSink_NewStr();
+    assert(PadIni_EncodeToSink(sink, obj, err, sizeof err));
+    assert(!strcmp(PadSink_GetcStr(sink), src));
+    PadSink_Del(sink);
+
+    // values of other than string are written as text
+    PadObj *sec = PadObjDict_Get(obj->objdict, "s2")->value;
+    PadObjDict_Move(sec->objdict, "i", PadObj_NewInt(gc, -3));
+    PadObjDict_Move(sec->objdict, "f", PadObj_NewFloat(gc, 0.5));
+    PadObjDict_Move(sec->objdict, "b", PadObj_NewBool(gc, false));
+    PadObjDict_Move(sec->objdict, "n", PadObj_NewNil(gc));
+    PadStr_Clear(s);
+    assert(PadIni_EncodeToStr(s, sec, err, sizeof err) == NULL);
+    assert(!strcmp(err, "section \"i\" is not dict"));
+    assert(PadIni_EncodeToStr(s, obj, err, sizeof err));
+    assert(strstr(PadStr_Getc(s), "[s2]\ni = -3\nf = 0.5\nb = false\nn = nil\n\n"));
+
+    PadObj_Del(obj);
+
+    // invalid names and values
+    static const struct {
+        const char *section;
+        const char *name;
+        const char *value;
+        const char *err;
+    } cases[] = {
+        {"s", "bad=name", "v", "invalid name \"bad=name\" in section \"s\""},
+        {"s", "[name", "v", "invalid name \"[name\" in section \"s\""},
+        {"s", "k", "a\r\nb", "value of \"k\" in section \"s\" has newline"},
+        {"s]", "k", "v", "invalid section name \"s]\""},
+        {0},
+    };
+    for (int32_t i = 0; cases[i].section; i++) {
+        obj = PadObj_NewDict(gc, PadObjDict_New(gc));
+        sec = PadObj_NewDict(gc, PadObjDict_New(gc));
+        PadObjDict_Move(sec->objdict, cases[i].name, PadObj_NewUnicodeCStr(gc, cases[i].value));
+        PadObjDict_Move(obj->objdict, cases[i].section, sec);
+        assert(!PadIni_EncodeToStr(s, obj, err, sizeof err));
+        assert(!strcmp(err, cases[i].err));
+        PadObj_Del(obj);
+    }
+
+    assert(!PadIni_EncodeToStr(s, PadObj_NewInt(gc, 1), err, sizeof err));
+    assert(!strcmp(err, "data is not dict"));
+
+    PadStr_Del(s);
+    PadGC_Del(gc);
+}
+
+static const struct testcase
+ini_tests[] = {
+    {"decode", test_lang_ini_decode},
+    {"decode_fail", test_lang_ini_decode_fail},
+    {"encode", test_lang_ini_encode},
     {0},
 };
 
@@ -31795,6 +34257,13 @@ test_modules[] = {
     {"util", util_tests},
     {"path", path_tests},
     {"unicode_path", unicode_path_tests},
+    {"unicode_kernel", unicode_kernel_tests},
+    {"num_kernel", num_kernel_tests},
+    {"num_array", num_array_tests},
+    {"number", number_tests},
+    {"sink", sink_tests},
+    {"html", html_tests},
+    {"regex", regex_tests},
     {"dict", dict_tests},
     {"void_dict", void_dict_tests},
     {"void_array", void_array_tests},
@@ -31807,6 +34276,9 @@ test_modules[] = {
     {"error_stack", error_stack_tests},
     {"gc", gc_tests},
     {"objdict", objdict_tests},
+    {"objdeque", objdeque_tests},
+    {"json", json_tests},
+    {"ini", ini_tests},
     {0},
 };
 
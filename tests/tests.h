@@ -38,6 +38,11 @@
 #include <pad/lib/unicode.h>
 #include <pad/lib/path.h>
 #include <pad/lib/unicode_path.h>
+#include <pad/lib/unicode_kernel.h>
+#include <pad/lib/number.h>
+#include <pad/lib/sink.h>
+#include <pad/lib/html.h>
+#include <pad/lib/regex.h>
 #include <pad/core/util.h>
 #include <pad/core/config.h>
 #include <pad/core/alias_info.h>
@@ -49,10 +54,13 @@
 #include <pad/lang/ast.h>
 #include <pad/lang/compiler.h>
 #include <pad/lang/traverser.h>
+#include <pad/lang/operator.h>
 #include <pad/lang/object.h>
 #include <pad/lang/object_array.h>
 #include <pad/lang/object_dict.h>
 #include <pad/lang/opts.h>
 #include <pad/lang/gc.h>
+#include <pad/lang/json.h>
+#include <pad/lang/ini.h>
 #include <pad/lang/builtin/modules/alias.h>
 #include <pad/lang/builtin/modules/opts.h>